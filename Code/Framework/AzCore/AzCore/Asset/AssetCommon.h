@@ -263,6 +263,9 @@ namespace AZ
             {
             }
             AssetFilterCB m_assetLoadFilterCB{ nullptr };
+            // The deadline and priority for loading the asset and its dependencies. If not set, the defaults of the asset handler
+            // are used. Requesting an asset that's already loading with a shorter deadline or higher priority escalates its
+            // streaming request and the job that processes the streamed data, but never lowers them.
             AZStd::optional<AZ::IO::IStreamerTypes::Deadline> m_deadline{};
             AZStd::optional<IO::IStreamerTypes::Priority> m_priority{ };
             AssetDependencyLoadRules m_dependencyRules{ AssetDependencyLoadRules::Default };
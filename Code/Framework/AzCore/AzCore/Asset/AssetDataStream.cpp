@@ -124,6 +124,11 @@ namespace AZ::Data
         m_filePath = filePath;
         m_fileOffset = fileOffset;
 
+        // Track the deadline and priority even if the streamer gets skipped, so that the processing of the loaded data can be
+        // prioritized the same way.
+        m_curDeadline = deadline;
+        m_curPriority = priority;
+
         // If the asset load is requesting more than 0 bytes of data, queue it up with the file streamer.
         if (m_requestedAssetSize > 0)
         {
@@ -173,8 +178,6 @@ namespace AZ::Data
                 *m_bufferAllocator,
                 m_requestedAssetSize,
                 deadline, priority, m_fileOffset);
-            m_curDeadline = deadline;
-            m_curPriority = priority;
             streamer->SetRequestCompleteCallback(m_privateData->m_curReadRequest, streamerCallback);
 
             streamer->QueueRequest(m_privateData->m_curReadRequest);
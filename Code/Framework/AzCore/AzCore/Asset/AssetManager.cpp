@@ -48,9 +48,10 @@ namespace AZ::Data
         , public Job
     {
     public:
-        AssetDatabaseAsyncJob(JobContext* jobContext, bool deleteWhenDone, AssetManager* owner, const Asset<AssetData>& asset, AssetHandler* assetHandler)
+        AssetDatabaseAsyncJob(JobContext* jobContext, bool deleteWhenDone, AssetManager* owner, const Asset<AssetData>& asset, AssetHandler* assetHandler,
+            AZ::s8 priority = 0)
             : AssetDatabaseJob(owner, asset, assetHandler)
-            , Job(deleteWhenDone, jobContext)
+            , Job(deleteWhenDone, jobContext, false, priority)
         {
         }
 
@@ -107,6 +108,15 @@ namespace AZ::Data
 
     using BlockingAssetLoadBus = EBus<BlockingAssetLoadEvents>;
 
+    // Maps a streaming priority onto the job priority range, with medium streaming priority as the default job priority.
+    // Loads that were requested at a higher priority, or that were escalated while streaming because a higher priority asset
+    // depends on them, are then processed ahead of background loads that finished streaming around the same time.
+    static AZ::s8 GetLoadJobPriority(AZ::IO::IStreamerTypes::Priority streamingPriority)
+    {
+        const int priority = aznumeric_cast<int>(streamingPriority) - aznumeric_cast<int>(AZ::IO::IStreamerTypes::s_priorityMedium);
+        return aznumeric_cast<AZ::s8>(AZ::GetClamp(priority, -128, 127));
+    }
+
     /*
      * This class processes async AssetDatabase load jobs
      */
@@ -119,7 +129,8 @@ namespace AZ::Data
         LoadAssetJob(AssetManager* owner, const Asset<AssetData>& asset,
             AZStd::shared_ptr<AssetDataStream> dataStream, bool isReload, AZ::IO::IStreamerTypes::RequestStatus requestState,
             AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded)
-            : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, handler)
+            : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, handler,
+                GetLoadJobPriority(dataStream ? dataStream->GetStreamingPriority() : AZ::IO::IStreamerTypes::s_priorityMedium))
             , m_dataStream(dataStream)
             , m_isReload(isReload)
             , m_requestState(requestState)
@@ -546,8 +557,8 @@ namespace AZ::Data
     {
         PrepareShutDown();
 
-        // Acquire the asset lock to make sure nobody else is trying to do anything fancy with assets
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        // Acquire the asset locks to make sure nobody else is trying to do anything fancy with assets
+        LockAllAssetMapShards();
 
         while (!m_handlers.empty())
         {
@@ -558,6 +569,8 @@ namespace AZ::Data
         }
 
         AssetManagerBus::Handler::BusDisconnect();
+
+        UnlockAllAssetMapShards();
     }
 
     //=========================================================================
@@ -677,10 +690,11 @@ namespace AZ::Data
                     // (~1 per 5000 runs) trigger the error case if we didn't wait for the jobs to finish here.
                     WaitForActiveJobsAndStreamerRequestsToFinish();
 
+                    for (AssetMapShard& shard : m_assetMapShards)
                     {
                         // this scope is used to control the scope of the lock.
-                        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                        for (const auto &assetEntry : m_assets)
+                        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                        for (const auto &assetEntry : shard.m_assets)
                         {
                             // is the handler that handles this type, this handler we're removing?
                             if (assetEntry.second->m_registeredHandler == handler)
@@ -772,19 +786,23 @@ namespace AZ::Data
             return;
         }
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        LockAllAssetMapShards();
+
         // First, release any containers that were loading this asset
-        for (auto asset = m_assets.begin();asset != m_assets.end();)
+        for (AssetMapShard& shard : m_assetMapShards)
         {
-            if (asset->second->m_useCount == 0)
-            {
-                auto releaseAsset = asset->second;
-                ++asset;
-                ReleaseAssetContainersForAsset(releaseAsset);
-            }
-            else
+            for (auto asset = shard.m_assets.begin(); asset != shard.m_assets.end();)
             {
-                ++asset;
+                if (asset->second->m_useCount == 0)
+                {
+                    auto releaseAsset = asset->second;
+                    ++asset;
+                    ReleaseAssetContainersForAsset(releaseAsset);
+                }
+                else
+                {
+                    ++asset;
+                }
             }
         }
 
@@ -792,13 +810,16 @@ namespace AZ::Data
 
         AZStd::vector<AssetData*> assetsToRelease;
 
-        for(auto&& asset : m_assets)
+        for (AssetMapShard& shard : m_assetMapShards)
         {
-            if(asset.second->m_weakUseCount == 0)
+            for (auto&& asset : shard.m_assets)
             {
-                // Keep a separate list of assets to release, because releasing them will modify the m_assets list that we're
-                // currently looping on.
-                assetsToRelease.push_back(asset.second);
+                if (asset.second->m_weakUseCount == 0)
+                {
+                    // Keep a separate list of assets to release, because releasing them will modify the asset map that we're
+                    // currently looping on.
+                    assetsToRelease.push_back(asset.second);
+                }
             }
         }
 
@@ -810,6 +831,8 @@ namespace AZ::Data
 
             ReleaseAsset(asset, asset->GetId(), asset->GetType(), removeFromHash, asset->m_creationToken);
         }
+
+        UnlockAllAssetMapShards();
     }
 
     AssetData::AssetStatus AssetManager::BlockUntilLoadComplete(const Asset<AssetData>& asset)
@@ -838,10 +861,15 @@ namespace AZ::Data
     // FindAsset
     //=========================================================================
     Asset<AssetData> AssetManager::FindAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior)
+    {
+        return FindRegisteredAsset(GetCanonicalAssetId(assetId), assetReferenceLoadBehavior);
+    }
+
+    AssetId AssetManager::GetCanonicalAssetId(const AssetId& assetId) const
     {
         // Look up the asset id in the catalog, and use the result of that instead.
         // If assetId is a legacy id, assetInfo.m_assetId will be the canonical id. Otherwise, assetInfo.m_assetID == assetId.
-        // This is because only canonical ids are stored in m_assets (see below).
+        // This is because only canonical ids are stored in the asset map.
         // Only do the look up if upgrading is enabled
         AZ::Data::AssetInfo assetInfo;
         if (GetAssetInfoUpgradingEnabled())
@@ -850,18 +878,56 @@ namespace AZ::Data
         }
 
         // If the catalog is not available, use the original assetId
-        const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
+        return assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId;
+    }
+
+    Asset<AssetData> AssetManager::FindRegisteredAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior)
+    {
+        AssetMapShard& shard = GetAssetMapShard(assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        AssetMap::iterator it = m_assets.find(assetToFind);
-        if (it != m_assets.end())
+        // Only the shared lock is needed. The asset can't be removed from the map while it's held, and ReleaseAsset will see the
+        // reference acquired here and keep the asset alive.
+        AssetData* assetData = nullptr;
         {
-            Asset<AssetData> asset(assetReferenceLoadBehavior);
-            asset.SetData(it->second);
+            AZStd::shared_lock<AZStd::shared_mutex> mapLock(shard.m_mapMutex);
+            AssetMap::iterator it = shard.m_assets.find(assetId);
+            if (it != shard.m_assets.end())
+            {
+                assetData = it->second;
+                assetData->Acquire();
+            }
+        }
 
-            return asset;
+        Asset<AssetData> asset(assetReferenceLoadBehavior);
+        if (assetData)
+        {
+            // Setting the data can query the catalog, so it's done outside of the lock. The temporary reference is released
+            // afterwards and can't be the last one.
+            asset.SetData(assetData);
+            assetData->Release();
+        }
+        return asset;
+    }
+
+    AssetManager::AssetMapShard& AssetManager::GetAssetMapShard(const AssetId& assetId)
+    {
+        return m_assetMapShards[AZStd::hash<AssetId>{}(assetId) % AssetMapShardCount];
+    }
+
+    void AssetManager::LockAllAssetMapShards()
+    {
+        for (AssetMapShard& shard : m_assetMapShards)
+        {
+            shard.m_mutex.lock();
+        }
+    }
+
+    void AssetManager::UnlockAllAssetMapShards()
+    {
+        for (auto shard = m_assetMapShards.rbegin(); shard != m_assetMapShards.rend(); ++shard)
+        {
+            shard->m_mutex.unlock();
         }
-        return Asset<AssetData>(assetReferenceLoadBehavior);
     }
 
     AZStd::pair<AZ::IO::IStreamerTypes::Deadline, AZ::IO::IStreamerTypes::Priority> GetEffectiveDeadlineAndPriority(
@@ -988,17 +1054,18 @@ namespace AZ::Data
         AssetData* assetData = nullptr;
         Asset<AssetData> asset; // Used to hold a reference while job is dispatched and while outside of the assetMutex lock.
 
-        // Control the scope of the assetMutex lock
+        // Control the scope of the asset shard lock
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetMapShard& shard = GetAssetMapShard(assetInfo.m_assetId);
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
             bool isNewEntry = false;
 
             // check if asset already exists
             {
                 AZ_PROFILE_SCOPE(AzCore, "GetAsset: FindAsset");
 
-                AssetMap::iterator it = m_assets.find(assetInfo.m_assetId);
-                if (it != m_assets.end())
+                AssetMap::iterator it = shard.m_assets.find(assetInfo.m_assetId);
+                if (it != shard.m_assets.end())
                 {
                     assetData = it->second;
                     asset.SetData(assetData);
@@ -1047,7 +1114,8 @@ namespace AZ::Data
                 if (isNewEntry && assetData->IsRegisterReadonlyAndShareable())
                 {
                     AZ_PROFILE_SCOPE(AzCore, "GetAsset: RegisterAsset");
-                    m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
+                    AZStd::scoped_lock<AZStd::shared_mutex> mapLock(shard.m_mapMutex);
+                    shard.m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
                 }
                 if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
                 {
@@ -1080,7 +1148,7 @@ namespace AZ::Data
 
         asset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
 
-        // We delay queueing the async file I/O until we release m_assetMutex
+        // We delay queueing the async file I/O until we release the asset shard lock
         if (dataStream)
         {
             AZ_Assert(loadInfo.IsValid(), "Expected valid stream info when dataStream is valid.");
@@ -1131,13 +1199,16 @@ namespace AZ::Data
 
     Asset<AssetData> AssetManager::FindOrCreateAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        // The asset is stored under its canonical id, so that's the shard that needs to be locked for the find and the create to be
+        // atomic, and the id it has to be created with to be found by later lookups through a legacy id.
+        const AssetId canonicalAssetId = GetCanonicalAssetId(assetId);
+        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(GetAssetMapShard(canonicalAssetId).m_mutex);
 
-        Asset<AssetData> asset = FindAsset(assetId, assetReferenceLoadBehavior);
+        Asset<AssetData> asset = FindRegisteredAsset(canonicalAssetId, assetReferenceLoadBehavior);
 
         if (!asset)
         {
-            asset = CreateAsset(assetId, assetType, assetReferenceLoadBehavior);
+            asset = CreateAsset(canonicalAssetId, assetType, assetReferenceLoadBehavior);
         }
 
         return asset;
@@ -1149,11 +1220,12 @@ namespace AZ::Data
     //=========================================================================
     Asset<AssetData> AssetManager::CreateAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        AssetMapShard& shard = GetAssetMapShard(assetId);
+        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(shard.m_mutex);
 
         // check if asset already exist
-        AssetMap::iterator it = m_assets.find(assetId);
-        if (it == m_assets.end())
+        AssetMap::iterator it = shard.m_assets.find(assetId);
+        if (it == shard.m_assets.end())
         {
             // find the asset type handler
             AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
@@ -1171,7 +1243,8 @@ namespace AZ::Data
                     assetData->RegisterWithHandler(handler);
                     if (assetData->IsRegisterReadonlyAndShareable())
                     {
-                        m_assets.insert(AZStd::make_pair(assetId, assetData));
+                        AZStd::scoped_lock<AZStd::shared_mutex> mapLock(shard.m_mapMutex);
+                        shard.m_assets.insert(AZStd::make_pair(assetId, assetData));
                     }
 
                     Asset<AssetData> asset(assetReferenceLoadBehavior);
@@ -1205,8 +1278,11 @@ namespace AZ::Data
 
         if (removeAssetFromHash)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-            AssetMap::iterator it = m_assets.find(assetId);
+            AssetMapShard& shard = GetAssetMapShard(assetId);
+            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(shard.m_mutex);
+            // The exclusive map lock keeps FindRegisteredAsset from acquiring a new reference while the count is checked.
+            AZStd::scoped_lock<AZStd::shared_mutex> mapLock(shard.m_mapMutex);
+            AssetMap::iterator it = shard.m_assets.find(assetId);
             // need to check the count again in here in case
            // someone was trying to get the asset on another thread
            // Set it to -1 so only this thread will attempt to clean up the cache and delete the asset
@@ -1214,10 +1290,10 @@ namespace AZ::Data
             // if the assetId is not in the map or if the identifierId
             // do not match it implies that the asset has been already destroyed.
             // if the usecount is non zero it implies that we cannot destroy this asset.
-            if (it != m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
+            if (it != shard.m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
             {
                 wasInAssetsHash = true;
-                m_assets.erase(it);
+                shard.m_assets.erase(it);
                 destroyAsset = true;
             }
         }
@@ -1325,19 +1401,29 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::ReloadAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior, bool isAutoReload)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        auto assetIter = m_assets.find(assetId);
+        AssetMapShard& shard = GetAssetMapShard(assetId);
+        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+        auto assetIter = shard.m_assets.find(assetId);
 
-        if (assetIter == m_assets.end() || assetIter->second->IsLoading())
+        if (assetIter == shard.m_assets.end() || assetIter->second->IsLoading())
         {
             // Only existing assets can be reloaded.
             return;
         }
 
-        auto reloadIter = m_reloads.find(assetId);
-        if (reloadIter != m_reloads.end())
+        Asset<AssetData> pendingReload;
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> reloadLock(m_reloadMutex);
+            auto reloadIter = m_reloads.find(assetId);
+            if (reloadIter != m_reloads.end())
+            {
+                pendingReload = reloadIter->second;
+            }
+        }
+
+        if (pendingReload)
         {
-            auto curStatus = reloadIter->second.GetData()->GetStatus();
+            auto curStatus = pendingReload.GetData()->GetStatus();
             // We don't need another reload if we're in "Queued" state because that reload has not actually begun yet.
             // If it is in Loading state we want to pass by and allow the new assetData to be created and start the new reload
             // As the current load could already be stale
@@ -1348,7 +1434,7 @@ namespace AZ::Data
             else if (curStatus == AssetData::AssetStatus::Loading || curStatus == AssetData::AssetStatus::StreamReady)
             {
                 // Don't flood the tick bus - this value will be checked when the asset load completes
-                reloadIter->second->SetRequeue(true);
+                pendingReload->SetRequeue(true);
                 return;
             }
         }
@@ -1406,7 +1492,10 @@ namespace AZ::Data
             newAssetData->m_status = AssetData::AssetStatus::Queued;
             Asset<AssetData> newAsset(newAssetData, assetReferenceLoadBehavior);
 
-            m_reloads[newAsset.GetId()] = newAsset;
+            {
+                AZStd::scoped_lock<AZStd::recursive_mutex> reloadLock(m_reloadMutex);
+                m_reloads[newAsset.GetId()] = newAsset;
+            }
 
             UpdateDebugStatus(newAsset);
 
@@ -1457,17 +1546,18 @@ namespace AZ::Data
 
         {
             AZ_Assert(asset.Get(), "Asset data for reload is missing.");
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetMapShard& shard = GetAssetMapShard(asset.GetId());
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
             AZ_Assert(
-                m_assets.find(asset.GetId()) != m_assets.end(),
+                shard.m_assets.find(asset.GetId()) != shard.m_assets.end(),
                 "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
             AZ_Assert(
-                m_assets.find(asset.GetId()) == m_assets.end() ||
-                    asset->RTTI_GetType() == m_assets.find(asset.GetId())->second->RTTI_GetType(),
+                shard.m_assets.find(asset.GetId()) == shard.m_assets.end() ||
+                    asset->RTTI_GetType() == shard.m_assets.find(asset.GetId())->second->RTTI_GetType(),
                 "New and old data types are mismatched!");
 
-            auto found = m_assets.find(asset.GetId());
-            if ((found == m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
+            auto found = shard.m_assets.find(asset.GetId());
+            if ((found == shard.m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
             {
                 return; // this will just lead to crashes down the line and the above asserts cover this.
             }
@@ -1491,7 +1581,7 @@ namespace AZ::Data
             }
         }
 
-        // We specifically perform this outside of the m_assetMutex lock so that the lock isn't held at the point that
+        // We specifically perform this outside of the asset shard lock so that the lock isn't held at the point that
         // OnAssetReload is triggered inside of AssignAssetData.  Otherwise, we open up a high potential for deadlocks.
         if (shouldAssignAssetData)
         {
@@ -1528,9 +1618,10 @@ namespace AZ::Data
         {
             bool requeue{ false };
             {
-                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                auto found = m_assets.find(assetId);
-                AZ_Assert(found == m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
+                AssetMapShard& shard = GetAssetMapShard(assetId);
+                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                auto found = shard.m_assets.find(assetId);
+                AZ_Assert(found == shard.m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
                     "New and old data types are mismatched!");
 
                 // if we are here it implies that we have two assets with the same asset id, and we are
@@ -1539,16 +1630,20 @@ namespace AZ::Data
                 // because of creation token mismatch when it's ref count finally goes to zero. Since the old asset is not shareable anymore
                 // manually setting the creationToken to default creation token will ensure that the asset is destroyed correctly.
                 asset.m_assetData->m_creationToken = ++m_creationTokenGenerator;
-                if (found != m_assets.end())
+                if (found != shard.m_assets.end())
                 {
                     found->second->m_creationToken = AZ::Data::s_defaultCreationToken;
                 }
 
                 // Held references to old data are retained, but replace the entry in the DB for future requests.
                 // Fire an OnAssetReloaded message so listeners can react to the new data.
-                m_assets[assetId] = asset.Get();
+                {
+                    AZStd::scoped_lock<AZStd::shared_mutex> mapLock(shard.m_mapMutex);
+                    shard.m_assets[assetId] = asset.Get();
+                }
 
                 // Release the reload reference.
+                AZStd::scoped_lock<AZStd::recursive_mutex> reloadLock(m_reloadMutex);
                 auto reloadInfo = m_reloads.find(assetId);
                 if (reloadInfo != m_reloads.end())
                 {
@@ -1619,8 +1714,8 @@ namespace AZ::Data
                 AZ_PROFILE_SCOPE(AzCore, "AZ::Data::LoadAssetStreamerCallback %s",
                     loadingAsset.GetHint().c_str());
                 {
-                    AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
                     AssetData* data = loadingAsset.Get();
+                    AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(GetAssetMapShard(data->GetId()).m_mutex);
                     if (data->GetStatus() != AssetData::AssetStatus::Queued)
                     {
                         AZ_Warning("AssetManager", false, "Asset %s no longer in Queued state, abandoning load", loadingAsset.GetId().ToString<AZStd::string>().c_str());
@@ -1726,7 +1821,8 @@ namespace AZ::Data
     {
         // Failed reloads have no side effects. Just notify observers (error reporting, etc).
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(GetAssetMapShard(asset.GetId()).m_mutex);
+            AZStd::lock_guard<AZStd::recursive_mutex> reloadLock(m_reloadMutex);
             m_reloads.erase(asset.GetId());
         }
         AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetReloadError, asset);
@@ -1768,23 +1864,21 @@ namespace AZ::Data
     bool AssetManager::ValidateAndRegisterAssetLoading(const Asset<AssetData>& asset)
     {
         AssetData* data = asset.Get();
+        if (data)
         {
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(GetAssetMapShard(data->GetId()).m_mutex);
 
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            if (data)
+            // The purpose of this function is to validate this asset is still in a StreamReady
+            // and only then continue the load.  We change status to loading if everything
+            // is expected which the blocking RegisterAssetLoading call does not do because it
+            // is already in loading status
+            if (data->GetStatus() != AssetData::AssetStatus::StreamReady)
             {
-                // The purpose of this function is to validate this asset is still in a StreamReady
-                // and only then continue the load.  We change status to loading if everything
-                // is expected which the blocking RegisterAssetLoading call does not do because it
-                // is already in loading status
-                if (data->GetStatus() != AssetData::AssetStatus::StreamReady)
-                {
-                    // Something else has attempted to load this asset
-                    return false;
-                }
-                data->m_status = AssetData::AssetStatus::Loading;
-                UpdateDebugStatus(asset);
+                // Something else has attempted to load this asset
+                return false;
             }
+            data->m_status = AssetData::AssetStatus::Loading;
+            UpdateDebugStatus(asset);
         }
 
         return true;
@@ -2112,7 +2206,7 @@ namespace AZ::Data
     {
         {
             // We may need to revalidate that this asset hasn't already passed through postLoad
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(GetAssetMapShard(asset->GetId()).m_mutex);
             if (asset->IsReady() || asset->m_status == AssetData::AssetStatus::LoadedPreReady)
             {
                 return;
@@ -14,7 +14,9 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_map.h>
@@ -340,6 +342,30 @@ namespace AZ
             void ReleaseAsset(AssetData* asset, AssetId assetId, AssetType assetType, bool removeAssetFromHash, int creationToken);
             void OnAssetUnused(AssetData* asset);
 
+            //! The asset map is split into shards by AssetId, so threads working with different assets rarely wait on each other.
+            struct AssetMapShard
+            {
+                AssetMap m_assets;
+                //! Lock when accessing the asset map of this shard or when changing the load status of one of its assets.
+                AZStd::recursive_mutex m_mutex;
+                //! Locked exclusively, while also holding m_mutex, whenever m_assets is changed. Lookups that only need to acquire a
+                //! reference to an existing asset lock this shared instead of locking m_mutex, so they don't wait on each other
+                //! or on loads of other assets in the shard.
+                AZStd::shared_mutex m_mapMutex;
+            };
+            static constexpr size_t AssetMapShardCount = 32;
+
+            AssetMapShard& GetAssetMapShard(const AssetId& assetId);
+            //! Locks the m_mutex of all shards in order, for operations that need to look at every asset.
+            void LockAllAssetMapShards();
+            void UnlockAllAssetMapShards();
+
+            //! Returns the canonical id that the asset is registered under in the asset map, which differs from assetId if it's a
+            //! legacy id and upgrading is enabled.
+            AssetId GetCanonicalAssetId(const AssetId& assetId) const;
+            //! Returns a reference to the asset registered under assetId, or a null asset if there's none.
+            Asset<AssetData> FindRegisteredAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior);
+
             void AddJob(AssetDatabaseJob* job);
             void RemoveJob(AssetDatabaseJob* job);
             void AddActiveStreamerRequest(AssetId assetId, AZStd::shared_ptr<AssetDataStream> readRequest);
@@ -403,8 +429,7 @@ namespace AZ
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
             AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
-            AssetMap                m_assets;
-            AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            AZStd::array<AssetMapShard, AssetMapShardCount> m_assetMapShards;
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
@@ -414,10 +439,11 @@ namespace AZ
             AZStd::thread::id m_mainThreadId;
             IDebugAssetEvent* m_debugAssetEvents{ nullptr };
 
-            int m_creationTokenGenerator = 0; // this is used to generate unique identifiers for assets
+            AZStd::atomic_int m_creationTokenGenerator{ 0 }; // this is used to generate unique identifiers for assets
 
             typedef AZStd::unordered_map<AssetId, Asset<AssetData> > ReloadMap;
             ReloadMap               m_reloads;          // book-keeping and reference-holding for asset reloads
+            AZStd::recursive_mutex  m_reloadMutex;      // lock when accessing the reload map, after the shard lock of the asset if both are needed
 
             typedef AZStd::intrusive_list<AssetDatabaseJob, AZStd::list_base_hook<AssetDatabaseJob> > ActiveJobList;
             ActiveJobList           m_activeJobs;
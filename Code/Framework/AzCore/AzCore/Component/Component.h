@@ -22,6 +22,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // Used as the allocator for most components.
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_set.h>
 
 namespace AZ
@@ -252,6 +253,7 @@ namespace AZ
     friend class AZ::HasComponentDependentServices<_ComponentClass>;                                                                    \
     friend class AZ::HasComponentRequiredServices<_ComponentClass>;                                                                     \
     friend class AZ::HasComponentIncompatibleServices<_ComponentClass>;                                                                 \
+    friend class AZ::HasComponentActivateBatch<_ComponentClass>;                                                                        \
     static AZ::ComponentDescriptor* CreateDescriptor()                                                                                  \
     {                                                                                                                                   \
             AZ::ComponentDescriptor* descriptor = nullptr;                                                                              \
@@ -403,6 +405,19 @@ namespace AZ
          */
         virtual void GetWarnings([[maybe_unused]] StringWarningArray& warnings, [[maybe_unused]] const Component* instance) const { }
 
+        /**
+         * Specifies whether components of this type can be activated together through ActivateBatch.
+         * Entity::ActivateEntities uses this when it activates several entities with the same component types.
+         */
+        virtual bool SupportsBatchActivation() const { return false; }
+
+        /**
+         * Activates a batch of components of this type, which belong to different entities.
+         * This is only called if SupportsBatchActivation returns true, and it must activate every component in the batch.
+         * @param components The components to activate, in the order of their entities.
+         */
+        virtual void ActivateBatch(AZStd::span<Component* const> components) const { (void)components; }
+
         /**
          * Gets the current descriptor.
          * @param instance The current descriptor.
@@ -496,6 +511,7 @@ namespace AZ
     AZ_HAS_STATIC_MEMBER(ComponentDependentServices, GetDependentServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentRequiredServices, GetRequiredServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentIncompatibleServices, GetIncompatibleServices, void, (ComponentDescriptor::DependencyArrayType &));
+    AZ_HAS_STATIC_MEMBER(ComponentActivateBatch, ActivateBatch, void, (AZStd::span<Component* const>));
     /// @endcond
 
     /**
@@ -568,6 +584,23 @@ namespace AZ
             CallIncompatibleServices(incompatible, typename HasComponentIncompatibleServices<ComponentClass>::type());
         }
 
+        /**
+         * Returns true if the user provided the static function ActivateBatch(AZStd::span<Component* const>).
+         */
+        bool SupportsBatchActivation() const override
+        {
+            return HasComponentActivateBatch<ComponentClass>::value;
+        }
+
+        /**
+         * Calls the static function ActivateBatch, if the user provided it.
+         * @param components The components to activate.
+         */
+        void ActivateBatch(AZStd::span<Component* const> components) const override
+        {
+            CallActivateBatch(components, typename HasComponentActivateBatch<ComponentClass>::type());
+        }
+
     private:
 
         void CallReflect(ReflectContext* reflection, const AZStd::true_type&) const
@@ -614,5 +647,14 @@ namespace AZ
         void CallIncompatibleServices(ComponentDescriptor::DependencyArrayType&, const AZStd::false_type&) const
         {
         }
+
+        void CallActivateBatch(AZStd::span<Component* const> components, const AZStd::true_type&) const
+        {
+            ComponentClass::ActivateBatch(components);
+        }
+
+        void CallActivateBatch(AZStd::span<Component* const>, const AZStd::false_type&) const
+        {
+        }
     };
 }
@@ -618,6 +618,10 @@ namespace AZ
 
         MergeSettingsToRegistry(*m_settingsRegistry);
 
+#if !defined(_RELEASE)
+        m_budgetTracker.ApplySettings(*m_settingsRegistry);
+#endif
+
         m_systemEntity = AZStd::make_unique<AZ::Entity>(SystemEntityId, "SystemEntity");
         CreateCommon();
         AZ_Assert(m_systemEntity, "SystemEntity failed to initialize!");
@@ -1346,6 +1350,10 @@ namespace AZ
         }
 
         m_timeSystem->ApplyTickRateLimiterIfNeeded();
+
+#if !defined(_RELEASE)
+        m_budgetTracker.EndFrame();
+#endif
     }
 
     void ComponentApplication::TickSystem()
@@ -156,6 +156,145 @@ namespace AZ
     }
 
     void Entity::Init()
+    {
+        BeginInit();
+
+        for (Component* component : m_components)
+        {
+            component->Init();
+        }
+
+        EndInit();
+    }
+
+    void Entity::Activate()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (!BeginActivate())
+        {
+            return;
+        }
+
+        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
+        {
+            ActivateComponent(**it);
+        }
+
+        EndActivate();
+    }
+
+    void Entity::InitEntities(AZStd::span<Entity* const> entities, const BatchProgressCallback& progressCallback)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        AZStd::vector<Entity*> batchedEntities;
+        batchedEntities.reserve(entities.size());
+        for (Entity* entity : entities)
+        {
+            if (entity->RTTI_GetType() != azrtti_typeid<Entity>())
+            {
+                entity->Init();
+                if (progressCallback)
+                {
+                    progressCallback();
+                }
+            }
+            else
+            {
+                entity->BeginInit();
+                batchedEntities.push_back(entity);
+            }
+        }
+
+        for (const AZStd::vector<Entity*>& group : GroupByComponentTypes(batchedEntities))
+        {
+            const size_t componentCount = group.front()->m_components.size();
+            for (size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+            {
+                for (Entity* entity : group)
+                {
+                    entity->m_components[componentIndex]->Init();
+                }
+            }
+
+            for (Entity* entity : group)
+            {
+                entity->EndInit();
+            }
+
+            if (progressCallback)
+            {
+                progressCallback();
+            }
+        }
+    }
+
+    void Entity::ActivateEntities(AZStd::span<Entity* const> entities, const BatchProgressCallback& progressCallback)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        AZStd::vector<Entity*> batchedEntities;
+        batchedEntities.reserve(entities.size());
+        for (Entity* entity : entities)
+        {
+            if (entity->RTTI_GetType() != azrtti_typeid<Entity>())
+            {
+                entity->Activate();
+                if (progressCallback)
+                {
+                    progressCallback();
+                }
+            }
+            else if (entity->BeginActivate())
+            {
+                batchedEntities.push_back(entity);
+            }
+        }
+
+        ComponentArrayType batchComponents;
+        for (const AZStd::vector<Entity*>& group : GroupByComponentTypes(batchedEntities))
+        {
+            const size_t componentCount = group.front()->m_components.size();
+            for (size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+            {
+                ComponentDescriptor* componentDescriptor = nullptr;
+                if (group.size() > 1)
+                {
+                    EBUS_EVENT_ID_RESULT(componentDescriptor, group.front()->m_components[componentIndex]->RTTI_GetType(), ComponentDescriptorBus, GetDescriptor);
+                }
+
+                if (componentDescriptor && componentDescriptor->SupportsBatchActivation())
+                {
+                    batchComponents.clear();
+                    for (Entity* entity : group)
+                    {
+                        batchComponents.push_back(entity->m_components[componentIndex]);
+                    }
+                    componentDescriptor->ActivateBatch(batchComponents);
+                }
+                else
+                {
+                    for (Entity* entity : group)
+                    {
+                        ActivateComponent(*entity->m_components[componentIndex]);
+                    }
+                }
+            }
+
+            for (Entity* entity : group)
+            {
+                entity->EndActivate();
+            }
+
+            if (progressCallback)
+            {
+                progressCallback();
+            }
+        }
+    }
+
+    void Entity::BeginInit()
     {
         AZ_Assert(m_state == State::Constructed, "Component should be in Constructed state to be Initialized!");
         SetState(State::Initializing);
@@ -172,7 +311,6 @@ namespace AZ
             if (component)
             {
                 component->SetEntity(this);
-                component->Init();
                 ++it;
             }
             else
@@ -180,33 +318,33 @@ namespace AZ
                 it = m_components.erase(it);
             }
         }
+    }
 
+    void Entity::EndInit()
+    {
         SetState(State::Init);
 
         EBUS_EVENT_ID(m_id, EntityBus, OnEntityExists, m_id);
         EBUS_EVENT(EntitySystemBus, OnEntityInitialized, m_id);
     }
 
-    void Entity::Activate()
+    bool Entity::BeginActivate()
     {
-        AZ_PROFILE_FUNCTION(AzCore);
-
         AZ_Assert(m_state == State::Init, "Entity should be in Init state to be Activated!");
 
         const DependencySortOutcome sortOutcome = EvaluateDependenciesGetDetails();
         if (!sortOutcome.IsSuccess())
         {
             AZ_Error("Entity", false, "Entity '%s' %s cannot be activated. %s", m_name.c_str(), m_id.ToString().c_str(), sortOutcome.GetError().m_message.c_str());
-            return;
+            return false;
         }
 
         SetState(State::Activating);
+        return true;
+    }
 
-        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
-        {
-            ActivateComponent(**it);
-        }
-
+    void Entity::EndActivate()
+    {
         SetState(State::Active);
 
         EBUS_EVENT_ID(m_id, EntityBus, OnEntityActivated, m_id);
@@ -218,6 +356,54 @@ namespace AZ
         }
     }
 
+    AZStd::vector<AZStd::vector<Entity*>> Entity::GroupByComponentTypes(AZStd::span<Entity* const> entities)
+    {
+        AZStd::vector<AZStd::vector<Entity*>> groups;
+        // Maps the hash of a list of component types to the groups with that hash.
+        AZStd::unordered_map<size_t, AZStd::vector<size_t>> groupsByHash;
+
+        auto hasSameComponentTypes = [](const ComponentArrayType& lhs, const ComponentArrayType& rhs)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < lhs.size(); ++i)
+            {
+                if (lhs[i]->RTTI_GetType() != rhs[i]->RTTI_GetType())
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        for (Entity* entity : entities)
+        {
+            size_t hash = entity->m_components.size();
+            for (const Component* component : entity->m_components)
+            {
+                AZStd::hash_combine(hash, component->RTTI_GetType());
+            }
+
+            AZStd::vector<size_t>& candidates = groupsByHash[hash];
+            auto groupIt = AZStd::find_if(candidates.begin(), candidates.end(), [&](size_t groupIndex)
+                {
+                    return hasSameComponentTypes(groups[groupIndex].front()->m_components, entity->m_components);
+                });
+            if (groupIt != candidates.end())
+            {
+                groups[*groupIt].push_back(entity);
+            }
+            else
+            {
+                candidates.push_back(groups.size());
+                groups.emplace_back().push_back(entity);
+            }
+        }
+        return groups;
+    }
+
     void Entity::Deactivate()
     {
         AZ_PROFILE_FUNCTION(AzCore);
@@ -19,6 +19,8 @@
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/EBus/Event.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/function/function_template.h>
 #include <AzCore/std/string/string.h>
 
 namespace AZ
@@ -173,6 +175,27 @@ namespace AZ
         //! entity. This function calls the Deactivate function of each component.
         virtual void Deactivate();
 
+        //! Called by InitEntities and ActivateEntities after each group of entities, so long batches can interleave other work.
+        using BatchProgressCallback = AZStd::function<void()>;
+
+        //! Initializes a batch of entities and their components.
+        //! This has the same result as calling Init on each entity, except that entities with the same component types are
+        //! initialized together, one component type at a time, instead of one entity at a time.
+        //! @param entities The entities to initialize. All of them must be in the State::Constructed state.
+        //! @param progressCallback Optional callback that is called after each group of entities is initialized.
+        static void InitEntities(AZStd::span<Entity* const> entities, const BatchProgressCallback& progressCallback = {});
+
+        //! Activates a batch of entities and their components.
+        //! Entities are grouped by the types of their sorted components, and each group is activated one component type at a
+        //! time: the first component of every entity in the group is activated, then the second one, and so on. Components of
+        //! a type whose descriptor supports batch activation are activated through ComponentDescriptor::ActivateBatch.
+        //! The components of each entity are still activated in dependency order, but the components of other entities in
+        //! the same group may become active in between. Entities are signaled as activated once their whole group is active.
+        //! Entities of a class derived from Entity are activated one by one through Activate.
+        //! @param entities The entities to activate. All of them must be in the State::Init state.
+        //! @param progressCallback Optional callback that is called after each group of entities is activated.
+        static void ActivateEntities(AZStd::span<Entity* const> entities, const BatchProgressCallback& progressCallback = {});
+
         //! Creates a component and attaches the component to the entity. 
         //! You cannot add a component to an entity when the entity is 
         //! active or in a transition state. After the component is attached 
@@ -395,6 +418,15 @@ namespace AZ
         //! @return True if the entity is in a state in which that components can be added or removed, otherwise false.
         bool CanAddRemoveComponents() const;
 
+        //! Steps of Init and Activate that are shared with InitEntities and ActivateEntities.
+        void BeginInit();
+        void EndInit();
+        bool BeginActivate();
+        void EndActivate();
+
+        //! Splits entities into groups that have the same component types in the same order.
+        static AZStd::vector<AZStd::vector<Entity*>> GroupByComponentTypes(AZStd::span<Entity* const> entities);
+
         // Helpers for child classes
         static void ActivateComponent(Component& component) { component.Activate(); }
         static void DeactivateComponent(Component& component) { component.Deactivate(); }
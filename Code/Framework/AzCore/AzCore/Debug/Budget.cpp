@@ -8,10 +8,15 @@
 
 #include "Budget.h"
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Module/Environment.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Statistics/StatisticalProfilerProxy.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/time.h>
 
 AZ_DEFINE_BUDGET(Animation);
 AZ_DEFINE_BUDGET(Audio);
@@ -27,9 +32,42 @@ namespace AZ::Debug
     struct BudgetImpl
     {
         AZ_CLASS_ALLOCATOR(BudgetImpl, AZ::SystemAllocator, 0);
-        // TODO: Budget implementation for tracking budget wall time per-core, memory, etc.
+
+        AZStd::atomic<AZStd::sys_time_t> m_frameTicks{ 0 };
+        AZStd::atomic<uint64_t> m_frameTimeLimitUs{ 0 };
+        AZStd::atomic_bool m_accountingEnabled{ false };
+        // Incremented every time accounting is enabled, to recognize regions that were still open when it was last disabled.
+        AZStd::atomic<uint32_t> m_accountingGeneration{ 0 };
+        // TODO: Budget implementation for tracking memory, etc.
     };
 
+    namespace
+    {
+        struct OpenRegion
+        {
+            const BudgetImpl* m_budget;
+            uint32_t m_generation;
+            AZStd::sys_time_t m_startTicks;
+        };
+
+        // Profile regions that are open on this thread for budgets with accounting enabled. Only the time of the outermost region of
+        // each budget is accumulated to avoid counting nested regions twice.
+        constexpr size_t MaxOpenRegions = 128;
+        thread_local AZStd::fixed_vector<OpenRegion, MaxOpenRegions> t_openRegions;
+
+        bool IsRegionOpen(const BudgetImpl* budget, uint32_t generation)
+        {
+            for (const OpenRegion& region : t_openRegions)
+            {
+                if (region.m_budget == budget && region.m_generation == generation)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace
+
     Budget::Budget(const char* name)
         : Budget( name, Crc32(name) )
     {
@@ -54,18 +92,66 @@ namespace AZ::Debug
         }
     }
 
-    // TODO:Budgets Methods below are stubbed pending future work to both update budget data and visualize it
-
-    void Budget::PerFrameReset()
+    uint64_t Budget::PerFrameReset()
     {
+        const AZStd::sys_time_t frameTicks = m_impl->m_frameTicks.exchange(0, AZStd::memory_order_relaxed);
+        return aznumeric_cast<uint64_t>(frameTicks * 1000000 / AZStd::GetTimeTicksPerSecond());
     }
 
     void Budget::BeginProfileRegion()
     {
+        if (!m_impl->m_accountingEnabled.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // Regions of this budget that were open when accounting was disabled never see their end, so they're dropped here.
+        const uint32_t generation = m_impl->m_accountingGeneration.load(AZStd::memory_order_relaxed);
+        const BudgetImpl* budget = m_impl;
+        t_openRegions.erase(
+            AZStd::remove_if(
+                t_openRegions.begin(), t_openRegions.end(),
+                [budget, generation](const OpenRegion& region)
+                {
+                    return region.m_budget == budget && region.m_generation != generation;
+                }),
+            t_openRegions.end());
+
+        if (t_openRegions.size() < t_openRegions.capacity())
+        {
+            t_openRegions.push_back({ m_impl, generation, AZStd::GetTimeNowTicks() });
+        }
     }
 
     void Budget::EndProfileRegion()
     {
+        if (!m_impl->m_accountingEnabled.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // Regions of different budgets don't have to be strictly nested, so the latest region of this budget is closed even if
+        // regions of other budgets were opened after it. Regions that began before accounting was enabled, or while too many
+        // regions were open, were never recorded.
+        auto region = AZStd::find_if(
+            t_openRegions.rbegin(), t_openRegions.rend(),
+            [budget = m_impl](const OpenRegion& openRegion)
+            {
+                return openRegion.m_budget == budget;
+            });
+        if (region == t_openRegions.rend())
+        {
+            return;
+        }
+
+        const AZStd::sys_time_t startTicks = region->m_startTicks;
+        const uint32_t generation = m_impl->m_accountingGeneration.load(AZStd::memory_order_relaxed);
+        const bool isCurrentGeneration = region->m_generation == generation;
+        t_openRegions.erase(AZStd::next(region).base());
+        if (isCurrentGeneration && !IsRegionOpen(m_impl, generation))
+        {
+            m_impl->m_frameTicks.fetch_add(AZStd::GetTimeNowTicks() - startTicks, AZStd::memory_order_relaxed);
+        }
     }
 
     void Budget::TrackAllocation(uint64_t)
@@ -75,4 +161,28 @@ namespace AZ::Debug
     void Budget::UntrackAllocation(uint64_t)
     {
     }
+
+    void Budget::SetAccountingEnabled(bool enabled)
+    {
+        if (enabled && !m_impl->m_accountingEnabled.load(AZStd::memory_order_relaxed))
+        {
+            m_impl->m_accountingGeneration.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+        m_impl->m_accountingEnabled.store(enabled, AZStd::memory_order_relaxed);
+    }
+
+    bool Budget::IsAccountingEnabled() const
+    {
+        return m_impl->m_accountingEnabled.load(AZStd::memory_order_relaxed);
+    }
+
+    void Budget::SetFrameTimeLimitUs(uint64_t limitUs)
+    {
+        m_impl->m_frameTimeLimitUs.store(limitUs, AZStd::memory_order_relaxed);
+    }
+
+    uint64_t Budget::GetFrameTimeLimitUs() const
+    {
+        return m_impl->m_frameTimeLimitUs.load(AZStd::memory_order_relaxed);
+    }
 } // namespace AZ::Debug
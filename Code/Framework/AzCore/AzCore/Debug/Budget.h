@@ -20,12 +20,23 @@ namespace AZ::Debug
         Budget(const char* name, uint32_t crc);
         ~Budget();
 
-        void PerFrameReset();
+        // Returns the CPU time in microseconds spent in profile regions of this budget since the last reset, and starts a new frame.
+        // Time is only accumulated while accounting is enabled. Time from regions running concurrently on several threads adds up.
+        uint64_t PerFrameReset();
         void BeginProfileRegion();
         void EndProfileRegion();
         void TrackAllocation(uint64_t bytes);
         void UntrackAllocation(uint64_t bytes);
 
+        // Accounting measures the time spent in the profile regions of the budget. It's off by default so profile markers don't pay
+        // for the timing unless it's needed, and is usually toggled for all budgets at once through the BudgetTracker.
+        void SetAccountingEnabled(bool enabled);
+        bool IsAccountingEnabled() const;
+
+        // The CPU time the budget is allowed to use per frame, or 0 if the budget has no limit.
+        void SetFrameTimeLimitUs(uint64_t limitUs);
+        uint64_t GetFrameTimeLimitUs() const;
+
         const char* Name() const
         {
             return m_name;
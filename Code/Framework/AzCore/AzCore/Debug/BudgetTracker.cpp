@@ -9,12 +9,24 @@
 #include <AzCore/Debug/BudgetTracker.h>
 
 #include <AzCore/base.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Budget.h>
+#include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Memory/Memory.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
 
 namespace AZ::Debug
 {
@@ -22,6 +34,58 @@ namespace AZ::Debug
     {
         AZStd::unordered_map<AZStd::string_view, Budget> m_budgets;
         AZStd::unordered_set<Budget**> m_externalBudgetRefs;
+
+        // Frame time limits read from the settings registry by budget name, applied to budgets as they're created.
+        AZStd::unordered_map<AZStd::string, uint64_t> m_frameTimeLimitsUs;
+
+        // Ring buffer of the most recent frames. It grows up to the history frame count, then the oldest frame is overwritten.
+        AZStd::vector<BudgetFrameRecord> m_frames;
+        size_t m_nextFrame = 0;
+        size_t m_historyFrameCount = DefaultHistoryFrameCount;
+        uint64_t m_frameIndex = 0;
+
+        // Budgets that were over their limit in the last frame, so an overrun is reported once when it starts instead of every frame.
+        AZStd::unordered_set<const Budget*> m_overrunBudgets;
+        bool m_accountingEnabled = false;
+
+        void ClearHistory()
+        {
+            m_frames.clear();
+            m_nextFrame = 0;
+            m_overrunBudgets.clear();
+        }
+
+        void SetAccountingEnabled(bool enabled)
+        {
+            if (m_accountingEnabled == enabled)
+            {
+                return;
+            }
+
+            m_accountingEnabled = enabled;
+            for (auto& [name, budget] : m_budgets)
+            {
+                budget.SetAccountingEnabled(enabled);
+                budget.PerFrameReset();
+            }
+            ClearHistory();
+        }
+
+        void SetHistoryFrameCount(size_t frameCount)
+        {
+            frameCount = AZStd::max<size_t>(frameCount, 1);
+            if (m_historyFrameCount != frameCount)
+            {
+                m_historyFrameCount = frameCount;
+                ClearHistory();
+            }
+        }
+
+        void ApplyFrameTimeLimit(Budget& budget) const
+        {
+            auto limitIt = m_frameTimeLimitsUs.find(AZStd::string(budget.Name()));
+            budget.SetFrameTimeLimitUs(limitIt != m_frameTimeLimitsUs.end() ? limitIt->second : 0);
+        }
     };
 
     void BudgetTracker::GetBudgetFromEnvironment(Budget*& extBudgetRef, const char* budgetName, uint32_t crc)
@@ -72,7 +136,265 @@ namespace AZ::Debug
 
         m_impl->m_externalBudgetRefs.insert(&extBudgetRef);
 
-        auto iter = m_impl->m_budgets.try_emplace(budgetName, budgetName, crc).first;
+        auto [iter, inserted] = m_impl->m_budgets.try_emplace(budgetName, budgetName, crc);
+        if (inserted)
+        {
+            iter->second.SetAccountingEnabled(m_impl->m_accountingEnabled);
+            m_impl->ApplyFrameTimeLimit(iter->second);
+        }
         extBudgetRef = &iter->second;
     }
+
+    void BudgetTracker::ApplySettings(SettingsRegistryInterface& registry)
+    {
+        bool accountingEnabled = false;
+        registry.Get(accountingEnabled, RegistryKey_AccountingEnabled);
+
+        AZ::u64 historyFrameCount = DefaultHistoryFrameCount;
+        registry.Get(historyFrameCount, RegistryKey_HistoryFrameCount);
+
+        AZStd::unordered_map<AZStd::string, uint64_t> frameTimeLimitsUs;
+        auto readFrameTimeLimit = [&registry, &frameTimeLimitsUs](
+            AZStd::string_view path, AZStd::string_view fieldName, SettingsRegistryInterface::Type)
+        {
+            double limitMs = 0.0;
+            if (AZ::s64 wholeLimitMs = 0; registry.Get(wholeLimitMs, path))
+            {
+                limitMs = static_cast<double>(wholeLimitMs);
+            }
+            else if (!registry.Get(limitMs, path))
+            {
+                AZ_Warning("BudgetTracker", false, "Frame time limit for budget '%.*s' must be a number of milliseconds.", AZ_STRING_ARG(fieldName));
+                return;
+            }
+            frameTimeLimitsUs[fieldName] = static_cast<uint64_t>(AZStd::max(limitMs, 0.0) * 1000.0);
+        };
+        SettingsRegistryVisitorUtils::VisitObject(registry, readFrameTimeLimit, RegistryKey_FrameTimeLimitsMs);
+
+        AZStd::scoped_lock lock{ m_mutex };
+        if (!m_impl)
+        {
+            return;
+        }
+
+        m_impl->m_frameTimeLimitsUs = AZStd::move(frameTimeLimitsUs);
+        for (auto& [name, budget] : m_impl->m_budgets)
+        {
+            m_impl->ApplyFrameTimeLimit(budget);
+        }
+        m_impl->SetHistoryFrameCount(aznumeric_cast<size_t>(historyFrameCount));
+        m_impl->SetAccountingEnabled(accountingEnabled);
+    }
+
+    void BudgetTracker::SetAccountingEnabled(bool enabled)
+    {
+        AZStd::scoped_lock lock{ m_mutex };
+        if (m_impl)
+        {
+            m_impl->SetAccountingEnabled(enabled);
+        }
+    }
+
+    bool BudgetTracker::IsAccountingEnabled() const
+    {
+        AZStd::scoped_lock lock{ m_mutex };
+        return m_impl && m_impl->m_accountingEnabled;
+    }
+
+    void BudgetTracker::EndFrame()
+    {
+        AZStd::scoped_lock lock{ m_mutex };
+        if (!m_impl || !m_impl->m_accountingEnabled)
+        {
+            return;
+        }
+
+        BudgetFrameRecord& record = m_impl->m_frames.size() < m_impl->m_historyFrameCount
+            ? m_impl->m_frames.emplace_back()
+            : m_impl->m_frames[m_impl->m_nextFrame];
+        m_impl->m_nextFrame = (m_impl->m_nextFrame + 1) % m_impl->m_historyFrameCount;
+        record.m_frameIndex = m_impl->m_frameIndex++;
+        record.m_samples.clear();
+
+        for (auto& [name, budget] : m_impl->m_budgets)
+        {
+            const uint64_t timeUs = budget.PerFrameReset();
+            const uint64_t limitUs = budget.GetFrameTimeLimitUs();
+            if (timeUs > 0)
+            {
+                record.m_samples.push_back({ budget.Name(), timeUs, limitUs });
+            }
+
+            if (limitUs > 0 && timeUs > limitUs)
+            {
+                if (m_impl->m_overrunBudgets.insert(&budget).second)
+                {
+                    AZ_Warning("BudgetTracker", false, "Budget '%s' used %.3f ms in frame %llu, which is over its limit of %.3f ms.",
+                        budget.Name(), timeUs / 1000.0, static_cast<unsigned long long>(record.m_frameIndex), limitUs / 1000.0);
+                }
+            }
+            else
+            {
+                m_impl->m_overrunBudgets.erase(&budget);
+            }
+        }
+    }
+
+    AZStd::vector<BudgetFrameRecord> BudgetTracker::GetFrameHistory() const
+    {
+        AZStd::scoped_lock lock{ m_mutex };
+
+        AZStd::vector<BudgetFrameRecord> history;
+        if (!m_impl)
+        {
+            return history;
+        }
+
+        // Once the ring is full, the next frame to overwrite is the oldest one.
+        const AZStd::vector<BudgetFrameRecord>& frames = m_impl->m_frames;
+        const size_t oldestFrame = frames.size() < m_impl->m_historyFrameCount ? 0 : m_impl->m_nextFrame;
+        history.reserve(frames.size());
+        for (size_t i = 0; i < frames.size(); ++i)
+        {
+            history.push_back(frames[(oldestFrame + i) % frames.size()]);
+        }
+        return history;
+    }
+
+    bool BudgetTracker::ExportFrameHistoryCsv(const char* filePath) const
+    {
+        AZ::IO::FixedMaxPath resolvedPath(filePath);
+        if (auto fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO)
+        {
+            fileIO->ResolvePath(resolvedPath, AZ::IO::PathView(filePath));
+        }
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(resolvedPath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Error("BudgetTracker", false, "Unable to open '%s' to export the budget frame history.", resolvedPath.c_str());
+            return false;
+        }
+
+        AZStd::string csv = "frame,budget,time_us,limit_us,over_limit\n";
+        for (const BudgetFrameRecord& frame : GetFrameHistory())
+        {
+            for (const BudgetFrameSample& sample : frame.m_samples)
+            {
+                csv += AZStd::string::format("%llu,%s,%llu,%llu,%d\n",
+                    static_cast<unsigned long long>(frame.m_frameIndex), sample.m_budgetName,
+                    static_cast<unsigned long long>(sample.m_timeUs), static_cast<unsigned long long>(sample.m_limitUs),
+                    sample.m_limitUs > 0 && sample.m_timeUs > sample.m_limitUs ? 1 : 0);
+            }
+        }
+
+        return file.Write(csv.data(), csv.size()) == csv.size();
+    }
+
+    void BudgetAccounting(const AZ::ConsoleCommandContainer& arguments)
+    {
+        BudgetTracker* tracker = Interface<BudgetTracker>::Get();
+        if (!tracker)
+        {
+            return;
+        }
+
+        if (bool enabled = false; !arguments.empty() && ConsoleTypeHelpers::StringSetToValue(enabled, arguments))
+        {
+            tracker->SetAccountingEnabled(enabled);
+        }
+        AZLOG_INFO("Budget accounting is %s", tracker->IsAccountingEnabled() ? "enabled" : "disabled");
+    }
+    AZ_CONSOLEFREEFUNC(BudgetAccounting, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Parameter: 0 or 1, enables or disables measuring the CPU time of each budget per frame. Prints the state without a parameter");
+
+    void BudgetReport(const AZ::ConsoleCommandContainer& arguments)
+    {
+        BudgetTracker* tracker = Interface<BudgetTracker>::Get();
+        if (!tracker)
+        {
+            return;
+        }
+
+        AZStd::vector<BudgetFrameRecord> history = tracker->GetFrameHistory();
+        if (AZ::u64 frameCount = 0; !arguments.empty() && ConsoleTypeHelpers::StringSetToValue(frameCount, arguments) &&
+            frameCount < history.size())
+        {
+            history.erase(history.begin(), history.end() - frameCount);
+        }
+
+        if (history.empty())
+        {
+            AZLOG_INFO("No budget frames were recorded. Enable accounting with BudgetAccounting 1.");
+            return;
+        }
+
+        struct BudgetSummary
+        {
+            const char* m_name = nullptr;
+            uint64_t m_totalUs = 0;
+            uint64_t m_maxUs = 0;
+            uint64_t m_limitUs = 0;
+            size_t m_overrunFrames = 0;
+        };
+        AZStd::unordered_map<AZStd::string_view, BudgetSummary> summaries;
+        for (const BudgetFrameRecord& frame : history)
+        {
+            for (const BudgetFrameSample& sample : frame.m_samples)
+            {
+                BudgetSummary& summary = summaries[sample.m_budgetName];
+                summary.m_name = sample.m_budgetName;
+                summary.m_totalUs += sample.m_timeUs;
+                summary.m_maxUs = AZStd::max(summary.m_maxUs, sample.m_timeUs);
+                summary.m_limitUs = sample.m_limitUs;
+                summary.m_overrunFrames += sample.m_limitUs > 0 && sample.m_timeUs > sample.m_limitUs ? 1 : 0;
+            }
+        }
+
+        AZStd::vector<BudgetSummary> sortedSummaries;
+        sortedSummaries.reserve(summaries.size());
+        for (const auto& [name, summary] : summaries)
+        {
+            sortedSummaries.push_back(summary);
+        }
+        AZStd::sort(sortedSummaries.begin(), sortedSummaries.end(),
+            [](const BudgetSummary& lhs, const BudgetSummary& rhs) { return lhs.m_maxUs > rhs.m_maxUs; });
+
+        AZLOG_INFO("Budget usage over the last %zu frames, sorted by peak frame time:", history.size());
+        for (const BudgetSummary& summary : sortedSummaries)
+        {
+            AZLOG_INFO("  %-24s avg %8.3f ms  max %8.3f ms  limit %8.3f ms  over limit in %zu frames",
+                summary.m_name, summary.m_totalUs / 1000.0 / history.size(), summary.m_maxUs / 1000.0, summary.m_limitUs / 1000.0,
+                summary.m_overrunFrames);
+        }
+    }
+    AZ_CONSOLEFREEFUNC(BudgetReport, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Parameter: optional number of recent frames, prints the average and peak frame time of each budget and how often it went over its limit");
+
+    void BudgetExportCsv(const AZ::ConsoleCommandContainer& arguments)
+    {
+        BudgetTracker* tracker = Interface<BudgetTracker>::Get();
+        if (!tracker)
+        {
+            return;
+        }
+
+        AZStd::string filePath;
+        if (!arguments.empty())
+        {
+            filePath = arguments.front();
+        }
+        else
+        {
+            filePath = AZStd::string::format("%s/budgets_%lld.csv", GetProfilerCaptureLocation().c_str(), AZStd::GetTimeNowSecond());
+        }
+
+        if (tracker->ExportFrameHistoryCsv(filePath.c_str()))
+        {
+            AZLOG_INFO("Exported the budget frame history to %s", filePath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(BudgetExportCsv, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Parameter: optional file path, writes the recorded budget frame times to a CSV file. Defaults to the profiler capture location");
 } // namespace AZ::Debug
@@ -10,18 +10,46 @@
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 
+namespace AZ
+{
+    class SettingsRegistryInterface;
+}
+
 namespace AZ::Debug
 {
     class Budget;
 
+    // The CPU time a budget used in one frame.
+    struct BudgetFrameSample
+    {
+        const char* m_budgetName = nullptr;
+        uint64_t m_timeUs = 0;
+        // The frame time limit of the budget at the end of the frame, or 0 if it had no limit.
+        uint64_t m_limitUs = 0;
+    };
+
+    // The budgets that used CPU time in one frame while budget accounting was enabled.
+    struct BudgetFrameRecord
+    {
+        uint64_t m_frameIndex = 0;
+        AZStd::vector<BudgetFrameSample> m_samples;
+    };
+
     class BudgetTracker
     {
     public:
         AZ_TYPE_INFO(BudgetTracker, "{E14A746D-BFFE-4C02-90FB-4699B79864A5}");
         static void GetBudgetFromEnvironment(Budget*& extBudgetRef, const char* budgetName, uint32_t crc);
 
+        static constexpr const char* RegistryKey_AccountingEnabled = "/O3DE/AzCore/Debug/Budgets/AccountingEnabled";
+        static constexpr const char* RegistryKey_HistoryFrameCount = "/O3DE/AzCore/Debug/Budgets/HistoryFrameCount";
+        // Object with the frame time limit in milliseconds of each budget by name, e.g. { "Physics": 4.0 }.
+        static constexpr const char* RegistryKey_FrameTimeLimitsMs = "/O3DE/AzCore/Debug/Budgets/FrameTimeLimitsMs";
+        static constexpr size_t DefaultHistoryFrameCount = 300;
+
         ~BudgetTracker();
 
         // Returns false if the budget tracker was already present in the environment (initialized already elsewhere)
@@ -30,10 +58,27 @@ namespace AZ::Debug
 
         void GetBudget(Budget*& extBudgetRef, const char* budgetName, uint32_t crc);
 
+        // Reads whether accounting is enabled, the number of frames to keep and the budget frame time limits from the registry.
+        void ApplySettings(SettingsRegistryInterface& registry);
+
+        // Enables or disables accounting for all current and future budgets. Changing this clears the frame history.
+        void SetAccountingEnabled(bool enabled);
+        bool IsAccountingEnabled() const;
+
+        // Ends the frame for all budgets. While accounting is enabled, this records the CPU time used by each budget in the frame
+        // history and warns about budgets that went over their frame time limit.
+        void EndFrame();
+
+        // Returns the recorded frames, oldest first.
+        AZStd::vector<BudgetFrameRecord> GetFrameHistory() const;
+
+        // Writes the recorded frames to a CSV file, with one row per budget and frame.
+        bool ExportFrameHistoryCsv(const char* filePath) const;
+
     private:
         struct BudgetTrackerImpl;
 
-        AZStd::mutex m_mutex;
+        mutable AZStd::mutex m_mutex;
 
         // The BudgetTracker is likely included in proportionally high number of files throughout the
         // engine, so indirection is used here to avoid imposing excessive recompilation in periods
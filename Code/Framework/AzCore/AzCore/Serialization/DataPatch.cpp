@@ -20,6 +20,7 @@
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ
 {
@@ -1276,6 +1277,486 @@ namespace AZ
         return flags;
     }
 
+    inline namespace DataPatchInternal
+    {
+        /**
+        * A patch with each of its addresses resolved once against the class layouts of a source type, so it can be applied to
+        * any number of instances of that type without building a DataNodeTree for them. Applying it clones the source and writes
+        * the patched values directly to the offsets in the clone, only searching containers for elements by persistent id or index.
+        * Only patches that overwrite existing leaf values can be compiled. Patches that add or remove elements, replace objects,
+        * hold legacy data or go through dynamic fields or classes with event handlers are always applied through the DataNodeTree.
+        */
+        class CompiledDataPatch
+        {
+        public:
+            static AZStd::shared_ptr<const CompiledDataPatch> Compile(
+                const PatchMap& patch,
+                const Uuid& targetClassId,
+                unsigned int targetClassVersion,
+                const Uuid& sourceClassId,
+                SerializeContext& context);
+
+            /// \returns true if all values of the patch could be resolved, otherwise the patch has to be applied through the DataNodeTree.
+            bool IsCompiled() const
+            {
+                return m_isCompiled;
+            }
+
+            /// \returns true if the patch was compiled for this source class and context and none of the classes it goes through changed since.
+            bool IsValidFor(const Uuid& sourceClassId, const SerializeContext& context) const;
+
+            /// Returns a patched clone of the source, or a null pointer if one of the patched values is stored in an element that the
+            /// source doesn't have, in which case the patch has to be applied through the DataNodeTree.
+            void* Apply(
+                const void* source,
+                SerializeContext& context,
+                const DataPatch::FlagsMap& sourceFlagsMap,
+                const DataPatch::FlagsMap& targetFlagsMap) const;
+
+        private:
+            // Steps from an object to one of its elements. Consecutive members stored by value are merged into a single offset.
+            struct Step
+            {
+                size_t m_offset = 0;
+                //! Set if the element at the offset is a pointer that has to be followed.
+                const SerializeContext::ClassElement* m_pointerElement = nullptr;
+                //! Set if the step looks up an element of a container by m_elementId instead of using the offset.
+                const SerializeContext::ClassData* m_containerClassData = nullptr;
+                u64 m_elementId = 0;
+                //! Class of the object the step ends at.
+                const SerializeContext::ClassData* m_classData = nullptr;
+            };
+
+            struct PatchedValue
+            {
+                AddressType m_address;
+                AZStd::any m_value;
+                TypeId m_valueTypeId;
+                AZStd::vector<Step> m_steps;
+            };
+
+            struct ContainerElement
+            {
+                void* m_object = nullptr;
+                const SerializeContext::ClassData* m_classData = nullptr;
+                bool m_isPointer = false;
+            };
+            using ContainerElementMap = AZStd::unordered_map<u64, ContainerElement>;
+            using ContainerElementMaps = AZStd::unordered_map<const void*, ContainerElementMap>;
+
+            bool CompileValue(const AddressType& address, AZStd::any&& value, SerializeContext& context);
+            const SerializeContext::ClassData* AddLayoutClass(const SerializeContext::ClassData* classData);
+            size_t CalculateLayoutHash(const SerializeContext& context) const;
+
+            static void* ResolveSteps(void* object, const AZStd::vector<Step>& steps, ContainerElementMaps& containerElements, SerializeContext& context);
+            static const ContainerElementMap& GetContainerElements(
+                void* container, const SerializeContext::ClassData& containerClassData, ContainerElementMaps& containerElements, SerializeContext& context);
+
+            AZStd::vector<PatchedValue> m_values;
+            //! Classes the resolved steps depend on, used to detect changes to their layouts.
+            AZStd::vector<TypeId> m_layoutTypeIds;
+            const SerializeContext* m_context = nullptr;
+            const SerializeContext::ClassData* m_sourceClassData = nullptr;
+            Uuid m_sourceClassId;
+            size_t m_layoutHash = 0;
+            bool m_isCompiled = false;
+        };
+
+        //=========================================================================
+        // CompiledDataPatch::Compile
+        //=========================================================================
+        AZStd::shared_ptr<const CompiledDataPatch> CompiledDataPatch::Compile(
+            const PatchMap& patch,
+            const Uuid& targetClassId,
+            unsigned int targetClassVersion,
+            const Uuid& sourceClassId,
+            SerializeContext& context)
+        {
+            AZ_PROFILE_FUNCTION(AzCore);
+
+            auto compiledPatch = AZStd::make_shared<CompiledDataPatch>();
+            compiledPatch->m_context = &context;
+            compiledPatch->m_sourceClassId = sourceClassId;
+            compiledPatch->m_sourceClassData = compiledPatch->AddLayoutClass(context.FindClassData(sourceClassId));
+
+            bool isCompiled = compiledPatch->m_sourceClassData && compiledPatch->m_sourceClassData->m_factory &&
+                !compiledPatch->m_sourceClassData->m_eventHandler;
+            if (isCompiled)
+            {
+                compiledPatch->m_values.reserve(patch.size());
+                // Copy each patch the same way Apply does, so UpgradeDataPatch can repair it before it's resolved.
+                for (PatchMap::value_type patchValue : patch)
+                {
+                    DataPatchUpgradeManager::UpgradeDataPatch(&context, targetClassId, targetClassVersion, patchValue.first, patchValue.second);
+                    if (!compiledPatch->CompileValue(patchValue.first, AZStd::move(patchValue.second), context))
+                    {
+                        isCompiled = false;
+                        break;
+                    }
+                }
+            }
+
+            if (!isCompiled)
+            {
+                compiledPatch->m_values = {};
+            }
+            compiledPatch->m_isCompiled = isCompiled;
+            compiledPatch->m_layoutHash = compiledPatch->CalculateLayoutHash(context);
+            return compiledPatch;
+        }
+
+        //=========================================================================
+        // CompiledDataPatch::CompileValue
+        //=========================================================================
+        bool CompiledDataPatch::CompileValue(const AddressType& address, AZStd::any&& value, SerializeContext& context)
+        {
+            // Removals, replaced roots and values that still need their class data to be loaded can't be written in place.
+            if (address.empty() || !address.IsValid() || value.empty() || value.type() == azrtti_typeid<DataPatch::LegacyStreamWrapper>())
+            {
+                return false;
+            }
+
+            PatchedValue patchedValue;
+            patchedValue.m_valueTypeId = value.type();
+            // See DataNodeTree::ApplyToElements, all asset patches are stored as AZ::Data::Asset<AZ::Data::AssetData>.
+            if (patchedValue.m_valueTypeId == azrtti_typeid<AZ::Data::Asset<AZ::Data::AssetData>>())
+            {
+                patchedValue.m_valueTypeId = AZ::GetAssetClassId();
+            }
+
+            const SerializeContext::ClassData* classData = m_sourceClassData;
+            const SerializeContext::ClassElement* leafElement = nullptr;
+            for (const AddressTypeElement& addressElement : address)
+            {
+                // Elements are only matched by their address element, but the type is needed to know what class they resolve to.
+                // Leaf classes are read and written as a whole, so nothing can be addressed below them.
+                if (!addressElement.IsValid() || addressElement.GetElementTypeId().IsNull() || classData->m_serializer)
+                {
+                    return false;
+                }
+
+                Step step;
+                if (classData->m_container)
+                {
+                    // Only containers with stable element storage can be written to in place, writing to the elements of
+                    // associative containers could change their keys.
+                    if (!classData->m_container->CanAccessElementsByIndex())
+                    {
+                        return false;
+                    }
+                    step.m_containerClassData = classData;
+                    step.m_elementId = addressElement.GetAddressElement();
+                    step.m_classData = AddLayoutClass(context.FindClassData(addressElement.GetElementTypeId()));
+                    leafElement = nullptr;
+                }
+                else
+                {
+                    const u32 elementNameCrc = static_cast<u32>(addressElement.GetAddressElement());
+                    auto elementIt = AZStd::find_if(classData->m_elements.begin(), classData->m_elements.end(),
+                        [elementNameCrc](const SerializeContext::ClassElement& element) { return element.m_nameCrc == elementNameCrc; });
+                    if (elementIt == classData->m_elements.end() || (elementIt->m_flags & SerializeContext::ClassElement::FLG_DYNAMIC_FIELD))
+                    {
+                        return false;
+                    }
+
+                    step.m_offset = elementIt->m_offset;
+                    if (elementIt->m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                    {
+                        // The address stores the actual class the pointer pointed to when the patch was created.
+                        step.m_pointerElement = &(*elementIt);
+                        step.m_classData = AddLayoutClass(context.FindClassData(addressElement.GetElementTypeId()));
+                        if (step.m_classData && step.m_classData->m_typeId != elementIt->m_typeId &&
+                            !(elementIt->m_azRtti && step.m_classData->m_azRtti))
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        step.m_classData = AddLayoutClass(elementIt->m_genericClassInfo
+                            ? elementIt->m_genericClassInfo->GetClassData()
+                            : context.FindClassData(elementIt->m_typeId, classData, elementIt->m_nameCrc));
+                        if (step.m_classData && step.m_classData->m_typeId != addressElement.GetElementTypeId())
+                        {
+                            return false;
+                        }
+                    }
+                    leafElement = &(*elementIt);
+                }
+
+                if (!step.m_classData || step.m_classData->m_eventHandler)
+                {
+                    return false;
+                }
+
+                Step* previousStep = patchedValue.m_steps.empty() ? nullptr : &patchedValue.m_steps.back();
+                if (previousStep && !previousStep->m_pointerElement && !previousStep->m_containerClassData && !step.m_containerClassData)
+                {
+                    previousStep->m_offset += step.m_offset;
+                    previousStep->m_pointerElement = step.m_pointerElement;
+                    previousStep->m_classData = step.m_classData;
+                }
+                else
+                {
+                    patchedValue.m_steps.push_back(step);
+                }
+                classData = step.m_classData;
+            }
+
+            // Only values of leaf classes are written in place, anything else would need the object to be rebuilt.
+            if (!classData->m_serializer)
+            {
+                return false;
+            }
+
+            // Use the same type check as DataNodeTree::ApplyToElements.
+            const TypeId& leafTypeId = leafElement ? leafElement->m_typeId : classData->m_typeId;
+            if ((leafElement && (leafElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)) ||
+                (leafTypeId != patchedValue.m_valueTypeId && context.GetUnderlyingTypeId(leafTypeId) != patchedValue.m_valueTypeId))
+            {
+                return false;
+            }
+
+            patchedValue.m_address = address;
+            patchedValue.m_value = AZStd::move(value);
+            m_values.push_back(AZStd::move(patchedValue));
+            return true;
+        }
+
+        //=========================================================================
+        // CompiledDataPatch::AddLayoutClass
+        //=========================================================================
+        const SerializeContext::ClassData* CompiledDataPatch::AddLayoutClass(const SerializeContext::ClassData* classData)
+        {
+            if (classData && AZStd::find(m_layoutTypeIds.begin(), m_layoutTypeIds.end(), classData->m_typeId) == m_layoutTypeIds.end())
+            {
+                m_layoutTypeIds.push_back(classData->m_typeId);
+            }
+            return classData;
+        }
+
+        //=========================================================================
+        // CompiledDataPatch::CalculateLayoutHash
+        //=========================================================================
+        size_t CompiledDataPatch::CalculateLayoutHash(const SerializeContext& context) const
+        {
+            // The class data is hashed by address as well, so reflecting a class again invalidates the offsets and elements taken from it.
+            size_t hash = 0;
+            for (const TypeId& typeId : m_layoutTypeIds)
+            {
+                const SerializeContext::ClassData* classData = context.FindClassData(typeId);
+                AZStd::hash_combine(hash, typeId, reinterpret_cast<uintptr_t>(classData));
+                if (classData)
+                {
+                    AZStd::hash_combine(hash, classData->m_version, classData->m_elements.size());
+                }
+            }
+            return hash;
+        }
+
+        //=========================================================================
+        // CompiledDataPatch::IsValidFor
+        //=========================================================================
+        bool CompiledDataPatch::IsValidFor(const Uuid& sourceClassId, const SerializeContext& context) const
+        {
+            return m_context == &context && m_sourceClassId == sourceClassId && m_layoutHash == CalculateLayoutHash(context);
+        }
+
+        //=========================================================================
+        // CompiledDataPatch::Apply
+        //=========================================================================
+        void* CompiledDataPatch::Apply(
+            const void* source,
+            SerializeContext& context,
+            const DataPatch::FlagsMap& sourceFlagsMap,
+            const DataPatch::FlagsMap& targetFlagsMap) const
+        {
+            AZ_PROFILE_FUNCTION(AzCore);
+
+            void* result = context.CloneObject(source, m_sourceClassId);
+            if (!result)
+            {
+                return nullptr;
+            }
+
+            const bool hasFlags = !sourceFlagsMap.empty() || !targetFlagsMap.empty();
+            ContainerElementMaps containerElements;
+            AddressType address;
+            for (const PatchedValue& patchedValue : m_values)
+            {
+                if (hasFlags)
+                {
+                    // Accumulate the flags down the address like DataNodeTree::ApplyToElements does while walking the tree.
+                    address.clear();
+                    DataPatch::Flags addressFlags = DataNodeTree::CalculateDataFlagsAtThisAddress(sourceFlagsMap, targetFlagsMap, 0, address);
+                    for (const AddressTypeElement& addressElement : patchedValue.m_address)
+                    {
+                        address.push_back(addressElement);
+                        addressFlags = DataNodeTree::CalculateDataFlagsAtThisAddress(sourceFlagsMap, targetFlagsMap, addressFlags, address);
+                    }
+
+                    if (addressFlags & DataPatch::Flag::PreventOverrideEffect)
+                    {
+                        continue;
+                    }
+                }
+
+                void* valuePointer = ResolveSteps(result, patchedValue.m_steps, containerElements, context);
+                if (!valuePointer)
+                {
+                    m_sourceClassData->m_factory->Destroy(result);
+                    return nullptr;
+                }
+                context.CloneObjectInplace(valuePointer, AZStd::any_cast<void>(&patchedValue.m_value), patchedValue.m_valueTypeId);
+            }
+            return result;
+        }
+
+        //=========================================================================
+        // CompiledDataPatch::ResolveSteps
+        //=========================================================================
+        void* CompiledDataPatch::ResolveSteps(
+            void* object, const AZStd::vector<Step>& steps, ContainerElementMaps& containerElements, SerializeContext& context)
+        {
+            for (size_t stepIndex = 0; stepIndex < steps.size(); ++stepIndex)
+            {
+                const Step& step = steps[stepIndex];
+                if (step.m_containerClassData)
+                {
+                    const ContainerElementMap& elements = GetContainerElements(object, *step.m_containerClassData, containerElements, context);
+                    auto elementIt = elements.find(step.m_elementId);
+                    const bool isLeaf = stepIndex + 1 == steps.size();
+                    if (elementIt == elements.end() || !elementIt->second.m_object || elementIt->second.m_classData != step.m_classData ||
+                        (isLeaf && elementIt->second.m_isPointer))
+                    {
+                        return nullptr;
+                    }
+                    object = elementIt->second.m_object;
+                    continue;
+                }
+
+                object = reinterpret_cast<char*>(object) + step.m_offset;
+                if (step.m_pointerElement)
+                {
+                    object = *reinterpret_cast<void**>(object);
+                    if (!object)
+                    {
+                        return nullptr;
+                    }
+
+                    if (step.m_pointerElement->m_azRtti)
+                    {
+                        if (step.m_pointerElement->m_azRtti->GetActualUuid(object) != step.m_classData->m_typeId)
+                        {
+                            return nullptr;
+                        }
+                        if (step.m_classData->m_typeId != step.m_pointerElement->m_typeId)
+                        {
+                            object = step.m_pointerElement->m_azRtti->Cast(object, step.m_classData->m_azRtti->GetTypeId());
+                            if (!object)
+                            {
+                                return nullptr;
+                            }
+                        }
+                    }
+                    else if (step.m_classData->m_typeId != step.m_pointerElement->m_typeId)
+                    {
+                        return nullptr;
+                    }
+                }
+            }
+            return object;
+        }
+
+        //=========================================================================
+        // CompiledDataPatch::GetContainerElements
+        //=========================================================================
+        const CompiledDataPatch::ContainerElementMap& CompiledDataPatch::GetContainerElements(
+            void* container, const SerializeContext::ClassData& containerClassData, ContainerElementMaps& containerElements, SerializeContext& context)
+        {
+            auto insertResult = containerElements.try_emplace(container);
+            ContainerElementMap& elements = insertResult.first->second;
+            if (!insertResult.second)
+            {
+                return elements;
+            }
+
+            // Identify the elements the same way DataNodeTree::ApplyToElements does for the nodes that SerializeContext::EnumerateInstance
+            // creates for them, so null pointers and elements without class data don't count towards the index.
+            u64 elementIndex = 0;
+            containerClassData.m_container->EnumElements(container,
+                [&elements, &elementIndex, &context](void* elementPtr, const Uuid& elementClassId, const SerializeContext::ClassData* elementClassData,
+                    const SerializeContext::ClassElement* classElement)
+                {
+                    void* object = elementPtr;
+                    const bool isPointer = classElement && (classElement->m_flags & SerializeContext::ClassElement::FLG_POINTER);
+                    if (isPointer)
+                    {
+                        object = *reinterpret_cast<void**>(elementPtr);
+                        if (!object)
+                        {
+                            return true;
+                        }
+                    }
+                    // The persistent id is read from the element pointer before it's cast to its actual class, as DataNodeTree does.
+                    const void* idObject = object;
+
+                    if (isPointer && classElement->m_azRtti)
+                    {
+                        const Uuid& actualClassId = classElement->m_azRtti->GetActualUuid(object);
+                        if (actualClassId != elementClassId)
+                        {
+                            elementClassData = context.FindClassData(actualClassId);
+                            if (elementClassData && elementClassData->m_azRtti)
+                            {
+                                object = classElement->m_azRtti->Cast(object, elementClassData->m_azRtti->GetTypeId());
+                                if (!object)
+                                {
+                                    return true;
+                                }
+                            }
+                        }
+                    }
+
+                    if (!elementClassData)
+                    {
+                        elementClassData = context.FindClassData(elementClassId);
+                        if (!elementClassData)
+                        {
+                            return true;
+                        }
+                    }
+
+                    SerializeContext::ClassPersistentId persistentIdFunction = elementClassData->GetPersistentId(context);
+                    const u64 elementId = persistentIdFunction ? persistentIdFunction(idObject) : elementIndex;
+                    ++elementIndex;
+
+                    auto elementInsertResult = elements.try_emplace(elementId, ContainerElement{ object, elementClassData, isPointer });
+                    if (!elementInsertResult.second)
+                    {
+                        // Patches apply to every element with the id, so duplicated ids are left to the DataNodeTree.
+                        elementInsertResult.first->second.m_object = nullptr;
+                    }
+                    return true;
+                });
+            return elements;
+        }
+
+        //=========================================================================
+        // DataPatchSerializationEvents
+        //=========================================================================
+        class DataPatchSerializationEvents
+            : public SerializeContext::IEventHandler
+        {
+        public:
+            void OnWriteBegin(void* classPtr) override
+            {
+                // The patch is about to be loaded in place, so whatever was compiled from it is out of date.
+                reinterpret_cast<DataPatch*>(classPtr)->ResetCompiledPatch();
+            }
+        };
+    } // namespace DataPatchInternal
+
     inline namespace DataPatchInternal
     {
         //=========================================================================
@@ -1706,6 +2187,10 @@ namespace AZ
         m_patch = rhs.m_patch;
         m_targetClassId = rhs.m_targetClassId;
         m_targetClassVersion = rhs.m_targetClassVersion;
+
+        // The compiled patch never changes once created, so copies of the same patch can share it.
+        AZStd::lock_guard<AZStd::mutex> lock(rhs.m_compiledPatchMutex);
+        m_compiledPatch = rhs.m_compiledPatch;
     }
 
     //=========================================================================
@@ -1716,6 +2201,9 @@ namespace AZ
         m_patch = AZStd::move(rhs.m_patch);
         m_targetClassId = AZStd::move(rhs.m_targetClassId);
         m_targetClassVersion = AZStd::move(rhs.m_targetClassVersion);
+
+        AZStd::lock_guard<AZStd::mutex> lock(rhs.m_compiledPatchMutex);
+        m_compiledPatch = AZStd::move(rhs.m_compiledPatch);
     }
 
     //=========================================================================
@@ -1726,6 +2214,14 @@ namespace AZ
         m_patch = AZStd::move(rhs.m_patch);
         m_targetClassId = AZStd::move(rhs.m_targetClassId);
         m_targetClassVersion = AZStd::move(rhs.m_targetClassVersion);
+
+        AZStd::shared_ptr<const CompiledDataPatch> compiledPatch;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(rhs.m_compiledPatchMutex);
+            compiledPatch = AZStd::move(rhs.m_compiledPatch);
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_compiledPatchMutex);
+        m_compiledPatch = AZStd::move(compiledPatch);
         return *this;
     }
 
@@ -1737,6 +2233,14 @@ namespace AZ
         m_patch = rhs.m_patch;
         m_targetClassId = rhs.m_targetClassId;
         m_targetClassVersion = rhs.m_targetClassVersion;
+
+        AZStd::shared_ptr<const CompiledDataPatch> compiledPatch;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(rhs.m_compiledPatchMutex);
+            compiledPatch = rhs.m_compiledPatch;
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_compiledPatchMutex);
+        m_compiledPatch = AZStd::move(compiledPatch);
         return *this;
     }
 
@@ -1786,6 +2290,7 @@ namespace AZ
         m_patch.clear();
         m_targetClassId = targetClassId;
         m_targetClassVersion = targetClassData->m_version;
+        ResetCompiledPatch();
 
         if (sourceClassId != targetClassId)
         {
@@ -1861,6 +2366,16 @@ namespace AZ
             return context->CloneObject(AZStd::any_cast<void>(&m_patch.begin()->second), m_patch.begin()->second.type());
         }
 
+        // Patches that only overwrite existing values are resolved once per source class and then written directly to a clone.
+        // If the source is missing any of the patched elements, fall back to rebuilding it below.
+        if (AZStd::shared_ptr<const CompiledDataPatch> compiledPatch = GetCompiledPatch(sourceClassId, *context); compiledPatch->IsCompiled())
+        {
+            if (void* result = compiledPatch->Apply(source, *context, sourceFlagsMap, targetFlagsMap))
+            {
+                return result;
+            }
+        }
+
         DataNodeTree sourceTree(context);
         sourceTree.Build(source, sourceClassId);
 
@@ -1945,6 +2460,28 @@ namespace AZ
         return result;
     }
 
+    //=========================================================================
+    // GetCompiledPatch
+    //=========================================================================
+    AZStd::shared_ptr<const CompiledDataPatch> DataPatch::GetCompiledPatch(const Uuid& sourceClassId, SerializeContext& context) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_compiledPatchMutex);
+        if (!m_compiledPatch || !m_compiledPatch->IsValidFor(sourceClassId, context))
+        {
+            m_compiledPatch = CompiledDataPatch::Compile(m_patch, m_targetClassId, m_targetClassVersion, sourceClassId, context);
+        }
+        return m_compiledPatch;
+    }
+
+    //=========================================================================
+    // ResetCompiledPatch
+    //=========================================================================
+    void DataPatch::ResetCompiledPatch()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_compiledPatchMutex);
+        m_compiledPatch.reset();
+    }
+
     /**
     * Helper method to convert over the legacy bytestream format to using AZStd::any to store patch data
     */
@@ -2141,6 +2678,7 @@ namespace AZ
             serializeContext->ClassDeprecate("OldDataPatch", GetLegacyDataPatchTypeId(), &LegacyDataPatchConverter);
 
             serializeContext->Class<DataPatch>()->
+                EventHandler<DataPatchInternal::DataPatchSerializationEvents>()->
                 Field("m_targetClassId", &DataPatch::m_targetClassId)->
                 Field("m_targetClassVersion", &DataPatch::m_targetClassVersion)->
                 Field("m_patch", &DataPatch::m_patch);
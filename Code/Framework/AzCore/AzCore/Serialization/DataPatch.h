@@ -9,6 +9,8 @@
 #define AZCORE_DATA_PATCH_FIELD_H
 
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include "ObjectStream.h"
 
@@ -20,6 +22,8 @@ namespace AZ
     inline namespace DataPatchInternal
     {
         class AddressTypeSerializer;
+        class CompiledDataPatch;
+        class DataPatchSerializationEvents;
         
         // Class to store information used in determining version, typeId and location in patch hierarchy for each class element examined between patch target (root) and patched element (leaf)
         class AddressTypeElement
@@ -379,6 +383,17 @@ namespace AZ
         Uuid     m_targetClassId;
         unsigned int m_targetClassVersion;
         mutable PatchMap m_patch;
+
+    private:
+        friend class DataPatchInternal::DataPatchSerializationEvents;
+
+        /// Returns the patch compiled for the source class, compiling it again if the cached one was compiled for another class
+        /// or the layout of the classes it goes through has changed since.
+        AZStd::shared_ptr<const CompiledDataPatch> GetCompiledPatch(const Uuid& sourceClassId, SerializeContext& context) const;
+        void ResetCompiledPatch();
+
+        mutable AZStd::shared_ptr<const CompiledDataPatch> m_compiledPatch;
+        mutable AZStd::mutex m_compiledPatchMutex;
     };
 
     /**
@@ -125,15 +125,32 @@ namespace AZ
     JsonDeserializerContext::JsonDeserializerContext(JsonDeserializerSettings& settings)
         : JsonBaseContext(settings.m_metadata, settings.m_reporting,
             StackedString::Format::JsonPointer, settings.m_serializeContext, settings.m_registrationContext)
+        , m_concurrentlyLoadableTypes(&settings.m_concurrentlyLoadableTypes)
+        , m_parallelArrayLoadThreshold(settings.m_parallelArrayLoadThreshold)
         , m_clearContainers(settings.m_clearContainers)
     {
     }
 
+    JsonDeserializerContext::JsonDeserializerContext(JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting)
+        : JsonBaseContext(parent.m_metadata, AZStd::move(reporting),
+            StackedString::Format::JsonPointer, parent.m_serializeContext, parent.m_registrationContext)
+        , m_concurrentlyLoadableTypes(parent.m_concurrentlyLoadableTypes)
+        , m_clearContainers(parent.m_clearContainers)
+    {
+        m_path = parent.m_path;
+    }
+
     bool JsonDeserializerContext::ShouldClearContainers() const
     {
         return m_clearContainers;
     }
 
+    bool JsonDeserializerContext::ShouldLoadArrayInParallel(const Uuid& elementTypeId, size_t elementCount) const
+    {
+        return m_parallelArrayLoadThreshold > 0 && elementCount >= m_parallelArrayLoadThreshold &&
+            m_concurrentlyLoadableTypes->contains(elementTypeId);
+    }
+
 
 
     //
@@ -89,6 +89,10 @@ namespace AZ
     {
     public:
         explicit JsonDeserializerContext(JsonDeserializerSettings& settings);
+        //! Creates a context to load part of the value of the parent context on another thread. The new context shares the settings
+        //! and metadata of the parent, starts at the current path of the parent and reports to the provided callback. Parallel
+        //! loading is disabled for the new context so loads started from it don't wait on the task graph.
+        JsonDeserializerContext(JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting);
         ~JsonDeserializerContext() override = default;
 
         JsonDeserializerContext(const JsonDeserializerContext&) = delete;
@@ -101,7 +105,12 @@ namespace AZ
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool ShouldClearContainers() const;
 
+        //! Checks if an array with the given number of elements of the given type should be loaded in parallel.
+        bool ShouldLoadArrayInParallel(const Uuid& elementTypeId, size_t elementCount) const;
+
     private:
+        const AZStd::unordered_set<Uuid>* m_concurrentlyLoadableTypes = nullptr;
+        size_t m_parallelArrayLoadThreshold = 0;
         bool m_clearContainers = false;
     };
 
@@ -7,11 +7,15 @@
  */
 
 #include <limits>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
@@ -198,54 +202,67 @@ namespace AZ
             retVal.Combine(result);
         }
         rapidjson::SizeType arraySize = inputValue.Size();
-        for (rapidjson::SizeType i = 0; i < arraySize; ++i)
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (container->CanAccessElementsByIndex() && !container->IsFixedCapacity() &&
+            context.ShouldLoadArrayInParallel(classElement->m_typeId, arraySize) &&
+            taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
         {
-            ScopedContextPath subPath(context, i);
-
-            size_t expectedSize = container->Size(outputValue) + 1;
-
-            if (expectedSize > capacity)
-            {
-                retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
-                    "Unable to load more entries in basic container because it's full."));
-                break;
-            }
-
-            void* elementAddress = container->ReserveElement(outputValue, classElement);
-            if (!elementAddress)
+            if (!LoadElementsInParallel(retVal, outputValue, container, classElement, inputValue, context, flags))
             {
-                return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
-                    "Failed to allocate an item in the basic container.");
-            }
-            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
-            {
-                *reinterpret_cast<void**>(elementAddress) = nullptr;
-            }
-            
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
-            if (result.GetProcessing() == JSR::Processing::Halted)
-            {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
                 return context.Report(retVal, "Failed to read element for basic container.");
             }
-            else if (result.GetProcessing() == JSR::Processing::Altered)
-            {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
-                retVal.Combine(result);
-            }
-            else
+        }
+        else
+        {
+            for (rapidjson::SizeType i = 0; i < arraySize; ++i)
             {
-                container->StoreElement(outputValue, elementAddress);
-                if (container->Size(outputValue) != expectedSize)
+                ScopedContextPath subPath(context, i);
+
+                size_t expectedSize = container->Size(outputValue) + 1;
+
+                if (expectedSize > capacity)
                 {
-                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
-                        "Unable to store element to basic container."));
+                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
+                        "Unable to load more entries in basic container because it's full."));
+                    break;
                 }
-                else
+
+                void* elementAddress = container->ReserveElement(outputValue, classElement);
+                if (!elementAddress)
+                {
+                    return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                        "Failed to allocate an item in the basic container.");
+                }
+                if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+                {
+                    *reinterpret_cast<void**>(elementAddress) = nullptr;
+                }
+            
+                JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+                if (result.GetProcessing() == JSR::Processing::Halted)
                 {
+                    container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+                    return context.Report(retVal, "Failed to read element for basic container.");
+                }
+                else if (result.GetProcessing() == JSR::Processing::Altered)
+                {
+                    container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
                     retVal.Combine(result);
                 }
-            } 
+                else
+                {
+                    container->StoreElement(outputValue, elementAddress);
+                    if (container->Size(outputValue) != expectedSize)
+                    {
+                        retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                            "Unable to store element to basic container."));
+                    }
+                    else
+                    {
+                        retVal.Combine(result);
+                    }
+                } 
+            }
         }
 
         if (!retVal.HasDoneWork() && inputValue.Empty())
@@ -265,4 +282,192 @@ namespace AZ
             "Partially read data for basic container.";
         return context.Report(retVal, message);
     }
+
+    bool JsonBasicContainerSerializer::LoadElementsInParallel(JsonSerializationResult::ResultCode& retVal, void* outputValue,
+        SerializeContext::IDataContainer* container, const SerializeContext::ClassElement* classElement,
+        const rapidjson::Value& inputValue, JsonDeserializerContext& context, ContinuationFlags flags)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        struct ReportedIssue
+        {
+            AZStd::string m_message;
+            AZStd::string m_path;
+            JSR::ResultCode m_result;
+        };
+
+        struct ElementLoad
+        {
+            void* m_address{ nullptr };
+            JSR::ResultCode m_result{ JSR::Tasks::ReadField };
+            AZStd::vector<ReportedIssue> m_issues;
+        };
+
+        // Reserve all elements before loading any of them, because reserving may move the elements that are already in the container.
+        const size_t firstElementIndex = container->Size(outputValue);
+        const size_t elementCount = inputValue.Size();
+        AZStd::vector<ElementLoad> elements(elementCount);
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            if (!container->ReserveElement(outputValue, classElement))
+            {
+                for (size_t reserved = i; reserved > 0; --reserved)
+                {
+                    container->RemoveElement(outputValue,
+                        container->GetElementByIndex(outputValue, classElement, firstElementIndex + reserved - 1),
+                        context.GetSerializeContext());
+                }
+                retVal = context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                    "Failed to allocate an item in the basic container.");
+                return false;
+            }
+        }
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            elements[i].m_address = container->GetElementByIndex(outputValue, classElement, firstElementIndex + i);
+            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            {
+                *reinterpret_cast<void**>(elements[i].m_address) = nullptr;
+            }
+            // Create the instances that pointers point to before dispatching, so the tasks only fill them in instead of all of them
+            // allocating at the same time.
+            CreatePointee(elements[i].m_address, classElement, inputValue[static_cast<rapidjson::SizeType>(i)],
+                *context.GetSerializeContext());
+        }
+
+        auto loadRange = [this, &elements, &inputValue, &context, classElement, flags](size_t begin, size_t end)
+        {
+            // Issues are kept with the element they were reported for so they can be passed on in order once all elements are loaded.
+            ElementLoad* currentElement = nullptr;
+            JsonDeserializerContext rangeContext(context,
+                [&currentElement](AZStd::string_view message, JSR::ResultCode result, AZStd::string_view path) -> JSR::ResultCode
+                {
+                    currentElement->m_issues.push_back(ReportedIssue{ AZStd::string(message), AZStd::string(path), result });
+                    return result;
+                });
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                currentElement = &elements[i];
+                ScopedContextPath subPath(rangeContext, i);
+                currentElement->m_result = ContinueLoading(currentElement->m_address, classElement->m_typeId,
+                    inputValue[static_cast<rapidjson::SizeType>(i)], rangeContext, flags);
+            }
+        };
+
+        // Elements of the arrays this is used for usually take a similar amount of time to load, so fixed size batches balance well
+        // enough while keeping the task overhead low.
+        constexpr size_t ElementsPerTask = 32;
+
+        AZ::TaskGraph taskGraph;
+        AZ::TaskDescriptor loadDescriptor{ "JsonBasicContainerSerializer_LoadElements", "Serialization" };
+        for (size_t begin = 0; begin < elementCount; begin += ElementsPerTask)
+        {
+            const size_t end = AZStd::min(begin + ElementsPerTask, elementCount);
+            taskGraph.AddTask(loadDescriptor, [&loadRange, begin, end]()
+                {
+                    loadRange(begin, end);
+                });
+        }
+
+        AZ::TaskGraphEvent waitForCompletion;
+        taskGraph.Submit(&waitForCompletion);
+        waitForCompletion.Wait();
+
+        // Merge the results in element order so the reported issues and the final result don't depend on the order the tasks ran in.
+        const JSR::JsonIssueCallback& reporter = context.GetReporter();
+        AZStd::vector<size_t> discardedElements;
+        size_t haltedElement = elementCount;
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            for (const ReportedIssue& issue : elements[i].m_issues)
+            {
+                reporter(issue.m_message, issue.m_result, issue.m_path);
+            }
+
+            const JSR::ResultCode& result = elements[i].m_result;
+            if (result.GetProcessing() == JSR::Processing::Halted)
+            {
+                haltedElement = i;
+                break;
+            }
+            else if (result.GetProcessing() == JSR::Processing::Altered)
+            {
+                discardedElements.push_back(i);
+            }
+            retVal.Combine(result);
+        }
+
+        // Remove elements back to front so the addresses of the elements that still need to be removed stay valid.
+        for (size_t i = elementCount; i > haltedElement; --i)
+        {
+            container->RemoveElement(outputValue, elements[i - 1].m_address, context.GetSerializeContext());
+        }
+        for (auto it = discardedElements.rbegin(); it != discardedElements.rend(); ++it)
+        {
+            container->RemoveElement(outputValue, elements[*it].m_address, context.GetSerializeContext());
+        }
+
+        return haltedElement == elementCount;
+    }
+
+    void JsonBasicContainerSerializer::CreatePointee(void* elementAddress, const SerializeContext::ClassElement* classElement,
+        const rapidjson::Value& inputValue, SerializeContext& serializeContext)
+    {
+        // If the type is explicitly provided it may differ from the declared type, in which case the instance would be replaced
+        // anyway, so leave those to the regular pointer resolution.
+        if (!inputValue.IsObject() || inputValue.HasMember(JsonSerialization::TypeIdFieldIdentifier))
+        {
+            return;
+        }
+
+        SerializeContext::IDataContainer* smartPointer = nullptr;
+        const SerializeContext::ClassElement* pointeeElement = nullptr;
+        if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+        {
+            pointeeElement = classElement;
+        }
+        else
+        {
+            const SerializeContext::ClassData* elementClass = serializeContext.FindClassData(classElement->m_typeId);
+            if (!elementClass || !elementClass->m_container || !elementClass->m_container->IsSmartPointer())
+            {
+                return;
+            }
+            smartPointer = elementClass->m_container;
+            smartPointer->EnumTypes([&pointeeElement](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+                {
+                    pointeeElement = genericClassElement;
+                    return false;
+                });
+            if (!pointeeElement || smartPointer->Size(elementAddress) != 0)
+            {
+                return;
+            }
+        }
+
+        const SerializeContext::ClassData* pointeeClass = serializeContext.FindClassData(pointeeElement->m_typeId);
+        if (!pointeeClass || !pointeeClass->m_factory || (pointeeClass->m_azRtti && pointeeClass->m_azRtti->IsAbstract()))
+        {
+            return;
+        }
+
+        void* instance = pointeeClass->m_factory->Create("Json Serializer");
+        if (!instance)
+        {
+            return;
+        }
+        if (smartPointer)
+        {
+            // Same as the smart pointer serializer, store the instance through the container so smart pointers with reference
+            // counting set up their control block.
+            void* pointerAddress = smartPointer->ReserveElement(elementAddress, nullptr);
+            *reinterpret_cast<void**>(pointerAddress) = instance;
+            smartPointer->StoreElement(elementAddress, nullptr);
+        }
+        else
+        {
+            *reinterpret_cast<void**>(elementAddress) = instance;
+        }
+    }
 } // namespace AZ
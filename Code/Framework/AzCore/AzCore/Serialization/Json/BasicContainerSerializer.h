@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/SerializeContext.h>
 
 namespace AZ
 {
@@ -32,5 +33,14 @@ namespace AZ
     private:
         JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId, const rapidjson::Value& inputValue,
             JsonDeserializerContext& context);
+        //! Reserves an element for every entry in the array and loads them on the task graph. Returns false if loading was halted,
+        //! in which case the element that halted and all elements after it have been removed again.
+        bool LoadElementsInParallel(JsonSerializationResult::ResultCode& retVal, void* outputValue,
+            SerializeContext::IDataContainer* container, const SerializeContext::ClassElement* classElement,
+            const rapidjson::Value& inputValue, JsonDeserializerContext& context, ContinuationFlags flags);
+        //! Creates the instance a raw or smart pointer element points to if the json value for it is an object without an explicit
+        //! type, so loading the element only has to fill the instance in.
+        static void CreatePointee(void* elementAddress, const SerializeContext::ClassElement* classElement, const rapidjson::Value& inputValue,
+            SerializeContext& serializeContext);
     };
 } // namespace AZ
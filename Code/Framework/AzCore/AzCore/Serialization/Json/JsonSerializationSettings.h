@@ -10,6 +10,7 @@
 
 #include <AzCore/Serialization/Json/JsonSerializationMetadata.h>
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -36,6 +37,19 @@ namespace AZ
         //! any values in the container will be kept and not overwritten.
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool m_clearContainers = false;
+
+        //! Arrays with at least this many elements are loaded in parallel on the task graph if they're loaded into a container
+        //! with random access, such as AZStd::vector, and the element type is listed in m_concurrentlyLoadableTypes. A value of
+        //! 0 disables parallel loading. JsonSerializationUtils::ApplyParallelArrayLoadSettings fills this and
+        //! m_concurrentlyLoadableTypes in from the settings registry.
+        //! Issues for the elements are collected while loading and passed to the reporting callback in element order after all
+        //! elements have been loaded, so result codes returned by the callback for these issues don't change how elements are loaded.
+        size_t m_parallelArrayLoadThreshold = 0;
+        //! Types that can be loaded on multiple threads at the same time. This requires the json serializers and the SerializeContext
+        //! reflection for the type and all types it contains to be free of shared state, and to not read or write m_metadata.
+        //! For raw pointer elements the listed type is the type that's pointed to and for smart pointer elements it's the type of
+        //! the smart pointer. In both cases the listed type also has to cover the types the element can point to.
+        AZStd::unordered_set<Uuid> m_concurrentlyLoadableTypes;
     };
 
     //! Optional settings used while storing an object to a json value.
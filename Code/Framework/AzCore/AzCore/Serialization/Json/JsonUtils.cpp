@@ -20,6 +20,8 @@
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
 #include <AzCore/Utils/Utils.h>
 
 #include <AzCore/Serialization/Json/JsonUtils.h>
@@ -31,6 +33,8 @@ namespace AZ::JsonSerializationUtils
     static const char* VersionTag = "Version";
     static const char* ClassNameTag = "ClassName";
     static const char* ClassDataTag = "ClassData";
+    static constexpr AZStd::string_view ParallelArrayLoadThresholdKey = "/O3DE/AzCore/Serialization/Json/ParallelArrayLoadThreshold";
+    static constexpr AZStd::string_view ConcurrentlyLoadableTypesKey = "/O3DE/AzCore/Serialization/Json/ConcurrentlyLoadableTypes";
 
     AZ::Outcome<void, AZStd::string> WriteJsonString(const rapidjson::Document& document, AZStd::string& jsonText, WriteJsonSettings settings)
     {
@@ -201,9 +205,65 @@ namespace AZ::JsonSerializationUtils
 
         returnSettings.m_reporting = issueReportingCallback;
 
+        ApplyParallelArrayLoadSettings(returnSettings);
+
         return AZ::Success();
     }
 
+    void ApplyParallelArrayLoadSettings(JsonDeserializerSettings& settings)
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (!settingsRegistry || settings.m_parallelArrayLoadThreshold != 0)
+        {
+            return;
+        }
+
+        AZ::u64 threshold = 0;
+        if (!settingsRegistry->Get(threshold, ParallelArrayLoadThresholdKey) || threshold == 0)
+        {
+            return;
+        }
+        settings.m_parallelArrayLoadThreshold = aznumeric_cast<size_t>(threshold);
+
+        SerializeContext* serializeContext = settings.m_serializeContext;
+        if (!serializeContext)
+        {
+            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+        }
+
+        auto AddConcurrentlyLoadableType = [&settings, settingsRegistry, serializeContext]
+            (AZStd::string_view typePath, AZStd::string_view, AZ::SettingsRegistryInterface::Type)
+        {
+            AZ::SettingsRegistryInterface::FixedValueString typeName;
+            if (!settingsRegistry->Get(typeName, typePath))
+            {
+                return;
+            }
+
+            // Entries can either be a type id or the name of a reflected class.
+            AZ::Uuid typeId = AZ::Uuid::CreateStringSkipWarnings(typeName.c_str(), typeName.size(), true);
+            if (typeId.IsNull() && serializeContext)
+            {
+                AZStd::vector<AZ::Uuid> classIds = serializeContext->FindClassId(AZ::Crc32(typeName.c_str()));
+                if (classIds.size() == 1)
+                {
+                    typeId = classIds.front();
+                }
+            }
+
+            if (!typeId.IsNull())
+            {
+                settings.m_concurrentlyLoadableTypes.insert(typeId);
+            }
+            else
+            {
+                AZ_Warning("JSON Serialization", false, "Unable to find a unique type for '%s' in the concurrently loadable types at '%.*s'.",
+                    typeName.c_str(), AZ_STRING_ARG(typePath));
+            }
+        };
+        AZ::SettingsRegistryVisitorUtils::VisitArray(*settingsRegistry, AddConcurrentlyLoadableType, ConcurrentlyLoadableTypesKey);
+    }
+
 
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonString(AZStd::string_view jsonText)
     {
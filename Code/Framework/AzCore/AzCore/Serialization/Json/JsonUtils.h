@@ -118,6 +118,12 @@ namespace AZ
             return LoadObjectFromStream(objectToLoad, inputFileStream, settings);
         }
 
+        //! Fills in the parallel array load settings of the deserializer settings from the settings registry, unless the caller
+        //! already set a threshold. The threshold is read from "/O3DE/AzCore/Serialization/Json/ParallelArrayLoadThreshold" and the
+        //! element types from "/O3DE/AzCore/Serialization/Json/ConcurrentlyLoadableTypes", which is an array of type ids or names of
+        //! reflected classes. The load functions in this file apply this to the settings they're given.
+        void ApplyParallelArrayLoadSettings(JsonDeserializerSettings& settings);
+
         //! Load any object
         AZ::Outcome<AZStd::any, AZStd::string> LoadAnyObjectFromStream(IO::GenericStream& stream, const JsonDeserializerSettings* settings = nullptr);
         AZ::Outcome<AZStd::any, AZStd::string> LoadAnyObjectFromFile(const AZStd::string& filePath,const JsonDeserializerSettings* settings = nullptr);
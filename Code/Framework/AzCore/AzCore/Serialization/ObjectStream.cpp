@@ -19,6 +19,7 @@
 #include <AzCore/std/functional.h>
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/XML/rapidxml.h>
 #include <AzCore/XML/rapidxml_print.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -194,6 +195,39 @@ namespace AZ
             bool ConvertOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
             void PreparseOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
 
+            /// Layout of a class of which all elements are leaf values with a serializer that are stored in the class itself.
+            /// The binary data of such classes can be loaded without finding the class data of every element.
+            struct BinaryClassLayout
+            {
+                struct Field
+                {
+                    SerializeContext::IDataSerializer* m_serializer{ nullptr };
+                    Uuid m_typeId;
+                    size_t m_offset{ 0 };
+                    u32 m_nameCrc{ 0 };
+                    unsigned int m_version{ 0 };
+                    /// Position and size of the value of the field in m_block.
+                    size_t m_valueOffset{ 0 };
+                    size_t m_valueSize{ 0 };
+                };
+
+                AZStd::vector<Field> m_fields;
+                /// Binary image of the elements of the last instance that was parsed, up to and including the end tag of the class.
+                /// Instances of which all bytes outside of the field values match are read with a single read.
+                AZStd::vector<u8> m_block;
+                unsigned int m_version{ 0 };
+                bool m_isSupported{ false };
+            };
+
+            BinaryClassLayout& GetBinaryClassLayout(const SerializeContext::ClassData* classData);
+            /// Loads the elements of the class from the binary stream using its layout. Returns false without consuming any data
+            /// if the class isn't supported or the stream doesn't match the layout, in which case LoadClass needs to be used.
+            bool LoadBinaryClassFromLayout(const SerializeContext::ClassData* classData, void* classPtr, bool& result);
+            /// Reads the element headers of an instance from the stream, checks that they match the fields of the layout and
+            /// updates the block and the value locations of the layout.
+            bool ParseBinaryClassLayoutBlock(BinaryClassLayout& layout);
+            bool LoadBinaryClassLayoutFields(const SerializeContext::ClassData* classData, const BinaryClassLayout& layout, const u8* block, void* classPtr);
+
             int                                 m_flags;
             FilterDescriptor                    m_filterDesc;
             IO::GenericStream*              m_stream;
@@ -240,6 +274,10 @@ namespace AZ
             // completed successfully to make sure the equivalent amount
             // of CloseElements are called
             AZStd::vector<bool>                           m_writeElementResultStack;
+
+            // binary layouts of the classes loaded by this stream, by type id
+            AZStd::unordered_map<Uuid, BinaryClassLayout>  m_binaryClassLayouts;
+            AZStd::vector<u8>                               m_binaryClassLayoutScratch;
         };
 
         //=========================================================================
@@ -836,8 +874,15 @@ namespace AZ
                     classData->m_container->ClearElements(dataAddress, m_sc);
                 }
 
-                // Read child nodes
-                result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                // Read child nodes. Classes that only hold leaf values can be read directly from binary streams, as long as
+                // no version conversion is needed.
+                const bool canLoadFromBinaryLayout = GetType() == ST_BINARY && m_version == s_objectStreamVersion
+                    && !isConvertedData && convertedNode->m_classData == nullptr && dataAddress
+                    && element.m_version == classData->m_version && !classData->m_serializer && !classData->m_container;
+                if (!canLoadFromBinaryLayout || !LoadBinaryClassFromLayout(classData, dataAddress, result))
+                {
+                    result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                }
 
                 if (classContainer)
                 {
@@ -865,6 +910,246 @@ namespace AZ
             return result;
         }
 
+        //=========================================================================
+        // GetBinaryClassLayout
+        //=========================================================================
+        ObjectStreamImpl::BinaryClassLayout& ObjectStreamImpl::GetBinaryClassLayout(const SerializeContext::ClassData* classData)
+        {
+            auto [layoutIt, isNewLayout] = m_binaryClassLayouts.try_emplace(classData->m_typeId);
+            BinaryClassLayout& layout = layoutIt->second;
+            if (!isNewLayout && layout.m_version == classData->m_version)
+            {
+                return layout;
+            }
+
+            layout = {};
+            layout.m_version = classData->m_version;
+            if (classData->m_elements.empty() || classData->IsDeprecated() || classData->m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid())
+            {
+                return layout;
+            }
+
+            constexpr u32 unsupportedElementFlags = SerializeContext::ClassElement::FLG_POINTER | SerializeContext::ClassElement::FLG_BASE_CLASS
+                | SerializeContext::ClassElement::FLG_DYNAMIC_FIELD | SerializeContext::ClassElement::FLG_UI_ELEMENT;
+            for (const SerializeContext::ClassElement& classElement : classData->m_elements)
+            {
+                // Pointers, base classes and nested classes fall back to LoadClass, as do values that need special handling
+                // such as asset references or event handlers.
+                const SerializeContext::ClassData* fieldClassData = m_sc->FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+                const GenericClassInfo* genericClassInfo = m_sc->FindGenericClassInfo(classElement.m_typeId);
+                if ((classElement.m_flags & unsupportedElementFlags) || classElement.m_nameCrc == 0 || !fieldClassData
+                    || !fieldClassData->m_serializer || fieldClassData->m_container || fieldClassData->m_eventHandler
+                    || fieldClassData->IsDeprecated() || fieldClassData->m_typeId != classElement.m_typeId
+                    || (genericClassInfo && genericClassInfo->GetGenericTypeId() == GetAssetClassId()))
+                {
+                    layout.m_fields.clear();
+                    return layout;
+                }
+
+                BinaryClassLayout::Field& field = layout.m_fields.emplace_back();
+                field.m_serializer = fieldClassData->m_serializer.get();
+                field.m_typeId = fieldClassData->m_typeId;
+                field.m_offset = classElement.m_offset;
+                field.m_nameCrc = classElement.m_nameCrc;
+                field.m_version = fieldClassData->m_version;
+            }
+
+            layout.m_isSupported = true;
+            return layout;
+        }
+
+        //=========================================================================
+        // LoadBinaryClassFromLayout
+        //=========================================================================
+        bool ObjectStreamImpl::LoadBinaryClassFromLayout(const SerializeContext::ClassData* classData, void* classPtr, bool& result)
+        {
+            BinaryClassLayout& layout = GetBinaryClassLayout(classData);
+            if (!layout.m_isSupported)
+            {
+                return false;
+            }
+
+            const IO::SizeType startPos = m_stream->GetCurPos();
+            const size_t blockSize = layout.m_block.size();
+            if (blockSize > 0 && m_stream->GetLength() - startPos >= blockSize)
+            {
+                // Read the whole instance at once and check that everything but the values is identical to the last instance.
+                m_binaryClassLayoutScratch.resize_no_construct(blockSize);
+                if (m_stream->Read(blockSize, m_binaryClassLayoutScratch.data()) == blockSize)
+                {
+                    const u8* block = m_binaryClassLayoutScratch.data();
+                    bool isMatch = true;
+                    size_t position = 0;
+                    for (const BinaryClassLayout::Field& field : layout.m_fields)
+                    {
+                        if (memcmp(block + position, layout.m_block.data() + position, field.m_valueOffset - position) != 0)
+                        {
+                            isMatch = false;
+                            break;
+                        }
+                        position = field.m_valueOffset + field.m_valueSize;
+                    }
+                    isMatch = isMatch && memcmp(block + position, layout.m_block.data() + position, blockSize - position) == 0;
+
+                    if (isMatch)
+                    {
+                        result = LoadBinaryClassLayoutFields(classData, layout, block, classPtr) && result;
+                        return true;
+                    }
+                }
+                m_stream->Seek(startPos, IO::GenericStream::ST_SEEK_BEGIN);
+            }
+
+            if (!ParseBinaryClassLayoutBlock(layout))
+            {
+                m_stream->Seek(startPos, IO::GenericStream::ST_SEEK_BEGIN);
+                return false;
+            }
+
+            result = LoadBinaryClassLayoutFields(classData, layout, layout.m_block.data(), classPtr) && result;
+            return true;
+        }
+
+        //=========================================================================
+        // ParseBinaryClassLayoutBlock
+        //=========================================================================
+        bool ObjectStreamImpl::ParseBinaryClassLayoutBlock(BinaryClassLayout& layout)
+        {
+            const IO::SizeType startPos = m_stream->GetCurPos();
+            for (BinaryClassLayout::Field& field : layout.m_fields)
+            {
+                u8 flagsSize = 0;
+                if (m_stream->Read(sizeof(flagsSize), &flagsSize) != sizeof(flagsSize))
+                {
+                    return false;
+                }
+                const u8 expectedFlags = ST_BINARYFLAG_ELEMENT_HEADER | ST_BINARYFLAG_HAS_NAME | ST_BINARYFLAG_HAS_VALUE
+                    | (field.m_version ? ST_BINARYFLAG_HAS_VERSION : 0);
+                if ((flagsSize & (ST_BINARYFLAG_MASK & ~ST_BINARYFLAG_EXTRA_SIZE_FIELD)) != expectedFlags)
+                {
+                    return false;
+                }
+
+                u32 nameCrc = 0;
+                if (m_stream->Read(sizeof(nameCrc), &nameCrc) != sizeof(nameCrc))
+                {
+                    return false;
+                }
+                AZStd::endian_swap(nameCrc);
+                if (nameCrc != field.m_nameCrc)
+                {
+                    return false;
+                }
+
+                if (field.m_version)
+                {
+                    u8 version = 0;
+                    if (m_stream->Read(sizeof(version), &version) != sizeof(version) || version != field.m_version)
+                    {
+                        return false;
+                    }
+                }
+
+                Uuid typeId;
+                const IO::SizeType typeIdSize = typeId.end() - typeId.begin();
+                if (m_stream->Read(typeIdSize, typeId.begin()) != typeIdSize || typeId != field.m_typeId)
+                {
+                    return false;
+                }
+
+                size_t valueBytes = static_cast<size_t>(flagsSize & ST_BINARY_VALUE_SIZE_MASK);
+                if (flagsSize & ST_BINARYFLAG_EXTRA_SIZE_FIELD)
+                {
+                    switch (valueBytes)
+                    {
+                    case 1:
+                    {
+                        u8 size;
+                        if (m_stream->Read(sizeof(u8), &size) != sizeof(u8))
+                        {
+                            return false;
+                        }
+                        valueBytes = size;
+                        break;
+                    }
+                    case 2:
+                    {
+                        u16 size;
+                        if (m_stream->Read(sizeof(u16), &size) != sizeof(u16))
+                        {
+                            return false;
+                        }
+                        AZStd::endian_swap(size);
+                        valueBytes = size;
+                        break;
+                    }
+                    case 4:
+                    {
+                        u32 size;
+                        if (m_stream->Read(sizeof(u32), &size) != sizeof(u32))
+                        {
+                            return false;
+                        }
+                        AZStd::endian_swap(size);
+                        valueBytes = size;
+                        break;
+                    }
+                    default:
+                        return false;
+                    }
+                }
+
+                field.m_valueOffset = static_cast<size_t>(m_stream->GetCurPos() - startPos);
+                field.m_valueSize = valueBytes;
+                if (m_stream->GetLength() - m_stream->GetCurPos() < valueBytes)
+                {
+                    return false;
+                }
+                m_stream->Seek(valueBytes, IO::GenericStream::ST_SEEK_CUR);
+
+                // Leaf values don't have any child elements.
+                u8 endTag = 0;
+                if (m_stream->Read(sizeof(endTag), &endTag) != sizeof(endTag) || endTag != ST_BINARYFLAG_ELEMENT_END)
+                {
+                    return false;
+                }
+            }
+
+            // The class itself has to end after the last field.
+            u8 endTag = 0;
+            if (m_stream->Read(sizeof(endTag), &endTag) != sizeof(endTag) || endTag != ST_BINARYFLAG_ELEMENT_END)
+            {
+                return false;
+            }
+
+            const size_t blockSize = static_cast<size_t>(m_stream->GetCurPos() - startPos);
+            layout.m_block.resize_no_construct(blockSize);
+            m_stream->Seek(startPos, IO::GenericStream::ST_SEEK_BEGIN);
+            return m_stream->Read(blockSize, layout.m_block.data()) == blockSize;
+        }
+
+        //=========================================================================
+        // LoadBinaryClassLayoutFields
+        //=========================================================================
+        bool ObjectStreamImpl::LoadBinaryClassLayoutFields(
+            const SerializeContext::ClassData* classData, const BinaryClassLayout& layout, const u8* block, void* classPtr)
+        {
+            bool result = true;
+            for (const BinaryClassLayout::Field& field : layout.m_fields)
+            {
+                IO::MemoryStream valueStream(block + field.m_valueOffset, field.m_valueSize);
+                if (!field.m_serializer->Load(reinterpret_cast<char*>(classPtr) + field.m_offset, valueStream, field.m_version, true))
+                {
+                    AZStd::string error = AZStd::string::format("Serializer failed for element (0x%x) of class '%s'.  File %s",
+                        field.m_nameCrc, classData->m_name, GetStreamFilename());
+
+                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                    m_errorLogger.ReportError(error.c_str());
+                }
+            }
+            return result;
+        }
+
         ObjectStreamImpl::StorageAddressResult ObjectStreamImpl::GetElementStorageAddress(StorageAddressElement& storageElement, const SerializeContext::ClassElement* classElement, const SerializeContext::DataElement& dataElement,
             const SerializeContext::ClassData* dataElementClassData, void* parentClassPtr)
         {
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <Tests/Asset/MockLoadAssetCatalogAndHandler.h>
+
+#if defined(HAVE_BENCHMARK)
+
+namespace AZ::Data::AssetManagerBenchmarks
+{
+    // Emulates the asset manager traffic of loads running in parallel on several threads, where every root asset resolves a set
+    // of dependencies that are shared with the other roots, so the same asset ids are looked up from many threads at once.
+    class AssetManagerContentionBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t DependencyPoolSize = 1024;
+        static constexpr size_t DependenciesPerRoot = 16;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            if (st.thread_index == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+                InternalSetUp();
+            }
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            if (st.thread_index == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+                InternalSetUp();
+            }
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            if (st.thread_index == 0)
+            {
+                InternalTearDown();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+            }
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            if (st.thread_index == 0)
+            {
+                InternalTearDown();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+            }
+        }
+
+    protected:
+        void InternalSetUp()
+        {
+            AssetManager::Create(AssetManager::Descriptor());
+
+            AZStd::unordered_set<AssetId> ids;
+            m_dependencyIds.reserve(DependencyPoolSize);
+            for (size_t index = 0; index < DependencyPoolSize; ++index)
+            {
+                m_dependencyIds.emplace_back(Uuid::CreateRandom(), 0);
+                ids.insert(m_dependencyIds.back());
+            }
+
+            m_assetHandlerAndCatalog = aznew UnitTest::MockLoadAssetCatalogAndHandler(
+                ids, azrtti_typeid<UnitTest::EmptyAsset>(),
+                []() { return AssetPtr(aznew UnitTest::EmptyAsset()); },
+                [](AssetPtr asset) { delete asset; });
+        }
+
+        void InternalTearDown()
+        {
+            m_residentAssets = {};
+            delete m_assetHandlerAndCatalog;
+            m_assetHandlerAndCatalog = nullptr;
+            m_dependencyIds = {};
+            AssetManager::Destroy();
+        }
+
+        // Returns the dependencies of the root asset with the given index, which overlap with those of neighboring roots.
+        const AssetId& GetDependencyId(size_t rootIndex, size_t dependencyIndex) const
+        {
+            return m_dependencyIds[(rootIndex * (DependenciesPerRoot / 2) + dependencyIndex) % DependencyPoolSize];
+        }
+
+        AZStd::vector<AssetId> m_dependencyIds;
+        AZStd::vector<Asset<AssetData>> m_residentAssets;
+        UnitTest::MockLoadAssetCatalogAndHandler* m_assetHandlerAndCatalog = nullptr;
+    };
+
+    // All dependencies are already resident, so every thread only looks them up. This is the case for most dependency
+    // references once a level has loaded.
+    BENCHMARK_DEFINE_F(AssetManagerContentionBenchmarkFixture, FindResidentDependencies)(::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            m_residentAssets.reserve(DependencyPoolSize);
+            for (const AssetId& assetId : m_dependencyIds)
+            {
+                m_residentAssets.push_back(AssetManager::Instance().FindOrCreateAsset(
+                    assetId, azrtti_typeid<UnitTest::EmptyAsset>(), AssetLoadBehavior::Default));
+            }
+        }
+
+        size_t rootIndex = state.thread_index;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t dependencyIndex = 0; dependencyIndex < DependenciesPerRoot; ++dependencyIndex)
+            {
+                Asset<AssetData> asset =
+                    AssetManager::Instance().FindAsset(GetDependencyId(rootIndex, dependencyIndex), AssetLoadBehavior::Default);
+                ::benchmark::DoNotOptimize(asset.Get());
+            }
+            rootIndex += state.threads;
+        }
+
+        state.SetItemsProcessed(state.iterations() * DependenciesPerRoot);
+    }
+    BENCHMARK_REGISTER_F(AssetManagerContentionBenchmarkFixture, FindResidentDependencies)->ThreadRange(1, 8)->UseRealTime();
+
+    // Dependencies are created by whichever thread reaches them first and released once the root is done with them, so lookups
+    // run concurrently with asset creation and destruction.
+    BENCHMARK_DEFINE_F(AssetManagerContentionBenchmarkFixture, FindOrCreateSharedDependencies)(::benchmark::State& state)
+    {
+        AZStd::vector<Asset<AssetData>> dependencies;
+        dependencies.reserve(DependenciesPerRoot);
+
+        size_t rootIndex = state.thread_index;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t dependencyIndex = 0; dependencyIndex < DependenciesPerRoot; ++dependencyIndex)
+            {
+                const AssetId& assetId = GetDependencyId(rootIndex, dependencyIndex);
+                Asset<AssetData> asset = AssetManager::Instance().FindAsset(assetId, AssetLoadBehavior::Default);
+                if (!asset)
+                {
+                    asset = AssetManager::Instance().FindOrCreateAsset(
+                        assetId, azrtti_typeid<UnitTest::EmptyAsset>(), AssetLoadBehavior::Default);
+                }
+                dependencies.push_back(AZStd::move(asset));
+            }
+            dependencies.clear();
+            rootIndex += state.threads;
+        }
+
+        state.SetItemsProcessed(state.iterations() * DependenciesPerRoot);
+    }
+    BENCHMARK_REGISTER_F(AssetManagerContentionBenchmarkFixture, FindOrCreateSharedDependencies)->ThreadRange(1, 8)->UseRealTime();
+} // namespace AZ::Data::AssetManagerBenchmarks
+
+#endif // defined(HAVE_BENCHMARK)
@@ -14,6 +14,7 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Outcome/Outcome.h>
@@ -327,6 +328,65 @@ namespace UnitTest
         }
     }
 
+    // Records the priority of the job that processes the streamed asset data.
+    class MockLoadAssetRecordingJobPriorityCatalogAndHandler
+        : public MockLoadAssetWithNonZeroSizeCatalogAndHandler
+    {
+    public:
+        using MockLoadAssetWithNonZeroSizeCatalogAndHandler::MockLoadAssetWithNonZeroSizeCatalogAndHandler;
+
+        LoadResult LoadAssetData([[maybe_unused]] const AZ::Data::Asset<AZ::Data::AssetData>& asset,
+            [[maybe_unused]] AZStd::shared_ptr<AZ::Data::AssetDataStream> stream,
+            [[maybe_unused]] const AZ::Data::AssetFilterCB& assetLoadFilterCB) override
+        {
+            Job* currentJob = JobContext::GetGlobalContext()->GetJobManager().GetCurrentJob();
+            m_loadedInJob = (currentJob != nullptr);
+            m_loadJobPriority = currentJob ? currentJob->GetPriority() : 0;
+            return LoadResult::LoadComplete;
+        }
+
+        bool m_loadedInJob{ false };
+        AZ::s8 m_loadJobPriority{ 0 };
+    };
+
+    TEST_F(AssetManagerStreamerTests, LoadJobPriority_FollowsEscalatedStreamingPriority)
+    {
+        UnitTest::MockLoadAssetRecordingJobPriorityCatalogAndHandler testAssetCatalog(
+            { MyAsset1Id },
+            azrtti_typeid<EmptyAsset>(),
+            []() { return AssetPtr(aznew EmptyAsset()); },
+            [](AssetPtr ptr) { delete ptr; }
+            );
+
+        {
+            // Start the load as background content, then request it again for something that needs it urgently.
+            AssetLoadParameters loadParams;
+            loadParams.m_priority = AZ::IO::IStreamerTypes::s_priorityLow;
+            AZ::Data::Asset<EmptyAsset> asset1 =
+                AssetManager::Instance().GetAsset<EmptyAsset>(MyAsset1Id, AZ::Data::AssetLoadBehavior::Default, loadParams);
+            ASSERT_TRUE(asset1);
+            EXPECT_EQ(m_mockStreamer->m_priority, AZ::IO::IStreamerTypes::s_priorityLow);
+
+            loadParams.m_priority = AZ::IO::IStreamerTypes::s_priorityHighest;
+            asset1 = AssetManager::Instance().GetAsset<EmptyAsset>(MyAsset1Id, AZ::Data::AssetLoadBehavior::Default, loadParams);
+            ASSERT_TRUE(asset1);
+            EXPECT_EQ(m_mockStreamer->m_priority, AZ::IO::IStreamerTypes::s_priorityHighest);
+
+            // Complete the streaming request so that the loaded data gets processed on a job.
+            m_mockStreamer->m_callback(m_mockStreamer->m_request);
+            asset1.BlockUntilLoadComplete();
+
+            // The job that processed the data should run ahead of default priority jobs, since the streaming priority was escalated.
+            EXPECT_TRUE(testAssetCatalog.m_loadedInJob);
+            EXPECT_GT(testAssetCatalog.m_loadJobPriority, 0);
+
+            AssetManager::Instance().DispatchEvents();
+
+            m_mockStreamer->m_callback = nullptr;
+            m_mockStreamer->m_request = nullptr;
+        }
+    }
+
     // The AssetManagerStreamerImmediateCompletionTests class adjusts the asset loading to force it to complete immediately,
     // while still within the callstack for GetAsset().  This can be used to test various conditions in which the load thread
     // completes more rapidly than expected, and can expose subtle race conditions.
@@ -38,7 +38,7 @@ namespace UnitTest
     */
     AZ::Data::AssetData::AssetStatus TestAssetManager::GetReloadStatus(const AssetId& assetId)
     {
-        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AZStd::lock_guard<AZStd::recursive_mutex> reloadLock(m_reloadMutex);
 
         auto reloadInfo = m_reloads.find(assetId);
         if (reloadInfo != m_reloads.end())
@@ -58,9 +58,15 @@ namespace UnitTest
         return m_ownedAssetContainers;
     }
 
-    const AssetManager::AssetMap& TestAssetManager::GetAssets() const
+    AssetManager::AssetMap TestAssetManager::GetAssets()
     {
-        return m_assets;
+        AssetMap assets;
+        for (AssetMapShard& shard : m_assetMapShards)
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+            assets.insert(shard.m_assets.begin(), shard.m_assets.end());
+        }
+        return assets;
     }
 
     void BaseAssetManagerTest::SetUp()
@@ -40,7 +40,8 @@ namespace UnitTest
 
         const AZ::Data::AssetManager::OwnedAssetContainerMap& GetAssetContainers() const;
 
-        const AssetMap& GetAssets() const;
+        // Get a copy of all registered assets
+        AssetMap GetAssets();
 
         // Expose these methods so that they can be queried by the unit tests.
         using AssetManager::GetAssetInternal;
@@ -790,7 +790,7 @@ namespace UnitTest
 
         AssetManager::Instance().DispatchEvents();
 
-        auto&& assets = m_testAssetManager->GetAssets();
+        auto assets = m_testAssetManager->GetAssets();
 
         EXPECT_EQ(assets.size(), 1);
         EXPECT_NE(assets.find(MyAsset1Id), assets.end());
@@ -799,12 +799,12 @@ namespace UnitTest
         
         // Sleep to allow for the assets to release
         int retryCount = 100;
-        while ((--retryCount>0) && assets.size() > 0)
+        while ((--retryCount>0) && m_testAssetManager->GetAssets().size() > 0)
         {
             AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
         }
 
-        EXPECT_EQ(assets.size(), 0);
+        EXPECT_EQ(m_testAssetManager->GetAssets().size(), 0);
     }
 
     TEST_F(AssetManagerTest, AssetManager_SuspendResumeAssetRelease_ReusedAssetIsNotReleased)
@@ -820,11 +820,30 @@ namespace UnitTest
 
         asset = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset1Id, AssetLoadBehavior::Default);
 
-        auto&& assets = m_testAssetManager->GetAssets();
-
         AssetManager::Instance().ResumeAssetRelease();
 
+        auto assets = m_testAssetManager->GetAssets();
         EXPECT_EQ(assets.size(), 1);
         EXPECT_NE(assets.find(MyAsset1Id), assets.end());
     }
+
+#if !defined(_RELEASE)
+    TEST_F(AssetManagerTest, FindOrCreateAsset_LegacyId_RegistersAssetUnderCanonicalId)
+    {
+        const AssetId legacyId(Uuid("{6F2E4B1A-93C7-4D58-A0E2-7B3D1C9F8E46}"), 0);
+        const AssetId canonicalId(MyAsset1Id, 0);
+        m_assetHandlerAndCatalog->m_legacyAssetIds[legacyId] = canonicalId;
+
+        // Lookups through either id find the same asset, which is only registered once.
+        auto asset = AssetManager::Instance().FindOrCreateAsset<AssetWithCustomData>(legacyId, AssetLoadBehavior::Default);
+        ASSERT_TRUE(asset);
+        EXPECT_EQ(asset.GetId(), canonicalId);
+        EXPECT_EQ(AssetManager::Instance().FindOrCreateAsset<AssetWithCustomData>(legacyId, AssetLoadBehavior::Default).Get(), asset.Get());
+        EXPECT_EQ(AssetManager::Instance().FindAsset<AssetWithCustomData>(canonicalId, AssetLoadBehavior::Default).Get(), asset.Get());
+
+        auto assets = m_testAssetManager->GetAssets();
+        EXPECT_EQ(assets.size(), 1);
+        EXPECT_NE(assets.find(canonicalId), assets.end());
+    }
+#endif
 }
@@ -1055,6 +1055,150 @@ namespace UnitTest
         EXPECT_EQ(Entity::DependencySortResult::HasIncompatibleServices, m_entity->EvaluateDependencies());
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // Batch activation - a component that activates through its descriptor's ActivateBatch and one that requires it
+    class BatchActivatedComponent
+        : public Component
+    {
+    public:
+        AZ_COMPONENT(BatchActivatedComponent, "{5C0E3B7A-8F24-4D19-9A6E-1B7D2C4F8E53}");
+
+        void Activate() override { m_isActive = true; }
+        void Deactivate() override { m_isActive = false; }
+
+        static void ActivateBatch(AZStd::span<Component* const> components)
+        {
+            s_batchSizes.push_back(components.size());
+            for (Component* component : components)
+            {
+                static_cast<BatchActivatedComponent*>(component)->Activate();
+            }
+        }
+
+        static void GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided) { provided.push_back(AZ_CRC("BatchService")); }
+        static void Reflect(ReflectContext* /*reflection*/) {}
+
+        bool m_isActive = false;
+        static AZStd::vector<size_t> s_batchSizes;
+    };
+    AZStd::vector<size_t> BatchActivatedComponent::s_batchSizes;
+
+    class BatchServiceUserComponent
+        : public Component
+    {
+    public:
+        AZ_COMPONENT(BatchServiceUserComponent, "{A3D8F1C6-2E57-4B90-8C1F-6D4E9B2A7F05}");
+
+        void Activate() override
+        {
+            BatchActivatedComponent* batchComponent = GetEntity()->FindComponent<BatchActivatedComponent>();
+            m_requiredServiceWasActive = batchComponent && batchComponent->m_isActive;
+        }
+        void Deactivate() override {}
+
+        static void GetRequiredServices(ComponentDescriptor::DependencyArrayType& required) { required.push_back(AZ_CRC("BatchService")); }
+        static void Reflect(ReflectContext* /*reflection*/) {}
+
+        bool m_requiredServiceWasActive = false;
+    };
+    //////////////////////////////////////////////////////////////////////////
+
+    class ComponentBatchActivation
+        : public ComponentDependency
+    {
+    protected:
+        void SetUp() override
+        {
+            aznew BatchActivatedComponent::DescriptorType;
+            aznew BatchServiceUserComponent::DescriptorType;
+            BatchActivatedComponent::s_batchSizes.clear();
+
+            ComponentDependency::SetUp();
+        }
+
+        void TearDown() override
+        {
+            for (Entity* entity : m_entities)
+            {
+                delete entity;
+            }
+            m_entities = {};
+            BatchActivatedComponent::s_batchSizes = {};
+
+            ComponentDependency::TearDown();
+        }
+
+        AZStd::vector<Entity*> m_entities;
+    };
+
+    TEST_F(ComponentBatchActivation, ActivateEntities_SameComponentTypes_ActivatedThroughOneBatchInDependencyOrder)
+    {
+        constexpr size_t entityCount = 4;
+        for (size_t i = 0; i < entityCount; ++i)
+        {
+            Entity* entity = m_entities.emplace_back(aznew Entity());
+            // Added in reverse dependency order so the components need to be sorted first.
+            entity->CreateComponent<BatchServiceUserComponent>();
+            entity->CreateComponent<BatchActivatedComponent>();
+        }
+        // An entity with a different set of components ends up in its own group, which is too small to batch.
+        m_entities.emplace_back(aznew Entity())->CreateComponent<BatchActivatedComponent>();
+
+        // The progress callback is called once per group.
+        int progressCount = 0;
+        auto progressCallback = [&progressCount]()
+        {
+            ++progressCount;
+        };
+
+        Entity::InitEntities(m_entities, progressCallback);
+        EXPECT_EQ(2, progressCount);
+        for (Entity* entity : m_entities)
+        {
+            EXPECT_EQ(Entity::State::Init, entity->GetState());
+        }
+
+        Entity::ActivateEntities(m_entities, progressCallback);
+        EXPECT_EQ(4, progressCount);
+
+        ASSERT_EQ(1u, BatchActivatedComponent::s_batchSizes.size());
+        EXPECT_EQ(entityCount, BatchActivatedComponent::s_batchSizes[0]);
+        for (Entity* entity : m_entities)
+        {
+            EXPECT_EQ(Entity::State::Active, entity->GetState());
+            EXPECT_TRUE(entity->FindComponent<BatchActivatedComponent>()->m_isActive);
+            if (BatchServiceUserComponent* user = entity->FindComponent<BatchServiceUserComponent>())
+            {
+                EXPECT_TRUE(user->m_requiredServiceWasActive);
+            }
+        }
+
+        for (Entity* entity : m_entities)
+        {
+            entity->Deactivate();
+        }
+    }
+
+    TEST_F(ComponentBatchActivation, ActivateEntities_MissingRequiredService_OnlyValidEntitiesActivated)
+    {
+        Entity* validEntity = m_entities.emplace_back(aznew Entity());
+        validEntity->CreateComponent<BatchActivatedComponent>();
+        validEntity->CreateComponent<BatchServiceUserComponent>();
+        Entity* invalidEntity = m_entities.emplace_back(aznew Entity());
+        invalidEntity->CreateComponent<BatchServiceUserComponent>();
+
+        Entity::InitEntities(m_entities);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        Entity::ActivateEntities(m_entities);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_EQ(Entity::State::Active, validEntity->GetState());
+        EXPECT_EQ(Entity::State::Init, invalidEntity->GetState());
+
+        validEntity->Deactivate();
+    }
+
     /**
      * UserSettingsComponent test
      */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Budget.h>
+#include <AzCore/Debug/BudgetTracker.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::Debug
+{
+    class BudgetTrackerTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        inline static constexpr const char* BudgetName = "BudgetTrackerTestBudget";
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+            m_tracker = AZStd::make_unique<BudgetTracker>();
+            ASSERT_TRUE(m_tracker->Init());
+            m_tracker->GetBudget(m_budget, BudgetName, Crc32(BudgetName));
+            ASSERT_NE(nullptr, m_budget);
+        }
+
+        void TearDown() override
+        {
+            m_tracker.reset();
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void RunRegion(AZStd::chrono::milliseconds duration)
+        {
+            m_budget->BeginProfileRegion();
+            AZStd::this_thread::sleep_for(duration);
+            m_budget->EndProfileRegion();
+        }
+
+    protected:
+        AZStd::unique_ptr<BudgetTracker> m_tracker;
+        Budget* m_budget = nullptr;
+    };
+
+    TEST_F(BudgetTrackerTest, EndFrame_AccountingDisabled_NothingRecorded)
+    {
+        RunRegion(AZStd::chrono::milliseconds(1));
+        m_tracker->EndFrame();
+
+        EXPECT_TRUE(m_tracker->GetFrameHistory().empty());
+    }
+
+    TEST_F(BudgetTrackerTest, EndFrame_AccountingEnabled_RegionTimeRecordedForFrame)
+    {
+        m_tracker->SetAccountingEnabled(true);
+        EXPECT_TRUE(m_budget->IsAccountingEnabled());
+
+        RunRegion(AZStd::chrono::milliseconds(2));
+        m_tracker->EndFrame();
+        m_tracker->EndFrame();
+
+        AZStd::vector<BudgetFrameRecord> history = m_tracker->GetFrameHistory();
+        ASSERT_EQ(2u, history.size());
+        ASSERT_EQ(1u, history[0].m_samples.size());
+        EXPECT_STREQ(BudgetName, history[0].m_samples[0].m_budgetName);
+        EXPECT_GE(history[0].m_samples[0].m_timeUs, 2000u);
+        // The budget didn't run in the second frame.
+        EXPECT_EQ(history[0].m_frameIndex + 1, history[1].m_frameIndex);
+        EXPECT_TRUE(history[1].m_samples.empty());
+    }
+
+    TEST_F(BudgetTrackerTest, EndFrame_NestedRegions_OnlyOutermostRegionCounted)
+    {
+        m_tracker->SetAccountingEnabled(true);
+
+        m_budget->BeginProfileRegion();
+        RunRegion(AZStd::chrono::milliseconds(20));
+        m_budget->EndProfileRegion();
+        m_tracker->EndFrame();
+
+        AZStd::vector<BudgetFrameRecord> history = m_tracker->GetFrameHistory();
+        ASSERT_EQ(1u, history.size());
+        ASSERT_EQ(1u, history[0].m_samples.size());
+        EXPECT_GE(history[0].m_samples[0].m_timeUs, 20000u);
+        EXPECT_LT(history[0].m_samples[0].m_timeUs, 40000u);
+    }
+
+    TEST_F(BudgetTrackerTest, EndFrame_OverlappingRegionsOfDifferentBudgets_BothRegionsCounted)
+    {
+        Budget* otherBudget = nullptr;
+        m_tracker->GetBudget(otherBudget, "BudgetTrackerTestOtherBudget", Crc32("BudgetTrackerTestOtherBudget"));
+        ASSERT_NE(nullptr, otherBudget);
+        m_tracker->SetAccountingEnabled(true);
+
+        // The first region ends while the region of the other budget that was opened after it is still open.
+        m_budget->BeginProfileRegion();
+        otherBudget->BeginProfileRegion();
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(2));
+        m_budget->EndProfileRegion();
+        otherBudget->EndProfileRegion();
+        m_tracker->EndFrame();
+
+        AZStd::vector<BudgetFrameRecord> history = m_tracker->GetFrameHistory();
+        ASSERT_EQ(1u, history.size());
+        ASSERT_EQ(2u, history[0].m_samples.size());
+        EXPECT_GE(history[0].m_samples[0].m_timeUs, 2000u);
+        EXPECT_GE(history[0].m_samples[1].m_timeUs, 2000u);
+    }
+
+    TEST_F(BudgetTrackerTest, EndFrame_AccountingDisabledDuringRegion_LaterRegionsCounted)
+    {
+        m_tracker->SetAccountingEnabled(true);
+        m_budget->BeginProfileRegion();
+        m_tracker->SetAccountingEnabled(false);
+        m_budget->EndProfileRegion();
+
+        // The region that was open when accounting was disabled doesn't hide the time of regions after it is enabled again.
+        m_tracker->SetAccountingEnabled(true);
+        RunRegion(AZStd::chrono::milliseconds(2));
+        m_tracker->EndFrame();
+
+        AZStd::vector<BudgetFrameRecord> history = m_tracker->GetFrameHistory();
+        ASSERT_EQ(1u, history.size());
+        ASSERT_EQ(1u, history[0].m_samples.size());
+        EXPECT_GE(history[0].m_samples[0].m_timeUs, 2000u);
+    }
+
+    TEST_F(BudgetTrackerTest, GetFrameHistory_MoreFramesThanHistorySize_KeepsMostRecentFramesInOrder)
+    {
+        m_tracker->SetAccountingEnabled(true);
+
+        constexpr size_t frameCount = BudgetTracker::DefaultHistoryFrameCount + 5;
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            m_tracker->EndFrame();
+        }
+
+        AZStd::vector<BudgetFrameRecord> history = m_tracker->GetFrameHistory();
+        ASSERT_EQ(BudgetTracker::DefaultHistoryFrameCount, history.size());
+        for (size_t i = 0; i < history.size(); ++i)
+        {
+            EXPECT_EQ(frameCount - BudgetTracker::DefaultHistoryFrameCount + i, history[i].m_frameIndex);
+        }
+    }
+
+    TEST_F(BudgetTrackerTest, EndFrame_OverFrameTimeLimit_SampleReportsLimit)
+    {
+        m_tracker->SetAccountingEnabled(true);
+        m_budget->SetFrameTimeLimitUs(500);
+
+        RunRegion(AZStd::chrono::milliseconds(2));
+        m_tracker->EndFrame();
+
+        AZStd::vector<BudgetFrameRecord> history = m_tracker->GetFrameHistory();
+        ASSERT_EQ(1u, history.size());
+        ASSERT_EQ(1u, history[0].m_samples.size());
+        EXPECT_EQ(500u, history[0].m_samples[0].m_limitUs);
+        EXPECT_GT(history[0].m_samples[0].m_timeUs, history[0].m_samples[0].m_limitUs);
+    }
+} // namespace AZ::Debug
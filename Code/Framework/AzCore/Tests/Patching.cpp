@@ -888,6 +888,100 @@ namespace UnitTest
             }
         }
 
+        TEST_F(PatchingTest, PatchArray_EditObjects_ApplyToMultipleSources_DataPatchAppliesCorrectly)
+        {
+            ObjectToPatch sourceObj;
+            sourceObj.m_intValue = 1;
+            sourceObj.m_objectArray.resize(8);
+
+            ObjectToPatch targetObj;
+            targetObj.m_intValue = 2;
+            targetObj.m_objectArray.resize(8);
+
+            for (size_t i = 0; i < sourceObj.m_objectArray.size(); ++i)
+            {
+                sourceObj.m_objectArray[i].m_persistentId = static_cast<int>(i + 10);
+                sourceObj.m_objectArray[i].m_data = static_cast<int>(i + 200);
+
+                targetObj.m_objectArray[i].m_persistentId = sourceObj.m_objectArray[i].m_persistentId;
+                targetObj.m_objectArray[i].m_data = (i % 2 == 0) ? sourceObj.m_objectArray[i].m_data + 100 : sourceObj.m_objectArray[i].m_data;
+            }
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+
+            // The first application compiles the patch, later ones reuse it.
+            for (int applyCount = 0; applyCount < 3; ++applyCount)
+            {
+                AZStd::unique_ptr<ObjectToPatch> generatedObj(patch.Apply(&sourceObj, m_serializeContext.get()));
+                ASSERT_TRUE(generatedObj);
+                EXPECT_EQ(targetObj.m_intValue, generatedObj->m_intValue);
+                ASSERT_EQ(targetObj.m_objectArray.size(), generatedObj->m_objectArray.size());
+                for (size_t i = 0; i < generatedObj->m_objectArray.size(); ++i)
+                {
+                    EXPECT_EQ(targetObj.m_objectArray[i].m_persistentId, generatedObj->m_objectArray[i].m_persistentId);
+                    EXPECT_EQ(targetObj.m_objectArray[i].m_data, generatedObj->m_objectArray[i].m_data);
+                }
+            }
+
+            // Elements are matched by persistent id, not by their position in the source.
+            ObjectToPatch reversedSourceObj;
+            reversedSourceObj.m_intValue = sourceObj.m_intValue;
+            reversedSourceObj.m_objectArray.assign(sourceObj.m_objectArray.rbegin(), sourceObj.m_objectArray.rend());
+
+            AZStd::unique_ptr<ObjectToPatch> reversedObj(patch.Apply(&reversedSourceObj, m_serializeContext.get()));
+            ASSERT_TRUE(reversedObj);
+            ASSERT_EQ(targetObj.m_objectArray.size(), reversedObj->m_objectArray.size());
+            for (size_t i = 0; i < reversedObj->m_objectArray.size(); ++i)
+            {
+                const ContainedObjectPersistentId& expected = targetObj.m_objectArray[targetObj.m_objectArray.size() - i - 1];
+                EXPECT_EQ(expected.m_persistentId, reversedObj->m_objectArray[i].m_persistentId);
+                EXPECT_EQ(expected.m_data, reversedObj->m_objectArray[i].m_data);
+            }
+        }
+
+        TEST_F(PatchingTest, PatchArray_EditObjects_SourceMissingEditedObject_DataPatchAppliesCorrectly)
+        {
+            ObjectToPatch sourceObj;
+            sourceObj.m_intValue = 1;
+            sourceObj.m_objectArray.resize(3);
+            for (size_t i = 0; i < sourceObj.m_objectArray.size(); ++i)
+            {
+                sourceObj.m_objectArray[i].m_persistentId = static_cast<int>(i + 1);
+                sourceObj.m_objectArray[i].m_data = static_cast<int>(i + 200);
+            }
+
+            ObjectToPatch targetObj;
+            targetObj.m_intValue = 2;
+            targetObj.m_objectArray.resize(3);
+            for (size_t i = 0; i < targetObj.m_objectArray.size(); ++i)
+            {
+                targetObj.m_objectArray[i].m_persistentId = sourceObj.m_objectArray[i].m_persistentId;
+                targetObj.m_objectArray[i].m_data = sourceObj.m_objectArray[i].m_data + 100;
+            }
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+            AZStd::unique_ptr<ObjectToPatch> generatedObj(patch.Apply(&sourceObj, m_serializeContext.get()));
+            ASSERT_TRUE(generatedObj);
+
+            // Apply the same patch to a source that no longer has the object with persistent id 2. Edits to objects that aren't in
+            // the source are dropped, everything else is still patched.
+            ObjectToPatch changedSourceObj;
+            changedSourceObj.m_intValue = sourceObj.m_intValue;
+            changedSourceObj.m_objectArray.push_back(sourceObj.m_objectArray[0]);
+            changedSourceObj.m_objectArray.push_back(sourceObj.m_objectArray[2]);
+
+            AZStd::unique_ptr<ObjectToPatch> changedObj(patch.Apply(&changedSourceObj, m_serializeContext.get()));
+            ASSERT_TRUE(changedObj);
+            EXPECT_EQ(targetObj.m_intValue, changedObj->m_intValue);
+            ASSERT_EQ(2u, changedObj->m_objectArray.size());
+            EXPECT_EQ(1u, changedObj->m_objectArray[0].m_persistentId);
+            EXPECT_EQ(targetObj.m_objectArray[0].m_data, changedObj->m_objectArray[0].m_data);
+            EXPECT_EQ(3u, changedObj->m_objectArray[1].m_persistentId);
+            EXPECT_EQ(targetObj.m_objectArray[2].m_data, changedObj->m_objectArray[1].m_data);
+        }
+
         TEST_F(PatchingTest, PatchArray_AddRemoveEdit_DataPatchAppliesCorrectly)
         {
             // Init Source
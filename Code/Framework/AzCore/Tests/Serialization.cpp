@@ -763,6 +763,52 @@ namespace SerializeTestClasses {
 
         int m_field = 0;
     };
+
+    // Only holds leaf values, so binary object streams can load it through a cached layout.
+    struct LeafValuesType
+    {
+        AZ_TYPE_INFO(LeafValuesType, "{4E7A3C21-9D0B-4F8E-A6C5-2B1D8E3F7A90}");
+        AZ_CLASS_ALLOCATOR(LeafValuesType, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& sc)
+        {
+            sc.Class<LeafValuesType>()
+                ->Version(2)
+                ->Field("id", &LeafValuesType::m_id)
+                ->Field("weight", &LeafValuesType::m_weight)
+                ->Field("name", &LeafValuesType::m_name)
+                ->Field("enabled", &LeafValuesType::m_enabled);
+        }
+
+        bool operator==(const LeafValuesType& rhs) const
+        {
+            return m_id == rhs.m_id && m_weight == rhs.m_weight && m_name == rhs.m_name && m_enabled == rhs.m_enabled;
+        }
+
+        AZ::u32 m_id = 0;
+        float m_weight = 0.0f;
+        AZStd::string m_name;
+        bool m_enabled = false;
+    };
+
+    struct LeafValuesContainerType
+    {
+        AZ_TYPE_INFO(LeafValuesContainerType, "{A1C9E5F3-7B2D-4C8A-9E6F-0D3B5A7C9E12}");
+        AZ_CLASS_ALLOCATOR(LeafValuesContainerType, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& sc)
+        {
+            LeafValuesType::Reflect(sc);
+            sc.Class<LeafValuesContainerType>()
+                ->Field("values", &LeafValuesContainerType::m_values)
+                ->Field("single", &LeafValuesContainerType::m_single)
+                ->Field("count", &LeafValuesContainerType::m_count);
+        }
+
+        AZStd::vector<LeafValuesType> m_values;
+        LeafValuesType m_single;
+        AZ::u64 m_count = 0;
+    };
 } //SerializeTestClasses
 
 namespace AZ
@@ -1954,6 +2000,77 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
             TestLoad(&stream);
         }
     }
+    TEST_F(Serialization, BinaryClassLayout_LeafValueClasses_RoundTrip)
+    {
+        LeafValuesContainerType::Reflect(*m_serializeContext);
+
+        LeafValuesContainerType source;
+        for (AZ::u32 index = 0; index < 64; ++index)
+        {
+            // Vary the length of the names so instances both match and differ from the layout of the previous instance.
+            LeafValuesType& value = source.m_values.emplace_back();
+            value.m_id = index * 7;
+            value.m_weight = static_cast<float>(index) * 0.5f;
+            value.m_name = (index % 5 == 0) ? AZStd::string::format("value %u with a longer name", index) : AZStd::string::format("v%02u", index);
+            value.m_enabled = (index % 3) == 0;
+        }
+        source.m_single.m_id = 1234;
+        source.m_single.m_name = "single";
+        source.m_count = source.m_values.size();
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(Utils::SaveObjectToStream(stream, DataStream::ST_BINARY, &source, m_serializeContext.get()));
+
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        LeafValuesContainerType loaded;
+        ASSERT_TRUE(Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+
+        EXPECT_EQ(source.m_values, loaded.m_values);
+        EXPECT_EQ(source.m_single, loaded.m_single);
+        EXPECT_EQ(source.m_count, loaded.m_count);
+    }
+
+    TEST_F(Serialization, BinaryClassLayout_StreamWithDifferentFields_FallsBackToElementLoading)
+    {
+        // Save the data while the class has an extra field, and load it after the field was removed and the remaining fields
+        // were reordered, so the stream doesn't match the layout of the class.
+        m_serializeContext->Class<LeafValuesType>()
+            ->Version(2)
+            ->Field("enabled", &LeafValuesType::m_enabled)
+            ->Field("name", &LeafValuesType::m_name)
+            ->Field("weight", &LeafValuesType::m_weight)
+            ->Field("id", &LeafValuesType::m_id);
+
+        LeafValuesType source;
+        source.m_id = 42;
+        source.m_weight = 2.0f;
+        source.m_name = "reordered";
+        source.m_enabled = true;
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(Utils::SaveObjectToStream(stream, DataStream::ST_BINARY, &source, m_serializeContext.get()));
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<LeafValuesType>();
+        m_serializeContext->DisableRemoveReflection();
+        m_serializeContext->Class<LeafValuesType>()
+            ->Version(2)
+            ->Field("id", &LeafValuesType::m_id)
+            ->Field("weight", &LeafValuesType::m_weight)
+            ->Field("name", &LeafValuesType::m_name);
+
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        LeafValuesType loaded;
+        ASSERT_TRUE(Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+
+        EXPECT_EQ(source.m_id, loaded.m_id);
+        EXPECT_EQ(source.m_weight, loaded.m_weight);
+        EXPECT_EQ(source.m_name, loaded.m_name);
+        EXPECT_FALSE(loaded.m_enabled);
+    }
+
     /*
     * Test serialization of built-in container types
     */
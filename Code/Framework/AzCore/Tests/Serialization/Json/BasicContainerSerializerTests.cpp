@@ -6,13 +6,19 @@
  *
  */
 
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/forward_list.h>
 #include <AzCore/std/iterator.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <Tests/Serialization/Json/JsonSerializerConformityTests.h>
 #include <Tests/Serialization/Json/TestCases_Classes.h>
 
@@ -348,6 +354,187 @@ namespace JsonSerializationTests
         Expect_DocStrEq(R"([{"$type": "SimpleInheritence"},{"$type": "SimpleInheritence"}])");
     }
 
+    // Tests for loading the elements of an AZStd::vector in parallel on the task graph
+
+    class JsonVectorParallelLoadTests
+        : public JsonBasicContainerSerializerTests
+        , public AZ::TaskGraphActiveInterface
+    {
+    public:
+        using Container = AZStd::vector<int>;
+        using PointerContainer = AZStd::vector<AZStd::unique_ptr<SimpleClass>>;
+        static constexpr size_t ElementCount = 512;
+        static constexpr size_t ParallelLoadThreshold = 64;
+
+        void SetUp() override
+        {
+            JsonBasicContainerSerializerTests::SetUp();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+
+        void TearDown() override
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            AZ::TaskExecutor::SetInstance(nullptr);
+            azdestroy(m_executor);
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            JsonBasicContainerSerializerTests::TearDown();
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+        using JsonBasicContainerSerializerTests::RegisterAdditional;
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
+        {
+            SimpleClass::Reflect(serializeContext, true);
+            serializeContext->RegisterGenericType<Container>();
+            serializeContext->RegisterGenericType<PointerContainer>();
+        }
+
+        // Creates an array of integers where every invalidEntryStride-th entry is a string that can't be converted to an integer.
+        rapidjson::Value CreateArray(size_t invalidEntryStride)
+        {
+            rapidjson::Value array(rapidjson::kArrayType);
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                if (invalidEntryStride != 0 && i % invalidEntryStride == 0)
+                {
+                    array.PushBack(rapidjson::StringRef("invalid"), m_jsonDocument->GetAllocator());
+                }
+                else
+                {
+                    array.PushBack(rapidjson::Value().SetInt64(aznumeric_cast<int64_t>(i) * 3), m_jsonDocument->GetAllocator());
+                }
+            }
+            return array;
+        }
+
+        // Creates an array of objects for SimpleClass where every explicitTypeStride-th entry explicitly names its type.
+        rapidjson::Value CreatePointerArray(size_t explicitTypeStride)
+        {
+            rapidjson::Value array(rapidjson::kArrayType);
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                rapidjson::Value entry(rapidjson::kObjectType);
+                if (explicitTypeStride != 0 && i % explicitTypeStride == 0)
+                {
+                    entry.AddMember(rapidjson::StringRef(AZ::JsonSerialization::TypeIdFieldIdentifier),
+                        rapidjson::StringRef("SimpleClass"), m_jsonDocument->GetAllocator());
+                }
+                entry.AddMember(rapidjson::StringRef("var1"), rapidjson::Value().SetInt64(aznumeric_cast<int64_t>(i) * 3),
+                    m_jsonDocument->GetAllocator());
+                array.PushBack(AZStd::move(entry), m_jsonDocument->GetAllocator());
+            }
+            return array;
+        }
+
+        template<typename LoadContainer>
+        AZ::JsonSerializationResult::ResultCode Load(
+            LoadContainer& instance, const rapidjson::Value& array, bool loadInParallel, AZStd::vector<AZStd::string>& reportedPaths)
+        {
+            using namespace AZ::JsonSerializationResult;
+
+            m_deserializationSettings->m_parallelArrayLoadThreshold = loadInParallel ? ParallelLoadThreshold : 0;
+            m_deserializationSettings->m_concurrentlyLoadableTypes.insert(azrtti_typeid<typename LoadContainer::value_type>());
+            m_deserializationSettings->m_reporting =
+                [&reportedPaths](AZStd::string_view, ResultCode result, AZStd::string_view path) -> ResultCode
+            {
+                if (result.GetOutcome() != Outcomes::Success)
+                {
+                    reportedPaths.emplace_back(path);
+                }
+                return result;
+            };
+            ResetJsonContexts();
+
+            return m_serializer->Load(&instance, azrtti_typeid(&instance), array, *m_jsonDeserializationContext);
+        }
+
+    protected:
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
+    TEST_F(JsonVectorParallelLoadTests, Load_LargeArrayInParallel_MatchesSequentialLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value array = CreateArray(0);
+
+        AZStd::vector<AZStd::string> sequentialPaths;
+        Container sequential;
+        ResultCode sequentialResult = Load(sequential, array, false, sequentialPaths);
+
+        AZStd::vector<AZStd::string> parallelPaths;
+        Container parallel;
+        ResultCode parallelResult = Load(parallel, array, true, parallelPaths);
+
+        EXPECT_EQ(sequentialResult.GetProcessing(), parallelResult.GetProcessing());
+        EXPECT_EQ(sequentialResult.GetOutcome(), parallelResult.GetOutcome());
+        ASSERT_EQ(ElementCount, parallel.size());
+        EXPECT_EQ(sequential, parallel);
+        EXPECT_TRUE(parallelPaths.empty());
+    }
+
+    TEST_F(JsonVectorParallelLoadTests, Load_LargeArrayWithInvalidEntriesInParallel_SkipsEntriesAndReportsInElementOrder)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        constexpr size_t InvalidEntryStride = 17;
+        rapidjson::Value array = CreateArray(InvalidEntryStride);
+
+        AZStd::vector<AZStd::string> sequentialPaths;
+        Container sequential;
+        ResultCode sequentialResult = Load(sequential, array, false, sequentialPaths);
+
+        AZStd::vector<AZStd::string> parallelPaths;
+        Container parallel;
+        ResultCode parallelResult = Load(parallel, array, true, parallelPaths);
+
+        EXPECT_EQ(sequentialResult.GetProcessing(), parallelResult.GetProcessing());
+        EXPECT_EQ(sequentialResult.GetOutcome(), parallelResult.GetOutcome());
+        EXPECT_EQ(ElementCount - (ElementCount + InvalidEntryStride - 1) / InvalidEntryStride, parallel.size());
+        EXPECT_EQ(sequential, parallel);
+        EXPECT_FALSE(parallelPaths.empty());
+        EXPECT_EQ(sequentialPaths, parallelPaths);
+    }
+
+    TEST_F(JsonVectorParallelLoadTests, Load_LargeArrayOfUniquePointersInParallel_MatchesSequentialLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        constexpr size_t ExplicitTypeStride = 5;
+        rapidjson::Value array = CreatePointerArray(ExplicitTypeStride);
+
+        AZStd::vector<AZStd::string> sequentialPaths;
+        PointerContainer sequential;
+        ResultCode sequentialResult = Load(sequential, array, false, sequentialPaths);
+
+        AZStd::vector<AZStd::string> parallelPaths;
+        PointerContainer parallel;
+        ResultCode parallelResult = Load(parallel, array, true, parallelPaths);
+
+        EXPECT_EQ(sequentialResult.GetProcessing(), parallelResult.GetProcessing());
+        EXPECT_EQ(sequentialResult.GetOutcome(), parallelResult.GetOutcome());
+        ASSERT_EQ(ElementCount, sequential.size());
+        ASSERT_EQ(ElementCount, parallel.size());
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            ASSERT_NE(nullptr, parallel[i]);
+            EXPECT_EQ(*sequential[i], *parallel[i]);
+        }
+        EXPECT_EQ(sequentialPaths, parallelPaths);
+    }
+
     // Specific tests for AZStd::fixed_vector
 
     class JsonFixedVectorSerializerTests
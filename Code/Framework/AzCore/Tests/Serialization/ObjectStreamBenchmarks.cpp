@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::ObjectStreamBenchmarks
+{
+    // Shaped after the metadata of model and animation assets: a few named meshes with bounds and counts, and long tracks of
+    // keyframes that only hold leaf values.
+    struct MeshInfo
+    {
+        AZ_TYPE_INFO(MeshInfo, "{3F0C6A8E-5B21-4D97-A1E4-7C2B9D6E0F35}");
+
+        AZStd::string m_name;
+        AZ::Vector3 m_aabbMin = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_aabbMax = AZ::Vector3::CreateZero();
+        AZ::u32 m_vertexCount = 0;
+        AZ::u32 m_indexCount = 0;
+        AZ::u32 m_materialSlot = 0;
+    };
+
+    struct Keyframe
+    {
+        AZ_TYPE_INFO(Keyframe, "{8D4E2B71-0A3C-4F6D-9B85-E17C2A5D3F60}");
+
+        float m_time = 0.0f;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateIdentity();
+        AZ::Vector3 m_scale = AZ::Vector3::CreateOne();
+    };
+
+    struct JointTrack
+    {
+        AZ_TYPE_INFO(JointTrack, "{C62A9F13-7E48-4B0D-8F2E-5A1B3C9D7E84}");
+
+        AZStd::string m_jointName;
+        AZStd::vector<Keyframe> m_keyframes;
+    };
+
+    struct ModelAssetMetadata
+    {
+        AZ_TYPE_INFO(ModelAssetMetadata, "{5E91B0D4-2C7F-4A38-B6E1-9F0A4D2C8B57}");
+
+        AZStd::string m_name;
+        AZStd::vector<MeshInfo> m_meshes;
+        AZStd::vector<JointTrack> m_tracks;
+    };
+
+    class ObjectStreamBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            InternalSetUp();
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            InternalSetUp();
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+    protected:
+        void InternalSetUp()
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            AZ::MathReflect(m_serializeContext.get());
+            m_serializeContext->Class<MeshInfo>()
+                ->Version(1)
+                ->Field("name", &MeshInfo::m_name)
+                ->Field("aabbMin", &MeshInfo::m_aabbMin)
+                ->Field("aabbMax", &MeshInfo::m_aabbMax)
+                ->Field("vertexCount", &MeshInfo::m_vertexCount)
+                ->Field("indexCount", &MeshInfo::m_indexCount)
+                ->Field("materialSlot", &MeshInfo::m_materialSlot);
+            m_serializeContext->Class<Keyframe>()
+                ->Version(1)
+                ->Field("time", &Keyframe::m_time)
+                ->Field("position", &Keyframe::m_position)
+                ->Field("rotation", &Keyframe::m_rotation)
+                ->Field("scale", &Keyframe::m_scale);
+            m_serializeContext->Class<JointTrack>()
+                ->Version(1)
+                ->Field("jointName", &JointTrack::m_jointName)
+                ->Field("keyframes", &JointTrack::m_keyframes);
+            m_serializeContext->Class<ModelAssetMetadata>()
+                ->Version(1)
+                ->Field("name", &ModelAssetMetadata::m_name)
+                ->Field("meshes", &ModelAssetMetadata::m_meshes)
+                ->Field("tracks", &ModelAssetMetadata::m_tracks);
+        }
+
+        void InternalTearDown()
+        {
+            m_buffer = {};
+            m_serializeContext.reset();
+        }
+
+        void SaveMetadata(size_t meshCount, size_t trackCount, size_t keyframesPerTrack)
+        {
+            ModelAssetMetadata metadata;
+            metadata.m_name = "character";
+            for (size_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
+            {
+                MeshInfo& mesh = metadata.m_meshes.emplace_back();
+                mesh.m_name = AZStd::string::format("lod0_mesh%zu", meshIndex);
+                mesh.m_aabbMin = AZ::Vector3(-1.0f, -1.0f, 0.0f) * static_cast<float>(meshIndex + 1);
+                mesh.m_aabbMax = AZ::Vector3(1.0f, 1.0f, 2.0f) * static_cast<float>(meshIndex + 1);
+                mesh.m_vertexCount = aznumeric_cast<AZ::u32>(1024 * (meshIndex + 1));
+                mesh.m_indexCount = mesh.m_vertexCount * 3;
+                mesh.m_materialSlot = aznumeric_cast<AZ::u32>(meshIndex % 4);
+            }
+
+            for (size_t trackIndex = 0; trackIndex < trackCount; ++trackIndex)
+            {
+                JointTrack& track = metadata.m_tracks.emplace_back();
+                track.m_jointName = AZStd::string::format("joint%zu", trackIndex);
+                for (size_t keyIndex = 0; keyIndex < keyframesPerTrack; ++keyIndex)
+                {
+                    Keyframe& keyframe = track.m_keyframes.emplace_back();
+                    const float time = static_cast<float>(keyIndex) / 30.0f;
+                    keyframe.m_time = time;
+                    keyframe.m_position = AZ::Vector3(time, static_cast<float>(trackIndex), 0.5f * time);
+                    keyframe.m_rotation = AZ::Quaternion::CreateRotationZ(time);
+                }
+            }
+
+            m_buffer.clear();
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+            AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &metadata, m_serializeContext.get());
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<char> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(ObjectStreamBenchmarkFixture, LoadBinaryModelMetadata)(::benchmark::State& state)
+    {
+        const size_t trackCount = aznumeric_cast<size_t>(state.range(0));
+        constexpr size_t keyframesPerTrack = 120;
+        SaveMetadata(16, trackCount, keyframesPerTrack);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ModelAssetMetadata loaded;
+            AZ::Utils::LoadObjectFromBufferInPlace(m_buffer.data(), m_buffer.size(), loaded, m_serializeContext.get());
+            ::benchmark::DoNotOptimize(loaded.m_tracks.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * m_buffer.size());
+        state.SetItemsProcessed(state.iterations() * trackCount * keyframesPerTrack);
+    }
+    BENCHMARK_REGISTER_F(ObjectStreamBenchmarkFixture, LoadBinaryModelMetadata)->Arg(8)->Arg(64)->Arg(256)->Unit(::benchmark::kMillisecond);
+} // namespace AZ::ObjectStreamBenchmarks
+
+#endif // defined(HAVE_BENCHMARK)
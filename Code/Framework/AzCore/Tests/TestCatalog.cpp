@@ -309,7 +309,8 @@ namespace UnitTest
     AssetInfo DataDrivenHandlerAndCatalog::GetAssetInfoById(const AssetId& assetId)
     {
         AssetInfo result;
-        const auto* def = FindById(assetId);
+        auto legacyIt = m_legacyAssetIds.find(assetId);
+        const auto* def = FindById(legacyIt != m_legacyAssetIds.end() ? legacyIt->second : assetId);
 
         if (def && !def->m_noAssetData)
         {
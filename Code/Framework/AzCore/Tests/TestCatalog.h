@@ -115,5 +115,7 @@ namespace UnitTest
         AZ::IO::IStreamerTypes::Priority m_defaultPriority = AZ::IO::IStreamerTypes::s_priorityMedium;
 
         AZStd::vector<AssetDefinition> m_assetDefinitions;
+        //! Legacy ids that GetAssetInfoById resolves to the canonical id of one of the asset definitions.
+        AZStd::unordered_map<AssetId, AssetId> m_legacyAssetIds;
     };
 }
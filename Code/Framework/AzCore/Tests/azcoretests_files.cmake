@@ -10,6 +10,7 @@ set(FILES
     Main.cpp
     Asset/AssetCommon.cpp
     Asset/AssetDataStreamTests.cpp
+    Asset/AssetManagerBenchmarks.cpp
     Asset/AssetManagerLoadingTests.cpp
     Asset/AssetManagerStreamingTests.cpp
     Asset/BaseAssetManagerTest.cpp
@@ -73,6 +74,7 @@ set(FILES
     TickBusTest.cpp
     UUIDTests.cpp
     XML.cpp
+    Debug/BudgetTrackerTests.cpp
     Debug/LocalFileEventLoggerTests.cpp
     Debug/Trace.cpp
     Debug/UnhandledExceptions.cpp
@@ -137,6 +139,7 @@ set(FILES
     Serialization/Json/UnorderedSetSerializerTests.cpp
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
+    Serialization/ObjectStreamBenchmarks.cpp
     Time/TimeTests.cpp
     Math/AabbTests.cpp
     Math/ColorTests.cpp
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/base.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Identifies a transform registered with ITransformHierarchy. Handles of removed transforms are never reused.
+    using TransformHierarchyHandle = AZ::u64;
+    constexpr TransformHierarchyHandle InvalidTransformHierarchyHandle = AZStd::numeric_limits<TransformHierarchyHandle>::max();
+
+    //! Keeps the world transforms of TransformComponents in contiguous arrays sorted by hierarchy depth, so the world transforms of
+    //! descendants of moved entities can be updated in a single pass instead of by every child listening for its parent.
+    //! TransformChanged notifications for the updated descendants are sent together once all world transforms have been updated.
+    //! @note World transforms read through the TransformBus always include changes of their ancestors, but the notifications for
+    //! those changes are only sent by the next ProcessTransformHierarchyUpdates.
+    class ITransformHierarchy
+    {
+    public:
+        AZ_RTTI(ITransformHierarchy, "{5C0A2D2B-6C49-4E4E-9B1F-3D6E7F1A2C84}");
+
+        //! Registers a transform. Transforms start without a parent.
+        virtual TransformHierarchyHandle AddTransform(TransformComponent& transform) = 0;
+
+        //! Unregisters a transform. Its children are treated as transforms without a parent until they're given a new one.
+        virtual void RemoveTransform(TransformHierarchyHandle handle) = 0;
+
+        //! Sets the registered parent of a transform, or clears it when parentHandle is InvalidTransformHierarchyHandle.
+        //! The world transforms of transforms with a registered parent are updated by the hierarchy when the parent moves.
+        virtual void SetParent(TransformHierarchyHandle handle, TransformHierarchyHandle parentHandle) = 0;
+
+        //! Notifies the hierarchy that the world transform of a transform has changed, so all of its descendants need updating.
+        virtual void MarkWorldTMChanged(TransformHierarchyHandle handle) = 0;
+
+        //! Brings the world transform of a single transform up to date with any of its ancestors that changed since the last update,
+        //! without sending notifications. Does nothing if none of its ancestors changed.
+        virtual void UpdateWorldTM(TransformHierarchyHandle handle) = 0;
+
+        //! Returns true if there are changes that haven't been propagated to descendants yet.
+        virtual bool HasPendingUpdates() const = 0;
+
+        //! Updates the world transforms of the descendants of all changed transforms and sends their TransformChanged notifications.
+        //! @note During normal operation this is called every frame in OnTick but can
+        //! also be called explicitly (e.g. For testing purposes).
+        virtual void ProcessTransformHierarchyUpdates() = 0;
+
+    protected:
+        ~ITransformHierarchy() = default;
+    };
+} // namespace AzFramework
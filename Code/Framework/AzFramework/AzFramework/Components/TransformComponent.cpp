@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/ITransformHierarchy.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -137,6 +138,7 @@ namespace AzFramework
     {
         if (auto config = azrtti_cast<AZ::TransformConfig*>(baseConfig))
         {
+            UpdateFromTransformHierarchy();
             config->m_localTransform = m_localTM;
             config->m_worldTransform = m_worldTM;
             config->m_parentId = m_parentId;
@@ -152,6 +154,12 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        m_transformHierarchy = AZ::Interface<ITransformHierarchy>::Get();
+        if (m_transformHierarchy)
+        {
+            m_transformHierarchyHandle = m_transformHierarchy->AddTransform(*this);
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
@@ -173,6 +181,13 @@ namespace AzFramework
             AZ::EntityBus::Handler::BusDisconnect();
         }
         AZ::TransformBus::Handler::BusDisconnect();
+
+        if (m_transformHierarchy)
+        {
+            UpdateFromTransformHierarchy();
+            m_transformHierarchy->RemoveTransform(m_transformHierarchyHandle);
+            DetachFromTransformHierarchy();
+        }
     }
 
     void TransformComponent::BindTransformChangedEventHandler(AZ::TransformChangedEvent::Handler& handler)
@@ -223,6 +238,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
+        UpdateFromTransformHierarchy();
         AZ::Transform newWorldTransform = m_worldTM;
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
@@ -237,6 +253,7 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldTranslation()
     {
+        UpdateFromTransformHierarchy();
         return m_worldTM.GetTranslation();
     }
 
@@ -247,24 +264,28 @@ namespace AzFramework
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
+        UpdateFromTransformHierarchy();
         const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
+        UpdateFromTransformHierarchy();
         const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
+        UpdateFromTransformHierarchy();
         const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
+        UpdateFromTransformHierarchy();
         const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
@@ -325,6 +346,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldRotation(const AZ::Vector3& eulerAnglesRadian)
     {
+        UpdateFromTransformHierarchy();
         AZ::Transform newWorldTransform = m_worldTM;
         newWorldTransform.SetRotation(AZ::Quaternion::CreateFromEulerAnglesRadians(eulerAnglesRadian));
         SetWorldTM(newWorldTransform);
@@ -332,6 +354,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldRotationQuaternion(const AZ::Quaternion& quaternion)
     {
+        UpdateFromTransformHierarchy();
         AZ::Transform newWorldTransform = m_worldTM;
         newWorldTransform.SetRotation(quaternion);
         SetWorldTM(newWorldTransform);
@@ -339,11 +362,13 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldRotation()
     {
+        UpdateFromTransformHierarchy();
         return m_worldTM.GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetWorldRotationQuaternion()
     {
+        UpdateFromTransformHierarchy();
         return m_worldTM.GetRotation();
     }
 
@@ -429,6 +454,7 @@ namespace AzFramework
 
     float TransformComponent::GetWorldUniformScale()
     {
+        UpdateFromTransformHierarchy();
         return m_worldTM.GetUniformScale();
     }
 
@@ -466,6 +492,12 @@ namespace AzFramework
 
     void TransformComponent::OnTransformChanged(const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM)
     {
+        // The transform hierarchy updates this transform when the parent is part of it.
+        if (m_isParentInTransformHierarchy)
+        {
+            return;
+        }
+
         OnTransformChangedImpl(parentLocalTM, parentWorldTM);
     }
 
@@ -508,6 +540,7 @@ namespace AzFramework
         if (parentEntity)
         {
             m_parentTM = parentEntity->GetTransform();
+            UpdateTransformHierarchyParent();
 
             AZ_Warning("TransformComponent", !m_isStatic || m_parentTM->IsStaticTransform(),
                 "Entity '%s' %s has static transform, but parent has non-static transform. This may lead to unexpected movement.",
@@ -527,8 +560,10 @@ namespace AzFramework
     void TransformComponent::OnEntityDeactivated([[maybe_unused]] const AZ::EntityId& parentEntityId)
     {
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+        UpdateFromTransformHierarchy();
         m_parentTM = nullptr;
         m_parentActive = false;
+        UpdateTransformHierarchyParent();
         ComputeLocalTM();
     }
 
@@ -540,6 +575,8 @@ namespace AzFramework
             return;
         }
 
+        UpdateFromTransformHierarchy();
+
         AZ::EntityId oldParent = m_parentId;
         if (m_parentId.IsValid())
         {
@@ -561,10 +598,12 @@ namespace AzFramework
             AZ::TransformNotificationBus::Handler::BusConnect(m_parentId);
             AZ::TransformHierarchyInformationBus::Handler::BusConnect(m_parentId);
             AZ::EntityBus::Handler::BusConnect(m_parentId);
+            UpdateTransformHierarchyParent();
         }
         else
         {
             m_parentTM = nullptr;
+            UpdateTransformHierarchyParent();
 
             if (isKeepWorldTM)
             {
@@ -622,6 +661,7 @@ namespace AzFramework
         if (m_parentTM)
         {
             m_worldTM = parentWorldTM * m_localTM;
+            MarkTransformHierarchyChanged();
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             m_transformChangedEvent.Signal(m_localTM, m_worldTM);
         }
@@ -638,6 +678,7 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
+        MarkTransformHierarchyChanged();
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
 
@@ -659,6 +700,42 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        MarkTransformHierarchyChanged();
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+    }
+
+    void TransformComponent::UpdateTransformHierarchyParent()
+    {
+        if (m_transformHierarchy)
+        {
+            // Only parents that are registered with the same hierarchy can have their changes propagated by it, any other parent
+            // keeps updating this transform through the TransformNotificationBus.
+            auto parent = m_parentActive ? azrtti_cast<TransformComponent*>(m_parentTM) : nullptr;
+            m_isParentInTransformHierarchy = parent && parent->m_transformHierarchy == m_transformHierarchy;
+            m_transformHierarchy->SetParent(
+                m_transformHierarchyHandle,
+                m_isParentInTransformHierarchy ? parent->m_transformHierarchyHandle : InvalidTransformHierarchyHandle);
+        }
+    }
+
+    void TransformComponent::MarkTransformHierarchyChanged()
+    {
+        if (m_transformHierarchy)
+        {
+            m_transformHierarchy->MarkWorldTMChanged(m_transformHierarchyHandle);
+        }
+    }
+
+    void TransformComponent::DetachFromTransformHierarchy()
+    {
+        m_transformHierarchy = nullptr;
+        m_transformHierarchyHandle = InvalidTransformHierarchyHandle;
+        m_isParentInTransformHierarchy = false;
+    }
+
+    void TransformComponent::NotifyTransformChanged()
+    {
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Components/ITransformHierarchy.h>
 
 namespace AzToolsFramework
 {
@@ -25,6 +26,7 @@ namespace AzToolsFramework
 namespace AzFramework
 {
     class GameEntityContextComponent;
+    class TransformHierarchySystem;
 
     /// @deprecated Use AZ::TransformConfig
     using TransformComponentConfiguration = AZ::TransformConfig;
@@ -41,6 +43,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class TransformHierarchySystem;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -56,9 +59,9 @@ namespace AzFramework
         //! Returns true if the tm was set to the local transform.
         const AZ::Transform& GetLocalTM() override { return m_localTM; }
         //! Returns true if the tm was set to the world transform.
-        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        const AZ::Transform& GetWorldTM() override { UpdateFromTransformHierarchy(); return m_worldTM; }
         //! Returns both local and world transforms.
-        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = m_worldTM; }
+        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { UpdateFromTransformHierarchy(); localTM = m_localTM; worldTM = m_worldTM; }
         //! Returns parent EntityId.
         AZ::EntityId GetParentId() override { return m_parentId; }
         //! Returns parent interface if available.
@@ -160,6 +163,24 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Transform hierarchy support.
+        //! @{
+        //! Brings m_worldTM up to date if an ancestor moved since the last hierarchy update. The notifications for the move are sent
+        //! by the hierarchy update.
+        void UpdateFromTransformHierarchy() const
+        {
+            if (m_isParentInTransformHierarchy)
+            {
+                m_transformHierarchy->UpdateWorldTM(m_transformHierarchyHandle);
+            }
+        }
+        void UpdateTransformHierarchyParent();
+        void MarkTransformHierarchyChanged();
+        void DetachFromTransformHierarchy();
+        //! Sends the notifications for a world transform set by the transform hierarchy.
+        void NotifyTransformChanged();
+        //! @}
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -186,5 +207,9 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+
+        ITransformHierarchy* m_transformHierarchy = nullptr; ///< Hierarchy this transform is registered with while active, if any.
+        TransformHierarchyHandle m_transformHierarchyHandle = InvalidTransformHierarchyHandle;
+        bool m_isParentInTransformHierarchy = false; ///< If true, m_transformHierarchy updates the world transform when the parent moves.
     };
 }   // namespace AZ
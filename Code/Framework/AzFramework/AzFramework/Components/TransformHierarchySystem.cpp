@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    TransformHierarchySystem::~TransformHierarchySystem()
+    {
+        Disconnect();
+    }
+
+    void TransformHierarchySystem::Connect()
+    {
+        if (!m_isConnected)
+        {
+            AZ::Interface<ITransformHierarchy>::Register(this);
+            AZ::TickBus::Handler::BusConnect();
+            m_isConnected = true;
+        }
+    }
+
+    void TransformHierarchySystem::Disconnect()
+    {
+        if (m_isConnected)
+        {
+            // Make sure the transforms have their final world transforms before they stop using the hierarchy.
+            ProcessTransformHierarchyUpdates();
+            for (Node& node : m_nodes)
+            {
+                if (node.m_transform)
+                {
+                    node.m_transform->DetachFromTransformHierarchy();
+                }
+            }
+
+            m_nodes.clear();
+            m_freeNodes.clear();
+            m_changedNodes.clear();
+            m_isSortRequired = true;
+
+            AZ::TickBus::Handler::BusDisconnect();
+            AZ::Interface<ITransformHierarchy>::Unregister(this);
+            m_isConnected = false;
+        }
+    }
+
+    TransformHierarchyHandle TransformHierarchySystem::AddTransform(TransformComponent& transform)
+    {
+        AZ::u32 nodeIndex;
+        if (!m_freeNodes.empty())
+        {
+            nodeIndex = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            nodeIndex = aznumeric_cast<AZ::u32>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        Node& node = m_nodes[nodeIndex];
+        node.m_transform = &transform;
+        node.m_parent = InvalidTransformHierarchyHandle;
+        node.m_sortedIndex = InvalidIndex;
+        m_isSortRequired = true;
+        return GetHandle(nodeIndex);
+    }
+
+    void TransformHierarchySystem::RemoveTransform(TransformHierarchyHandle handle)
+    {
+        if (Node* node = FindNode(handle))
+        {
+            node->m_transform = nullptr;
+            node->m_parent = InvalidTransformHierarchyHandle;
+            node->m_isChanged = false;
+            // Bumping the generation invalidates the handle, including any references to it from children or queued notifications.
+            ++node->m_generation;
+            m_freeNodes.push_back(aznumeric_cast<AZ::u32>(node - m_nodes.data()));
+            m_isSortRequired = true;
+        }
+    }
+
+    void TransformHierarchySystem::SetParent(TransformHierarchyHandle handle, TransformHierarchyHandle parentHandle)
+    {
+        if (Node* node = FindNode(handle); node && node->m_parent != parentHandle)
+        {
+            node->m_parent = parentHandle;
+            m_isSortRequired = true;
+            // The world transform may already include changes of the old parent that were applied by UpdateWorldTM, which still need
+            // to reach the descendants.
+            MarkWorldTMChanged(handle);
+        }
+    }
+
+    void TransformHierarchySystem::MarkWorldTMChanged(TransformHierarchyHandle handle)
+    {
+        if (Node* node = FindNode(handle); node && !node->m_isChanged)
+        {
+            node->m_isChanged = true;
+            m_changedNodes.push_back(aznumeric_cast<AZ::u32>(handle & InvalidIndex));
+        }
+    }
+
+    void TransformHierarchySystem::UpdateWorldTM(TransformHierarchyHandle handle)
+    {
+        const Node* node = FindNode(handle);
+        if (!node || m_isProcessing || m_changedNodes.empty())
+        {
+            return;
+        }
+
+        // Nothing above the highest changed ancestor has changed, so its world transform is up to date and everything below it
+        // only needs to be recomputed from the local transforms.
+        m_ancestors.clear();
+        size_t changedAncestorCount = 0;
+        for (const Node* parent = FindNode(node->m_parent); parent && m_ancestors.size() < m_nodes.size();
+             parent = FindNode(parent->m_parent))
+        {
+            m_ancestors.push_back(parent->m_transform);
+            if (parent->m_isChanged)
+            {
+                changedAncestorCount = m_ancestors.size();
+            }
+        }
+
+        if (changedAncestorCount == 0)
+        {
+            return;
+        }
+
+        // The intermediate ancestors are updated as well, their notifications are sent with the rest of the propagated transforms.
+        AZ::Transform worldTM = m_ancestors[changedAncestorCount - 1]->m_worldTM;
+        for (size_t ancestor = changedAncestorCount - 1; ancestor-- > 0;)
+        {
+            worldTM = worldTM * m_ancestors[ancestor]->m_localTM;
+            m_ancestors[ancestor]->m_worldTM = worldTM;
+        }
+        node->m_transform->m_worldTM = worldTM * node->m_transform->m_localTM;
+    }
+
+    bool TransformHierarchySystem::HasPendingUpdates() const
+    {
+        return !m_changedNodes.empty() && !m_isProcessing;
+    }
+
+    void TransformHierarchySystem::ProcessTransformHierarchyUpdates()
+    {
+        if (m_isProcessing || m_changedNodes.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AzFramework, "TransformHierarchySystem: ProcessTransformHierarchyUpdates");
+
+        m_isProcessing = true;
+        if (m_isSortRequired)
+        {
+            SortNodes();
+        }
+
+        // Pick up the latest transforms of everything that changed and find the range of levels that needs updating.
+        const size_t levelCount = m_levelOffsets.size() - 1;
+        size_t firstLevel = levelCount;
+        size_t lastChangedLevel = 0;
+        for (AZ::u32 nodeIndex : m_changedNodes)
+        {
+            Node& node = m_nodes[nodeIndex];
+            node.m_isChanged = false;
+            if (node.m_transform)
+            {
+                const AZ::u32 sortedIndex = node.m_sortedIndex;
+                m_localTMs[sortedIndex] = node.m_transform->m_localTM;
+                m_worldTMs[sortedIndex] = node.m_transform->m_worldTM;
+                m_updateStates[sortedIndex] = UpdateState::Changed;
+
+                const size_t level = AZStd::distance(
+                    m_levelOffsets.begin(), AZStd::upper_bound(m_levelOffsets.begin(), m_levelOffsets.end(), sortedIndex)) - 1;
+                firstLevel = AZStd::min(firstLevel, level);
+                lastChangedLevel = AZStd::max(lastChangedLevel, level);
+            }
+        }
+        m_changedNodes.clear();
+
+        if (firstLevel == levelCount)
+        {
+            m_isProcessing = false;
+            return;
+        }
+
+        // Every level only depends on the level above it, so the transforms within a level can be updated in any order.
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        constexpr size_t TransformsPerTask = 1024;
+
+        size_t level = firstLevel + 1;
+        for (bool previousLevelChanged = true; level < levelCount && (previousLevelChanged || level <= lastChangedLevel); ++level)
+        {
+            const size_t begin = m_levelOffsets[level];
+            const size_t end = m_levelOffsets[level + 1];
+            if (!previousLevelChanged)
+            {
+                // Nothing moved in the level above, but changes further down still need to be looked at.
+                previousLevelChanged = AZStd::any_of(
+                    m_updateStates.begin() + begin, m_updateStates.begin() + end,
+                    [](UpdateState state)
+                    {
+                        return state != UpdateState::Unchanged;
+                    });
+                continue;
+            }
+
+            if (useTaskGraph && (end - begin) >= 2 * TransformsPerTask)
+            {
+                AZStd::atomic_bool levelChanged{ false };
+                AZ::TaskGraph taskGraph;
+                AZ::TaskDescriptor propagateDescriptor{ "TransformHierarchySystem_Propagate", "Transforms" };
+                for (size_t taskBegin = begin; taskBegin < end; taskBegin += TransformsPerTask)
+                {
+                    const size_t taskEnd = AZStd::min(taskBegin + TransformsPerTask, end);
+                    taskGraph.AddTask(
+                        propagateDescriptor,
+                        [this, &levelChanged, taskBegin, taskEnd]()
+                        {
+                            AZ_PROFILE_SCOPE(AzFramework, "TransformHierarchySystem: Propagate");
+                            if (PropagateRange(taskBegin, taskEnd))
+                            {
+                                levelChanged = true;
+                            }
+                        });
+                }
+
+                AZ::TaskGraphEvent waitForCompletion;
+                taskGraph.Submit(&waitForCompletion);
+                waitForCompletion.Wait();
+                previousLevelChanged = levelChanged;
+            }
+            else
+            {
+                previousLevelChanged = PropagateRange(begin, end);
+            }
+        }
+
+        // Collect the updated transforms in depth order and reset the states for the next update.
+        AZStd::vector<Notification> notifications;
+        const size_t processedEnd = m_levelOffsets[level];
+        for (size_t sortedIndex = m_levelOffsets[firstLevel]; sortedIndex < processedEnd; ++sortedIndex)
+        {
+            if (m_updateStates[sortedIndex] == UpdateState::Propagated)
+            {
+                notifications.push_back({ GetHandle(m_sortedNodes[sortedIndex]), m_worldTMs[sortedIndex] });
+            }
+            m_updateStates[sortedIndex] = UpdateState::Unchanged;
+        }
+
+        // Store all world transforms before sending any notifications, so handlers always read up to date transforms for any
+        // entity in the hierarchy.
+        for (const Notification& notification : notifications)
+        {
+            m_nodes[notification.m_handle & InvalidIndex].m_transform->m_worldTM = notification.m_worldTM;
+        }
+
+        // Handlers are allowed to move, reparent or remove transforms, which will be handled by the next update.
+        m_isProcessing = false;
+        for (const Notification& notification : notifications)
+        {
+            if (Node* node = FindNode(notification.m_handle))
+            {
+                node->m_transform->NotifyTransformChanged();
+            }
+        }
+    }
+
+    void TransformHierarchySystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ProcessTransformHierarchyUpdates();
+    }
+
+    int TransformHierarchySystem::GetTickOrder()
+    {
+        return AZ::TICK_FIRST;
+    }
+
+    TransformHierarchySystem::Node* TransformHierarchySystem::FindNode(TransformHierarchyHandle handle)
+    {
+        const AZ::u64 nodeIndex = handle & InvalidIndex;
+        if (nodeIndex < m_nodes.size())
+        {
+            Node& node = m_nodes[nodeIndex];
+            if (node.m_transform && node.m_generation == (handle >> 32))
+            {
+                return &node;
+            }
+        }
+        return nullptr;
+    }
+
+    TransformHierarchyHandle TransformHierarchySystem::GetHandle(AZ::u32 nodeIndex) const
+    {
+        return (aznumeric_cast<TransformHierarchyHandle>(m_nodes[nodeIndex].m_generation) << 32) | nodeIndex;
+    }
+
+    void TransformHierarchySystem::SortNodes()
+    {
+        AZ_PROFILE_SCOPE(AzFramework, "TransformHierarchySystem: SortNodes");
+
+        const size_t nodeCount = m_nodes.size();
+        constexpr AZ::u32 UnknownDepth = InvalidIndex;
+
+        // Find the depth of every node. Walks stop at the first ancestor with a known depth, so every node is visited a small
+        // number of times.
+        m_nodeDepths.assign(nodeCount, UnknownDepth);
+        AZStd::vector<AZ::u32> ancestors;
+        AZ::u32 maxDepth = 0;
+        size_t transformCount = 0;
+        for (AZ::u32 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+        {
+            if (!m_nodes[nodeIndex].m_transform)
+            {
+                continue;
+            }
+            ++transformCount;
+
+            AZ::u32 current = nodeIndex;
+            while (m_nodeDepths[current] == UnknownDepth)
+            {
+                const Node* parent = FindNode(m_nodes[current].m_parent);
+                // The TransformComponent rejects loops, but guard against them regardless by treating the node as a root.
+                if (!parent || ancestors.size() > nodeCount)
+                {
+                    m_nodeDepths[current] = 0;
+                    break;
+                }
+                ancestors.push_back(current);
+                current = aznumeric_cast<AZ::u32>(parent - m_nodes.data());
+            }
+
+            AZ::u32 depth = m_nodeDepths[current];
+            while (!ancestors.empty())
+            {
+                m_nodeDepths[ancestors.back()] = ++depth;
+                ancestors.pop_back();
+            }
+            maxDepth = AZStd::max(maxDepth, m_nodeDepths[nodeIndex]);
+        }
+
+        // Counting sort by depth.
+        m_levelOffsets.assign(transformCount > 0 ? maxDepth + 2 : 1, 0);
+        for (AZ::u32 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+        {
+            if (m_nodes[nodeIndex].m_transform)
+            {
+                ++m_levelOffsets[m_nodeDepths[nodeIndex] + 1];
+            }
+        }
+        for (size_t level = 1; level < m_levelOffsets.size(); ++level)
+        {
+            m_levelOffsets[level] += m_levelOffsets[level - 1];
+        }
+
+        m_sortedNodes.resize(transformCount);
+        AZStd::vector<size_t> insertOffsets(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+        for (AZ::u32 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+        {
+            if (m_nodes[nodeIndex].m_transform)
+            {
+                const size_t sortedIndex = insertOffsets[m_nodeDepths[nodeIndex]]++;
+                m_sortedNodes[sortedIndex] = nodeIndex;
+                m_nodes[nodeIndex].m_sortedIndex = aznumeric_cast<AZ::u32>(sortedIndex);
+            }
+        }
+
+        // The components hold the latest transforms for anything that isn't marked as changed.
+        m_localTMs.resize(transformCount);
+        m_worldTMs.resize(transformCount);
+        m_parentIndices.resize(transformCount);
+        m_updateStates.assign(transformCount, UpdateState::Unchanged);
+        for (size_t sortedIndex = 0; sortedIndex < transformCount; ++sortedIndex)
+        {
+            const Node& node = m_nodes[m_sortedNodes[sortedIndex]];
+            const Node* parent = m_nodeDepths[m_sortedNodes[sortedIndex]] > 0 ? FindNode(node.m_parent) : nullptr;
+            m_localTMs[sortedIndex] = node.m_transform->m_localTM;
+            m_worldTMs[sortedIndex] = node.m_transform->m_worldTM;
+            m_parentIndices[sortedIndex] = parent ? parent->m_sortedIndex : InvalidIndex;
+        }
+
+        m_isSortRequired = false;
+    }
+
+    bool TransformHierarchySystem::PropagateRange(size_t begin, size_t end)
+    {
+        bool changed = false;
+        for (size_t sortedIndex = begin; sortedIndex < end; ++sortedIndex)
+        {
+            const AZ::u32 parentIndex = m_parentIndices[sortedIndex];
+            if (parentIndex != InvalidIndex && m_updateStates[parentIndex] != UpdateState::Unchanged)
+            {
+                m_worldTMs[sortedIndex] = m_worldTMs[parentIndex] * m_localTMs[sortedIndex];
+                m_updateStates[sortedIndex] = UpdateState::Propagated;
+            }
+            changed = changed || m_updateStates[sortedIndex] != UpdateState::Unchanged;
+        }
+        return changed;
+    }
+} // namespace AzFramework
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Components/ITransformHierarchy.h>
+
+namespace AzFramework
+{
+    //! Default implementation of ITransformHierarchy.
+    //! Transforms are stored sorted by depth, so all parents come before their children. Updates are applied one depth level at
+    //! a time, starting at the shallowest changed transform. Levels with many transforms are split over the task graph.
+    class TransformHierarchySystem final
+        : public ITransformHierarchy
+        , private AZ::TickBus::Handler
+    {
+    public:
+        TransformHierarchySystem() = default;
+        ~TransformHierarchySystem();
+
+        void Connect();
+        void Disconnect();
+
+        // ITransformHierarchy overrides ...
+        TransformHierarchyHandle AddTransform(TransformComponent& transform) override;
+        void RemoveTransform(TransformHierarchyHandle handle) override;
+        void SetParent(TransformHierarchyHandle handle, TransformHierarchyHandle parentHandle) override;
+        void MarkWorldTMChanged(TransformHierarchyHandle handle) override;
+        void UpdateWorldTM(TransformHierarchyHandle handle) override;
+        bool HasPendingUpdates() const override;
+        void ProcessTransformHierarchyUpdates() override;
+
+    private:
+        static constexpr AZ::u32 InvalidIndex = AZStd::numeric_limits<AZ::u32>::max();
+
+        enum class UpdateState : AZ::u8
+        {
+            Unchanged,
+            Changed, //!< The world transform was changed by the component itself.
+            Propagated //!< The world transform was updated because an ancestor changed.
+        };
+
+        struct Node
+        {
+            TransformComponent* m_transform{ nullptr };
+            TransformHierarchyHandle m_parent{ InvalidTransformHierarchyHandle };
+            AZ::u32 m_generation{ 0 };
+            AZ::u32 m_sortedIndex{ InvalidIndex }; //!< Position of the node in the depth sorted arrays.
+            bool m_isChanged{ false }; //!< True while the node is in m_changedNodes.
+        };
+
+        struct Notification
+        {
+            TransformHierarchyHandle m_handle;
+            AZ::Transform m_worldTM;
+        };
+
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        Node* FindNode(TransformHierarchyHandle handle);
+        TransformHierarchyHandle GetHandle(AZ::u32 nodeIndex) const;
+
+        //! Rebuilds the depth sorted arrays after transforms were added, removed or reparented.
+        void SortNodes();
+        //! Applies parent changes to the sorted range [begin, end) in a single depth level. Returns true if any transform in the
+        //! range is no longer unchanged.
+        bool PropagateRange(size_t begin, size_t end);
+
+        AZStd::vector<Node> m_nodes;
+        AZStd::vector<AZ::u32> m_freeNodes;
+        //! Nodes marked as changed since the last update.
+        AZStd::vector<AZ::u32> m_changedNodes;
+        //! Ancestors of the transform being updated by UpdateWorldTM, closest first.
+        AZStd::vector<TransformComponent*> m_ancestors;
+
+        //! Depth sorted arrays, with one entry per registered transform.
+        //! @{
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<AZ::u32> m_parentIndices; //!< Sorted index of the parent, or InvalidIndex for transforms without a parent.
+        AZStd::vector<UpdateState> m_updateStates;
+        AZStd::vector<AZ::u32> m_sortedNodes; //!< Node index for each sorted entry.
+        //! @}
+        //! Start of every depth level in the sorted arrays, followed by the total number of sorted transforms.
+        AZStd::vector<size_t> m_levelOffsets;
+        //! Depth of each node, only valid while sorting.
+        AZStd::vector<AZ::u32> m_nodeDepths;
+
+        bool m_isSortRequired{ false };
+        bool m_isProcessing{ false };
+        bool m_isConnected{ false };
+    };
+} // namespace AzFramework
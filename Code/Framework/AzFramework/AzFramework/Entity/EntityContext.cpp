@@ -237,6 +237,19 @@ namespace AzFramework
         m_entityOwnershipService->AddEntity(entity);
     }
 
+    //=========================================================================
+    // AddEntities
+    //=========================================================================
+    void EntityContext::AddEntities(const EntityList& entities)
+    {
+        for ([[maybe_unused]] AZ::Entity* entity : entities)
+        {
+            AZ_Assert(!EntityIdContextQueryBus::FindFirstHandler(entity->GetId()), "Entity already belongs to a context.");
+        }
+
+        m_entityOwnershipService->AddEntities(entities);
+    }
+
     //=========================================================================
     // ActivateEntity
     //=========================================================================
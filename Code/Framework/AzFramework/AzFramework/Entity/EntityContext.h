@@ -61,6 +61,9 @@ namespace AzFramework
         /// \return the context's Id, which is used to listen on a given context's request or event bus.
         const EntityContextId& GetContextId() const { return m_contextId; }
 
+        /// Adds several entities to the context at once, so they're handled as one batch when they're initialized and activated.
+        void AddEntities(const EntityList& entities);
+
         //////////////////////////////////////////////////////////////////////////
         // EntityContextRequestBus
         AZ::Entity* CreateEntity(const char* name) override;
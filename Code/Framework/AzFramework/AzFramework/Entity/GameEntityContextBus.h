@@ -84,6 +84,14 @@ namespace AzFramework
          */
         virtual void AddGameEntity(AZ::Entity* /*entity*/) = 0;
 
+        /**
+         * Adds several existing entities to the game context at once.
+         * Entities added together are initialized and activated as a batch, grouping the work by component type. Unlike adding
+         * them one at a time, components of different entities in the batch may be activated interleaved with each other.
+         * @param entities The entities to add to the game context.
+         */
+        virtual void AddGameEntities(const EntityList& /*entities*/) = 0;
+
         /**
          * Destroys an entity. 
          * The entity is immediately deactivated and will be destroyed on the next tick.
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -20,6 +21,10 @@
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, transform_batchHierarchyUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Update the world transforms of game entity descendants in batches through the TransformHierarchySystem instead of through "
+        "TransformNotificationBus events. Takes effect when the game entity context is activated.");
+
     //=========================================================================
     // Reflect
     //=========================================================================
@@ -93,6 +98,11 @@ namespace AzFramework
         GameEntityContextRequestBus::Handler::BusConnect();
 
         m_entityVisibilityBoundsUnionSystem.Connect();
+
+        if (transform_batchHierarchyUpdates)
+        {
+            m_transformHierarchySystem.Connect();
+        }
     }
 
     //=========================================================================
@@ -100,6 +110,7 @@ namespace AzFramework
     //=========================================================================
     void GameEntityContextComponent::Deactivate()
     {
+        m_transformHierarchySystem.Disconnect();
         m_entityVisibilityBoundsUnionSystem.Disconnect();
 
         GameEntityContextRequestBus::Handler::BusDisconnect();
@@ -145,6 +156,16 @@ namespace AzFramework
         AddEntity(entity);
     }
 
+    //=========================================================================
+    // GameEntityContextRequestBus::AddGameEntities
+    //=========================================================================
+    void GameEntityContextComponent::AddGameEntities(const EntityList& entities)
+    {
+        m_isAddingEntityBatch = true;
+        AddEntities(entities);
+        m_isAddingEntityBatch = false;
+    }
+
 
     //=========================================================================
     // CreateEntity
@@ -216,6 +237,42 @@ namespace AzFramework
         };
     #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
 
+        // Entities added by the components that are activated below aren't part of the batch.
+        const bool isEntityBatch = m_isAddingEntityBatch;
+        m_isAddingEntityBatch = false;
+        if (isEntityBatch)
+        {
+            // Entities added through AddGameEntities are initialized and activated as batches, so components of the same type
+            // across entities are handled together. This changes the order in which components of different entities are
+            // activated, so it's only done for callers that asked for it.
+            EntityList batch;
+            batch.reserve(entities.size());
+            AZ::Entity::BatchProgressCallback progressCallback;
+        #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+            progressCallback = PumpSystemEventsIfNeeded;
+        #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+
+            for (AZ::Entity* entity : entities)
+            {
+                if (entity->GetState() == AZ::Entity::State::Constructed)
+                {
+                    batch.push_back(entity);
+                }
+            }
+            AZ::Entity::InitEntities(batch, progressCallback);
+
+            batch.clear();
+            for (AZ::Entity* entity : entities)
+            {
+                if (entity->GetState() == AZ::Entity::State::Init && entity->IsRuntimeActiveByDefault())
+                {
+                    batch.push_back(entity);
+                }
+            }
+            AZ::Entity::ActivateEntities(batch, progressCallback);
+            return;
+        }
+
         for (AZ::Entity* entity : entities)
         {
             if (entity->GetState() == AZ::Entity::State::Constructed)
@@ -13,6 +13,7 @@
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Component/Component.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
 
@@ -53,6 +54,7 @@ namespace AzFramework
         AZ::Entity* CreateGameEntity(const char* name) override;
         BehaviorEntity CreateGameEntityForBehaviorContext(const char* name) override;
         void AddGameEntity(AZ::Entity* entity) override;
+        void AddGameEntities(const EntityList& entities) override;
         void DestroyGameEntity(const AZ::EntityId&) override;
         void DestroyGameEntityAndDescendants(const AZ::EntityId&) override;
         void ActivateGameEntity(const AZ::EntityId&) override;
@@ -92,6 +94,9 @@ namespace AzFramework
     private:
 
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AzFramework::TransformHierarchySystem m_transformHierarchySystem;
+        //! True while AddGameEntities adds its entities, which are then initialized and activated as a batch.
+        bool m_isAddingEntityBatch = false;
     };
 } // namespace AzFramework
 
@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzFramework/Spawnable/EntityClonePlanCache.h>
+
+namespace AzFramework
+{
+    AZ::Entity* EntityClonePlanCache::CloneEntity(
+        const AZ::Entity& prototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        SetSerializeContext(serializeContext);
+
+        const TypePlan& entityPlan = GetTypePlan(azrtti_typeid<AZ::Entity>());
+        bool isSupported = entityPlan.m_isSupported;
+
+        const AZ::Entity::ComponentArrayType& prototypeComponents = prototype.GetComponents();
+        m_componentPlans.clear();
+        m_componentPlans.reserve(prototypeComponents.size());
+        for (const AZ::Component* component : prototypeComponents)
+        {
+            const TypePlan& componentPlan = GetTypePlan(component->RTTI_GetType());
+            isSupported = isSupported && componentPlan.m_isSupported;
+            m_componentPlans.push_back(&componentPlan);
+        }
+
+        if (!isSupported)
+        {
+            return AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                &prototype, prototypeToCloneMap, &serializeContext);
+        }
+
+        AZ::Entity* clone = serializeContext.CloneObject(&prototype);
+        if (!clone)
+        {
+            return nullptr;
+        }
+
+        const AZ::Entity::ComponentArrayType& cloneComponents = clone->GetComponents();
+        if (cloneComponents.size() != m_componentPlans.size())
+        {
+            // Components that fail to clone are dropped, which means the recorded plans no longer line up with the clone.
+            AZ::IdUtils::Remapper<AZ::EntityId, false>::GenerateNewIdsAndFixRefs(clone, prototypeToCloneMap, &serializeContext);
+            return clone;
+        }
+
+        // Generate all new ids before remapping any references so references between ids on the same entity are resolved,
+        // matching the two passes done by the Remapper.
+        GenerateIds(entityPlan, clone, prototypeToCloneMap);
+        for (size_t i = 0; i < cloneComponents.size(); ++i)
+        {
+            AZ::Component* component = cloneComponents[i];
+            GenerateIds(*m_componentPlans[i], component->RTTI_AddressOf(component->RTTI_GetType()), prototypeToCloneMap);
+        }
+
+        RemapIdReferences(entityPlan, clone, prototypeToCloneMap);
+        for (size_t i = 0; i < cloneComponents.size(); ++i)
+        {
+            AZ::Component* component = cloneComponents[i];
+            RemapIdReferences(*m_componentPlans[i], component->RTTI_AddressOf(component->RTTI_GetType()), prototypeToCloneMap);
+        }
+
+        return clone;
+    }
+
+    bool EntityClonePlanCache::CanCloneConcurrently(
+        const AZ::Entity& prototype,
+        const EntityIdMap& prototypeToCloneMap,
+        const AZStd::unordered_set<AZ::TypeId>& concurrentlyClonableComponentTypes,
+        AZ::SerializeContext& serializeContext)
+    {
+        // Check the opt-in first, it's cheaper than recording layouts and most component types won't have opted in.
+        for (const AZ::Component* component : prototype.GetComponents())
+        {
+            if (!concurrentlyClonableComponentTypes.contains(component->RTTI_GetType()))
+            {
+                return false;
+            }
+        }
+
+        SetSerializeContext(serializeContext);
+
+        const TypePlan& entityPlan = GetTypePlan(azrtti_typeid<AZ::Entity>());
+        if (!entityPlan.m_isSupported || !AreGeneratedIdsMapped(entityPlan, &prototype, prototypeToCloneMap))
+        {
+            return false;
+        }
+
+        for (const AZ::Component* component : prototype.GetComponents())
+        {
+            const TypePlan& componentPlan = GetTypePlan(component->RTTI_GetType());
+            if (!componentPlan.m_isSupported ||
+                !AreGeneratedIdsMapped(componentPlan, component->RTTI_AddressOf(component->RTTI_GetType()), prototypeToCloneMap))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    AZ::Entity* EntityClonePlanCache::CloneEntityConcurrently(
+        const AZ::Entity& prototype, const EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext) const
+    {
+        AZ_Assert(m_serializeContext == &serializeContext, "The entity clone plans were recorded with a different serialize context.");
+
+        AZ::Entity* clone = serializeContext.CloneObject(&prototype);
+        if (!clone)
+        {
+            return nullptr;
+        }
+
+        // Since all generated ids are already mapped, ids and references can be remapped in a single pass.
+        auto entityPlan = m_typePlans.find(azrtti_typeid<AZ::Entity>());
+        AZ_Assert(entityPlan != m_typePlans.end(), "CanCloneConcurrently wasn't called for entity '%s'.", prototype.GetName().c_str());
+        RemapAllIds(entityPlan->second, clone, prototypeToCloneMap);
+
+        // Plans are looked up by the type of the clone's components, in case a component failed to clone.
+        for (AZ::Component* component : clone->GetComponents())
+        {
+            const AZ::TypeId& componentType = component->RTTI_GetType();
+            auto componentPlan = m_typePlans.find(componentType);
+            AZ_Assert(
+                componentPlan != m_typePlans.end(), "CanCloneConcurrently wasn't called for entity '%s'.", prototype.GetName().c_str());
+            if (componentPlan != m_typePlans.end())
+            {
+                RemapAllIds(componentPlan->second, component->RTTI_AddressOf(componentType), prototypeToCloneMap);
+            }
+        }
+
+        return clone;
+    }
+
+    void EntityClonePlanCache::Clear()
+    {
+        m_typePlans.clear();
+        m_typesWithEntityIds.clear();
+        m_componentPlans.clear();
+        m_serializeContext = nullptr;
+    }
+
+    void EntityClonePlanCache::SetSerializeContext(AZ::SerializeContext& serializeContext)
+    {
+        if (m_serializeContext != &serializeContext)
+        {
+            Clear();
+            m_serializeContext = &serializeContext;
+        }
+    }
+
+    auto EntityClonePlanCache::GetTypePlan(const AZ::TypeId& typeId) -> const TypePlan&
+    {
+        auto it = m_typePlans.find(typeId);
+        if (it != m_typePlans.end())
+        {
+            return it->second;
+        }
+
+        TypePlan plan;
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(typeId);
+        if (classData && !classData->m_container)
+        {
+            RecordIdFields(plan, *classData, 0, false);
+        }
+        else
+        {
+            plan.m_isSupported = false;
+        }
+
+        if (!plan.m_isSupported)
+        {
+            // Only the offsets of supported plans are used, so don't hold on to partially recorded ones.
+            plan.m_idFields.clear();
+        }
+        return m_typePlans.emplace(typeId, AZStd::move(plan)).first->second;
+    }
+
+    void EntityClonePlanCache::RecordIdFields(
+        TypePlan& plan, const AZ::SerializeContext::ClassData& classData, size_t baseOffset, bool hasEventHandler)
+    {
+        // The components are cloned and planned separately.
+        const bool isEntity = classData.m_typeId == azrtti_typeid<AZ::Entity>();
+        // Event handlers would have to be told about ids being written, which the plan doesn't do.
+        hasEventHandler = hasEventHandler || classData.m_eventHandler != nullptr;
+
+        for (const AZ::SerializeContext::ClassElement& element : classData.m_elements)
+        {
+            if (!plan.m_isSupported)
+            {
+                return;
+            }
+
+            if (isEntity && element.m_nameCrc == AZ_CRC_CE("Components"))
+            {
+                continue;
+            }
+
+            if (element.m_flags & AZ::SerializeContext::ClassElement::FLG_DYNAMIC_FIELD)
+            {
+                plan.m_isSupported = false;
+                return;
+            }
+
+            if (element.m_typeId == azrtti_typeid<AZ::EntityId>())
+            {
+                if ((element.m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER) || hasEventHandler)
+                {
+                    plan.m_isSupported = false;
+                    return;
+                }
+
+                IdField field;
+                field.m_offset = baseOffset + element.m_offset;
+                if (AZ::Attribute* attribute = AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, element.m_attributes))
+                {
+                    field.m_idGenerator = azrtti_cast<AZ::AttributeFunction<AZ::EntityId()>*>(attribute);
+                }
+                plan.m_idFields.push_back(field);
+                continue;
+            }
+
+            if (element.m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER)
+            {
+                if (ElementMayContainEntityId(element, &classData))
+                {
+                    plan.m_isSupported = false;
+                    return;
+                }
+                continue;
+            }
+
+            const AZ::SerializeContext::ClassData* elementClassData = element.m_genericClassInfo
+                ? element.m_genericClassInfo->GetClassData()
+                : m_serializeContext->FindClassData(element.m_typeId, &classData, element.m_nameCrc);
+            if (!elementClassData || !MayContainEntityId(elementClassData))
+            {
+                continue;
+            }
+
+            if (elementClassData->m_container || elementClassData->m_typeId == azrtti_typeid<AZ::DynamicSerializableField>())
+            {
+                // The number of ids and where they're stored differs per instance.
+                plan.m_isSupported = false;
+                return;
+            }
+
+            RecordIdFields(plan, *elementClassData, baseOffset + element.m_offset, hasEventHandler);
+        }
+    }
+
+    bool EntityClonePlanCache::MayContainEntityId(const AZ::SerializeContext::ClassData* classData)
+    {
+        if (!classData)
+        {
+            return false;
+        }
+
+        const AZ::TypeId& typeId = classData->m_typeId;
+        if (typeId == azrtti_typeid<AZ::EntityId>() || typeId == azrtti_typeid<AZ::DynamicSerializableField>())
+        {
+            return true;
+        }
+
+        auto it = m_typesWithEntityIds.find(typeId);
+        if (it != m_typesWithEntityIds.end())
+        {
+            return it->second;
+        }
+
+        // Assume the type holds ids while it's being resolved so recursive types are treated conservatively.
+        m_typesWithEntityIds[typeId] = true;
+
+        bool result = false;
+        if (classData->m_container)
+        {
+            classData->m_container->EnumTypes(
+                [this, classData, &result](const AZ::Uuid&, const AZ::SerializeContext::ClassElement* element)
+                {
+                    result = element && ElementMayContainEntityId(*element, classData);
+                    return !result;
+                });
+        }
+
+        for (const AZ::SerializeContext::ClassElement& element : classData->m_elements)
+        {
+            if (result)
+            {
+                break;
+            }
+            result = ElementMayContainEntityId(element, classData);
+        }
+
+        m_typesWithEntityIds[typeId] = result;
+        return result;
+    }
+
+    bool EntityClonePlanCache::ElementMayContainEntityId(
+        const AZ::SerializeContext::ClassElement& element, const AZ::SerializeContext::ClassData* parent)
+    {
+        if ((element.m_flags & AZ::SerializeContext::ClassElement::FLG_DYNAMIC_FIELD) || element.m_typeId == azrtti_typeid<AZ::EntityId>())
+        {
+            return true;
+        }
+
+        if ((element.m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER) && element.m_azRtti)
+        {
+            // The pointer may hold a derived type, which is what the Remapper would enumerate.
+            return true;
+        }
+
+        const AZ::SerializeContext::ClassData* elementClassData = element.m_genericClassInfo
+            ? element.m_genericClassInfo->GetClassData()
+            : m_serializeContext->FindClassData(element.m_typeId, parent, element.m_nameCrc);
+        return MayContainEntityId(elementClassData);
+    }
+
+    void EntityClonePlanCache::GenerateIds(const TypePlan& plan, void* instance, EntityIdMap& prototypeToCloneMap)
+    {
+        for (const IdField& field : plan.m_idFields)
+        {
+            if (field.m_idGenerator)
+            {
+                AZ::EntityId& id = *reinterpret_cast<AZ::EntityId*>(reinterpret_cast<char*>(instance) + field.m_offset);
+                auto it = prototypeToCloneMap.find(id);
+                if (it == prototypeToCloneMap.end())
+                {
+                    it = prototypeToCloneMap.emplace(id, field.m_idGenerator->Invoke(nullptr)).first;
+                }
+                id = it->second;
+            }
+        }
+    }
+
+    void EntityClonePlanCache::RemapIdReferences(const TypePlan& plan, void* instance, const EntityIdMap& prototypeToCloneMap)
+    {
+        for (const IdField& field : plan.m_idFields)
+        {
+            if (!field.m_idGenerator)
+            {
+                AZ::EntityId& id = *reinterpret_cast<AZ::EntityId*>(reinterpret_cast<char*>(instance) + field.m_offset);
+                auto it = prototypeToCloneMap.find(id);
+                if (it != prototypeToCloneMap.end())
+                {
+                    id = it->second;
+                }
+            }
+        }
+    }
+
+    void EntityClonePlanCache::RemapAllIds(const TypePlan& plan, void* instance, const EntityIdMap& prototypeToCloneMap)
+    {
+        for (const IdField& field : plan.m_idFields)
+        {
+            AZ::EntityId& id = *reinterpret_cast<AZ::EntityId*>(reinterpret_cast<char*>(instance) + field.m_offset);
+            auto it = prototypeToCloneMap.find(id);
+            if (it != prototypeToCloneMap.end())
+            {
+                id = it->second;
+            }
+        }
+    }
+
+    bool EntityClonePlanCache::AreGeneratedIdsMapped(const TypePlan& plan, const void* instance, const EntityIdMap& prototypeToCloneMap)
+    {
+        for (const IdField& field : plan.m_idFields)
+        {
+            if (field.m_idGenerator)
+            {
+                const AZ::EntityId& id = *reinterpret_cast<const AZ::EntityId*>(reinterpret_cast<const char*>(instance) + field.m_offset);
+                if (!prototypeToCloneMap.contains(id))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+} // namespace AzFramework
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class Entity;
+}
+
+namespace AzFramework
+{
+    //! Cache of flattened entity id layouts used to clone spawnable entities without enumerating every clone through the
+    //! SerializeContext to find the entity ids that need to be generated or remapped.
+    //! The first time a component type is cloned, its class data is walked once to record the offsets of all entity ids that are
+    //! stored directly in the type, including in nested classes. Later clones of any entity using that type replay those offsets.
+    //! Types that can hold entity ids in containers, behind pointers or below classes with serialization event handlers can't
+    //! be described by offsets alone, so entities with components of such types fall back to AZ::IdUtils::Remapper.
+    //! Only the id generation and remapping are replaced. The copy itself still goes through SerializeContext::CloneObject,
+    //! because reflection doesn't tell which members can be copied as raw memory, and components hold a vtable, a pointer to
+    //! their entity and bus connections that must not be copied.
+    //! The cache is not thread safe.
+    class EntityClonePlanCache final
+    {
+    public:
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! Clones the prototype, then generates new ids and fixes up entity references in the clone following the same rules as
+        //! AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs.
+        AZ::Entity* CloneEntity(const AZ::Entity& prototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+
+        //! Records the layouts for the prototype and checks if it can be cloned with CloneEntityConcurrently. This requires all
+        //! components on the prototype to be listed in concurrentlyClonableComponentTypes, all types on the prototype to be supported
+        //! and all ids that would be newly generated to already have a mapping, so cloning doesn't need to add to the map.
+        bool CanCloneConcurrently(
+            const AZ::Entity& prototype,
+            const EntityIdMap& prototypeToCloneMap,
+            const AZStd::unordered_set<AZ::TypeId>& concurrentlyClonableComponentTypes,
+            AZ::SerializeContext& serializeContext);
+        //! Clones a prototype that passed CanCloneConcurrently without changing the cache or the map. Multiple calls can run at the
+        //! same time, as long as no other calls are made to the cache and the map isn't changed until they're done.
+        AZ::Entity* CloneEntityConcurrently(
+            const AZ::Entity& prototype, const EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext) const;
+
+        //! Removes all recorded layouts.
+        void Clear();
+
+    private:
+        struct IdField
+        {
+            //! Set for ids that get a newly generated id, such as the id of the entity itself, instead of being remapped.
+            AZ::AttributeFunction<AZ::EntityId()>* m_idGenerator{ nullptr };
+            size_t m_offset{ 0 };
+        };
+
+        struct TypePlan
+        {
+            AZStd::vector<IdField> m_idFields;
+            bool m_isSupported{ true };
+        };
+
+        const TypePlan& GetTypePlan(const AZ::TypeId& typeId);
+        void RecordIdFields(TypePlan& plan, const AZ::SerializeContext::ClassData& classData, size_t baseOffset, bool hasEventHandler);
+        bool MayContainEntityId(const AZ::SerializeContext::ClassData* classData);
+        bool ElementMayContainEntityId(const AZ::SerializeContext::ClassElement& element, const AZ::SerializeContext::ClassData* parent);
+
+        void SetSerializeContext(AZ::SerializeContext& serializeContext);
+
+        static void GenerateIds(const TypePlan& plan, void* instance, EntityIdMap& prototypeToCloneMap);
+        static void RemapIdReferences(const TypePlan& plan, void* instance, const EntityIdMap& prototypeToCloneMap);
+        static void RemapAllIds(const TypePlan& plan, void* instance, const EntityIdMap& prototypeToCloneMap);
+        static bool AreGeneratedIdsMapped(const TypePlan& plan, const void* instance, const EntityIdMap& prototypeToCloneMap);
+
+        AZStd::unordered_map<AZ::TypeId, TypePlan> m_typePlans;
+        //! Whether or not an instance of a type could hold an entity id anywhere in its hierarchy.
+        AZStd::unordered_map<AZ::TypeId, bool> m_typesWithEntityIds;
+        //! Scratch list of the plans for the components of the entity being cloned.
+        AZStd::vector<const TypePlan*> m_componentPlans;
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+    };
+} // namespace AzFramework
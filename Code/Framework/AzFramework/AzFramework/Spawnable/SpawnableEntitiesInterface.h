@@ -421,6 +421,13 @@ namespace AzFramework
         virtual void LoadBarrier(
             EntitySpawnTicket& ticket, BarrierCallback completionCallback, LoadBarrierOptionalArgs optionalArgs = {}) = 0;
 
+        //! Allows components of the given type to be cloned on the task graph when entities are spawned. Only register types whose
+        //! reflected serialization, including custom serializers, event handlers and allocators, is safe to run on several threads
+        //! at the same time. Entities with any component that isn't registered are cloned on the thread that processes the spawn
+        //! queue. Call this from the main thread, for instance when the system component of a gem is activated.
+        //! @param componentType The type id of the component.
+        virtual void AddConcurrentlyClonableComponentType(const AZ::TypeId& componentType) = 0;
+
     protected:
         [[nodiscard]] virtual void* CreateTicket(AZ::Data::Asset<Spawnable>&& spawnable) = 0;
         virtual void IncrementTicketReference(void* ticket) = 0;
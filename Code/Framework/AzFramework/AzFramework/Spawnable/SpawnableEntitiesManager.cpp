@@ -8,9 +8,12 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -43,6 +46,9 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            settingsRegistry->Get(m_concurrentCloneThreshold, "/O3DE/AzFramework/Spawnables/ConcurrentCloneThreshold");
+            settingsRegistry->Get(m_batchEntityActivation, "/O3DE/AzFramework/Spawnables/BatchEntityActivation");
         }
     }
 
@@ -229,6 +235,11 @@ namespace AzFramework
         return result;
     }
 
+    void SpawnableEntitiesManager::AddConcurrentlyClonableComponentType(const AZ::TypeId& componentType)
+    {
+        m_concurrentlyClonableComponentTypes.insert(componentType);
+    }
+
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
         // Process delayed requests first.
@@ -344,11 +355,12 @@ namespace AzFramework
     AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
         EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
     {
-        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
-        constexpr bool allowDuplicateIds = false;
+        // Cloning on the calling thread may add to the map, so finish the deferred clones that depend on it first.
+        ClonePendingEntities();
 
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-            &entityPrototype, prototypeToCloneMap, &serializeContext);
+        // If the same ID gets remapped more than once, the original remapping is preserved instead of overwritten. Entities with
+        // components the plan cache can't describe are cloned through the AZ::IdUtils::Remapper.
+        return m_clonePlanCache.CloneEntity(entityPrototype, prototypeToCloneMap, serializeContext);
     }
 
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
@@ -358,6 +370,8 @@ namespace AzFramework
         AZ::Entity* previouslySpawnedEntity,
         AZ::SerializeContext& serializeContext)
     {
+        ClonePendingEntities();
+
         AZ::Entity* clone = nullptr;
         switch (alias.m_aliasType)
         {
@@ -410,6 +424,87 @@ namespace AzFramework
         }
     }
 
+    void SpawnableEntitiesManager::SpawnSingleEntity(
+        const AZ::Entity& entityPrototype,
+        AZStd::vector<AZ::Entity*>& spawnedEntities,
+        EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext)
+    {
+        if (!m_clonePlanCache.CanCloneConcurrently(entityPrototype, prototypeToCloneMap, m_concurrentlyClonableComponentTypes, serializeContext))
+        {
+            spawnedEntities.push_back(CloneSingleEntity(entityPrototype, prototypeToCloneMap, serializeContext));
+            return;
+        }
+
+        if (m_pendingClones.m_spawnedEntities != &spawnedEntities || m_pendingClones.m_prototypeToCloneMap != &prototypeToCloneMap ||
+            m_pendingClones.m_serializeContext != &serializeContext)
+        {
+            ClonePendingEntities();
+            m_pendingClones.m_spawnedEntities = &spawnedEntities;
+            m_pendingClones.m_prototypeToCloneMap = &prototypeToCloneMap;
+            m_pendingClones.m_serializeContext = &serializeContext;
+        }
+
+        // Reserve the spot for the clone so the order of the spawned entities matches the order they were requested in.
+        m_pendingClones.m_entries.push_back({ &entityPrototype, spawnedEntities.size() });
+        spawnedEntities.push_back(nullptr);
+    }
+
+    void SpawnableEntitiesManager::ClonePendingEntities()
+    {
+        if (m_pendingClones.m_entries.empty())
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::Entity*>& spawnedEntities = *m_pendingClones.m_spawnedEntities;
+        const EntityIdMap& prototypeToCloneMap = *m_pendingClones.m_prototypeToCloneMap;
+        AZ::SerializeContext& serializeContext = *m_pendingClones.m_serializeContext;
+        const size_t entryCount = m_pendingClones.m_entries.size();
+
+        auto cloneRange = [this, &spawnedEntities, &prototypeToCloneMap, &serializeContext](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const PendingClones::Entry& entry = m_pendingClones.m_entries[i];
+                spawnedEntities[entry.m_spawnedEntityIndex] =
+                    m_clonePlanCache.CloneEntityConcurrently(*entry.m_prototype, prototypeToCloneMap, serializeContext);
+            }
+        };
+
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (entryCount >= m_concurrentCloneThreshold && taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            // Cloning is mostly spent in allocations and reflection lookups, so use batches that are large enough to amortize
+            // the task overhead.
+            constexpr size_t EntitiesPerTask = 16;
+
+            AZ::TaskGraph taskGraph;
+            AZ::TaskDescriptor cloneDescriptor{ "SpawnableEntitiesManager_CloneEntities", "Spawnables" };
+            for (size_t begin = 0; begin < entryCount; begin += EntitiesPerTask)
+            {
+                const size_t end = AZStd::min(begin + EntitiesPerTask, entryCount);
+                taskGraph.AddTask(
+                    cloneDescriptor,
+                    [&cloneRange, begin, end]()
+                    {
+                        AZ_PROFILE_SCOPE(AzFramework, "SpawnableEntitiesManager: CloneEntities");
+                        cloneRange(begin, end);
+                    });
+            }
+
+            AZ::TaskGraphEvent waitForCompletion;
+            taskGraph.Submit(&waitForCompletion);
+            waitForCompletion.Wait();
+        }
+        else
+        {
+            cloneRange(0, entryCount);
+        }
+
+        m_pendingClones.m_entries.clear();
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
         const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
     {
@@ -432,7 +527,9 @@ namespace AzFramework
         if (previouslySpawned.contains(entityId))
         {
             // This entity has already been spawned at least once before, so we need to generate a new id for it and
-            // preserve the new id to fix up any future entity references to this entity.
+            // preserve the new id to fix up any future entity references to this entity. Deferred clones still need to see the
+            // previous id, so complete them first.
+            ClonePendingEntities();
             idMap[entityId] = AZ::Entity::MakeId();
         }
         else
@@ -483,8 +580,8 @@ namespace AzFramework
                         RefreshEntityIdMapping(
                             entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                        SpawnSingleEntity(
+                            *entitiesToSpawn[i], spawnedEntities, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                         spawnedEntityIndices.push_back(i);
                     }
                 }
@@ -498,8 +595,8 @@ namespace AzFramework
 
                         if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
                         {
-                            spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            SpawnSingleEntity(
+                                *entitiesToSpawn[i], spawnedEntities, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                             spawnedEntityIndices.push_back(i);
                         }
                         else
@@ -524,6 +621,8 @@ namespace AzFramework
                     }
                 }
 
+                ClonePendingEntities();
+
                 // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
                 // a new set are not added so it no longer holds exactly the number of entities.
                 ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
@@ -541,7 +640,15 @@ namespace AzFramework
                 {
                     AZ::Entity* clone = (*it);
                     clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    if (!m_batchEntityActivation)
+                    {
+                        GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    }
+                }
+                if (m_batchEntityActivation)
+                {
+                    GameEntityContextRequestBus::Broadcast(
+                        &GameEntityContextRequestBus::Events::AddGameEntities, AZStd::vector<AZ::Entity*>(newEntitiesBegin, newEntitiesEnd));
                 }
 
                 // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
@@ -606,8 +713,8 @@ namespace AzFramework
                             RefreshEntityIdMapping(
                                 entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                            spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            SpawnSingleEntity(
+                                *entitiesToSpawn[index], spawnedEntities, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                             spawnedEntityIndices.push_back(index);
                         }
                     }
@@ -631,8 +738,9 @@ namespace AzFramework
 
                             if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
                             {
-                                spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                SpawnSingleEntity(
+                                    *entitiesToSpawn[index], spawnedEntities, ticket.m_entityIdReferenceMap,
+                                    *request.m_serializeContext);
                                 spawnedEntityIndices.push_back(index);
                             }
                             else
@@ -658,6 +766,7 @@ namespace AzFramework
                         }
                     }
                 }
+                ClonePendingEntities();
                 ticket.m_loadAll = false;
 
                 // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
@@ -674,7 +783,16 @@ namespace AzFramework
                 {
                     AZ::Entity* clone = (*it);
                     clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
+                    if (!m_batchEntityActivation)
+                    {
+                        GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
+                    }
+                }
+                if (m_batchEntityActivation)
+                {
+                    GameEntityContextRequestBus::Broadcast(
+                        &GameEntityContextRequestBus::Events::AddGameEntities,
+                        AZStd::vector<AZ::Entity*>(ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
 
                 if (request.m_completionCallback)
@@ -795,22 +913,21 @@ namespace AzFramework
                 // to spawn every entity, simply start over.
                 ticket.m_spawnedEntityIndices.clear();
                 size_t entitiesToSpawnSize = entities.size();
+                ticket.m_spawnedEntities.reserve(entitiesToSpawnSize);
 
                 for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                 {
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                    AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
-
-                    ticket.m_spawnedEntities.push_back(clone);
+                    SpawnSingleEntity(*entities[i], ticket.m_spawnedEntities, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     ticket.m_spawnedEntityIndices.push_back(i);
                 }
             }
             else
             {
                 size_t entitiesSize = entities.size();
+                ticket.m_spawnedEntities.reserve(ticket.m_spawnedEntityIndices.size());
 
                 for (uint32_t index : ticket.m_spawnedEntityIndices)
                 {
@@ -822,12 +939,15 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                        AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
-                        ticket.m_spawnedEntities.push_back(clone);
+                        SpawnSingleEntity(
+                            *entities[index], ticket.m_spawnedEntities, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     }
                 }
             }
+            ClonePendingEntities();
+            AZ_Assert(
+                AZStd::find(ticket.m_spawnedEntities.begin(), ticket.m_spawnedEntities.end(), nullptr) == ticket.m_spawnedEntities.end(),
+                "Failed to clone spawnable entity.");
             ticket.m_spawnable = AZStd::move(request.m_spawnable);
 
             if (request.m_completionCallback)
@@ -11,11 +11,13 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Spawnable/EntityClonePlanCache.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
 namespace AZ
@@ -88,6 +90,9 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(CommandQueuePriority priority);
 
+        //! This function isn't thread safe and shouldn't be called while the queue is being processed.
+        void AddConcurrentlyClonableComponentType(const AZ::TypeId& componentType) override;
+
     protected:
         enum class CommandResult : bool
         {
@@ -277,6 +282,16 @@ namespace AzFramework
             const AZ::Entity::ComponentArrayType& componentPrototypes,
             EntityIdMap& prototypeToCloneMap,
             AZ::SerializeContext& serializeContext);
+        //! Adds a clone of the prototype to the spawned entities. If possible the clone is deferred so it can be made together with
+        //! other clones on the task graph, in which case the entry in the spawned entities is filled in by ClonePendingEntities.
+        void SpawnSingleEntity(
+            const AZ::Entity& entityPrototype,
+            AZStd::vector<AZ::Entity*>& spawnedEntities,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
+        //! Makes all clones deferred by SpawnSingleEntity. This has to be called before the entity id map is changed and before the
+        //! spawned entities are used.
+        void ClonePendingEntities();
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
@@ -302,15 +317,45 @@ namespace AzFramework
         void RefreshEntityIdMapping(
             const AZ::EntityId& entityId, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned);
 
+        //! Clones deferred by SpawnSingleEntity. All clones share the same entity id map and serialize context and write their result
+        //! into the same list of spawned entities.
+        struct PendingClones
+        {
+            struct Entry
+            {
+                const AZ::Entity* m_prototype;
+                size_t m_spawnedEntityIndex;
+            };
+
+            AZStd::vector<Entry> m_entries;
+            AZStd::vector<AZ::Entity*>* m_spawnedEntities{ nullptr };
+            const EntityIdMap* m_prototypeToCloneMap{ nullptr };
+            AZ::SerializeContext* m_serializeContext{ nullptr };
+        };
+
         Queue m_highPriorityQueue;
         Queue m_regularPriorityQueue;
+        PendingClones m_pendingClones;
 
         AZ::SerializeContext* m_defaultSerializeContext { nullptr };
+        //! Recorded entity id layouts of the entity and component types that have been spawned, used to remap the ids of clones.
+        EntityClonePlanCache m_clonePlanCache;
         //! The threshold used to determine if a request goes in the regular (if bigger than the value) or high priority queue (if smaller
         //! or equal to this value). The starting value of 64 is chosen as it's between default values SpawnablePriority_High and
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The minimum number of deferred clones before they're spread over the task graph instead of being cloned on the calling thread.
+        //! This value can be configured through the Settings Registry under the key
+        //! "/O3DE/AzFramework/Spawnables/ConcurrentCloneThreshold".
+        AZ::u64 m_concurrentCloneThreshold { 64 };
+        //! If true, the entities of a spawn request are added to the game entity context with a single AddGameEntities call, so
+        //! they're initialized and activated as a batch. This changes the order in which the components of the spawned entities
+        //! are activated relative to each other, so it's off by default. This value can be configured through the Settings
+        //! Registry under the key "/O3DE/AzFramework/Spawnables/BatchEntityActivation".
+        bool m_batchEntityActivation { false };
+        //! Component types that opted in to being cloned on the task graph through AddConcurrentlyClonableComponentType.
+        AZStd::unordered_set<AZ::TypeId> m_concurrentlyClonableComponentTypes;
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzFramework/Components/NonUniformScaleComponent.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 #include <AzFramework/Spawnable/SpawnableSystemComponent.h>
@@ -161,6 +162,11 @@ namespace AzFramework
         AZ::Data::AssetCatalogRequestBus::Broadcast(
             &AZ::Data::AssetCatalogRequestBus::Events::AddExtension, Spawnable::FileExtension);
 
+        // The components of the framework that only hold plain reflected data, so they can be cloned on the task graph. Gems can
+        // register their own components through SpawnableEntitiesInterface.
+        m_entitiesManager.AddConcurrentlyClonableComponentType(azrtti_typeid<TransformComponent>());
+        m_entitiesManager.AddConcurrentlyClonableComponentType(azrtti_typeid<NonUniformScaleComponent>());
+
         // Register for the CriticalAssetsCompiled lifecycle event to trigger the loading of the root spawnable
         auto settingsRegistry = AZ::SettingsRegistry::Get();
         AZ_Assert(settingsRegistry, "Unable to change root spawnable callback because Settings Registry is not available.");
@@ -57,6 +57,9 @@ namespace AzFramework
         {
             const AZ::Aabb m_bounds;
             const AZStd::vector<VisibilityEntry*>& m_entries;
+            //! Changes whenever an entry is added to, removed from or updated within the node.
+            //! Versions are never reused within a scene, so callers can use them to detect nodes that haven't changed.
+            const uint64_t m_version = 0;
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
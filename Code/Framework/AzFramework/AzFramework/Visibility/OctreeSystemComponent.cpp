@@ -35,6 +35,7 @@ namespace AzFramework
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
+        , m_version(rhs.m_version)
     {
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -49,6 +50,7 @@ namespace AzFramework
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
+        m_version = rhs.m_version;
 
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -90,6 +92,7 @@ namespace AzFramework
             m_entries.push_back(entry);
             entry->m_internalNode = this;
             entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+            MarkModified(octreeScene);
         }
     }
 
@@ -103,6 +106,7 @@ namespace AzFramework
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
+            MarkModified(octreeScene);
             return;
         }
 
@@ -138,6 +142,7 @@ namespace AzFramework
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
         }
         m_entries.pop_back();
+        MarkModified(octreeScene);
 
         if (m_parent != nullptr)
         {
@@ -174,7 +179,7 @@ namespace AzFramework
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_bounds, m_entries, m_version});
         }
 
         if (m_children != nullptr)
@@ -238,7 +243,7 @@ namespace AzFramework
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_bounds, m_entries, m_version});
         }
 
         if (m_children != nullptr)
@@ -324,6 +329,12 @@ namespace AzFramework
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
         m_childNodeIndex = InvalidChildNodeIndex;
         m_children = nullptr;
+        MarkModified(octreeScene);
+    }
+
+    void OctreeNode::MarkModified(OctreeScene& octreeScene)
+    {
+        m_version = ++octreeScene.m_nodeVersionCounter;
     }
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
@@ -75,6 +75,7 @@ namespace AzFramework
 
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
+        void MarkModified(OctreeScene& octreeScene);
 
         // The page is stored in the upper 16-bits of the child node index, the offset into the page is the lower 16-bits
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
@@ -84,6 +85,7 @@ namespace AzFramework
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+        uint64_t m_version = 0; //< Assigned from the scene's version counter each time the entry set or one of its entries changes.
     };
 
     //! Implementation of the visibility system interface.
@@ -132,6 +134,7 @@ namespace AzFramework
 
         uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
         uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the octreeSystemComponent, at least one for the root node.
+        uint64_t m_nodeVersionCounter = 0; //< Source of the node versions, only modified while holding the unique lock.
 
         static constexpr uint32_t BlockSize = 8192; //< This represents the number of nodes that can be stored in each page
         static_assert(BlockSize < 0xFFFF, "BlockSize must be less than 2^16");
@@ -128,6 +128,9 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/ITransformHierarchy.h
+    Components/TransformHierarchySystem.cpp
+    Components/TransformHierarchySystem.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -311,6 +314,8 @@ set(FILES
     Render/Intersector.cpp
     Render/Intersector.h
     Render/IntersectorInterface.h
+    Spawnable/EntityClonePlanCache.h
+    Spawnable/EntityClonePlanCache.cpp
     Spawnable/RootSpawnableInterface.h
     Spawnable/Script/SpawnableScriptAssetRef.cpp
     Spawnable/Script/SpawnableScriptAssetRef.h
@@ -70,6 +70,7 @@ namespace AzFramework
 
         MOCK_METHOD3(Barrier, void(EntitySpawnTicket& ticket, BarrierCallback completionCallback, BarrierOptionalArgs optionalArgs));
         MOCK_METHOD3(LoadBarrier, void(EntitySpawnTicket& ticket, BarrierCallback completionCallback, LoadBarrierOptionalArgs optionalArgs));
+        MOCK_METHOD1(AddConcurrentlyClonableComponentType, void(const AZ::TypeId& componentType));
 
         MOCK_METHOD1(CreateTicket, void*(AZ::Data::Asset<Spawnable>&& spawnable));
         MOCK_METHOD1(IncrementTicketReference, void(void* ticket));
@@ -186,6 +186,45 @@ namespace UnitTest
         EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
     }
 
+    TEST_F(OctreeTests, NodeVersion_UpdateEntry_OnlyChangesVersionOfModifiedNode)
+    {
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        m_octreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->InsertOrUpdateEntry(visEntry[1]); // This should force a split of the root node
+
+        auto getNodeVersions = [this]()
+        {
+            AZStd::unordered_map<const AzFramework::VisibilityEntry*, uint64_t> nodeVersions;
+            m_octreeScene->EnumerateNoCull([&nodeVersions](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                {
+                    nodeVersions[entry] = nodeData.m_version;
+                }
+            });
+            return nodeVersions;
+        };
+
+        auto versionsBefore = getNodeVersions();
+        ASSERT_EQ(versionsBefore.size(), 2u);
+        EXPECT_NE(versionsBefore[&visEntry[0]], versionsBefore[&visEntry[1]]);
+
+        // Move the second entry within its leaf node, which doesn't change the structure of the octree
+        const AzFramework::VisibilityNode* nodeBefore = visEntry[1].m_internalNode;
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.2f), AZ::Vector3(0.5f));
+        m_octreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[1].m_internalNode, nodeBefore);
+
+        auto versionsAfter = getNodeVersions();
+        EXPECT_EQ(versionsAfter[&visEntry[0]], versionsBefore[&visEntry[0]]);
+        EXPECT_NE(versionsAfter[&visEntry[1]], versionsBefore[&visEntry[1]]);
+
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        m_octreeScene->RemoveEntry(visEntry[0]);
+    }
+
     TEST_F(OctreeTests, UpdateSplitMerge)
     {
         AzFramework::VisibilityEntry visEntry[3];
@@ -98,6 +98,59 @@ namespace UnitTest
         AZ::EntityId m_parent;
     };
 
+    // Test component that stores its entity reference in a nested class, which the clone plans record as a plain offset.
+    class ComponentWithNestedEntityReference : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithNestedEntityReference, "{0E1B7B8D-5C3F-4A8E-9E3B-2D6A1C7F4E90}");
+
+        struct Reference
+        {
+            AZ_TYPE_INFO(Reference, "{6A0E2C55-3B1D-4F7A-8C2E-91D4B7E3A5F6}");
+
+            int m_weight{ 0 };
+            AZ::EntityId m_entityReference;
+        };
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<Reference>()
+                    ->Field("Weight", &Reference::m_weight)
+                    ->Field("EntityReference", &Reference::m_entityReference);
+                serializeContext->Class<ComponentWithNestedEntityReference, AZ::Component>()
+                    ->Field("Reference", &ComponentWithNestedEntityReference::m_reference);
+            }
+        }
+
+        Reference m_reference;
+    };
+
+    // Test component that stores entity references in a container, which the clone plans can't describe.
+    class ComponentWithEntityReferenceList : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithEntityReferenceList, "{D3F1A7C2-8B64-4E0F-A5D9-7C2B3E1F6A84}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithEntityReferenceList, AZ::Component>()
+                    ->Field("EntityReferences", &ComponentWithEntityReferenceList::m_entityReferences);
+            }
+        }
+
+        AZStd::vector<AZ::EntityId> m_entityReferences;
+    };
+
     class SpawnableEntitiesManagerTest : public AllocatorsFixture
     {
     public:
@@ -113,6 +166,8 @@ namespace UnitTest
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
             m_application->RegisterComponentDescriptor(SourceSpawnableComponent::CreateDescriptor());
             m_application->RegisterComponentDescriptor(TargetSpawnableComponent::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithNestedEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithEntityReferenceList::CreateDescriptor());
 
             // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
             // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
@@ -620,6 +675,157 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_NestedEntityReferences_EntityIdsAreMappedCorrectlyOnEverySpawn)
+    {
+        // The first spawn records the clone plan for the component, later spawns replay it.
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            auto component = prototypes[i]->CreateComponent<ComponentWithNestedEntityReference>();
+            component->m_reference.m_weight = aznumeric_cast<int>(i);
+            component->m_reference.m_entityReference = prototypes[(i + 1) % NumEntities]->GetId();
+        }
+
+        auto callback = [](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(0, entities.size() % NumEntities);
+            for (size_t i = 0; i < entities.size(); ++i)
+            {
+                const size_t batchOffset = (i / NumEntities) * NumEntities;
+                const size_t batchIndex = i - batchOffset;
+                const AZ::Entity* const entity = *(entities.begin() + i);
+                const AZ::Entity* const referenced = *(entities.begin() + batchOffset + ((batchIndex + 1) % NumEntities));
+
+                auto component = entity->FindComponent<ComponentWithNestedEntityReference>();
+                ASSERT_NE(nullptr, component);
+                EXPECT_EQ(aznumeric_cast<int>(batchIndex), component->m_reference.m_weight);
+                EXPECT_EQ(referenced->GetId(), component->m_reference.m_entityReference);
+                EXPECT_NE(EntityIdStartId + batchIndex, static_cast<AZ::u64>(entity->GetId()));
+            }
+        };
+
+        constexpr size_t NumSpawnAllCalls = 3;
+        for (size_t spawns = 0; spawns < NumSpawnAllCalls; ++spawns)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        }
+        m_manager->ListEntities(*m_ticket, callback);
+        ProcessQueueTillEmtpy();
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_EntityReferencesInContainer_EntityIdsAreMappedCorrectly)
+    {
+        // Entity ids in containers can't be described by the clone plans so these entities are cloned through the fallback.
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            auto component = prototypes[i]->CreateComponent<ComponentWithEntityReferenceList>();
+            for (size_t j = 0; j < NumEntities; ++j)
+            {
+                component->m_entityReferences.push_back(prototypes[j]->GetId());
+            }
+        }
+
+        auto callback = [](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(0, entities.size() % NumEntities);
+            for (size_t i = 0; i < entities.size(); ++i)
+            {
+                const size_t batchOffset = (i / NumEntities) * NumEntities;
+                auto component = (*(entities.begin() + i))->FindComponent<ComponentWithEntityReferenceList>();
+                ASSERT_NE(nullptr, component);
+                ASSERT_EQ(NumEntities, component->m_entityReferences.size());
+                for (size_t j = 0; j < NumEntities; ++j)
+                {
+                    EXPECT_EQ((*(entities.begin() + batchOffset + j))->GetId(), component->m_entityReferences[j]);
+                }
+            }
+        };
+
+        constexpr size_t NumSpawnAllCalls = 2;
+        for (size_t spawns = 0; spawns < NumSpawnAllCalls; ++spawns)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        }
+        m_manager->ListEntities(*m_ticket, callback);
+        ProcessQueueTillEmtpy();
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_LargeSpawnableWithReferences_EntityIdsAreMappedCorrectly)
+    {
+        // Enough entities for the clones to be spread over the task graph. The entities should still be spawned in order and
+        // refer to the entities in their own batch.
+        static constexpr size_t NumEntities = 512;
+        m_manager->AddConcurrentlyClonableComponentType(azrtti_typeid<SourceSpawnableComponent>());
+        m_manager->AddConcurrentlyClonableComponentType(azrtti_typeid<ComponentWithEntityReference>());
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferencePreviousCircular);
+
+        auto callback = [this](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferencePreviousCircular, NumEntities, entities);
+        };
+
+        size_t callbackCount = 0;
+        constexpr size_t NumSpawnAllCalls = 2;
+        for (size_t spawns = 0; spawns < NumSpawnAllCalls; ++spawns)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback =
+                [&callback, &callbackCount](AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                ASSERT_EQ(NumEntities, entities.size());
+                callback(ticketId, entities);
+                ++callbackCount;
+            };
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        }
+        m_manager->ListEntities(*m_ticket, callback);
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumSpawnAllCalls, callbackCount);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_LargeSpawnableWithoutConcurrentlyClonableTypes_EntityIdsAreMappedCorrectly)
+    {
+        // None of the component types opted in to concurrent cloning, so all entities are cloned on the calling thread.
+        static constexpr size_t NumEntities = 512;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferencePreviousCircular);
+
+        auto callback = [this](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferencePreviousCircular, NumEntities, entities);
+        };
+
+        size_t callbackCount = 0;
+        constexpr size_t NumSpawnAllCalls = 2;
+        for (size_t spawns = 0; spawns < NumSpawnAllCalls; ++spawns)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback =
+                [&callback, &callbackCount](AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                ASSERT_EQ(NumEntities, entities.size());
+                callback(ticketId, entities);
+                ++callbackCount;
+            };
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        }
+        m_manager->ListEntities(*m_ticket, callback);
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumSpawnAllCalls, callbackCount);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -8,49 +8,66 @@
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <climits>
 #include <cinttypes>
 
 namespace AzNetworking
 {
+    TimeoutQueue::TimeoutQueue()
+    {
+        Reset();
+    }
+
     void TimeoutQueue::Reset()
     {
-        m_timeoutItemMap.clear();
-        m_timeoutItemQueue = TimeoutItemQueue();
-        m_nextTimeoutId = TimeoutId{0};
+        m_nodes.clear();
+        m_listHeads.fill(InvalidIndex);
+        m_occupiedSlots.fill(0);
+        m_expiredTail = InvalidIndex;
+        m_freeHead = InvalidIndex;
+        m_itemCount = 0;
+        m_nextTick = 0;
     }
 
     TimeoutId TimeoutQueue::RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs)
     {
-        const TimeoutId timeoutId = m_nextTimeoutId;
-        const AZ::TimeMs timeoutTimeMs = AZ::GetElapsedTimeMs() + timeoutMs;
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (m_itemCount == 0)
+        {
+            // Nothing is scheduled, so the wheel can jump straight to the current time
+            m_nextTick = aznumeric_cast<int64_t>(currentTimeMs);
+        }
+
+        const uint32_t index = AllocateNode();
+        const TimeoutId timeoutId = MakeTimeoutId(index);
+        TimeoutNode& node = m_nodes[index];
+        node.m_item = TimeoutItem(userData, timeoutMs);
+        ScheduleNode(index, node.m_item.m_nextTimeoutTimeMs);
+
         AZLOG(TimeoutQueue, "Pushing timeoutid %u with user data %" PRIu64 " to expire at time %u",
             aznumeric_cast<uint32_t>(timeoutId),
             userData,
-            aznumeric_cast<uint32_t>(timeoutTimeMs)
+            aznumeric_cast<uint32_t>(node.m_item.m_nextTimeoutTimeMs)
         );
 
-        TimeoutQueueItem queueItem(timeoutId, timeoutTimeMs);
-        m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
-        m_timeoutItemQueue.push(queueItem);
-        ++m_nextTimeoutId;
-
         return timeoutId;
     }
 
     TimeoutQueue::TimeoutItem *TimeoutQueue::RetrieveItem(TimeoutId timeoutId)
     {
-        TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
-        if (iter != m_timeoutItemMap.end())
-        {
-            return &(iter->second);
-        }
-        return nullptr;
+        TimeoutNode* node = FindNode(timeoutId);
+        return (node != nullptr) ? &node->m_item : nullptr;
     }
 
     void TimeoutQueue::RemoveItem(TimeoutId timeoutId)
     {
-        m_timeoutItemMap.erase(timeoutId);
+        if (FindNode(timeoutId) != nullptr)
+        {
+            const uint32_t index = aznumeric_cast<uint32_t>(timeoutId) & IndexMask;
+            UnlinkNode(index);
+            FreeNode(index);
+        }
     }
 
     void TimeoutQueue::UpdateTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts)
@@ -61,56 +78,47 @@ namespace AzNetworking
             maxTimeouts = INT_MAX;
         }
         AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-        while (m_timeoutItemQueue.size() > 0)
-        {
-            const TimeoutQueueItem queueItem = m_timeoutItemQueue.top();
-            const TimeoutId    itemTimeoutId = queueItem.m_timeoutId;
-            const AZ::TimeMs   itemTimeoutMs = queueItem.m_timeoutTimeMs;
+        AdvanceTo(aznumeric_cast<int64_t>(currentTimeMs));
 
-            // Head item has not timed out yet, we can terminate because we've run out of timed out items
-            if (itemTimeoutMs >= currentTimeMs)
-            {
-                break;
-            }
+        while (m_listHeads[ExpiredList] != InvalidIndex)
+        {
+            const uint32_t index = m_listHeads[ExpiredList];
 
             ++numTimeouts;
 
             if (numTimeouts >= maxTimeouts)
             {
+                // Remaining expired items stay in the expired list and are processed first on the next update
                 AZLOG_WARN("Terminating timeout queue iteration due to hitting timeout count limit: %d", numTimeouts);
                 break;
             }
 
-            // Pop the item, we're either going to time it out or reinsert it
-            m_timeoutItemQueue.pop();
+            UnlinkNode(index);
 
-            TimeoutItemMap::iterator iter = m_timeoutItemMap.find(itemTimeoutId);
-            if (iter == m_timeoutItemMap.end())
+            // Check to see if the item has been refreshed since it was inserted
+            if (m_nodes[index].m_item.m_nextTimeoutTimeMs > currentTimeMs)
             {
-                // Item has already been deleted, just continue
+                ScheduleNode(index, m_nodes[index].m_item.m_nextTimeoutTimeMs);
                 continue;
             }
 
-            TimeoutItem mapItem = iter->second;
+            // By this point, the item is definitely timed out
+            // Invoke the timeout function on a copy, the handler may register or remove items which could reuse this node
+            const TimeoutId itemTimeoutId = MakeTimeoutId(index);
+            TimeoutItem mapItem = m_nodes[index].m_item;
+            const TimeoutResult result = timeoutHandler(mapItem);
 
-            // Check to see if the item has been refreshed since it was inserted
-            if (mapItem.m_nextTimeoutTimeMs > currentTimeMs)
+            if (FindNode(itemTimeoutId) == nullptr)
             {
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                // The handler removed the item itself
                 continue;
             }
 
-            // By this point, the item is definitely timed out
-            // Invoke the timeout function to see how to proceed
-            const TimeoutResult result = timeoutHandler(mapItem);
-
             if (result == TimeoutResult::Refresh)
             {
                 mapItem.UpdateTimeoutTime(currentTimeMs);
-                // Re-insert into priority queue
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                m_nodes[index].m_item = mapItem;
+                ScheduleNode(index, mapItem.m_nextTimeoutTimeMs);
                 continue;
             }
 
@@ -119,7 +127,226 @@ namespace AzNetworking
                 mapItem.m_userData,
                 aznumeric_cast<uint32_t>(mapItem.m_nextTimeoutTimeMs),
                 aznumeric_cast<uint32_t>(currentTimeMs));
-            m_timeoutItemMap.erase(itemTimeoutId);
+            FreeNode(index);
+        }
+    }
+
+    TimeoutId TimeoutQueue::MakeTimeoutId(uint32_t index) const
+    {
+        return TimeoutId{ (m_nodes[index].m_generation << IndexBits) | index };
+    }
+
+    TimeoutQueue::TimeoutNode* TimeoutQueue::FindNode(TimeoutId timeoutId)
+    {
+        const uint32_t index = aznumeric_cast<uint32_t>(timeoutId) & IndexMask;
+        if ((index < m_nodes.size()) && m_nodes[index].m_allocated && (MakeTimeoutId(index) == timeoutId))
+        {
+            return &m_nodes[index];
+        }
+        return nullptr;
+    }
+
+    uint32_t TimeoutQueue::AllocateNode()
+    {
+        uint32_t index = m_freeHead;
+        if (index != InvalidIndex)
+        {
+            m_freeHead = m_nodes[index].m_next;
+        }
+        else
+        {
+            index = aznumeric_cast<uint32_t>(m_nodes.size());
+            AZ_Assert(index <= IndexMask, "TimeoutQueue exceeded the maximum of %u concurrent items", IndexMask + 1);
+            m_nodes.emplace_back();
+        }
+
+        TimeoutNode& node = m_nodes[index];
+        node.m_prev = InvalidIndex;
+        node.m_next = InvalidIndex;
+        node.m_list = NoList;
+        node.m_allocated = true;
+        ++m_itemCount;
+        return index;
+    }
+
+    void TimeoutQueue::FreeNode(uint32_t index)
+    {
+        TimeoutNode& node = m_nodes[index];
+        node.m_allocated = false;
+        // Bump the generation so that stale identifiers for this node are rejected
+        node.m_generation = (node.m_generation + 1) & (0xFFFFFFFF >> IndexBits);
+        node.m_next = m_freeHead;
+        m_freeHead = index;
+        --m_itemCount;
+    }
+
+    void TimeoutQueue::LinkNode(uint32_t index, uint32_t list)
+    {
+        TimeoutNode& node = m_nodes[index];
+        node.m_list = list;
+        if (list == ExpiredList)
+        {
+            // The expired list is kept in expiry order, so append
+            node.m_prev = m_expiredTail;
+            node.m_next = InvalidIndex;
+            if (m_expiredTail != InvalidIndex)
+            {
+                m_nodes[m_expiredTail].m_next = index;
+            }
+            else
+            {
+                m_listHeads[ExpiredList] = index;
+            }
+            m_expiredTail = index;
+            return;
+        }
+
+        node.m_prev = InvalidIndex;
+        node.m_next = m_listHeads[list];
+        if (node.m_next != InvalidIndex)
+        {
+            m_nodes[node.m_next].m_prev = index;
+        }
+        m_listHeads[list] = index;
+        m_occupiedSlots[list / SlotCount] |= uint64_t(1) << (list & SlotMask);
+    }
+
+    void TimeoutQueue::UnlinkNode(uint32_t index)
+    {
+        TimeoutNode& node = m_nodes[index];
+        const uint32_t list = node.m_list;
+        if (list == NoList)
+        {
+            return;
+        }
+
+        if (node.m_prev != InvalidIndex)
+        {
+            m_nodes[node.m_prev].m_next = node.m_next;
+        }
+        else
+        {
+            m_listHeads[list] = node.m_next;
+        }
+
+        if (node.m_next != InvalidIndex)
+        {
+            m_nodes[node.m_next].m_prev = node.m_prev;
+        }
+        else if (list == ExpiredList)
+        {
+            m_expiredTail = node.m_prev;
+        }
+
+        if ((list != ExpiredList) && (m_listHeads[list] == InvalidIndex))
+        {
+            m_occupiedSlots[list / SlotCount] &= ~(uint64_t(1) << (list & SlotMask));
+        }
+
+        node.m_prev = InvalidIndex;
+        node.m_next = InvalidIndex;
+        node.m_list = NoList;
+    }
+
+    void TimeoutQueue::ScheduleNode(uint32_t index, AZ::TimeMs timeoutTimeMs)
+    {
+        // Items time out once the current time has passed their timeout time, so they expire on the following tick
+        m_nodes[index].m_expiryTick = aznumeric_cast<int64_t>(timeoutTimeMs) + 1;
+        InsertNode(index);
+    }
+
+    void TimeoutQueue::InsertNode(uint32_t index)
+    {
+        TimeoutNode& node = m_nodes[index];
+        const int64_t delta = node.m_expiryTick - m_nextTick;
+        if (delta < 0)
+        {
+            LinkNode(index, ExpiredList);
+            return;
+        }
+
+        // Items further out than the wheel can represent are parked in the furthest slot, and rescheduled once it expires
+        const int64_t expiryTick = (delta > MaxScheduleTicks) ? m_nextTick + MaxScheduleTicks : node.m_expiryTick;
+        const int64_t clampedDelta = expiryTick - m_nextTick;
+        uint32_t level = 0;
+        while ((level + 1 < LevelCount) && (clampedDelta >= (int64_t(1) << (SlotBits * (level + 1)))))
+        {
+            ++level;
+        }
+        const uint32_t slot = aznumeric_cast<uint32_t>(expiryTick >> (SlotBits * level)) & SlotMask;
+        LinkNode(index, level * SlotCount + slot);
+    }
+
+    void TimeoutQueue::ExpireSlot(uint32_t list)
+    {
+        while (m_listHeads[list] != InvalidIndex)
+        {
+            const uint32_t index = m_listHeads[list];
+            UnlinkNode(index);
+            LinkNode(index, ExpiredList);
+        }
+    }
+
+    void TimeoutQueue::Cascade(uint32_t level)
+    {
+        if (level >= LevelCount)
+        {
+            return;
+        }
+
+        const uint32_t slot = aznumeric_cast<uint32_t>(m_nextTick >> (SlotBits * level)) & SlotMask;
+        const uint32_t list = level * SlotCount + slot;
+        uint32_t index = m_listHeads[list];
+        m_listHeads[list] = InvalidIndex;
+        m_occupiedSlots[level] &= ~(uint64_t(1) << slot);
+        while (index != InvalidIndex)
+        {
+            const uint32_t next = m_nodes[index].m_next;
+            m_nodes[index].m_list = NoList;
+            InsertNode(index);
+            index = next;
+        }
+
+        if (slot == 0)
+        {
+            Cascade(level + 1);
+        }
+    }
+
+    void TimeoutQueue::AdvanceTo(int64_t currentTick)
+    {
+        if (m_itemCount == 0)
+        {
+            m_nextTick = AZStd::max(m_nextTick, currentTick + 1);
+            return;
+        }
+
+        while (m_nextTick <= currentTick)
+        {
+            const uint32_t slot = aznumeric_cast<uint32_t>(m_nextTick) & SlotMask;
+            if (slot == 0)
+            {
+                Cascade(1);
+            }
+
+            // Skip over empty slots in the current rotation of the lowest level
+            const uint64_t pendingSlots = m_occupiedSlots[0] >> slot;
+            if (pendingSlots == 0)
+            {
+                m_nextTick = AZStd::min((m_nextTick | SlotMask) + 1, currentTick + 1);
+                continue;
+            }
+
+            const int64_t expiryTick = m_nextTick + az_ctz_u64(pendingSlots);
+            if (expiryTick > currentTick)
+            {
+                m_nextTick = currentTick + 1;
+                break;
+            }
+
+            m_nextTick = expiryTick;
+            ExpireSlot(aznumeric_cast<uint32_t>(m_nextTick) & SlotMask);
+            ++m_nextTick;
         }
     }
 }
@@ -10,8 +10,8 @@
 
 #include <AzCore/Time/ITime.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
-#include <AzCore/std/containers/map.h>
-#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
 
 namespace AzNetworking
 {
@@ -25,6 +25,10 @@ namespace AzNetworking
 
     //! @class TimeoutQueue
     //! @brief class for managing timeout items.
+    //!
+    //! Items are stored in a hierarchical timer wheel with millisecond resolution, so registering and removing an item are constant
+    //! time and do not allocate once the internal item pool has grown to the peak number of items. Expired items are gathered into a
+    //! batch each update, in expiry order, before the timeout handler is invoked.
     class TimeoutQueue
     {
     public:
@@ -41,7 +45,7 @@ namespace AzNetworking
             AZ::TimeMs m_nextTimeoutTimeMs = AZ::Time::ZeroTimeMs;
         };
 
-        TimeoutQueue() = default;
+        TimeoutQueue();
         ~TimeoutQueue() = default;
 
         //! Resets all internal state for this timeout queue.
@@ -70,22 +74,54 @@ namespace AzNetworking
 
     private:
 
-        struct TimeoutQueueItem
-        {
-            TimeoutQueueItem(TimeoutId timeoutId, AZ::TimeMs timeoutTimeMs);
+        static constexpr uint32_t SlotBits = 6;
+        static constexpr uint32_t SlotCount = 1 << SlotBits;
+        static constexpr uint32_t SlotMask = SlotCount - 1;
+        static constexpr uint32_t LevelCount = 4;
+        static constexpr int64_t MaxScheduleTicks = (int64_t(1) << (SlotBits * LevelCount)) - 1;
 
-            bool operator < (const TimeoutQueueItem &rhs) const;
+        static constexpr uint32_t IndexBits = 22;
+        static constexpr uint32_t IndexMask = (1 << IndexBits) - 1;
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
 
-            TimeoutId m_timeoutId;
-            AZ::TimeMs m_timeoutTimeMs;
-        };
+        // The list of expired items waiting for the timeout handler follows the wheel slot lists
+        static constexpr uint32_t ExpiredList = SlotCount * LevelCount;
+        static constexpr uint32_t NoList = ExpiredList + 1;
 
-        using TimeoutItemMap   = AZStd::map<TimeoutId, TimeoutItem>;
-        using TimeoutItemQueue = AZStd::priority_queue<TimeoutQueueItem>;
+        struct TimeoutNode
+        {
+            TimeoutItem m_item;
+            int64_t m_expiryTick = 0;
+            uint32_t m_prev = InvalidIndex;
+            uint32_t m_next = InvalidIndex;
+            uint32_t m_list = NoList;
+            uint32_t m_generation = 0;
+            bool m_allocated = false;
+        };
 
-        TimeoutId        m_nextTimeoutId = TimeoutId{ 0 };
-        TimeoutItemMap   m_timeoutItemMap;
-        TimeoutItemQueue m_timeoutItemQueue;
+        TimeoutId MakeTimeoutId(uint32_t index) const;
+        TimeoutNode* FindNode(TimeoutId timeoutId);
+        uint32_t AllocateNode();
+        void FreeNode(uint32_t index);
+
+        void LinkNode(uint32_t index, uint32_t list);
+        void UnlinkNode(uint32_t index);
+        void ScheduleNode(uint32_t index, AZ::TimeMs timeoutTimeMs);
+        void InsertNode(uint32_t index);
+        void ExpireSlot(uint32_t list);
+        void Cascade(uint32_t level);
+        void AdvanceTo(int64_t currentTick);
+
+        // Nodes are kept in a deque so that pointers returned by RetrieveItem remain stable as the pool grows
+        AZStd::deque<TimeoutNode> m_nodes;
+        AZStd::array<uint32_t, NoList> m_listHeads;
+        AZStd::array<uint64_t, LevelCount> m_occupiedSlots = {};
+        uint32_t m_expiredTail = InvalidIndex;
+        uint32_t m_freeHead = InvalidIndex;
+        uint32_t m_itemCount = 0;
+
+        //! The next wheel tick to expire, all ticks before this have already been moved to the expired list
+        int64_t m_nextTick = 0;
     };
 }
 
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/FieldSchema.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AzNetworking
+{
+    // Largest magnitude any of the three smallest components of a unit quaternion can have
+    static constexpr float SmallestThreeBound = 0.707106781f;
+
+    static uint32_t GetMaxQuantizedValue(uint32_t bitCount)
+    {
+        return (bitCount >= 32) ? 0xFFFFFFFF : ((1u << bitCount) - 1);
+    }
+
+    static uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t maxQuantizedValue)
+    {
+        const double range = static_cast<double>(maxValue) - static_cast<double>(minValue);
+        if (!(range > 0.0))
+        {
+            return 0;
+        }
+
+        const double normalized = (static_cast<double>(value) - static_cast<double>(minValue)) / range;
+        if (!(normalized > 0.0))
+        {
+            // Also catches NaN
+            return 0;
+        }
+        if (normalized >= 1.0)
+        {
+            return maxQuantizedValue;
+        }
+        return static_cast<uint32_t>(normalized * static_cast<double>(maxQuantizedValue) + 0.5);
+    }
+
+    static float DequantizeFloat(uint32_t quantizedValue, float minValue, float maxValue, uint32_t maxQuantizedValue)
+    {
+        const double range = static_cast<double>(maxValue) - static_cast<double>(minValue);
+        const double normalized = static_cast<double>(quantizedValue) / static_cast<double>(maxQuantizedValue);
+        return static_cast<float>(static_cast<double>(minValue) + normalized * range);
+    }
+
+    // Quantizes and serializes an array of floats, only updating elements in values if their quantized representation changed
+    static bool SerializeQuantizedFloats(ISerializer& serializer, float* values, const char* const* names, uint32_t count, float minValue, float maxValue, uint32_t bitCount)
+    {
+        const uint32_t maxQuantizedValue = GetMaxQuantizedValue(AZ::GetClamp(bitCount, 1u, 32u));
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            const uint32_t originalValue = QuantizeFloat(values[index], minValue, maxValue, maxQuantizedValue);
+            uint32_t quantizedValue = originalValue;
+            if (!serializer.Serialize(quantizedValue, names[index], 0u, maxQuantizedValue))
+            {
+                return false;
+            }
+            // Values that were clamped during quantization can't be left as they are, even if the quantized value matches
+            const bool outOfRange = !(values[index] >= minValue && values[index] <= maxValue);
+            if ((serializer.GetSerializerMode() == SerializerMode::WriteToObject) && ((quantizedValue != originalValue) || outOfRange))
+            {
+                values[index] = DequantizeFloat(quantizedValue, minValue, maxValue, maxQuantizedValue);
+            }
+        }
+        return serializer.IsValid();
+    }
+
+    static const char* const ElementNames[] = { "xValue", "yValue", "zValue", "wValue" };
+
+    bool SerializeQuantizedFloat(ISerializer& serializer, float& value, const char* name, float minValue, float maxValue, uint32_t bitCount)
+    {
+        return SerializeQuantizedFloats(serializer, &value, &name, 1, minValue, maxValue, bitCount);
+    }
+
+    bool SerializeQuantizedVector2(ISerializer& serializer, AZ::Vector2& value, const char* name, float minValue, float maxValue, uint32_t bitCount)
+    {
+        float values[2];
+        value.StoreToFloat2(values);
+        if (serializer.BeginObject(name, "AZ::Vector2") && SerializeQuantizedFloats(serializer, values, ElementNames, 2, minValue, maxValue, bitCount))
+        {
+            value = AZ::Vector2::CreateFromFloat2(values);
+            return serializer.EndObject(name, "AZ::Vector2");
+        }
+        return false;
+    }
+
+    bool SerializeQuantizedVector3(ISerializer& serializer, AZ::Vector3& value, const char* name, float minValue, float maxValue, uint32_t bitCount)
+    {
+        float values[3];
+        value.StoreToFloat3(values);
+        if (serializer.BeginObject(name, "AZ::Vector3") && SerializeQuantizedFloats(serializer, values, ElementNames, 3, minValue, maxValue, bitCount))
+        {
+            value = AZ::Vector3::CreateFromFloat3(values);
+            return serializer.EndObject(name, "AZ::Vector3");
+        }
+        return false;
+    }
+
+    bool SerializeQuantizedQuaternion(ISerializer& serializer, AZ::Quaternion& value, const char* name, float minValue, float maxValue, uint32_t bitCount)
+    {
+        float values[4];
+        value.StoreToFloat4(values);
+        if (serializer.BeginObject(name, "AZ::Quaternion") && SerializeQuantizedFloats(serializer, values, ElementNames, 4, minValue, maxValue, bitCount))
+        {
+            value = AZ::Quaternion::CreateFromFloat4(values);
+            return serializer.EndObject(name, "AZ::Quaternion");
+        }
+        return false;
+    }
+
+    bool SerializeSmallestThree(ISerializer& serializer, AZ::Quaternion& value, const char* name, uint32_t bitCount)
+    {
+        const uint32_t maxQuantizedValue = GetMaxQuantizedValue(AZ::GetClamp(bitCount, 1u, 32u));
+        const AZ::Quaternion normalized = value.IsZero() ? AZ::Quaternion::CreateIdentity() : value.GetNormalized();
+
+        float components[4];
+        normalized.StoreToFloat4(components);
+
+        const uint8_t originalLargestIndex = [&components]()
+        {
+            uint8_t largestIndex = 0;
+            for (uint8_t index = 1; index < 4; ++index)
+            {
+                if (AZ::GetAbs(components[index]) > AZ::GetAbs(components[largestIndex]))
+                {
+                    largestIndex = index;
+                }
+            }
+            return largestIndex;
+        }();
+
+        // q and -q represent the same rotation, so flip the quaternion to make the dropped component positive
+        const float sign = (components[originalLargestIndex] < 0.0f) ? -1.0f : 1.0f;
+        uint32_t originalValues[3];
+        for (uint8_t index = 0, smallIndex = 0; index < 4; ++index)
+        {
+            if (index != originalLargestIndex)
+            {
+                originalValues[smallIndex++] = QuantizeFloat(components[index] * sign, -SmallestThreeBound, SmallestThreeBound, maxQuantizedValue);
+            }
+        }
+
+        uint8_t largestIndex = originalLargestIndex;
+        uint32_t quantizedValues[3] = { originalValues[0], originalValues[1], originalValues[2] };
+        if (!serializer.BeginObject(name, "AZ::Quaternion"))
+        {
+            return false;
+        }
+        serializer.Serialize(largestIndex, "LargestIndex", uint8_t(0), uint8_t(3));
+        serializer.Serialize(quantizedValues[0], "aValue", 0u, maxQuantizedValue);
+        serializer.Serialize(quantizedValues[1], "bValue", 0u, maxQuantizedValue);
+        serializer.Serialize(quantizedValues[2], "cValue", 0u, maxQuantizedValue);
+        if (!serializer.IsValid())
+        {
+            return false;
+        }
+
+        // A value that isn't a unit quaternion can't be left as it is, even if the quantized values match
+        const bool changed = !AZ::IsClose(value.GetLengthSq(), 1.0f, 0.001f)
+            || (largestIndex != originalLargestIndex)
+            || (quantizedValues[0] != originalValues[0])
+            || (quantizedValues[1] != originalValues[1])
+            || (quantizedValues[2] != originalValues[2]);
+        if ((serializer.GetSerializerMode() == SerializerMode::WriteToObject) && changed)
+        {
+            float decoded[4];
+            float sumSquares = 0.0f;
+            for (uint8_t index = 0, smallIndex = 0; index < 4; ++index)
+            {
+                if (index != largestIndex)
+                {
+                    decoded[index] = DequantizeFloat(quantizedValues[smallIndex++], -SmallestThreeBound, SmallestThreeBound, maxQuantizedValue);
+                    sumSquares += decoded[index] * decoded[index];
+                }
+            }
+            decoded[largestIndex] = AZ::Sqrt(AZ::GetMax(1.0f - sumSquares, 0.0f));
+            value = AZ::Quaternion::CreateFromFloat4(decoded);
+        }
+        return serializer.EndObject(name, "AZ::Quaternion");
+    }
+
+    bool SerializeWithSchema(ISerializer& serializer, float& value, const char* name, const FieldSchema& schema)
+    {
+        if (schema.m_encoding == FieldEncoding::Quantized)
+        {
+            return SerializeQuantizedFloat(serializer, value, name, schema.m_minValue, schema.m_maxValue, schema.m_bitCount);
+        }
+        return serializer.Serialize(value, name);
+    }
+
+    bool SerializeWithSchema(ISerializer& serializer, AZ::Vector2& value, const char* name, const FieldSchema& schema)
+    {
+        if (schema.m_encoding == FieldEncoding::Quantized)
+        {
+            return SerializeQuantizedVector2(serializer, value, name, schema.m_minValue, schema.m_maxValue, schema.m_bitCount);
+        }
+        return serializer.Serialize(value, name);
+    }
+
+    bool SerializeWithSchema(ISerializer& serializer, AZ::Vector3& value, const char* name, const FieldSchema& schema)
+    {
+        if (schema.m_encoding == FieldEncoding::Quantized)
+        {
+            return SerializeQuantizedVector3(serializer, value, name, schema.m_minValue, schema.m_maxValue, schema.m_bitCount);
+        }
+        return serializer.Serialize(value, name);
+    }
+
+    bool SerializeWithSchema(ISerializer& serializer, AZ::Quaternion& value, const char* name, const FieldSchema& schema)
+    {
+        switch (schema.m_encoding)
+        {
+        case FieldEncoding::Quantized:
+            return SerializeQuantizedQuaternion(serializer, value, name, schema.m_minValue, schema.m_maxValue, schema.m_bitCount);
+        case FieldEncoding::SmallestThree:
+            return SerializeSmallestThree(serializer, value, name, schema.m_bitCount);
+        default:
+            break;
+        }
+        return serializer.Serialize(value, name);
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! Wire encodings that may be selected for an individual serialized field.
+    enum class FieldEncoding : uint8_t
+    {
+        Default,       //!< Serialize the value through ISerializer unchanged
+        Quantized,     //!< Floating point values are quantized to m_bitCount bits over [m_minValue, m_maxValue], integers are bounded by the same range
+        SmallestThree, //!< Quaternions drop their largest component and quantize the remaining three to m_bitCount bits each
+        Delta          //!< Integers are zigzag encoded relative to m_baseline using a variable number of bits
+    };
+
+    //! @struct FieldSchema
+    //! @brief Per-field description of how a value should be encoded on the wire.
+    //!
+    //! Schemas are typically generated from network property attributes and are only meaningful when both sides of a connection
+    //! use the same schema for a field. The size savings are largest when paired with NetworkBitInputSerializer, which does not round
+    //! individual values up to whole bytes.
+    struct FieldSchema
+    {
+        FieldEncoding m_encoding = FieldEncoding::Default;
+        float m_minValue = 0.0f;
+        float m_maxValue = 1.0f;
+        uint32_t m_bitCount = 16;
+        int64_t m_baseline = 0;
+    };
+
+    //! Serializes a float quantized to bitCount bits over the range [minValue, maxValue].
+    //! Values outside of the range are clamped. When writing to an object, a value already within the range is only modified if its quantized value changed.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the value to serialize
+    //! @param name       the name of the value
+    //! @param minValue   the minimum representable value
+    //! @param maxValue   the maximum representable value
+    //! @param bitCount   the number of bits to quantize to, between 1 and 32
+    //! @return boolean true for success, false for serialization failure
+    bool SerializeQuantizedFloat(ISerializer& serializer, float& value, const char* name, float minValue, float maxValue, uint32_t bitCount);
+
+    //! Serializes each component of a vector quantized to bitCount bits over the range [minValue, maxValue].
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the value to serialize
+    //! @param name       the name of the value
+    //! @param minValue   the minimum representable component value
+    //! @param maxValue   the maximum representable component value
+    //! @param bitCount   the number of bits to quantize each component to, between 1 and 32
+    //! @return boolean true for success, false for serialization failure
+    bool SerializeQuantizedVector2(ISerializer& serializer, AZ::Vector2& value, const char* name, float minValue, float maxValue, uint32_t bitCount);
+    bool SerializeQuantizedVector3(ISerializer& serializer, AZ::Vector3& value, const char* name, float minValue, float maxValue, uint32_t bitCount);
+    bool SerializeQuantizedQuaternion(ISerializer& serializer, AZ::Quaternion& value, const char* name, float minValue, float maxValue, uint32_t bitCount);
+
+    //! Serializes a unit quaternion using smallest-three compression.
+    //! The index of the largest component is serialized in two bits, and the remaining three components are quantized to bitCount bits
+    //! each over the range [-1/sqrt(2), 1/sqrt(2)]. The largest component is reconstructed on read from the unit length constraint.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the value to serialize, assumed to be normalized
+    //! @param name       the name of the value
+    //! @param bitCount   the number of bits to quantize each of the three smallest components to, between 1 and 32
+    //! @return boolean true for success, false for serialization failure
+    bool SerializeSmallestThree(ISerializer& serializer, AZ::Quaternion& value, const char* name, uint32_t bitCount);
+
+    //! Serializes an integer as a zigzag encoded difference from a baseline value.
+    //! A two bit size class selects whether the difference is written in 4, 8, 16 or the full width of TYPE bits, so values close
+    //! to the baseline take very little space.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the value to serialize
+    //! @param name       the name of the value
+    //! @param baseline   the baseline the difference is computed from, must match on both sides of the connection
+    //! @return boolean true for success, false for serialization failure
+    template <typename TYPE>
+    bool SerializeDeltaInteger(ISerializer& serializer, TYPE& value, const char* name, TYPE baseline);
+
+    //! Serializes a value using the encoding described by the provided schema.
+    //! Encodings which do not apply to TYPE fall back to the default ISerializer behaviour.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the value to serialize
+    //! @param name       the name of the value
+    //! @param schema     the schema describing how to encode the value
+    //! @return boolean true for success, false for serialization failure
+    template <typename TYPE>
+    bool SerializeWithSchema(ISerializer& serializer, TYPE& value, const char* name, const FieldSchema& schema);
+
+    bool SerializeWithSchema(ISerializer& serializer, float& value, const char* name, const FieldSchema& schema);
+    bool SerializeWithSchema(ISerializer& serializer, AZ::Vector2& value, const char* name, const FieldSchema& schema);
+    bool SerializeWithSchema(ISerializer& serializer, AZ::Vector3& value, const char* name, const FieldSchema& schema);
+    bool SerializeWithSchema(ISerializer& serializer, AZ::Quaternion& value, const char* name, const FieldSchema& schema);
+}
+
+#include <AzNetworking/Serialization/FieldSchema.inl>
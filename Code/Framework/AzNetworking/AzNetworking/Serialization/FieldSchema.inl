@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/typetraits/is_enum.h>
+#include <AzCore/std/typetraits/is_integral.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/typetraits/is_signed.h>
+#include <AzCore/std/typetraits/is_unsigned.h>
+#include <AzCore/std/typetraits/underlying_type.h>
+#include <AzCore/std/limits.h>
+
+namespace AzNetworking
+{
+    template <typename TYPE>
+    inline bool SerializeDeltaInteger(ISerializer& serializer, TYPE& value, const char* name, TYPE baseline)
+    {
+        static_assert(AZStd::is_integral_v<TYPE> && !AZStd::is_same_v<TYPE, bool>, "Delta encoding is only supported for integral types");
+        using UnsignedType = AZStd::make_unsigned_t<TYPE>;
+        using SignedType = AZStd::make_signed_t<TYPE>;
+        constexpr uint32_t TypeBitCount = sizeof(TYPE) * 8;
+        constexpr uint32_t SizeClassBitCounts[] = { 4, 8, 16, TypeBitCount };
+
+        // Zigzag encode the difference so that small negative and small positive differences both produce small values
+        const SignedType difference = static_cast<SignedType>(static_cast<UnsignedType>(static_cast<UnsignedType>(value) - static_cast<UnsignedType>(baseline)));
+        const UnsignedType encoded = static_cast<UnsignedType>(static_cast<UnsignedType>(static_cast<UnsignedType>(difference) << 1) ^ static_cast<UnsignedType>(difference >> (TypeBitCount - 1)));
+
+        // Pick the smallest size class that can hold the encoded difference, the last class always uses the full width of TYPE
+        uint8_t sizeClass = 3;
+        for (uint8_t candidate = 0; candidate < 3; ++candidate)
+        {
+            if ((SizeClassBitCounts[candidate] < TypeBitCount) && ((static_cast<uint64_t>(encoded) >> SizeClassBitCounts[candidate]) == 0))
+            {
+                sizeClass = candidate;
+                break;
+            }
+        }
+
+        uint64_t serializeValue = static_cast<uint64_t>(encoded);
+        if (!serializer.Serialize(sizeClass, "SizeClass", uint8_t(0), uint8_t(3)))
+        {
+            return false;
+        }
+
+        const uint32_t bitCount = SizeClassBitCounts[sizeClass];
+        const uint64_t maxValue = (bitCount >= 64) ? AZStd::numeric_limits<uint64_t>::max() : ((uint64_t(1) << bitCount) - 1);
+        if (!serializer.Serialize(serializeValue, name, uint64_t(0), maxValue))
+        {
+            return false;
+        }
+
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            const UnsignedType decoded = static_cast<UnsignedType>(serializeValue);
+            const UnsignedType decodedDifference = static_cast<UnsignedType>((decoded >> 1) ^ static_cast<UnsignedType>(UnsignedType(0) - static_cast<UnsignedType>(decoded & 1)));
+            value = static_cast<TYPE>(static_cast<UnsignedType>(static_cast<UnsignedType>(baseline) + decodedDifference));
+        }
+        return serializer.IsValid();
+    }
+
+    template <typename TYPE>
+    inline bool SerializeWithSchema(ISerializer& serializer, TYPE& value, const char* name, const FieldSchema& schema)
+    {
+        if constexpr (AZStd::is_enum_v<TYPE>)
+        {
+            // Also covers type safe integrals, which are declared as enum classes
+            using UnderlyingType = AZStd::underlying_type_t<TYPE>;
+            UnderlyingType& integralValue = reinterpret_cast<UnderlyingType&>(value);
+            return SerializeWithSchema(serializer, integralValue, name, schema);
+        }
+        else if constexpr (AZStd::is_integral_v<TYPE> && !AZStd::is_same_v<TYPE, bool>)
+        {
+            switch (schema.m_encoding)
+            {
+            case FieldEncoding::Quantized:
+                return serializer.Serialize(value, name, static_cast<TYPE>(schema.m_minValue), static_cast<TYPE>(schema.m_maxValue));
+            case FieldEncoding::Delta:
+                return SerializeDeltaInteger<TYPE>(serializer, value, name, static_cast<TYPE>(schema.m_baseline));
+            default:
+                break;
+            }
+        }
+        return serializer.Serialize(value, name);
+    }
+}
@@ -189,6 +189,16 @@ namespace AzNetworking
         //! @return size of the data contained in the serialization buffer in bytes
         virtual uint32_t GetSize() const = 0;
 
+        //! Returns the size of the data contained in the serialization buffer in bits.
+        //! Bit-packed serializers return the exact number of bits, other serializers return GetSize() converted to bits.
+        //! @return size of the data contained in the serialization buffer in bits
+        virtual uint32_t GetSizeInBits() const;
+
+        //! Returns whether this serializer packs values into exactly the bits their range requires.
+        //! Field schemas are only applied when bit-packing, so byte aligned payloads keep their existing wire format.
+        //! @return boolean true if values are bit-packed
+        virtual bool IsBitPacked() const;
+
         //! This is a helper for network serialization.
         //! It clears the track changes flag internal to some serializers
         virtual void ClearTrackedChangesFlag() = 0;
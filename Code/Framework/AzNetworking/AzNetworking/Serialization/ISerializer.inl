@@ -97,6 +97,16 @@ namespace AzNetworking
         return m_serializerValid;
     }
 
+    inline uint32_t ISerializer::GetSizeInBits() const
+    {
+        return GetSize() * 8;
+    }
+
+    inline bool ISerializer::IsBitPacked() const
+    {
+        return false;
+    }
+
     inline void ISerializer::Invalidate()
     {
         m_serializerValid = false;
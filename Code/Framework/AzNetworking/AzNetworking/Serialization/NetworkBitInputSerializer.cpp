@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Utilities/BitPacking.h>
+#include <AzCore/std/typetraits/is_unsigned.h>
+
+namespace AzNetworking
+{
+    NetworkBitInputSerializer::NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    bool NetworkBitInputSerializer::CopyBitsToBuffer(const uint8_t* data, uint32_t dataBitOffset, uint32_t bitCount)
+    {
+        constexpr uint32_t ChunkBits = 32;
+        while (bitCount > 0)
+        {
+            const uint32_t chunkSize = AZStd::min(bitCount, ChunkBits);
+            if (!SerializeBits(ReadBits(data, dataBitOffset, chunkSize), chunkSize))
+            {
+                return false;
+            }
+            dataBitOffset += chunkSize;
+            bitCount -= chunkSize;
+        }
+        return true;
+    }
+
+    SerializerMode NetworkBitInputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool NetworkBitInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return SerializeBits(value ? 1 : 0, 1);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(float));
+        return SerializeBits(bits, 32);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(double));
+        return SerializeBits(bits, 64);
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+
+        for (uint32_t index = 0; index < outSize; ++index)
+        {
+            if (!SerializeBits(buffer[index], 8))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitInputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSize() const
+    {
+        return (m_bitPosition + 7) / 8;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSizeInBits() const
+    {
+        return m_bitPosition;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitInputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue)
+    {
+        // Work in the unsigned type of the same width so that full range signed values don't overflow
+        using UnsignedType = AZStd::make_unsigned_t<ORIGINAL_TYPE>;
+        m_serializerValid &= (inputValue >= minValue);
+        m_serializerValid &= (inputValue <= maxValue);
+        const UnsignedType valueRange = static_cast<UnsignedType>(static_cast<UnsignedType>(maxValue) - static_cast<UnsignedType>(minValue));
+        const UnsignedType serializeValue = static_cast<UnsignedType>(static_cast<UnsignedType>(inputValue) - static_cast<UnsignedType>(minValue));
+        return SerializeBits(static_cast<uint64_t>(serializeValue), GetRequiredBitCount(static_cast<uint64_t>(valueRange)));
+    }
+
+    bool NetworkBitInputSerializer::SerializeBits(uint64_t value, uint32_t bitCount)
+    {
+        const uint64_t nextBitPosition = static_cast<uint64_t>(m_bitPosition) + bitCount;
+        if (!m_serializerValid || (nextBitPosition > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        WriteBits(m_buffer, m_bitPosition, value, bitCount);
+        m_bitPosition += bitCount;
+        return true;
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! @class NetworkBitInputSerializer
+    //! @brief Input serializer for writing an object model into a bit-packed bytestream.
+    //!
+    //! Unlike NetworkInputSerializer, values are not rounded up to whole bytes. Booleans consume a single bit, and bounded values
+    //! consume exactly as many bits as required to represent maxValue - minValue. Use NetworkBitOutputSerializer to read the stream back.
+    class NetworkBitInputSerializer final
+        : public ISerializer
+    {
+    public:
+
+        //! Constructor.
+        //! @param buffer         input buffer to write to
+        //! @param bufferCapacity capacity of the buffer in bytes
+        NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity);
+
+        //! Appends bits from another bit-packed buffer to the serialization output buffer.
+        //! @param data          pointer to the bit-packed data to copy
+        //! @param dataBitOffset bit offset into data to start copying from
+        //! @param bitCount      number of bits to copy
+        //! @return boolean true on success, false if there was insufficient space to store all the data
+        bool CopyBitsToBuffer(const uint8_t* data, uint32_t dataBitOffset, uint32_t bitCount);
+
+        // ISerializer interfaces
+        SerializerMode GetSerializerMode() const override;
+        bool Serialize(bool& value, const char* name) override;
+        bool Serialize(char& value, const char* name, char minValue, char maxValue) override;
+        bool Serialize(int8_t& value, const char* name, int8_t minValue, int8_t maxValue) override;
+        bool Serialize(int16_t& value, const char* name, int16_t minValue, int16_t maxValue) override;
+        bool Serialize(int32_t& value, const char* name, int32_t minValue, int32_t maxValue) override;
+        bool Serialize(int64_t& value, const char* name, int64_t minValue, int64_t maxValue) override;
+        bool Serialize(uint8_t& value, const char* name, uint8_t minValue, uint8_t maxValue) override;
+        bool Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue) override;
+        bool Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue) override;
+        bool Serialize(uint64_t& value, const char* name, uint64_t minValue, uint64_t maxValue) override;
+        bool Serialize(float& value, const char* name, float minValue, float maxValue) override;
+        bool Serialize(double& value, const char* name, double minValue, double maxValue) override;
+        bool SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name) override;
+        bool BeginObject(const char* name, const char* typeName) override;
+        bool EndObject(const char* name, const char* typeName) override;
+
+        const uint8_t* GetBuffer() const override;
+        uint32_t GetCapacity() const override;
+        uint32_t GetSize() const override;
+        uint32_t GetSizeInBits() const override;
+        bool IsBitPacked() const override { return true; }
+        void ClearTrackedChangesFlag() override {}
+        bool GetTrackedChangesFlag() const override { return false; }
+        // ISerializer interfaces
+
+    private:
+
+        //! Private copy operator, do not allow copying instances
+        NetworkBitInputSerializer& operator=(const NetworkBitInputSerializer&) = delete;
+
+        template <typename ORIGINAL_TYPE>
+        bool SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue);
+
+        bool SerializeBits(uint64_t value, uint32_t bitCount);
+
+        uint32_t       m_bitPosition = 0;
+        const uint32_t m_bufferCapacity;
+        uint8_t*       m_buffer;
+    };
+}
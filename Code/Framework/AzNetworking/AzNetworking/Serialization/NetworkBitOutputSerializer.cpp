@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Utilities/BitPacking.h>
+#include <AzCore/std/typetraits/is_unsigned.h>
+
+namespace AzNetworking
+{
+    NetworkBitOutputSerializer::NetworkBitOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    SerializerMode NetworkBitOutputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        uint64_t bits = 0;
+        if (SerializeBits(bits, 1))
+        {
+            value = (bits != 0);
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint64_t bits = 0;
+        if (SerializeBits(bits, 32))
+        {
+            const uint32_t floatBits = static_cast<uint32_t>(bits);
+            memcpy(&value, &floatBits, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        if (SerializeBits(bits, 64))
+        {
+            memcpy(&value, &bits, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+
+        for (uint32_t index = 0; index < outSize; ++index)
+        {
+            uint64_t bits = 0;
+            if (!SerializeBits(bits, 8))
+            {
+                return false;
+            }
+            buffer[index] = static_cast<uint8_t>(bits);
+        }
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitOutputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetSize() const
+    {
+        return (m_bitPosition + 7) / 8;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetSizeInBits() const
+    {
+        return m_bitPosition;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
+    {
+        using UnsignedType = AZStd::make_unsigned_t<ORIGINAL_TYPE>;
+        const UnsignedType valueRange = static_cast<UnsignedType>(static_cast<UnsignedType>(maxValue) - static_cast<UnsignedType>(minValue));
+        uint64_t bits = 0;
+        if (SerializeBits(bits, GetRequiredBitCount(static_cast<uint64_t>(valueRange))))
+        {
+            // Reject values outside of the expected range, they can only come from a malformed stream
+            m_serializerValid &= (bits <= static_cast<uint64_t>(valueRange));
+            if (m_serializerValid)
+            {
+                outValue = static_cast<ORIGINAL_TYPE>(static_cast<UnsignedType>(static_cast<UnsignedType>(minValue) + static_cast<UnsignedType>(bits)));
+            }
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBits(uint64_t& outValue, uint32_t bitCount)
+    {
+        const uint64_t nextBitPosition = static_cast<uint64_t>(m_bitPosition) + bitCount;
+        if (!m_serializerValid || (nextBitPosition > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        outValue = ReadBits(m_buffer, m_bitPosition, bitCount);
+        m_bitPosition += bitCount;
+        return true;
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/algorithm.h>
+#include <stdint.h>
+
+namespace AzNetworking
+{
+    //! Returns the number of bits required to represent every value in the range [0, valueRange].
+    //! @param valueRange the largest value that needs to be represented
+    //! @return the number of bits required, zero if the range only contains a single value
+    inline uint32_t GetRequiredBitCount(uint64_t valueRange)
+    {
+        return (valueRange == 0) ? 0 : 64 - static_cast<uint32_t>(az_clz_u64(valueRange));
+    }
+
+    //! Writes the low bitCount bits of value into a buffer, least significant bit first.
+    //! Bits above the written range in the final byte are cleared, so buffers may be written sequentially without being zeroed first.
+    //! @param buffer      the buffer to write to, must contain at least (bitPosition + bitCount + 7) / 8 bytes
+    //! @param bitPosition the bit offset into the buffer to start writing at
+    //! @param value       the value to write
+    //! @param bitCount    the number of bits of value to write, at most 64
+    inline void WriteBits(uint8_t* buffer, uint32_t bitPosition, uint64_t value, uint32_t bitCount)
+    {
+        while (bitCount > 0)
+        {
+            const uint32_t byteIndex = bitPosition >> 3;
+            const uint32_t bitOffset = bitPosition & 7;
+            const uint32_t bitsInByte = AZStd::min(8 - bitOffset, bitCount);
+            const uint32_t mask = (1u << bitsInByte) - 1;
+            const uint8_t existing = (bitOffset == 0) ? 0 : static_cast<uint8_t>(buffer[byteIndex] & ((1u << bitOffset) - 1));
+            buffer[byteIndex] = static_cast<uint8_t>(existing | ((static_cast<uint32_t>(value) & mask) << bitOffset));
+            value >>= bitsInByte;
+            bitPosition += bitsInByte;
+            bitCount -= bitsInByte;
+        }
+    }
+
+    //! Reads bitCount bits from a buffer that was written using WriteBits.
+    //! @param buffer      the buffer to read from, must contain at least (bitPosition + bitCount + 7) / 8 bytes
+    //! @param bitPosition the bit offset into the buffer to start reading from
+    //! @param bitCount    the number of bits to read, at most 64
+    //! @return the value that was read
+    inline uint64_t ReadBits(const uint8_t* buffer, uint32_t bitPosition, uint32_t bitCount)
+    {
+        uint64_t value = 0;
+        uint32_t bitsRead = 0;
+        while (bitsRead < bitCount)
+        {
+            const uint32_t byteIndex = bitPosition >> 3;
+            const uint32_t bitOffset = bitPosition & 7;
+            const uint32_t bitsInByte = AZStd::min(8 - bitOffset, bitCount - bitsRead);
+            const uint32_t mask = (1u << bitsInByte) - 1;
+            value |= static_cast<uint64_t>((buffer[byteIndex] >> bitOffset) & mask) << bitsRead;
+            bitPosition += bitsInByte;
+            bitsRead += bitsInByte;
+        }
+        return value;
+    }
+}
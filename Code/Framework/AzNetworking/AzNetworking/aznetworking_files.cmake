@@ -52,10 +52,17 @@ set(FILES
     Serialization/DeltaSerializer.cpp
     Serialization/DeltaSerializer.h
     Serialization/DeltaSerializer.inl
+    Serialization/FieldSchema.cpp
+    Serialization/FieldSchema.h
+    Serialization/FieldSchema.inl
     Serialization/HashSerializer.cpp
     Serialization/HashSerializer.h
     Serialization/ISerializer.h
     Serialization/ISerializer.inl
+    Serialization/NetworkBitInputSerializer.cpp
+    Serialization/NetworkBitInputSerializer.h
+    Serialization/NetworkBitOutputSerializer.cpp
+    Serialization/NetworkBitOutputSerializer.h
     Serialization/NetworkInputSerializer.cpp
     Serialization/NetworkInputSerializer.h
     Serialization/NetworkOutputSerializer.cpp
@@ -120,6 +127,7 @@ set(FILES
     UdpTransport/UdpSocket.cpp
     UdpTransport/UdpSocket.h
     UdpTransport/UdpSocket.inl
+    Utilities/BitPacking.h
     Utilities/CidrAddress.cpp
     Utilities/CidrAddress.h
     Utilities/EncryptionCommon.cpp
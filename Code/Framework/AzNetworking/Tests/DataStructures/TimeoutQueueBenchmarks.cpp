@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+#include <climits>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    // The priority queue and map based timeout queue that TimeoutQueue used before it moved to a timer wheel, kept as a baseline
+    class LegacyTimeoutQueue
+    {
+    public:
+        using TimeoutItem = TimeoutQueue::TimeoutItem;
+        using TimeoutHandler = TimeoutQueue::TimeoutHandler;
+
+        void Reset()
+        {
+            m_timeoutItemMap.clear();
+            m_timeoutItemQueue = TimeoutItemQueue();
+            m_nextTimeoutId = TimeoutId{ 0 };
+        }
+
+        TimeoutId RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs)
+        {
+            const TimeoutId timeoutId = m_nextTimeoutId;
+            m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
+            m_timeoutItemQueue.push(TimeoutQueueItem{ timeoutId, AZ::GetElapsedTimeMs() + timeoutMs });
+            ++m_nextTimeoutId;
+            return timeoutId;
+        }
+
+        void RemoveItem(TimeoutId timeoutId)
+        {
+            m_timeoutItemMap.erase(timeoutId);
+        }
+
+        void UpdateTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts = -1)
+        {
+            int32_t numTimeouts = 0;
+            if (maxTimeouts < 0)
+            {
+                maxTimeouts = INT_MAX;
+            }
+            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+            while (m_timeoutItemQueue.size() > 0)
+            {
+                const TimeoutQueueItem queueItem = m_timeoutItemQueue.top();
+                if (queueItem.m_timeoutTimeMs >= currentTimeMs)
+                {
+                    break;
+                }
+
+                if (++numTimeouts >= maxTimeouts)
+                {
+                    break;
+                }
+
+                m_timeoutItemQueue.pop();
+                auto iter = m_timeoutItemMap.find(queueItem.m_timeoutId);
+                if (iter == m_timeoutItemMap.end())
+                {
+                    continue;
+                }
+
+                TimeoutItem mapItem = iter->second;
+                if (mapItem.m_nextTimeoutTimeMs > currentTimeMs)
+                {
+                    m_timeoutItemQueue.push(TimeoutQueueItem{ queueItem.m_timeoutId, mapItem.m_nextTimeoutTimeMs });
+                    continue;
+                }
+
+                if (timeoutHandler(mapItem) == TimeoutResult::Refresh)
+                {
+                    mapItem.UpdateTimeoutTime(currentTimeMs);
+                    iter->second = mapItem;
+                    m_timeoutItemQueue.push(TimeoutQueueItem{ queueItem.m_timeoutId, mapItem.m_nextTimeoutTimeMs });
+                    continue;
+                }
+
+                m_timeoutItemMap.erase(iter);
+            }
+        }
+
+    private:
+        struct TimeoutQueueItem
+        {
+            bool operator <(const TimeoutQueueItem& rhs) const
+            {
+                return rhs.m_timeoutTimeMs < m_timeoutTimeMs;
+            }
+
+            TimeoutId m_timeoutId;
+            AZ::TimeMs m_timeoutTimeMs;
+        };
+
+        using TimeoutItemMap = AZStd::map<TimeoutId, TimeoutItem>;
+        using TimeoutItemQueue = AZStd::priority_queue<TimeoutQueueItem>;
+
+        TimeoutId m_nextTimeoutId = TimeoutId{ 0 };
+        TimeoutItemMap m_timeoutItemMap;
+        TimeoutItemQueue m_timeoutItemQueue;
+    };
+
+    // Time source that only advances when told to, so every iteration sees the same timeline
+    class TimeoutBenchmarkTime
+        : public AZ::ITime
+    {
+    public:
+        TimeoutBenchmarkTime()
+        {
+            AZ::Interface<AZ::ITime>::Register(this);
+        }
+
+        ~TimeoutBenchmarkTime() override
+        {
+            AZ::Interface<AZ::ITime>::Unregister(this);
+        }
+
+        AZ::TimeMs GetElapsedTimeMs() const override { return m_timeMs; }
+        AZ::TimeUs GetElapsedTimeUs() const override { return AZ::TimeMsToUs(m_timeMs); }
+        AZ::TimeMs GetRealElapsedTimeMs() const override { return m_timeMs; }
+        AZ::TimeUs GetRealElapsedTimeUs() const override { return AZ::TimeMsToUs(m_timeMs); }
+        AZ::TimeUs GetSimulationTickDeltaTimeUs() const override { return AZ::Time::ZeroTimeUs; }
+        AZ::TimeUs GetRealTickDeltaTimeUs() const override { return AZ::Time::ZeroTimeUs; }
+        AZ::TimeUs GetLastSimulationTickTime() const override { return AZ::Time::ZeroTimeUs; }
+        void SetSimulationTickDeltaOverride(AZ::TimeMs) override {}
+        AZ::TimeMs GetSimulationTickDeltaOverride() const override { return AZ::Time::ZeroTimeMs; }
+        void SetSimulationTickScale(float) override {}
+        float GetSimulationTickScale() const override { return 1.0f; }
+        void SetSimulationTickRate(int) override {}
+        int32_t GetSimulationTickRate() const override { return 0; }
+
+        AZ::TimeMs m_timeMs = AZ::Time::ZeroTimeMs;
+    };
+
+    /*
+     * Compares the timer wheel TimeoutQueue against the previous priority queue implementation with 100k live timers.
+     * Register measures inserting every timer, Remove measures cancelling every timer in random order, and Expire measures
+     * ticking the queue at a fixed interval until every timer has expired. Timeouts are uniformly distributed up to MaxTimeoutMs.
+     */
+    class TimeoutQueueBenchmark
+        : public AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t TimerCount = 100000;
+        static constexpr uint32_t MaxTimeoutMs = 10000;
+        static constexpr AZ::TimeMs TickIntervalMs = AZ::TimeMs{ 16 };
+
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void InternalSetUp()
+        {
+            m_time = AZStd::make_unique<TimeoutBenchmarkTime>();
+
+            AZ::SimpleLcgRandom random(1234);
+            m_timeouts.resize(TimerCount);
+            m_removeOrder.resize(TimerCount);
+            for (uint32_t index = 0; index < TimerCount; ++index)
+            {
+                m_timeouts[index] = AZ::TimeMs{ 1 + random.GetRandom() % MaxTimeoutMs };
+                m_removeOrder[index] = index;
+            }
+            for (uint32_t index = TimerCount - 1; index > 0; --index)
+            {
+                AZStd::swap(m_removeOrder[index], m_removeOrder[random.GetRandom() % (index + 1)]);
+            }
+            m_timeoutIds.resize(TimerCount);
+        }
+
+        void InternalTearDown()
+        {
+            m_timeoutIds = {};
+            m_removeOrder = {};
+            m_timeouts = {};
+            m_time.reset();
+        }
+
+        template <typename QUEUE>
+        void RegisterTimers(QUEUE& queue)
+        {
+            for (uint32_t index = 0; index < TimerCount; ++index)
+            {
+                m_timeoutIds[index] = queue.RegisterItem(index, m_timeouts[index]);
+            }
+        }
+
+        template <typename QUEUE>
+        void RunRegister(benchmark::State& state, QUEUE& queue)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                queue.Reset();
+                state.ResumeTiming();
+
+                RegisterTimers(queue);
+            }
+            state.SetItemsProcessed(state.iterations() * TimerCount);
+        }
+
+        template <typename QUEUE>
+        void RunRemove(benchmark::State& state, QUEUE& queue)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                queue.Reset();
+                RegisterTimers(queue);
+                state.ResumeTiming();
+
+                for (uint32_t index : m_removeOrder)
+                {
+                    queue.RemoveItem(m_timeoutIds[index]);
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * TimerCount);
+        }
+
+        template <typename QUEUE>
+        void RunExpire(benchmark::State& state, QUEUE& queue)
+        {
+            uint64_t expiredCount = 0;
+            auto timeoutHandler = [&expiredCount](TimeoutQueue::TimeoutItem&)
+            {
+                ++expiredCount;
+                return TimeoutResult::Delete;
+            };
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                queue.Reset();
+                RegisterTimers(queue);
+                const AZ::TimeMs endTimeMs = m_time->m_timeMs + AZ::TimeMs{ MaxTimeoutMs + 1 };
+                state.ResumeTiming();
+
+                while (m_time->m_timeMs <= endTimeMs)
+                {
+                    m_time->m_timeMs += TickIntervalMs;
+                    queue.UpdateTimeouts(timeoutHandler);
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * TimerCount);
+            state.counters["Expired"] = benchmark::Counter(aznumeric_cast<double>(expiredCount), benchmark::Counter::kAvgIterations);
+        }
+
+        AZStd::unique_ptr<TimeoutBenchmarkTime> m_time;
+        AZStd::vector<AZ::TimeMs> m_timeouts;
+        AZStd::vector<uint32_t> m_removeOrder;
+        AZStd::vector<TimeoutId> m_timeoutIds;
+    };
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmark, TimerWheel_Register)(benchmark::State& state)
+    {
+        TimeoutQueue queue;
+        RunRegister(state, queue);
+    }
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmark, PriorityQueue_Register)(benchmark::State& state)
+    {
+        LegacyTimeoutQueue queue;
+        RunRegister(state, queue);
+    }
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmark, TimerWheel_Remove)(benchmark::State& state)
+    {
+        TimeoutQueue queue;
+        RunRemove(state, queue);
+    }
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmark, PriorityQueue_Remove)(benchmark::State& state)
+    {
+        LegacyTimeoutQueue queue;
+        RunRemove(state, queue);
+    }
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmark, TimerWheel_Expire)(benchmark::State& state)
+    {
+        TimeoutQueue queue;
+        RunExpire(state, queue);
+    }
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmark, PriorityQueue_Expire)(benchmark::State& state)
+    {
+        LegacyTimeoutQueue queue;
+        RunExpire(state, queue);
+    }
+
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmark, TimerWheel_Register)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmark, PriorityQueue_Register)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmark, TimerWheel_Remove)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmark, PriorityQueue_Remove)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmark, TimerWheel_Expire)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmark, PriorityQueue_Expire)->Unit(benchmark::kMillisecond);
+}
+
+#endif
@@ -7,8 +7,205 @@
  */
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    // Time source that only advances when told to, so timeouts can be tested deterministically
+    class ManualTime
+        : public AZ::ITime
+    {
+    public:
+        ManualTime()
+        {
+            AZ::Interface<AZ::ITime>::Register(this);
+        }
+
+        ~ManualTime() override
+        {
+            AZ::Interface<AZ::ITime>::Unregister(this);
+        }
+
+        AZ::TimeMs GetElapsedTimeMs() const override { return m_timeMs; }
+        AZ::TimeUs GetElapsedTimeUs() const override { return AZ::TimeMsToUs(m_timeMs); }
+        AZ::TimeMs GetRealElapsedTimeMs() const override { return m_timeMs; }
+        AZ::TimeUs GetRealElapsedTimeUs() const override { return AZ::TimeMsToUs(m_timeMs); }
+        AZ::TimeUs GetSimulationTickDeltaTimeUs() const override { return AZ::Time::ZeroTimeUs; }
+        AZ::TimeUs GetRealTickDeltaTimeUs() const override { return AZ::Time::ZeroTimeUs; }
+        AZ::TimeUs GetLastSimulationTickTime() const override { return AZ::Time::ZeroTimeUs; }
+        void SetSimulationTickDeltaOverride(AZ::TimeMs) override {}
+        AZ::TimeMs GetSimulationTickDeltaOverride() const override { return AZ::Time::ZeroTimeMs; }
+        void SetSimulationTickScale(float) override {}
+        float GetSimulationTickScale() const override { return 1.0f; }
+        void SetSimulationTickRate(int) override {}
+        int32_t GetSimulationTickRate() const override { return 0; }
+
+        AZ::TimeMs m_timeMs = AZ::TimeMs{ 1000 };
+    };
+
+    class TimeoutQueueTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_time = AZStd::make_unique<ManualTime>();
+        }
+
+        void TearDown() override
+        {
+            m_time.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        void Advance(int64_t timeMs)
+        {
+            m_time->m_timeMs += AZ::TimeMs{ timeMs };
+        }
+
+        AZStd::vector<uint64_t> Update(TimeoutQueue& queue, TimeoutResult result = TimeoutResult::Delete, int32_t maxTimeouts = -1)
+        {
+            AZStd::vector<uint64_t> timedOut;
+            queue.UpdateTimeouts([&timedOut, result](TimeoutQueue::TimeoutItem& item)
+            {
+                timedOut.push_back(item.m_userData);
+                return result;
+            }, maxTimeouts);
+            return timedOut;
+        }
+
+        AZStd::unique_ptr<ManualTime> m_time;
+    };
+
+    TEST_F(TimeoutQueueTests, TestItemsExpireInOrder)
+    {
+        TimeoutQueue queue;
+        queue.RegisterItem(3, AZ::TimeMs{ 300 });
+        queue.RegisterItem(1, AZ::TimeMs{ 100 });
+        queue.RegisterItem(2, AZ::TimeMs{ 200 });
+
+        // Items only time out once the current time has passed their timeout time
+        Advance(100);
+        EXPECT_TRUE(Update(queue).empty());
+
+        Advance(250);
+        EXPECT_EQ(Update(queue), AZStd::vector<uint64_t>({ 1, 2, 3 }));
+
+        Advance(1000);
+        EXPECT_TRUE(Update(queue).empty());
+    }
+
+    TEST_F(TimeoutQueueTests, TestRefreshAndRemove)
+    {
+        TimeoutQueue queue;
+        const TimeoutId refreshedId = queue.RegisterItem(1, AZ::TimeMs{ 50 });
+        const TimeoutId removedId = queue.RegisterItem(2, AZ::TimeMs{ 50 });
+
+        queue.RemoveItem(removedId);
+        EXPECT_EQ(queue.RetrieveItem(removedId), nullptr);
+
+        Advance(51);
+        EXPECT_EQ(Update(queue, TimeoutResult::Refresh), AZStd::vector<uint64_t>({ 1 }));
+        ASSERT_NE(queue.RetrieveItem(refreshedId), nullptr);
+
+        // Refreshing through the retrieved item delays the next timeout
+        Advance(40);
+        queue.RetrieveItem(refreshedId)->UpdateTimeoutTime(m_time->GetElapsedTimeMs());
+        Advance(40);
+        EXPECT_TRUE(Update(queue).empty());
+        Advance(11);
+        EXPECT_EQ(Update(queue), AZStd::vector<uint64_t>({ 1 }));
+        EXPECT_EQ(queue.RetrieveItem(refreshedId), nullptr);
+
+        // Identifiers of removed items are not aliased by newly registered items that reuse their storage
+        const TimeoutId reusedId = queue.RegisterItem(3, AZ::TimeMs{ 50 });
+        EXPECT_NE(reusedId, refreshedId);
+        EXPECT_NE(reusedId, removedId);
+        EXPECT_EQ(queue.RetrieveItem(refreshedId), nullptr);
+        ASSERT_NE(queue.RetrieveItem(reusedId), nullptr);
+        EXPECT_EQ(queue.RetrieveItem(reusedId)->m_userData, 3);
+    }
+
+    TEST_F(TimeoutQueueTests, TestMaxTimeoutsDefersRemainingItems)
+    {
+        TimeoutQueue queue;
+        for (uint64_t userData = 0; userData < 10; ++userData)
+        {
+            queue.RegisterItem(userData, AZ::TimeMs{ 10 });
+        }
+
+        Advance(20);
+        EXPECT_EQ(Update(queue, TimeoutResult::Delete, 5).size(), 4);
+        EXPECT_EQ(Update(queue).size(), 6);
+    }
+
+    TEST_F(TimeoutQueueTests, TestLongTimeouts)
+    {
+        TimeoutQueue queue;
+        // Beyond the range of the wheel, which covers a little over four hours
+        constexpr int64_t LongTimeoutMs = 10 * 60 * 60 * 1000;
+        queue.RegisterItem(1, AZ::TimeMs{ LongTimeoutMs });
+        queue.RegisterItem(2, AZ::TimeMs{ 5000 });
+
+        Advance(5001);
+        EXPECT_EQ(Update(queue), AZStd::vector<uint64_t>({ 2 }));
+        Advance(LongTimeoutMs - 5001);
+        EXPECT_TRUE(Update(queue).empty());
+        Advance(1);
+        EXPECT_EQ(Update(queue), AZStd::vector<uint64_t>({ 1 }));
+    }
+
+    TEST_F(TimeoutQueueTests, TestMatchesReference)
+    {
+        TimeoutQueue queue;
+        AZ::SimpleLcgRandom random(1234);
+
+        struct ReferenceItem
+        {
+            TimeoutId m_timeoutId;
+            AZ::TimeMs m_timeoutTimeMs;
+            bool m_active;
+        };
+        AZStd::vector<ReferenceItem> reference;
+
+        for (uint32_t step = 0; step < 2000; ++step)
+        {
+            for (uint32_t count = random.GetRandom() % 8; count > 0; --count)
+            {
+                const AZ::TimeMs timeoutMs = AZ::TimeMs{ random.GetRandom() % 20000 };
+                const TimeoutId timeoutId = queue.RegisterItem(reference.size(), timeoutMs);
+                reference.push_back({ timeoutId, m_time->GetElapsedTimeMs() + timeoutMs, true });
+            }
+
+            if (!reference.empty() && (random.GetRandom() % 4 == 0))
+            {
+                ReferenceItem& removed = reference[random.GetRandom() % reference.size()];
+                queue.RemoveItem(removed.m_timeoutId);
+                removed.m_active = false;
+            }
+
+            Advance(random.GetRandom() % 100);
+
+            AZStd::vector<uint64_t> expected;
+            for (uint64_t index = 0; index < reference.size(); ++index)
+            {
+                if (reference[index].m_active && (reference[index].m_timeoutTimeMs < m_time->GetElapsedTimeMs()))
+                {
+                    expected.push_back(index);
+                    reference[index].m_active = false;
+                }
+            }
+
+            AZStd::vector<uint64_t> timedOut = Update(queue);
+            AZStd::sort(timedOut.begin(), timedOut.end());
+            EXPECT_EQ(timedOut, expected);
+        }
+    }
 }
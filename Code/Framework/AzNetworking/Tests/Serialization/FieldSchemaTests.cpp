@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/FieldSchema.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    template <typename TYPE>
+    uint32_t RoundTripWithSchema(const TYPE& valueIn, TYPE& valueOut, const AzNetworking::FieldSchema& schema)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        AzNetworking::NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        TYPE value = valueIn;
+        EXPECT_TRUE(AzNetworking::SerializeWithSchema(inputSerializer, value, "Value", schema));
+
+        AzNetworking::NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(AzNetworking::SerializeWithSchema(outputSerializer, valueOut, "Value", schema));
+        return inputSerializer.GetSizeInBits();
+    }
+
+    TEST(FieldSchema, TestQuantizedFloat)
+    {
+        const AzNetworking::FieldSchema schema{ AzNetworking::FieldEncoding::Quantized, -10.0f, 10.0f, 12, 0 };
+        const float tolerance = 20.0f / 4095.0f;
+        for (float value : { -10.0f, -3.3f, 0.0f, 7.77f, 10.0f })
+        {
+            float valueOut = 100.0f;
+            EXPECT_EQ(RoundTripWithSchema(value, valueOut, schema), 12);
+            EXPECT_NEAR(valueOut, value, tolerance);
+        }
+
+        // Out of range values are clamped
+        float valueOut = 0.0f;
+        RoundTripWithSchema(25.0f, valueOut, schema);
+        EXPECT_NEAR(valueOut, 10.0f, tolerance);
+    }
+
+    TEST(FieldSchema, TestQuantizedVector3)
+    {
+        const AzNetworking::FieldSchema schema{ AzNetworking::FieldEncoding::Quantized, -512.0f, 512.0f, 16, 0 };
+        const AZ::Vector3 value(-100.25f, 0.5f, 333.3f);
+        AZ::Vector3 valueOut = AZ::Vector3::CreateZero();
+        EXPECT_EQ(RoundTripWithSchema(value, valueOut, schema), 48);
+        EXPECT_TRUE(valueOut.IsClose(value, 1024.0f / 65535.0f));
+    }
+
+    TEST(FieldSchema, TestSmallestThree)
+    {
+        const AzNetworking::FieldSchema schema{ AzNetworking::FieldEncoding::SmallestThree, 0.0f, 1.0f, 15, 0 };
+        const AZ::Quaternion rotations[] =
+        {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationZ(1.0f),
+            AZ::Quaternion::CreateRotationX(-2.5f) * AZ::Quaternion::CreateRotationY(0.7f),
+            AZ::Quaternion(-0.5f, 0.5f, -0.5f, -0.5f)
+        };
+
+        for (const AZ::Quaternion& rotation : rotations)
+        {
+            AZ::Quaternion rotationOut = AZ::Quaternion::CreateZero();
+            // Two bits for the dropped component index, plus three 15 bit components
+            EXPECT_EQ(RoundTripWithSchema(rotation, rotationOut, schema), 47);
+            // q and -q are the same rotation, so compare using the absolute dot product
+            EXPECT_GT(AZ::GetAbs(rotationOut.Dot(rotation)), 0.99999f);
+        }
+    }
+
+    TEST(FieldSchema, TestDeltaInteger)
+    {
+        const AzNetworking::FieldSchema schema{ AzNetworking::FieldEncoding::Delta, 0.0f, 1.0f, 16, -1 };
+
+        int32_t valueOut = 0;
+        // Values close to the baseline use the smallest size class, 2 bits of size class plus 4 bits of value
+        EXPECT_EQ(RoundTripWithSchema(int32_t(-1), valueOut, schema), 6);
+        EXPECT_EQ(valueOut, -1);
+        EXPECT_EQ(RoundTripWithSchema(int32_t(5), valueOut, schema), 6);
+        EXPECT_EQ(valueOut, 5);
+        EXPECT_EQ(RoundTripWithSchema(int32_t(200), valueOut, schema), 18);
+        EXPECT_EQ(valueOut, 200);
+        EXPECT_EQ(RoundTripWithSchema(AZStd::numeric_limits<int32_t>::min(), valueOut, schema), 34);
+        EXPECT_EQ(valueOut, AZStd::numeric_limits<int32_t>::min());
+        EXPECT_EQ(RoundTripWithSchema(AZStd::numeric_limits<int32_t>::max(), valueOut, schema), 34);
+        EXPECT_EQ(valueOut, AZStd::numeric_limits<int32_t>::max());
+
+        for (int32_t value = -128; value < 128; ++value)
+        {
+            int8_t smallOut = 0;
+            RoundTripWithSchema(static_cast<int8_t>(value), smallOut, schema);
+            EXPECT_EQ(smallOut, static_cast<int8_t>(value));
+        }
+    }
+
+    TEST(FieldSchema, TestDefaultEncodingUnchanged)
+    {
+        const AzNetworking::FieldSchema schema;
+        float valueOut = 0.0f;
+        EXPECT_EQ(RoundTripWithSchema(1.2345f, valueOut, schema), 32);
+        EXPECT_EQ(valueOut, 1.2345f);
+    }
+}
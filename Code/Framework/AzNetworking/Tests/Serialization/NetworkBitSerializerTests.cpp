@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Utilities/BitPacking.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    TEST(NetworkBitSerializer, TestRequiredBitCount)
+    {
+        EXPECT_EQ(AzNetworking::GetRequiredBitCount(0), 0);
+        EXPECT_EQ(AzNetworking::GetRequiredBitCount(1), 1);
+        EXPECT_EQ(AzNetworking::GetRequiredBitCount(3), 2);
+        EXPECT_EQ(AzNetworking::GetRequiredBitCount(4), 3);
+        EXPECT_EQ(AzNetworking::GetRequiredBitCount(255), 8);
+        EXPECT_EQ(AzNetworking::GetRequiredBitCount(256), 9);
+        EXPECT_EQ(AzNetworking::GetRequiredBitCount(0xFFFFFFFFFFFFFFFF), 64);
+    }
+
+    TEST(NetworkBitSerializer, TestRoundTrip)
+    {
+        AZStd::array<uint8_t, 128> buffer;
+        AzNetworking::NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::ISerializer& input = inputSerializer;
+
+        bool boolIn = true;
+        uint8_t smallIn = 5;
+        int32_t signedIn = -1000;
+        int32_t fullRangeIn = AZStd::numeric_limits<int32_t>::min();
+        uint64_t wideIn = 0x0123456789ABCDEF;
+        float floatIn = 3.25f;
+        double doubleIn = -7.125;
+        char stringIn[] = "bits";
+        uint32_t stringSize = 4;
+
+        EXPECT_TRUE(input.Serialize(boolIn, "Bool"));
+        EXPECT_TRUE(input.Serialize(smallIn, "Small", uint8_t(0), uint8_t(7)));
+        EXPECT_TRUE(input.Serialize(signedIn, "Signed", -1024, 1023));
+        EXPECT_TRUE(input.Serialize(fullRangeIn, "FullRange"));
+        EXPECT_TRUE(input.Serialize(wideIn, "Wide"));
+        EXPECT_TRUE(input.Serialize(floatIn, "Float"));
+        EXPECT_TRUE(input.Serialize(doubleIn, "Double"));
+        EXPECT_TRUE(input.SerializeBytes(reinterpret_cast<uint8_t*>(stringIn), 16, true, stringSize, "String"));
+
+        // 1 + 3 + 11 + 32 + 64 + 32 + 64 + (5 + 4 * 8)
+        EXPECT_EQ(inputSerializer.GetSizeInBits(), 244);
+        EXPECT_EQ(inputSerializer.GetSize(), 31);
+
+        AzNetworking::NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        AzNetworking::ISerializer& output = outputSerializer;
+
+        bool boolOut = false;
+        uint8_t smallOut = 0;
+        int32_t signedOut = 0;
+        int32_t fullRangeOut = 0;
+        uint64_t wideOut = 0;
+        float floatOut = 0.0f;
+        double doubleOut = 0.0;
+        char stringOut[16] = {};
+        uint32_t stringSizeOut = 0;
+
+        EXPECT_TRUE(output.Serialize(boolOut, "Bool"));
+        EXPECT_TRUE(output.Serialize(smallOut, "Small", uint8_t(0), uint8_t(7)));
+        EXPECT_TRUE(output.Serialize(signedOut, "Signed", -1024, 1023));
+        EXPECT_TRUE(output.Serialize(fullRangeOut, "FullRange"));
+        EXPECT_TRUE(output.Serialize(wideOut, "Wide"));
+        EXPECT_TRUE(output.Serialize(floatOut, "Float"));
+        EXPECT_TRUE(output.Serialize(doubleOut, "Double"));
+        EXPECT_TRUE(output.SerializeBytes(reinterpret_cast<uint8_t*>(stringOut), 16, true, stringSizeOut, "String"));
+
+        EXPECT_EQ(boolOut, boolIn);
+        EXPECT_EQ(smallOut, smallIn);
+        EXPECT_EQ(signedOut, signedIn);
+        EXPECT_EQ(fullRangeOut, fullRangeIn);
+        EXPECT_EQ(wideOut, wideIn);
+        EXPECT_EQ(floatOut, floatIn);
+        EXPECT_EQ(doubleOut, doubleIn);
+        EXPECT_EQ(stringSizeOut, stringSize);
+        EXPECT_EQ(memcmp(stringOut, stringIn, stringSize), 0);
+        EXPECT_EQ(outputSerializer.GetSizeInBits(), inputSerializer.GetSizeInBits());
+    }
+
+    TEST(NetworkBitSerializer, TestSmallerThanByteSerializer)
+    {
+        AZStd::array<uint8_t, 64> byteBuffer;
+        AZStd::array<uint8_t, 64> bitBuffer;
+        AzNetworking::NetworkInputSerializer byteSerializer(byteBuffer.data(), static_cast<uint32_t>(byteBuffer.size()));
+        AzNetworking::NetworkBitInputSerializer bitSerializer(bitBuffer.data(), static_cast<uint32_t>(bitBuffer.size()));
+
+        for (uint8_t index = 0; index < 8; ++index)
+        {
+            bool flag = (index % 2) == 0;
+            uint8_t value = index;
+            byteSerializer.Serialize(flag, "Flag");
+            byteSerializer.Serialize(value, "Value", uint8_t(0), uint8_t(7));
+            bitSerializer.Serialize(flag, "Flag");
+            bitSerializer.Serialize(value, "Value", uint8_t(0), uint8_t(7));
+        }
+
+        EXPECT_EQ(byteSerializer.GetSize(), 16);
+        EXPECT_EQ(bitSerializer.GetSize(), 4);
+    }
+
+    TEST(NetworkBitSerializer, TestCopyBitsToBuffer)
+    {
+        AZStd::array<uint8_t, 32> sourceBuffer;
+        AzNetworking::NetworkBitInputSerializer sourceSerializer(sourceBuffer.data(), static_cast<uint32_t>(sourceBuffer.size()));
+        bool prefix = true;
+        uint16_t value = 0x1234;
+        AzNetworking::ISerializer& source = sourceSerializer;
+        source.Serialize(prefix, "Prefix");
+        source.Serialize(value, "Value");
+
+        // Copy only the value bits, at an unaligned offset in both the source and destination
+        AZStd::array<uint8_t, 32> destBuffer;
+        AzNetworking::NetworkBitInputSerializer destSerializer(destBuffer.data(), static_cast<uint32_t>(destBuffer.size()));
+        uint8_t destPrefix = 2;
+        destSerializer.Serialize(destPrefix, "Prefix", uint8_t(0), uint8_t(3));
+        EXPECT_TRUE(destSerializer.CopyBitsToBuffer(sourceBuffer.data(), 1, 16));
+        EXPECT_EQ(destSerializer.GetSizeInBits(), 18);
+
+        AzNetworking::NetworkBitOutputSerializer outputSerializer(destBuffer.data(), destSerializer.GetSize());
+        uint8_t prefixOut = 0;
+        uint16_t valueOut = 0;
+        AzNetworking::ISerializer& output = outputSerializer;
+        output.Serialize(prefixOut, "Prefix", uint8_t(0), uint8_t(3));
+        output.Serialize(valueOut, "Value");
+        EXPECT_EQ(prefixOut, destPrefix);
+        EXPECT_EQ(valueOut, value);
+    }
+
+    TEST(NetworkBitSerializer, TestOverflowInvalidates)
+    {
+        AZStd::array<uint8_t, 1> buffer;
+        AzNetworking::NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        uint8_t value = 3;
+        EXPECT_TRUE(inputSerializer.Serialize(value, "Value", uint8_t(0), uint8_t(7)));
+        EXPECT_TRUE(inputSerializer.Serialize(value, "Value", uint8_t(0), uint8_t(7)));
+        EXPECT_FALSE(inputSerializer.Serialize(value, "Value", uint8_t(0), uint8_t(7)));
+        EXPECT_FALSE(inputSerializer.IsValid());
+
+        AzNetworking::NetworkBitOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::ISerializer& output = outputSerializer;
+        uint16_t wideValue = 0;
+        EXPECT_FALSE(output.Serialize(wideValue, "Value"));
+        EXPECT_FALSE(outputSerializer.IsValid());
+    }
+}
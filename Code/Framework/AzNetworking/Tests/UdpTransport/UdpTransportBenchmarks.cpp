@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/EBus/EventSchedulerSystemComponent.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class BenchmarkUdpConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ;
+        }
+
+        PacketDispatchResult OnPacketReceived([[maybe_unused]] IConnection* connection, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            // Only core packets are sent by the benchmark, and those are handled by the network interface itself
+            return PacketDispatchResult::Failure;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ;
+        }
+    };
+
+    /*
+     * Measures how the Udp transport scales with connection count, loss and latency.
+     * A server and N in-process client interfaces are connected over loopback, and every benchmark iteration is a single network tick in
+     * which the server sends one reliable and one unreliable packet per connection and every client sends one unreliable packet back.
+     * Loss and latency are simulated on both ends of every connection through ConnectionQuality, which requires ENABLE_LATENCY_DEBUG (non-release builds).
+     * Ticks are paced in real time so that acks, retransmit timeouts and deferred sends behave as they would on a running server; the pacing
+     * sleep is excluded from the measured time, so the reported time is the cost of a single tick.
+     * Range 0 is the client count, range 1 the loss percentage and range 2 the one way latency in milliseconds.
+     */
+    class UdpTransportBenchmark
+        : public AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint16_t ServerPort = 33450;
+        static constexpr AZ::TimeMs TickIntervalMs = AZ::TimeMs{ 5 };
+        static constexpr AZ::TimeMs ConnectTimeoutMs = AZ::TimeMs{ 10000 };
+        static constexpr int32_t TickCount = 400;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void InternalSetUp(const benchmark::State& state)
+        {
+            AZ::NameDictionary::Create();
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_eventScheduler = AZStd::make_unique<AZ::EventSchedulerSystemComponent>();
+            m_networkingSystemComponent = AZStd::make_unique<NetworkingSystemComponent>();
+
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            m_serverInterface = networking->CreateNetworkInterface(AZ::Name("BenchmarkUdpServer"), ProtocolType::Udp, TrustZone::ExternalClientToServer, m_listener);
+            m_serverInterface->Listen(ServerPort);
+
+            const uint32_t clientCount = aznumeric_cast<uint32_t>(state.range(0));
+            for (uint32_t index = 0; index < clientCount; ++index)
+            {
+                const AZ::Name clientName(AZStd::string::format("BenchmarkUdpClient%u", index));
+                INetworkInterface* clientInterface = networking->CreateNetworkInterface(clientName, ProtocolType::Udp, TrustZone::ExternalClientToServer, m_listener);
+                clientInterface->Connect(IpAddress(127, 0, 0, 1, ServerPort));
+                m_clientNames.push_back(clientName);
+                m_clientInterfaces.push_back(clientInterface);
+            }
+
+            // Connect over a perfect link, the simulated link quality is only applied once every connection is established
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            while (!AllClientsConnected() && (AZ::GetElapsedTimeMs() - startTimeMs < ConnectTimeoutMs))
+            {
+                Tick();
+            }
+
+            const ConnectionQuality quality(aznumeric_cast<int32_t>(state.range(1)), AZ::TimeMs{ state.range(2) }, AZ::Time::ZeroTimeMs);
+            auto applyQuality = [&quality](IConnection& connection) { connection.GetConnectionQuality() = quality; };
+            m_serverInterface->GetConnectionSet().VisitConnections(applyQuality);
+            for (INetworkInterface* clientInterface : m_clientInterfaces)
+            {
+                clientInterface->GetConnectionSet().VisitConnections(applyQuality);
+            }
+        }
+
+        void InternalTearDown()
+        {
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            for (const AZ::Name& clientName : m_clientNames)
+            {
+                networking->DestroyNetworkInterface(clientName);
+            }
+            networking->DestroyNetworkInterface(AZ::Name("BenchmarkUdpServer"));
+            m_clientInterfaces.clear();
+            m_clientNames.clear();
+
+            m_networkingSystemComponent.reset();
+            m_eventScheduler.reset();
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+            AZ::NameDictionary::Destroy();
+        }
+
+        static uint32_t GetConnectedCount(INetworkInterface* networkInterface)
+        {
+            uint32_t connectedCount = 0;
+            networkInterface->GetConnectionSet().VisitConnections([&connectedCount](IConnection& connection)
+            {
+                connectedCount += (connection.GetConnectionState() == ConnectionState::Connected) ? 1 : 0;
+            });
+            return connectedCount;
+        }
+
+        bool AllClientsConnected() const
+        {
+            bool connected = (GetConnectedCount(m_serverInterface) == m_clientInterfaces.size());
+            for (INetworkInterface* clientInterface : m_clientInterfaces)
+            {
+                connected &= (GetConnectedCount(clientInterface) == 1);
+            }
+            return connected;
+        }
+
+        void Tick()
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(aznumeric_cast<int64_t>(TickIntervalMs)));
+            m_eventScheduler->OnTick(0.0f, AZ::ScriptTimePoint());
+            m_networkingSystemComponent->OnSystemTick();
+        }
+
+        void SendTraffic()
+        {
+            m_serverInterface->GetConnectionSet().VisitConnections([](IConnection& connection)
+            {
+                connection.SendReliablePacket(CorePackets::HeartbeatPacket(false));
+                connection.SendUnreliablePacket(CorePackets::HeartbeatPacket(false));
+            });
+            for (INetworkInterface* clientInterface : m_clientInterfaces)
+            {
+                clientInterface->GetConnectionSet().VisitConnections([](IConnection& connection)
+                {
+                    connection.SendUnreliablePacket(CorePackets::HeartbeatPacket(false));
+                });
+            }
+        }
+
+        NetworkInterfaceMetrics GetTotalMetrics() const
+        {
+            NetworkInterfaceMetrics total = m_serverInterface->GetMetrics();
+            for (INetworkInterface* clientInterface : m_clientInterfaces)
+            {
+                const NetworkInterfaceMetrics& metrics = clientInterface->GetMetrics();
+                total.m_sendPackets += metrics.m_sendPackets;
+                total.m_recvPackets += metrics.m_recvPackets;
+                total.m_resentPackets += metrics.m_resentPackets;
+            }
+            return total;
+        }
+
+        //! Allocations are only counted while the system allocator keeps allocation records, otherwise nothing is returned.
+        static AZStd::optional<size_t> GetRequestedAllocs()
+        {
+            AZ::Debug::AllocationRecords* records = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().GetRecords();
+            if (records == nullptr || records->GetMode() == AZ::Debug::AllocationRecords::RECORD_NO_RECORDS)
+            {
+                return AZStd::nullopt;
+            }
+            return records->RequestedAllocs();
+        }
+
+        BenchmarkUdpConnectionListener m_listener;
+        INetworkInterface* m_serverInterface = nullptr;
+        AZStd::vector<AZ::Name> m_clientNames;
+        AZStd::vector<INetworkInterface*> m_clientInterfaces;
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<AZ::EventSchedulerSystemComponent> m_eventScheduler;
+        AZStd::unique_ptr<NetworkingSystemComponent> m_networkingSystemComponent;
+    };
+
+    BENCHMARK_DEFINE_F(UdpTransportBenchmark, ServerTick)(benchmark::State& state)
+    {
+        if (!AllClientsConnected())
+        {
+            state.SkipWithError("Failed to establish all loopback connections");
+            return;
+        }
+
+        const NetworkInterfaceMetrics startMetrics = GetTotalMetrics();
+        const AZStd::optional<size_t> startAllocs = GetRequestedAllocs();
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        uint64_t reliableSends = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(aznumeric_cast<int64_t>(TickIntervalMs)));
+            state.ResumeTiming();
+
+            SendTraffic();
+            reliableSends += m_serverInterface->GetConnectionSet().GetActiveConnectionCount();
+            m_eventScheduler->OnTick(0.0f, AZ::ScriptTimePoint());
+            m_networkingSystemComponent->OnSystemTick();
+        }
+
+        const NetworkInterfaceMetrics endMetrics = GetTotalMetrics();
+        const double elapsedSeconds = AZ::GetMax(AZ::TimeMsToSecondsDouble(AZ::GetElapsedTimeMs() - startTimeMs), 0.001);
+        const double sentPackets = aznumeric_cast<double>(endMetrics.m_sendPackets - startMetrics.m_sendPackets);
+        const double recvPackets = aznumeric_cast<double>(endMetrics.m_recvPackets - startMetrics.m_recvPackets);
+        const double resentPackets = aznumeric_cast<double>(endMetrics.m_resentPackets - startMetrics.m_resentPackets);
+
+        state.counters["Connections"] = aznumeric_cast<double>(m_serverInterface->GetConnectionSet().GetActiveConnectionCount());
+        state.counters["SentPacketsPerSecond"] = sentPackets / elapsedSeconds;
+        state.counters["RecvPacketsPerSecond"] = recvPackets / elapsedSeconds;
+        if (const AZStd::optional<size_t> endAllocs = GetRequestedAllocs(); startAllocs && endAllocs)
+        {
+            state.counters["AllocsPerTick"] =
+                benchmark::Counter(aznumeric_cast<double>(*endAllocs - *startAllocs), benchmark::Counter::kAvgIterations);
+        }
+        else
+        {
+            state.SetLabel("AllocsPerTick unavailable: allocation records are disabled");
+        }
+        state.counters["ResentPackets"] = resentPackets;
+        state.counters["RetransmitOverhead"] = (reliableSends > 0) ? resentPackets / aznumeric_cast<double>(reliableSends) : 0.0;
+    }
+
+    BENCHMARK_REGISTER_F(UdpTransportBenchmark, ServerTick)
+        ->Args({ 1, 0, 0 })
+        ->Args({ 16, 0, 0 })
+        ->Args({ 64, 0, 0 })
+        ->Args({ 256, 0, 0 })
+        ->Args({ 64, 5, 50 })
+        ->Args({ 64, 20, 100 })
+        ->Args({ 256, 5, 50 })
+        ->Iterations(UdpTransportBenchmark::TickCount)
+        ->Unit(benchmark::kMicrosecond);
+}
+
+#endif
@@ -14,13 +14,17 @@ set(FILES
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
+    DataStructures/TimeoutQueueBenchmarks.cpp
     DataStructures/TimeoutQueueTests.cpp
     Serialization/DeltaSerializerTests.cpp
+    Serialization/FieldSchemaTests.cpp
     Serialization/HashSerializerTests.cpp
+    Serialization/NetworkBitSerializerTests.cpp
     Serialization/NetworkInputSerializerTests.cpp
     Serialization/NetworkOutputSerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpTransportBenchmarks.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
@@ -10,6 +10,7 @@
 #include <AzCore/Asset/AssetJsonSerializer.h>
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
 
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
@@ -161,6 +162,8 @@ namespace AzToolsFramework
                         settings.m_metadata.Create<InstanceDomMetadata>();
                     }
 
+                    AZ::JsonSerializationUtils::ApplyParallelArrayLoadSettings(settings);
+
                     AZ::JsonSerializationResult::ResultCode result = AZ::JsonSerialization::Load(instance, prefabDom, settings);
 
                     AZ::Data::AssetManager::Instance().ResumeAssetRelease();
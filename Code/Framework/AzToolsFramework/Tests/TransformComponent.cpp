@@ -16,6 +16,7 @@
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/UnitTest/AzToolsFrameworkTestHelpers.h>
@@ -724,6 +725,250 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Fixture for AzFramework::TransformComponents that are updated through the TransformHierarchySystem.
+    class TransformComponentBatchedHierarchy
+        : public TransformComponentApplication
+    {
+    protected:
+        // Counts the transform changes of a single entity.
+        class TransformChangeCounter
+            : public TransformNotificationBus::Handler
+        {
+        public:
+            explicit TransformChangeCounter(EntityId entityId)
+            {
+                TransformNotificationBus::Handler::BusConnect(entityId);
+            }
+
+            ~TransformChangeCounter() override
+            {
+                TransformNotificationBus::Handler::BusDisconnect();
+            }
+
+            void OnTransformChanged([[maybe_unused]] const Transform& local, const Transform& world) override
+            {
+                ++m_changeCount;
+                m_lastWorldTM = world;
+            }
+
+            int m_changeCount = 0;
+            Transform m_lastWorldTM = Transform::CreateIdentity();
+        };
+
+        void TearDown() override
+        {
+            for (auto entityIt = m_entities.rbegin(); entityIt != m_entities.rend(); ++entityIt)
+            {
+                if ((*entityIt)->GetState() == Entity::State::Active)
+                {
+                    (*entityIt)->Deactivate();
+                }
+                delete *entityIt;
+            }
+            m_entities.clear();
+            m_hierarchy.Disconnect();
+
+            TransformComponentApplication::TearDown();
+        }
+
+        // Creates an active entity, parented while keeping its local transform.
+        EntityId CreateEntity(const Transform& localTM, EntityId parentId = EntityId())
+        {
+            Entity* entity = aznew Entity();
+            entity->Init();
+            entity->CreateComponent<TransformComponent>();
+            entity->Activate();
+            m_entities.push_back(entity);
+
+            TransformBus::Event(entity->GetId(), &TransformBus::Events::SetLocalTM, localTM);
+            if (parentId.IsValid())
+            {
+                TransformBus::Event(entity->GetId(), &TransformBus::Events::SetParentRelative, parentId);
+            }
+            return entity->GetId();
+        }
+
+        // Creates a chain of entities with each entity parented to the previous one.
+        AZStd::vector<EntityId> CreateChain(size_t length)
+        {
+            AZStd::vector<EntityId> chain;
+            for (size_t i = 0; i < length; ++i)
+            {
+                chain.push_back(CreateEntity(
+                    Transform::CreateTranslation(Vector3(1.0f, 0.0f, 0.0f)), chain.empty() ? EntityId() : chain.back()));
+            }
+            return chain;
+        }
+
+        static Transform GetWorldTM(EntityId entityId)
+        {
+            Transform worldTM = Transform::CreateIdentity();
+            TransformBus::EventResult(worldTM, entityId, &TransformBus::Events::GetWorldTM);
+            return worldTM;
+        }
+
+        TransformHierarchySystem m_hierarchy;
+        AZStd::vector<Entity*> m_entities;
+    };
+
+    TEST_F(TransformComponentBatchedHierarchy, MoveRoot_DescendantWorldTransformsAreUpToDateWhenRead)
+    {
+        m_hierarchy.Connect();
+        AZStd::vector<EntityId> chain = CreateChain(8);
+
+        TransformBus::Event(chain.front(), &TransformBus::Events::SetWorldTranslation, Vector3(10.0f, 5.0f, 0.0f));
+        EXPECT_TRUE(m_hierarchy.HasPendingUpdates());
+
+        for (size_t i = 0; i < chain.size(); ++i)
+        {
+            EXPECT_THAT(GetWorldTM(chain[i]).GetTranslation(), IsClose(Vector3(10.0f + aznumeric_cast<float>(i), 5.0f, 0.0f)));
+        }
+
+        // Reads don't send notifications, so the update is still pending.
+        EXPECT_TRUE(m_hierarchy.HasPendingUpdates());
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, ReadDescendant_NotificationsAreDeferredUntilProcessed)
+    {
+        m_hierarchy.Connect();
+        AZStd::vector<EntityId> chain = CreateChain(4);
+        m_hierarchy.ProcessTransformHierarchyUpdates();
+
+        TransformChangeCounter middleCounter(chain[1]);
+        TransformChangeCounter leafCounter(chain.back());
+        TransformBus::Event(chain.front(), &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 7.0f, 0.0f));
+
+        EXPECT_THAT(GetWorldTM(chain.back()).GetTranslation(), IsClose(Vector3(3.0f, 7.0f, 0.0f)));
+        EXPECT_EQ(middleCounter.m_changeCount, 0);
+        EXPECT_EQ(leafCounter.m_changeCount, 0);
+
+        m_hierarchy.ProcessTransformHierarchyUpdates();
+        EXPECT_EQ(middleCounter.m_changeCount, 1);
+        EXPECT_THAT(middleCounter.m_lastWorldTM.GetTranslation(), IsClose(Vector3(1.0f, 7.0f, 0.0f)));
+        EXPECT_EQ(leafCounter.m_changeCount, 1);
+        EXPECT_THAT(leafCounter.m_lastWorldTM.GetTranslation(), IsClose(Vector3(3.0f, 7.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, MoveUnrelatedRoot_ReadDoesNotProcessOtherHierarchies)
+    {
+        m_hierarchy.Connect();
+        AZStd::vector<EntityId> movedChain = CreateChain(3);
+        AZStd::vector<EntityId> readChain = CreateChain(3);
+        m_hierarchy.ProcessTransformHierarchyUpdates();
+
+        TransformChangeCounter movedLeafCounter(movedChain.back());
+        TransformBus::Event(movedChain.front(), &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 0.0f, 9.0f));
+
+        EXPECT_THAT(GetWorldTM(readChain.back()).GetTranslation(), IsClose(Vector3(3.0f, 0.0f, 0.0f)));
+        EXPECT_EQ(movedLeafCounter.m_changeCount, 0);
+        EXPECT_TRUE(m_hierarchy.HasPendingUpdates());
+
+        m_hierarchy.ProcessTransformHierarchyUpdates();
+        EXPECT_EQ(movedLeafCounter.m_changeCount, 1);
+        EXPECT_THAT(movedLeafCounter.m_lastWorldTM.GetTranslation(), IsClose(Vector3(3.0f, 0.0f, 9.0f)));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, MoveRoot_DescendantNotificationsAreSentWhenProcessed)
+    {
+        m_hierarchy.Connect();
+        AZStd::vector<EntityId> chain = CreateChain(4);
+        m_hierarchy.ProcessTransformHierarchyUpdates();
+
+        TransformChangeCounter leafCounter(chain.back());
+        TransformBus::Event(chain.front(), &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 0.0f, 3.0f));
+        TransformBus::Event(chain.front(), &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 0.0f, 6.0f));
+        EXPECT_EQ(leafCounter.m_changeCount, 0);
+
+        // Both moves are combined into a single update of the descendants.
+        m_hierarchy.ProcessTransformHierarchyUpdates();
+        EXPECT_EQ(leafCounter.m_changeCount, 1);
+        EXPECT_THAT(leafCounter.m_lastWorldTM.GetTranslation(), IsClose(Vector3(3.0f, 0.0f, 6.0f)));
+
+        m_hierarchy.ProcessTransformHierarchyUpdates();
+        EXPECT_EQ(leafCounter.m_changeCount, 1);
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, RemoveMiddleOfChain_DescendantsKeepWorldTransform)
+    {
+        m_hierarchy.Connect();
+        AZStd::vector<EntityId> chain = CreateChain(4);
+        TransformBus::Event(chain.front(), &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 2.0f, 0.0f));
+
+        // Deactivating a parent with pending updates applies them before the children are detached.
+        m_entities[1]->Deactivate();
+        EXPECT_THAT(GetWorldTM(chain[3]).GetTranslation(), IsClose(Vector3(3.0f, 2.0f, 0.0f)));
+
+        TransformBus::Event(chain.front(), &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 4.0f, 0.0f));
+        m_hierarchy.ProcessTransformHierarchyUpdates();
+        EXPECT_THAT(GetWorldTM(chain[3]).GetTranslation(), IsClose(Vector3(3.0f, 2.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, RandomHierarchyChanges_MatchesUnbatchedHierarchy)
+    {
+        constexpr size_t EntityCount = 64;
+        AZ::SimpleLcgRandom random(1234);
+        auto randomTransform = [&random]()
+        {
+            return Transform::CreateFromQuaternionAndTranslation(
+                Quaternion::CreateRotationZ(random.GetRandomFloat() * Constants::TwoPi),
+                Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 10.0f);
+        };
+
+        // Build the same random tree twice, first with entities that aren't in the hierarchy system.
+        AZStd::vector<Transform> localTMs;
+        AZStd::vector<size_t> parents;
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            localTMs.push_back(randomTransform());
+            parents.push_back(i == 0 ? 0 : random.GetRandom() % i);
+        }
+
+        AZStd::vector<EntityId> reference;
+        AZStd::vector<EntityId> batched;
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            reference.push_back(CreateEntity(localTMs[i], i == 0 ? EntityId() : reference[parents[i]]));
+        }
+        m_hierarchy.Connect();
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            batched.push_back(CreateEntity(localTMs[i], i == 0 ? EntityId() : batched[parents[i]]));
+        }
+
+        for (int step = 0; step < 32; ++step)
+        {
+            // Move a few entities, occasionally in world space, before comparing the whole tree.
+            for (int move = 0; move < 4; ++move)
+            {
+                const size_t index = random.GetRandom() % EntityCount;
+                const Transform tm = randomTransform();
+                const bool isWorldMove = random.GetRandom() % 4 == 0;
+                for (EntityId entityId : { reference[index], batched[index] })
+                {
+                    if (isWorldMove)
+                    {
+                        TransformBus::Event(entityId, &TransformBus::Events::SetWorldTM, tm);
+                    }
+                    else
+                    {
+                        TransformBus::Event(entityId, &TransformBus::Events::SetLocalTM, tm);
+                    }
+                }
+            }
+
+            // Read half of the tree before processing, to mix reads that resolve pending updates with updates on tick.
+            for (size_t i = 0; i < EntityCount; i += 2)
+            {
+                EXPECT_THAT(GetWorldTM(batched[i]), IsCloseTolerance(GetWorldTM(reference[i]), 1e-3f));
+            }
+            m_hierarchy.ProcessTransformHierarchyUpdates();
+            for (size_t i = 0; i < EntityCount; ++i)
+            {
+                EXPECT_THAT(GetWorldTM(batched[i]), IsCloseTolerance(GetWorldTM(reference[i]), 1e-3f));
+            }
+        }
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
@@ -165,6 +165,9 @@ namespace AZ
 
             const AZ::RPI::Scene* m_scene = nullptr;
 
+            // The name the dynamic buffers are accounted under, which includes the DebugDraw gem since it draws through AuxGeom
+            Name m_bufferConsumer = Name("AuxGeom");
+
             bool m_needUpdatePipelineStates = false;
 
         };
@@ -152,6 +152,7 @@ namespace AZ
 
             RHI::IndexBufferView m_indexBufferView;
             AZStd::array<RHI::StreamBufferView, 2> m_vertexBufferView; // For vertex buffer and instance data
+            Name m_bufferConsumer = Name("ImGui"); // The name the dynamic buffers are accounted under
             AZStd::vector<DrawInfo> m_draws;
             Data::Instance<RPI::StreamingImage> m_fontAtlas;
 
@@ -8,10 +8,13 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
 
 namespace AZ
 {
@@ -99,6 +102,16 @@ namespace AZ
          * kept inside the compiler. The cache is big enough to avoid having to re-create views every frame, but
          * bounded in order to release entries old views.
          *
+         *      == Topology Caching ==
+         *
+         * The render pipeline rarely changes its topology between frames. The compiler hashes the scopes, their
+         * producer / consumer edges, the attachment usages on each scope and the transient attachment descriptors.
+         * When the hash matches the previous frame, the queue-centric links, the transient attachment lifetimes,
+         * the sorted transient pool commands and the transient memory hint are reused. Only the per-frame data is
+         * patched: scopes are re-linked, the transient pool is replayed to assign this frame's resources, and views
+         * are re-assigned. The platform compilers don't reuse anything yet: barrier lists and fence values are derived
+         * from scratch every frame. For them IsTopologyUnchanged only detects the unchanged topology.
+         *
          *      == Platform-Specific Compilation ==
          *
          * Finally, the compiler calls into the platform-specific compile method, which hands control over to the
@@ -125,6 +138,11 @@ namespace AZ
              */
             MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+            /// Returns true if the graph being compiled (or last compiled) has the same topology as the
+            /// previous one, and the cached platform-independent compile results were reused. No platform
+            /// CompileInternal implementation uses this yet.
+            bool IsTopologyUnchanged() const;
+
         protected:
             FrameGraphCompiler() = default;
 
@@ -146,6 +164,12 @@ namespace AZ
 
             MessageOutcome ValidateCompileRequest(const FrameGraphCompileRequest& request) const;
 
+            /// Hashes everything the platform-independent compile results depend on.
+            size_t CalculateTopologyHash(const FrameGraphCompileRequest& request) const;
+
+            /// Drops the cached compile results, forcing a full compile on the next frame.
+            void ResetTopologyCache();
+
             void CompileQueueCentricScopeGraph(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
@@ -171,6 +195,38 @@ namespace AZ
             ObjectCache<ImageView> m_imageViewCache;
             ObjectCache<BufferView> m_bufferViewCache;
 
+            //////////////////////////////////////////////////////////////////////////
+            // Compile results cached from the previous frame, keyed by the topology hash.
+
+            struct QueueLink
+            {
+                uint32_t m_producerScopeIndex = 0;
+                uint32_t m_consumerScopeIndex = 0;
+            };
+
+            struct AttachmentLifetime
+            {
+                uint32_t m_firstScopeIndex = 0;
+                uint32_t m_lastScopeIndex = 0;
+            };
+
+            size_t m_topologyHash = 0;
+            bool m_hasCachedTopology = false;
+            bool m_isTopologyUnchanged = false;
+
+            /// Producer / consumer links of the queue-centric scope graph.
+            AZStd::vector<QueueLink> m_queueLinks;
+
+            /// Transient attachment lifetimes after async queue extension, in attachment database order.
+            AZStd::vector<AttachmentLifetime> m_transientImageLifetimes;
+            AZStd::vector<AttachmentLifetime> m_transientBufferLifetimes;
+
+            /// The sorted activate / deactivate commands replayed against the transient attachment pool.
+            AZStd::vector<uint32_t> m_transientCommands;
+
+            /// The memory usage gathered by the statistics pass of the MemoryHint heap strategy.
+            AZStd::optional<TransientAttachmentStatistics::MemoryUsage> m_transientMemoryHint;
+            //////////////////////////////////////////////////////////////////////////
         };
     }
 }
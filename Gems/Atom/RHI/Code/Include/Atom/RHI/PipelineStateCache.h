@@ -11,6 +11,9 @@
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/function/function_template.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -92,6 +95,9 @@ namespace AZ
         //!      // In jobs. Lots and lots of requests.
         //!      const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
         //!
+        //!      // Optionally, compile pipeline states that are expected to be requested (e.g. because a previous session did) in jobs.
+        //!      pipelineStateCache->PrewarmLibrary(libraryHandle, AZStd::move(prewarmDescriptors));
+        //!
         //!      // Reset contents of library. Releases all pipeline state references. Library remains valid.
         //!      pipelineStateCache->ResetLibrary(libraryHandle);
         //!
@@ -112,6 +118,39 @@ namespace AZ
 
             static Ptr<PipelineStateCache> Create(Device& device);
 
+            //! Pipeline state descriptor variant for dispatch, draw, and ray tracing.
+            using PipelineStateDescriptorVariant = AZStd::variant<PipelineStateDescriptorForDraw, PipelineStateDescriptorForDispatch, PipelineStateDescriptorForRayTracing>;
+
+            //! A pipeline state to compile before it is requested.
+            struct PrewarmDescriptor
+            {
+                PipelineStateDescriptorVariant m_descriptor;
+
+                //! The number of consecutive sessions in which the pipeline state was prewarmed but not acquired.
+                //! ForEachPipelineState reports it back, incremented, if the pipeline state isn't acquired this session either.
+                uint32_t m_unusedSessionCount = 0;
+            };
+
+            //! Called with the descriptor of a pipeline state, and the number of consecutive sessions in which it was
+            //! prewarmed but not acquired (zero if it was acquired).
+            using PipelineStateVisitor = AZStd::function<void(const PipelineStateDescriptor& descriptor, uint32_t unusedSessionCount)>;
+
+            //! Counts of how pipeline states were provided since the cache was created.
+            struct PrewarmStatistics
+            {
+                //! Pipeline states compiled by PrewarmLibrary.
+                uint32_t m_prewarmedCount = 0;
+
+                //! First requests of a pipeline state that were served by a prewarmed pipeline state.
+                uint32_t m_warmHitCount = 0;
+
+                //! First requests of a pipeline state that had to compile it.
+                uint32_t m_coldCompileCount = 0;
+
+                //! Returns the fraction of first requests that didn't have to compile.
+                float GetWarmHitRate() const;
+            };
+
             //! Resets the caches of all pipeline libraries back to empty. All internal references to pipeline states are released.
             void Reset();
 
@@ -128,6 +167,20 @@ namespace AZ
             //! The merged library can be used to write out the serialized data.
             Ptr<PipelineLibrary> GetMergedLibrary(PipelineLibraryHandle handle) const;
 
+            //! Compiles the pipeline states in jobs and returns without waiting for them. AcquirePipelineState hands out
+            //! a prewarmed pipeline state the first time a descriptor with the same hash is requested, instead of
+            //! compiling it. A request that comes in while the same pipeline state is still being prewarmed compiles
+            //! it again. Prewarming stops when the library is reset or released. Without a global job context, the
+            //! pipeline states are compiled before returning.
+            void PrewarmLibrary(PipelineLibraryHandle handle, AZStd::vector<PrewarmDescriptor>&& prewarmDescriptors);
+
+            //! Visits the pipeline states acquired through the library, followed by the prewarmed ones that were not
+            //! acquired. Like GetMergedLibrary, this is designed to happen once when the library is released, so that
+            //! the caller can record what to prewarm in the next session.
+            void ForEachPipelineState(PipelineLibraryHandle handle, const PipelineStateVisitor& visitor) const;
+
+            PrewarmStatistics GetPrewarmStatistics() const;
+
             //! Acquires a pipeline state (either draw or dispatch variants) from the cache. Pipeline states are associated
             //! to a specific library handle. Successive calls with the same pipeline state descriptor hash will return the same
             //! pipeline state, even across threads. If the library handle is invalid or the acquire operation fails, a null pointer
@@ -163,9 +216,6 @@ namespace AZ
 
                 PipelineStateHash m_hash;
                 ConstPtr<PipelineState> m_pipelineState;
-
-                // pipeline state descriptor variant for dispatch, draw, and ray tracing
-                using PipelineStateDescriptorVariant = AZStd::variant<AZ::RHI::PipelineStateDescriptorForDraw, AZ::RHI::PipelineStateDescriptorForDispatch, AZ::RHI::PipelineStateDescriptorForRayTracing>;
                 PipelineStateDescriptorVariant m_pipelineStateDescriptorVariant;
             };
 
@@ -180,6 +230,16 @@ namespace AZ
             // The pipeline state set is an unordered set to help with detecting hash collisions and also faster find and store operations.
             using PipelineStateSet = AZStd::unordered_set<PipelineStateEntry, PipelineStateCacheHash>;
 
+            struct PrewarmedEntry
+            {
+                PipelineStateEntry m_entry;
+                uint32_t m_unusedSessionCount = 0;
+            };
+
+            // Prewarmed pipeline states are matched by hash alone, since descriptor equality compares the
+            // shader function and layout pointers, which differ between the recorded and the requested descriptors.
+            using PrewarmedPipelineStateMap = AZStd::unordered_map<uint64_t, PrewarmedEntry>;
+
             struct GlobalLibraryEntry
             {
                 // The global, read-only pipeline state set.
@@ -192,6 +252,12 @@ namespace AZ
                 // Tracks the number of pipeline states actively being compiled across all threads.
                 AZStd::atomic_uint32_t m_pendingCompileCount = {0};
 
+                // Pipeline states compiled by PrewarmLibrary that were not acquired yet. Guarded by m_pendingCacheMutex.
+                PrewarmedPipelineStateMap m_prewarmedPipelineStates;
+
+                // Incremented when the library is reset or released, which cancels the prewarm jobs started before.
+                uint32_t m_generation = 0;
+
                 // Contains the initial serialized data (Used to prime the thread libraries)
                 // or the file name that contains the serialized data
                 PipelineLibraryDescriptor m_pipelineLibraryDescriptor;
@@ -229,6 +295,16 @@ namespace AZ
                 const PipelineStateDescriptor& pipelineStateDescriptor,
                 PipelineStateHash pipelineStateHash);
 
+            //! Lazily initializes the pipeline library of the calling thread.
+            void InitThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry);
+
+            //! Compiles the pipeline state with the thread library, if it was initialized successfully.
+            ResultCode InitPipelineState(
+                PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, const ThreadLibraryEntry& threadLibraryEntry);
+
+            //! Compiles pipeline states for PrewarmLibrary, unless the library was reset or released since.
+            void PrewarmPipelineStates(PipelineLibraryHandle handle, uint32_t generation, AZStd::span<const PrewarmDescriptor> prewarmDescriptors);
+
             //! Resets the library without validating the handle or taking a lock.
             void ResetLibraryImpl(PipelineLibraryHandle handle);
 
@@ -251,6 +327,10 @@ namespace AZ
             /// to recycle slots in m_globalLibrarySet.
             AZStd::fixed_vector<PipelineLibraryHandle, LibraryCountMax> m_libraryFreeList;
 
+            AZStd::atomic_uint32_t m_prewarmedCount = {0};
+            AZStd::atomic_uint32_t m_warmHitCount = {0};
+            AZStd::atomic_uint32_t m_coldCompileCount = {0};
+
             // Friends
             friend class UnitTest::PipelineStateTests;
         };
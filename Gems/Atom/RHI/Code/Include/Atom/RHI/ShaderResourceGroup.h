@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/Interval.h>
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
 
@@ -69,6 +70,25 @@ namespace AZ
             //! be compiled for another m_updateMaskResetLatency number of Compile calls
             void ResetResourceTypeIteration(const ShaderResourceGroupData::ResourceType resourceType);
 
+            //! Enables compilation of every resource type and every shader input, so the next compiles rebuild the whole group.
+            void EnableRhiCompilationForAllResourceTypes();
+
+            //! Enables compilation of a single buffer or image input for the next m_updateMaskResetLatency + 1 compiles,
+            //! along with its resource type. Used when the views of an input are invalidated.
+            void EnableRhiBufferInputCompilation(ShaderInputBufferIndex inputIndex);
+            void EnableRhiImageInputCompilation(ShaderInputImageIndex inputIndex);
+
+            //! Returns true if the shader input has to be written by the current compile. Inputs stay enabled for as many
+            //! compiles as their resource type after they change, so every buffered copy of the group receives the update.
+            //! Only meaningful while the resource type of the input is enabled for compilation.
+            bool IsConstantInputEnabledForCompilation(ShaderInputConstantIndex inputIndex) const;
+            bool IsBufferInputEnabledForCompilation(ShaderInputBufferIndex inputIndex) const;
+            bool IsImageInputEnabledForCompilation(ShaderInputImageIndex inputIndex) const;
+
+            //! Returns the byte intervals of the constant data that the current compile has to upload.
+            //! Neighboring inputs are merged into a single interval. Empty if constants are not enabled for compilation.
+            AZStd::span<const Interval> GetConstantIntervalsToCompile() const;
+
             //! Return the view hash stored within m_viewHash
             HashValue64 GetViewHash(const AZ::Name& viewName);
 
@@ -81,6 +101,12 @@ namespace AZ
         private:
             void SetData(const ShaderResourceGroupData& data);
 
+            // Enables compilation of the shader inputs flagged as updated in the data.
+            void UpdateShaderInputCompilation(const ShaderResourceGroupData& data);
+
+            // Builds m_constantIntervalsToCompile from the constant inputs enabled for compilation.
+            void UpdateConstantIntervalsToCompile();
+
             ShaderResourceGroupData m_data;
 
             // The binding slot cached from the layout.
@@ -96,6 +122,15 @@ namespace AZ
             uint32_t m_resourceTypeIteration[static_cast<uint32_t>(ShaderResourceGroupData::ResourceType::Count)] = { 0 };
             uint32_t m_updateMaskResetLatency = RHI::Limits::Device::FrameCountMax - 1; //we do -1 because we update after compile
 
+            // Number of compiles left for which each constant, buffer and image input has to be written, indexed by shader input.
+            // A freshly initialized group starts with every input enabled so all of its copies are fully written once.
+            AZStd::vector<uint8_t> m_constantInputCompileCount;
+            AZStd::vector<uint8_t> m_bufferInputCompileCount;
+            AZStd::vector<uint8_t> m_imageInputCompileCount;
+
+            // Byte intervals of the constant data written by the current compile.
+            AZStd::vector<Interval> m_constantIntervalsToCompile;
+
             // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
             AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
         };
@@ -213,12 +213,30 @@ namespace AZ
 
             //! Returns the mask that is suppose to indicate which resource type was updated
             uint32_t GetUpdateMask() const;
-            
+
+            //! Returns whether the constant input was assigned since the update mask was last reset.
+            //! The RHI uses this to only upload the constant ranges that changed.
+            bool IsConstantInputUpdated(ShaderInputConstantIndex inputIndex) const;
+
+            //! Returns whether views were assigned to the buffer input since the update mask was last reset.
+            bool IsBufferInputUpdated(ShaderInputBufferIndex inputIndex) const;
+
+            //! Returns whether views were assigned to the image input since the update mask was last reset.
+            bool IsImageInputUpdated(ShaderInputImageIndex inputIndex) const;
+
         private:
             static const ConstPtr<ImageView> s_nullImageView;
             static const ConstPtr<BufferView> s_nullBufferView;
             static const SamplerState s_nullSamplerState;
 
+            //! Flags a single shader input as updated, along with its resource type.
+            void EnableConstantInputCompilation(ShaderInputConstantIndex inputIndex);
+            void EnableBufferInputCompilation(ShaderInputBufferIndex inputIndex);
+            void EnableImageInputCompilation(ShaderInputImageIndex inputIndex);
+
+            //! Flags every constant input overlapping the byte range [byteOffset, byteOffset + byteCount) as updated.
+            void EnableConstantRangeCompilation(uint32_t byteOffset, uint32_t byteCount);
+
             bool ValidateSetImageView(ShaderInputImageIndex inputIndex, const ImageView* imageView, uint32_t arrayIndex) const;
             bool ValidateSetBufferView(ShaderInputBufferIndex inputIndex, const BufferView* bufferView, uint32_t arrayIndex) const;
 
@@ -241,26 +259,32 @@ namespace AZ
 
             //! Mask used to check whether to compile a specific resource type. This mask is managed by RPI and copied over to the RHI every frame. 
             uint32_t m_updateMask = 0;
+
+            //! Bit masks of the shader inputs that were assigned since the update mask was last reset, one bit per input index.
+            //! They refine m_updateMask so the RHI can re-upload only the constant ranges and descriptors that changed.
+            AZStd::vector<uint64_t> m_constantInputUpdateMask;
+            AZStd::vector<uint64_t> m_bufferInputUpdateMask;
+            AZStd::vector<uint64_t> m_imageInputUpdateMask;
         };
 
         template <typename T>
         bool ShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            EnableConstantInputCompilation(inputIndex);
             return m_constantsData.SetConstant(inputIndex, value);
         }
 
         template <typename T>
         bool ShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value, uint32_t arrayIndex)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            EnableConstantInputCompilation(inputIndex);
             return m_constantsData.SetConstant(inputIndex, value, arrayIndex);
         }
 
         template<typename T>
         bool ShaderResourceGroupData::SetConstantMatrixRows(ShaderInputConstantIndex inputIndex, const T& value, uint32_t rowCount)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            EnableConstantInputCompilation(inputIndex);
             return m_constantsData.SetConstantMatrixRows(inputIndex, value, rowCount);
         }
 
@@ -269,7 +293,7 @@ namespace AZ
         {
             if (!values.empty())
             {
-                EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+                EnableConstantInputCompilation(inputIndex);
             }
             return m_constantsData.SetConstantArray(inputIndex, values);
         }
@@ -7,12 +7,110 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/utils.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Below this many items the comparison sort is faster than the fixed cost of the radix passes.
+            constexpr size_t RadixSortMinItemCount = 256;
+
+            constexpr uint32_t RadixDigitBits = 8;
+            constexpr uint32_t RadixBucketCount = 1 << RadixDigitBits;
+            constexpr uint32_t DepthDigitCount = sizeof(uint32_t) * 8 / RadixDigitBits;
+            constexpr uint32_t SortKeyDigitCount = sizeof(uint64_t) * 8 / RadixDigitBits;
+            constexpr uint32_t RadixDigitCount = DepthDigitCount + SortKeyDigitCount;
+
+            // Maps the sort key to an unsigned value with the same ordering.
+            uint64_t GetSortKeyBits(DrawItemSortKey sortKey)
+            {
+                return static_cast<uint64_t>(sortKey) ^ (uint64_t{ 1 } << 63);
+            }
+
+            // Maps the depth to an unsigned value with the same ordering. Negative values have all their bits flipped so larger
+            // magnitudes sort first, positive values only get the sign bit set so they sort after all negative values.
+            uint32_t GetDepthBits(float depth)
+            {
+                uint32_t bits = 0;
+                // Treat -0 and +0 the same, as the comparison sort does.
+                if (depth != 0.0f)
+                {
+                    memcpy(&bits, &depth, sizeof(bits));
+                }
+                return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            }
+
+            // Returns the value of the digit with the given index of the packed (sort key, depth) key of the item, where digit 0 is the
+            // least significant digit of the depth and the sort key holds the most significant digits.
+            template<bool ReverseDepth>
+            uint32_t GetRadixDigit(const DrawItemProperties& item, uint32_t digitIndex)
+            {
+                if (digitIndex < DepthDigitCount)
+                {
+                    const uint32_t depthBits = ReverseDepth ? ~GetDepthBits(item.m_depth) : GetDepthBits(item.m_depth);
+                    return (depthBits >> (digitIndex * RadixDigitBits)) & (RadixBucketCount - 1);
+                }
+                const uint32_t shift = (digitIndex - DepthDigitCount) * RadixDigitBits;
+                return static_cast<uint32_t>(GetSortKeyBits(item.m_sortKey) >> shift) & (RadixBucketCount - 1);
+            }
+
+            // Stable LSD radix sort by sort key, then depth. This gives the same order as the comparison sort for KeyThenDepth and
+            // KeyThenReverseDepth, except that items with equal keys keep their relative order.
+            template<bool ReverseDepth>
+            void RadixSortKeyThenDepth(DrawList& drawList)
+            {
+                using Histogram = AZStd::array<uint32_t, RadixBucketCount>;
+                AZStd::array<Histogram, RadixDigitCount> histograms{};
+
+                // All histograms are built in a single pass over the items.
+                for (const DrawItemProperties& item : drawList)
+                {
+                    for (uint32_t digitIndex = 0; digitIndex < RadixDigitCount; ++digitIndex)
+                    {
+                        ++histograms[digitIndex][GetRadixDigit<ReverseDepth>(item, digitIndex)];
+                    }
+                }
+
+                const uint32_t itemCount = static_cast<uint32_t>(drawList.size());
+                DrawList scratch(drawList.size());
+                DrawList* source = &drawList;
+                DrawList* destination = &scratch;
+                for (uint32_t digitIndex = 0; digitIndex < RadixDigitCount; ++digitIndex)
+                {
+                    Histogram& histogram = histograms[digitIndex];
+
+                    // Skip the pass if all items have the same value for this digit, which is common for the high bits of both the
+                    // sort key and the depth.
+                    if (histogram[GetRadixDigit<ReverseDepth>(drawList.front(), digitIndex)] == itemCount)
+                    {
+                        continue;
+                    }
+
+                    uint32_t offset = 0;
+                    for (uint32_t& bucket : histogram)
+                    {
+                        offset += AZStd::exchange(bucket, offset);
+                    }
+
+                    for (const DrawItemProperties& item : *source)
+                    {
+                        (*destination)[histogram[GetRadixDigit<ReverseDepth>(item, digitIndex)]++] = item;
+                    }
+                    AZStd::swap(source, destination);
+                }
+
+                if (source != &drawList)
+                {
+                    drawList.swap(scratch);
+                }
+            }
+        } // namespace
+
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
         {
             if (drawList.empty())
@@ -28,6 +126,21 @@ namespace AZ
 
         void SortDrawList(DrawList& drawList, DrawListSortType sortType)
         {
+            if (drawList.size() >= RadixSortMinItemCount)
+            {
+                switch (sortType)
+                {
+                case DrawListSortType::KeyThenDepth:
+                    RadixSortKeyThenDepth<false>(drawList);
+                    return;
+                case DrawListSortType::KeyThenReverseDepth:
+                    RadixSortKeyThenDepth<true>(drawList);
+                    return;
+                default:
+                    break;
+                }
+            }
+
             switch (sortType)
             {
             case DrawListSortType::KeyThenDepth:
@@ -8,6 +8,7 @@
 #include <Atom/RHI/DrawListContext.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -88,11 +89,26 @@ namespace AZ
         void DrawListContext::FinalizeLists()
         {
             AZ_PROFILE_SCOPE(RHI, "DrawListContext: FinalizeLists");
+
+            // Reserve the merged lists up front, so large lists aren't reallocated once for every thread that contributed to them.
+            AZStd::array<size_t, RHI::Limits::Pipeline::DrawListTagCountMax> itemCounts{};
+            m_threadListsByTag.ForEach([this, &itemCounts](DrawListsByTag& drawListsByTag)
+            {
+                for (size_t i = 0; i < drawListsByTag.size(); ++i)
+                {
+                    if (m_drawListMask[i])
+                    {
+                        itemCounts[i] += drawListsByTag[i].size();
+                    }
+                }
+            });
+
             for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
             {
                 if (m_drawListMask[i])
                 {
                     m_mergedListsByTag[i].clear();
+                    m_mergedListsByTag[i].reserve(itemCounts[i]);
                 }
             }
 
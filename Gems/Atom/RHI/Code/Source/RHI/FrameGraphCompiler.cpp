@@ -17,14 +17,70 @@
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/hash.h>
 #include <AzCore/std/sort.h>
-#include <AzCore/std/optional.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(bool, r_FrameGraphCompileCache, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Reuse the previous frame's graph compile results when the frame graph topology is unchanged.");
+
+        namespace
+        {
+            /**
+             * Builds a sortable key for the transient attachment pool. It iterates each scope and performs deactivations
+             * followed by activations on each attachment.
+             */
+            const uint32_t ATTACHMENT_BIT_COUNT = 16;
+            const uint32_t SCOPE_BIT_COUNT = 14;
+
+            enum class Action
+            {
+                ActivateImage = 0,
+                ActivateBuffer,
+                DeactivateImage,
+                DeactivateBuffer,
+            };
+
+            struct Command
+            {
+                Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
+                {
+                    m_bits.m_scopeIndex = scopeIndex;
+                    m_bits.m_action = (uint32_t)action;
+                    m_bits.m_attachmentIndex = attachmentIndex;
+                }
+
+                explicit Command(uint32_t command)
+                    : m_command(command)
+                {
+                }
+
+                struct Bits
+                {
+                    /// Sort by attachment index last
+                    uint32_t m_attachmentIndex : ATTACHMENT_BIT_COUNT;
+
+                    /// Sort by the action after the scope. First by deactivations, then by activations.
+                    uint32_t m_action : 2;
+
+                    /// Sort by scope index first.
+                    uint32_t m_scopeIndex : SCOPE_BIT_COUNT;
+                };
+
+                union
+                {
+                    Bits m_bits;
+
+                    uint32_t m_command = 0;
+                };
+            };
+        }
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -60,6 +116,7 @@ namespace AZ
             {
                 m_imageViewCache.Clear();
                 m_bufferViewCache.Clear();
+                ResetTopologyCache();
 
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -92,9 +149,85 @@ namespace AZ
             return AZ::Success();
         }
 
+        bool FrameGraphCompiler::IsTopologyUnchanged() const
+        {
+            return m_isTopologyUnchanged;
+        }
+
+        size_t FrameGraphCompiler::CalculateTopologyHash(const FrameGraphCompileRequest& request) const
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CalculateTopologyHash");
+
+            const FrameGraph& frameGraph = *request.m_frameGraph;
+
+            size_t seed = 0;
+            AZStd::hash_combine(seed, static_cast<uint32_t>(request.m_compileFlags));
+            AZStd::hash_combine(seed, reinterpret_cast<uintptr_t>(request.m_transientAttachmentPool));
+
+            for (const Scope* scope : frameGraph.GetScopes())
+            {
+                AZStd::hash_combine(seed, scope->GetId().GetHash());
+                AZStd::hash_combine(seed, static_cast<uint32_t>(scope->GetHardwareQueueClass()));
+
+                // Edges from attachments and explicit dependencies both drive the queue-centric graph.
+                AZStd::hash_combine(seed, frameGraph.GetConsumers(*scope).size());
+                for (const Scope* consumer : frameGraph.GetConsumers(*scope))
+                {
+                    AZStd::hash_combine(seed, consumer->GetIndex());
+                }
+
+                for (const ScopeAttachment* scopeAttachment : scope->GetAttachments())
+                {
+                    const FrameAttachment& frameAttachment = scopeAttachment->GetFrameAttachment();
+                    AZStd::hash_combine(seed, frameAttachment.GetId().GetHash());
+                    AZStd::hash_combine(seed, static_cast<uint32_t>(frameAttachment.GetLifetimeType()));
+
+                    for (const ScopeAttachmentUsageAndAccess& usageAndAccess : scopeAttachment->GetUsageAndAccess())
+                    {
+                        AZStd::hash_combine(seed, static_cast<uint32_t>(usageAndAccess.m_usage));
+                        AZStd::hash_combine(seed, static_cast<uint32_t>(usageAndAccess.m_access));
+                    }
+                }
+            }
+
+            // The transient pool commands index into these lists, so their order is part of the topology.
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            for (const ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                AZStd::hash_combine(seed, transientImage->GetId().GetHash());
+                AZStd::hash_combine(seed, static_cast<uint64_t>(transientImage->GetImageDescriptor().GetHash()));
+                AZStd::hash_combine(seed, static_cast<uint32_t>(transientImage->GetSupportedQueueMask()));
+            }
+
+            for (const BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                AZStd::hash_combine(seed, transientBuffer->GetId().GetHash());
+                AZStd::hash_combine(seed, static_cast<uint64_t>(transientBuffer->GetBufferDescriptor().GetHash()));
+            }
+
+            return seed;
+        }
+
+        void FrameGraphCompiler::ResetTopologyCache()
+        {
+            m_topologyHash = 0;
+            m_hasCachedTopology = false;
+            m_isTopologyUnchanged = false;
+            m_queueLinks.clear();
+            m_transientImageLifetimes.clear();
+            m_transientBufferLifetimes.clear();
+            m_transientCommands.clear();
+            m_transientMemoryHint.reset();
+        }
+
         /**
          * The entry point for FrameGraph compilation. Frame Graph compilation is broken into several phases:
          * 
+         *      0) Topology Hash:
+         *
+         *          The topology of the graph is hashed and compared against the previous frame. If it matches, the phases
+         *          below reuse their cached results and only patch the per-frame data (scope links, resources and views).
+         *
          *      1) Queue-Centric Scope Graph Compilation:
          *
          *          This phase takes the scope graph and compiles a queue-centric scope graph. The former is a simple
@@ -129,6 +262,12 @@ namespace AZ
 
             FrameGraph& frameGraph = *request.m_frameGraph;
 
+            /// [Phase 0] Detects whether the cached compile results of the previous frame can be reused.
+            const size_t topologyHash = CalculateTopologyHash(request);
+            m_isTopologyUnchanged = r_FrameGraphCompileCache && m_hasCachedTopology && topologyHash == m_topologyHash;
+            m_topologyHash = topologyHash;
+            m_hasCachedTopology = true;
+
             /// [Phase 1] Compiles the cross-queue scope graph.
             CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
 
@@ -171,6 +310,24 @@ namespace AZ
                 }
             }
 
+            /// The links only depend on the topology, so replay them onto this frame's scopes.
+            if (m_isTopologyUnchanged)
+            {
+                const auto& scopes = frameGraph.GetScopes();
+                for (const QueueLink& queueLink : m_queueLinks)
+                {
+                    Scope::LinkProducerConsumerByQueues(scopes[queueLink.m_producerScopeIndex], scopes[queueLink.m_consumerScopeIndex]);
+                }
+                return;
+            }
+
+            m_queueLinks.clear();
+            auto linkProducerConsumer = [this](Scope* producer, Scope* consumer)
+            {
+                Scope::LinkProducerConsumerByQueues(producer, consumer);
+                m_queueLinks.push_back({ producer->GetIndex(), consumer->GetIndex() });
+            };
+
             /**
              * Build the per-queue graph by first linking scopes on the same queue
              * with their neighbors. This is because the queue is going to execute serially.
@@ -182,7 +339,7 @@ namespace AZ
                     const uint32_t hardwareQueueClassIdx = static_cast<uint32_t>(consumer->GetHardwareQueueClass());
                     if (producer[hardwareQueueClassIdx])
                     {
-                        Scope::LinkProducerConsumerByQueues(producer[hardwareQueueClassIdx], consumer);
+                        linkProducerConsumer(producer[hardwareQueueClassIdx], consumer);
                     }
                     producer[hardwareQueueClassIdx] = consumer;
                 }
@@ -235,7 +392,7 @@ namespace AZ
 
                         if (foundEarlierConsumerOnSameQueue == false)
                         {
-                            Scope::LinkProducerConsumerByQueues(producerScopeLast, currentScope);
+                            linkProducerConsumer(producerScopeLast, currentScope);
                         }
                     }
                 }
@@ -480,115 +637,82 @@ namespace AZ
 
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-
-            /**
-             * Builds a sortable key. It iterates each scope and performs deactivations
-             * followed by activations on each attachment.
-             */
-            const uint32_t ATTACHMENT_BIT_COUNT = 16;
-            const uint32_t SCOPE_BIT_COUNT = 14;
-
-            enum class Action
-            {
-                ActivateImage = 0,
-                ActivateBuffer,
-                DeactivateImage,
-                DeactivateBuffer,
-            };
+            const auto& scopes = frameGraph.GetScopes();
+            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
+            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
 
-            struct Command
+            if (m_isTopologyUnchanged)
             {
-                Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
+                // Restore the lifetimes computed by the async queue extension. The sorted commands are reused as is.
+                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
                 {
-                    m_bits.m_scopeIndex = scopeIndex;
-                    m_bits.m_action = (uint32_t)action;
-                    m_bits.m_attachmentIndex = attachmentIndex;
+                    const AttachmentLifetime& lifetime = m_transientBufferLifetimes[attachmentIndex];
+                    transientBufferGraphAttachments[attachmentIndex]->m_firstScope = scopes[lifetime.m_firstScopeIndex];
+                    transientBufferGraphAttachments[attachmentIndex]->m_lastScope = scopes[lifetime.m_lastScopeIndex];
                 }
 
-                bool operator < (Command rhs) const
+                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
                 {
-                    return m_command < rhs.m_command;
+                    const AttachmentLifetime& lifetime = m_transientImageLifetimes[attachmentIndex];
+                    transientImageGraphAttachments[attachmentIndex]->m_firstScope = scopes[lifetime.m_firstScopeIndex];
+                    transientImageGraphAttachments[attachmentIndex]->m_lastScope = scopes[lifetime.m_lastScopeIndex];
                 }
+            }
+            else
+            {
+                ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
 
-                struct Bits
-                {
-                    /// Sort by attachment index last
-                    uint32_t m_attachmentIndex : ATTACHMENT_BIT_COUNT;
-
-                    /// Sort by the action after the scope. First by deactivations, then by activations.
-                    uint32_t m_action : 2;
+                AZ_Assert(scopes.size() < AZ_BIT(SCOPE_BIT_COUNT),
+                    "Exceeded maximum number of allowed scopes");
 
-                    /// Sort by scope index first.
-                    uint32_t m_scopeIndex : SCOPE_BIT_COUNT;
-                };
+                AZ_Assert(transientBufferGraphAttachments.size() + transientImageGraphAttachments.size() < AZ_BIT(ATTACHMENT_BIT_COUNT),
+                    "Exceeded maximum number of allowed attachments");
 
-                union
+                m_transientBufferLifetimes.clear();
+                for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
                 {
-                    Bits m_bits;
-
-                    uint32_t m_command = 0;
-                };
-            };
-
-            const auto& scopes = frameGraph.GetScopes();
-            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
-            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
+                    m_transientBufferLifetimes.push_back({ transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex() });
+                }
 
-            AZ_Assert(scopes.size() < AZ_BIT(SCOPE_BIT_COUNT),
-                "Exceeded maximum number of allowed scopes");
+                m_transientImageLifetimes.clear();
+                for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
+                {
+                    m_transientImageLifetimes.push_back({ transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex() });
+                }
 
-            AZ_Assert(transientBufferGraphAttachments.size() + transientImageGraphAttachments.size() < AZ_BIT(ATTACHMENT_BIT_COUNT),
-                "Exceeded maximum number of allowed attachments");            
+                AZStd::vector<uint32_t>& commands = m_transientCommands;
+                commands.clear();
+                commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-            AZStd::vector<Buffer*> transientBuffers(transientBufferGraphAttachments.size());
-            AZStd::vector<Image*> transientImages(transientImageGraphAttachments.size());
-            AZStd::vector<Command> commands;
-            commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
-
-            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
-            {
+                const bool disableAttachmentAliasing = CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing);
                 const uint32_t ScopeIndexFirst = 0;
                 const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
 
                 // Generate commands for each transient buffer: one for activation, and one for deactivation.
                 for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    const AttachmentLifetime& lifetime = m_transientBufferLifetimes[attachmentIndex];
+                    const uint32_t scopeIndexFirst = disableAttachmentAliasing ? ScopeIndexFirst : lifetime.m_firstScopeIndex;
+                    const uint32_t scopeIndexLast = disableAttachmentAliasing ? ScopeIndexLast : lifetime.m_lastScopeIndex;
+                    commands.push_back(Command(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex).m_command);
+                    commands.push_back(Command(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex).m_command);
                 }
 
                 // Generate commands for each transient image: one for activation, and one for deactivation.
                 for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
-                }
-            }
-            else
-            {
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
-                {
-                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    const AttachmentLifetime& lifetime = m_transientImageLifetimes[attachmentIndex];
+                    const uint32_t scopeIndexFirst = disableAttachmentAliasing ? ScopeIndexFirst : lifetime.m_firstScopeIndex;
+                    const uint32_t scopeIndexLast = disableAttachmentAliasing ? ScopeIndexLast : lifetime.m_lastScopeIndex;
+                    commands.push_back(Command(scopeIndexFirst, Action::ActivateImage, attachmentIndex).m_command);
+                    commands.push_back(Command(scopeIndexLast, Action::DeactivateImage, attachmentIndex).m_command);
                 }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
-                {
-                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
-                }
+                AZStd::sort(commands.begin(), commands.end());
             }
 
-            AZStd::sort(commands.begin(), commands.end());
+            AZStd::vector<Buffer*> transientBuffers(transientBufferGraphAttachments.size());
+            AZStd::vector<Image*> transientImages(transientImageGraphAttachments.size());
 
             auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
             {
@@ -598,8 +722,9 @@ namespace AZ
 
                 bool allocateResources = !CheckBitsAny(compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources);
 
-                for (Command command : commands)
+                for (uint32_t rawCommand : m_transientCommands)
                 {
+                    const Command command(rawCommand);
                     const uint32_t scopeIndex = command.m_bits.m_scopeIndex;
                     const uint32_t attachmentIndex = command.m_bits.m_attachmentIndex;
                     const Action action = (Action)command.m_bits.m_action;
@@ -695,13 +820,20 @@ namespace AZ
                 transientAttachmentPool.End();
             };
 
-            AZStd::optional<TransientAttachmentStatistics::MemoryUsage> memoryUsage;
-            // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
+            // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources).
+            // The size only depends on the topology, so an unchanged graph reuses the previous frame's result.
             if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                if (!m_isTopologyUnchanged || !m_transientMemoryHint)
+                {
+                    // First pass to calculate size needed.
+                    processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    m_transientMemoryHint = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                }
+            }
+            else
+            {
+                m_transientMemoryHint.reset();
             }
 
             // Second pass uses the information about memory usage
@@ -710,7 +842,7 @@ namespace AZ
             {
                 poolCompileFlags |= TransientAttachmentPoolCompileFlags::GatherStatistics;
             }
-            processCommands(poolCompileFlags, memoryUsage ? &memoryUsage.value() : nullptr);
+            processCommands(poolCompileFlags, m_transientMemoryHint ? &m_transientMemoryHint.value() : nullptr);
         }
                     
         ImageView* FrameGraphCompiler::GetImageViewFromLocalCache(Image* image, const ImageViewDescriptor& imageViewDescriptor)
@@ -10,13 +10,52 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Number of prewarmed pipeline states compiled by each job.
+            constexpr size_t PrewarmCompilesPerJob = 8;
+
+            const PipelineStateDescriptor& GetDescriptor(const PipelineStateDescriptorForDraw& descriptor)
+            {
+                return descriptor;
+            }
+
+            const PipelineStateDescriptor& GetDescriptor(const PipelineStateDescriptorForDispatch& descriptor)
+            {
+                return descriptor;
+            }
+
+            const PipelineStateDescriptor& GetDescriptor(const PipelineStateDescriptorForRayTracing& descriptor)
+            {
+                return descriptor;
+            }
+
+            template<typename DescriptorVariant>
+            const PipelineStateDescriptor& GetDescriptor(const DescriptorVariant& descriptorVariant)
+            {
+                return AZStd::visit([](const auto& descriptor) -> const PipelineStateDescriptor&
+                {
+                    return GetDescriptor(descriptor);
+                }, descriptorVariant);
+            }
+        }
+
+        float PipelineStateCache::PrewarmStatistics::GetWarmHitRate() const
+        {
+            const uint32_t requestCount = m_warmHitCount + m_coldCompileCount;
+            return requestCount > 0 ? static_cast<float>(m_warmHitCount) / static_cast<float>(requestCount) : 0.0f;
+        }
+
         Ptr<PipelineStateCache> PipelineStateCache::Create(Device& device)
         {
             return aznew PipelineStateCache(device);
@@ -160,7 +199,11 @@ namespace AZ
             libraryEntry.m_readOnlyCache.clear();
             libraryEntry.m_pendingCacheMutex.lock();
             libraryEntry.m_pendingCache.clear();
+            libraryEntry.m_prewarmedPipelineStates.clear();
             libraryEntry.m_pendingCacheMutex.unlock();
+
+            // Prewarm jobs that haven't run yet would compile pipeline states for the previous contents of the library.
+            ++libraryEntry.m_generation;
         }
 
         Ptr<PipelineLibrary> PipelineStateCache::GetMergedLibrary(PipelineLibraryHandle handle) const
@@ -215,6 +258,135 @@ namespace AZ
             return nullptr;
         }
 
+        void PipelineStateCache::PrewarmLibrary(PipelineLibraryHandle handle, AZStd::vector<PrewarmDescriptor>&& prewarmDescriptors)
+        {
+            if (handle.IsNull() || prewarmDescriptors.empty())
+            {
+                return;
+            }
+
+            uint32_t generation = 0;
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+                generation = m_globalLibrarySet[handle.GetIndex()].m_generation;
+            }
+
+            if (!AZ::JobContext::GetGlobalContext())
+            {
+                PrewarmPipelineStates(handle, generation, prewarmDescriptors);
+                return;
+            }
+
+            // The jobs share the descriptors and keep the cache alive until they are done. They don't hold the
+            // cache lock while they are queued, so library creation and release aren't blocked behind them.
+            auto sharedDescriptors = AZStd::make_shared<AZStd::vector<PrewarmDescriptor>>(AZStd::move(prewarmDescriptors));
+            Ptr<PipelineStateCache> pipelineStateCache = this;
+            for (size_t beginIndex = 0; beginIndex < sharedDescriptors->size(); beginIndex += PrewarmCompilesPerJob)
+            {
+                const size_t count = AZStd::min(PrewarmCompilesPerJob, sharedDescriptors->size() - beginIndex);
+                AZ::Job* job = AZ::CreateJobFunction([pipelineStateCache, handle, generation, sharedDescriptors, beginIndex, count]()
+                {
+                    pipelineStateCache->PrewarmPipelineStates(
+                        handle, generation, AZStd::span<const PrewarmDescriptor>(sharedDescriptors->data() + beginIndex, count));
+                }, true, nullptr);
+                job->Start();
+            }
+        }
+
+        void PipelineStateCache::PrewarmPipelineStates(
+            PipelineLibraryHandle handle, uint32_t generation, AZStd::span<const PrewarmDescriptor> prewarmDescriptors)
+        {
+            AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: PrewarmPipelineStates");
+
+            // Holding the shared lock while compiling keeps the library from being reset or released underneath,
+            // the same way AcquirePipelineState does.
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+            if (!m_globalLibraryActiveBits[handle.GetIndex()] || globalLibraryEntry.m_generation != generation)
+            {
+                return;
+            }
+
+            // Each compilation uses the pipeline library of the thread it runs on, the same way AcquirePipelineState does.
+            ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+            InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
+
+            for (const PrewarmDescriptor& prewarmDescriptor : prewarmDescriptors)
+            {
+                const PipelineStateDescriptor& descriptor = GetDescriptor(prewarmDescriptor.m_descriptor);
+                const PipelineStateHash pipelineStateHash = descriptor.GetHash();
+
+                // Skip pipeline states that were acquired or prewarmed already.
+                if (FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
+                {
+                    continue;
+                }
+                {
+                    AZStd::lock_guard<AZStd::mutex> pendingCacheLock(globalLibraryEntry.m_pendingCacheMutex);
+                    if (FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor) ||
+                        globalLibraryEntry.m_prewarmedPipelineStates.count(static_cast<uint64_t>(pipelineStateHash)))
+                    {
+                        continue;
+                    }
+                }
+
+                Ptr<PipelineState> pipelineState = Factory::Get().CreatePipelineState();
+                if (InitPipelineState(*pipelineState, descriptor, threadLibraryEntry) != ResultCode::Success)
+                {
+                    // Pipeline states that failed to compile are left to AcquirePipelineState, which reports the error.
+                    continue;
+                }
+
+                AZStd::lock_guard<AZStd::mutex> pendingCacheLock(globalLibraryEntry.m_pendingCacheMutex);
+                if (!FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor))
+                {
+                    const bool isInserted = globalLibraryEntry.m_prewarmedPipelineStates.emplace(
+                        static_cast<uint64_t>(pipelineStateHash),
+                        PrewarmedEntry{ PipelineStateEntry(pipelineStateHash, pipelineState, descriptor), prewarmDescriptor.m_unusedSessionCount }).second;
+                    if (isInserted)
+                    {
+                        ++m_prewarmedCount;
+                    }
+                }
+            }
+        }
+
+        void PipelineStateCache::ForEachPipelineState(PipelineLibraryHandle handle, const PipelineStateVisitor& visitor) const
+        {
+            if (handle.IsNull())
+            {
+                return;
+            }
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
+
+            for (const PipelineStateSet* pipelineStateSet : { &entry.m_readOnlyCache, &entry.m_pendingCache })
+            {
+                for (const PipelineStateEntry& pipelineStateEntry : *pipelineStateSet)
+                {
+                    visitor(GetDescriptor(pipelineStateEntry.m_pipelineStateDescriptorVariant), 0);
+                }
+            }
+
+            // The prewarmed pipeline states that are left were not acquired in this session either.
+            for (const auto& prewarmedPair : entry.m_prewarmedPipelineStates)
+            {
+                const PrewarmedEntry& prewarmedEntry = prewarmedPair.second;
+                visitor(GetDescriptor(prewarmedEntry.m_entry.m_pipelineStateDescriptorVariant), prewarmedEntry.m_unusedSessionCount + 1);
+            }
+        }
+
+        PipelineStateCache::PrewarmStatistics PipelineStateCache::GetPrewarmStatistics() const
+        {
+            PrewarmStatistics statistics;
+            statistics.m_prewarmedCount = m_prewarmedCount;
+            statistics.m_warmHitCount = m_warmHitCount;
+            statistics.m_coldCompileCount = m_coldCompileCount;
+            return statistics;
+        }
+
         void PipelineStateCache::Compact()
         {
             AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: Compact");
@@ -313,20 +485,7 @@ namespace AZ
                 // No entry in the thread-local set. Request a pipeline state from the pending cache and add
                 // it to the thread-local cache to reduce contention on the pending cache.
                 {
-                    // Lazy-init the library on first access.
-                    if (!threadLibraryEntry.m_library)
-                    {
-                        Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
-                        RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_pipelineLibraryDescriptor);
-                        if (resultCode != RHI::ResultCode::Success)
-                        {
-                            AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
-                        }
-
-                        // We store a valid pointer even if initialization failed, to avoid attempting
-                        // to re-create it with every access.
-                        threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
-                    }
+                    InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
 
                     ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash);
 
@@ -338,6 +497,51 @@ namespace AZ
             }
         }
 
+        void PipelineStateCache::InitThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry)
+        {
+            // Lazy-init the library on first access.
+            if (!threadLibraryEntry.m_library)
+            {
+                Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
+                RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_pipelineLibraryDescriptor);
+                if (resultCode != RHI::ResultCode::Success)
+                {
+                    AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+                }
+
+                // We store a valid pointer even if initialization failed, to avoid attempting
+                // to re-create it with every access.
+                threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+            }
+        }
+
+        ResultCode PipelineStateCache::InitPipelineState(
+            PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, const ThreadLibraryEntry& threadLibraryEntry)
+        {
+            // If the pipeline library failed to initialize, then we don't use it.
+            PipelineLibrary* pipelineLibrary = threadLibraryEntry.m_library.get();
+            if (!pipelineLibrary->IsInitialized())
+            {
+                pipelineLibrary = nullptr;
+            }
+
+            switch (descriptor.GetType())
+            {
+            case PipelineStateType::Draw:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
+
+            case PipelineStateType::Dispatch:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
+
+            case PipelineStateType::RayTracing:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
+
+            default:
+                AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
+                return ResultCode::InvalidArgument;
+            }
+        }
+
         ConstPtr<PipelineState> PipelineStateCache::CompilePipelineState(
             GlobalLibraryEntry& globalLibraryEntry,
             ThreadLibraryEntry& threadLibraryEntry,
@@ -357,6 +561,19 @@ namespace AZ
                     return pipeline;
                 }
 
+                // A previous session recorded this descriptor and PrewarmLibrary already compiled it.
+                auto prewarmedIt = globalLibraryEntry.m_prewarmedPipelineStates.find(static_cast<uint64_t>(pipelineStateHash));
+                if (prewarmedIt != globalLibraryEntry.m_prewarmedPipelineStates.end())
+                {
+                    ConstPtr<PipelineState> prewarmedPipelineState = AZStd::move(prewarmedIt->second.m_entry.m_pipelineState);
+                    globalLibraryEntry.m_prewarmedPipelineStates.erase(prewarmedIt);
+
+                    [[maybe_unused]] bool success = InsertPipelineState(pendingCache, PipelineStateEntry(pipelineStateHash, prewarmedPipelineState, descriptor));
+                    AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
+                    ++m_warmHitCount;
+                    return prewarmedPipelineState;
+                }
+
                 // We need to create and insert the pipeline state into the locked cache. Create the pipeline state
                 // but don't initialize it yet. We can safely allocate the 'empty' instance and cache it.
                 pipelineState = Factory::Get().CreatePipelineState();
@@ -365,7 +582,7 @@ namespace AZ
                 AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
             }
 
-            [[maybe_unused]] ResultCode resultCode = ResultCode::InvalidArgument;
+            ++m_coldCompileCount;
 
             // Increment the pending compile count on the global entry, which tracks how many pipeline states
             // are currently being compiled across all threads.
@@ -374,32 +591,9 @@ namespace AZ
                 ++globalLibraryEntry.m_pendingCompileCount;
             }
 
-            // If the pipeline library failed to initialize, then we don't use it.
-            PipelineLibrary* pipelineLibrary = threadLibraryEntry.m_library.get();
-            if (!pipelineLibrary->IsInitialized())
-            {
-                pipelineLibrary = nullptr;
-            }
-
             // We no longer have the lock, but we own compilation of the pipeline state. Use the
             // thread-local library to perform compilation without blocking other threads.
-            switch (descriptor.GetType())
-            {
-            case PipelineStateType::Draw:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
-                break;
-
-            case PipelineStateType::Dispatch:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
-                break;
-
-            case PipelineStateType::RayTracing:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
-                break;
-
-            default:
-                AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
-            }
+            [[maybe_unused]] ResultCode resultCode = InitPipelineState(*pipelineState, descriptor, threadLibraryEntry);
 
             if (Validation::IsEnabled())
             {
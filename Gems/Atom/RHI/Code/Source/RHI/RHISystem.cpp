@@ -179,6 +179,14 @@ namespace AZ
             Interface<RHISystemInterface>::Unregister(this);
             m_frameScheduler.Shutdown();
 
+            if (m_pipelineStateCache)
+            {
+                const PipelineStateCache::PrewarmStatistics statistics = m_pipelineStateCache->GetPrewarmStatistics();
+                AZ_Printf(
+                    "RHISystem", "Pipeline states: %u prewarmed, %u warm hits, %u cold compiles (%.1f%% warm hit rate).\n",
+                    statistics.m_prewarmedCount, statistics.m_warmHitCount, statistics.m_coldCompileCount,
+                    statistics.GetWarmHitRate() * 100.0f);
+            }
             m_pipelineStateCache = nullptr;
             if (m_device)
             {
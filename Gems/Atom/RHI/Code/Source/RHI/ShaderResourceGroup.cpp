@@ -9,11 +9,31 @@
 #include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/ImageView.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Gap in bytes between two constant inputs below which their intervals are uploaded as one.
+            constexpr uint32_t ConstantIntervalMergeGap = 16;
+
+            bool IsInputEnabled(const AZStd::vector<uint8_t>& inputCompileCount, uint32_t inputIndex)
+            {
+                return inputIndex < inputCompileCount.size() && inputCompileCount[inputIndex] > 0;
+            }
+
+            void DecrementInputCompileCount(AZStd::vector<uint8_t>& inputCompileCount)
+            {
+                for (uint8_t& compileCount : inputCompileCount)
+                {
+                    compileCount = compileCount > 0 ? compileCount - 1 : 0;
+                }
+            }
+        }
+
         void ShaderResourceGroup::Compile(const ShaderResourceGroupData& groupData, CompileMode compileMode /*= CompileMode::Async*/)
         {
             switch (compileMode)
@@ -69,10 +89,123 @@ namespace AZ
                     m_resourceTypeIteration[i] = 0;
                 }
             }
+
+            UpdateShaderInputCompilation(data);
+        }
+
+        void ShaderResourceGroup::UpdateShaderInputCompilation(const ShaderResourceGroupData& data)
+        {
+            const ShaderResourceGroupLayout* layout = data.GetLayout();
+            const size_t constantCount = layout ? layout->GetShaderInputListForConstants().size() : 0;
+            const size_t bufferCount = layout ? layout->GetShaderInputListForBuffers().size() : 0;
+            const size_t imageCount = layout ? layout->GetShaderInputListForImages().size() : 0;
+
+            const uint8_t compileCount = static_cast<uint8_t>(m_updateMaskResetLatency + 1);
+            if (m_constantInputCompileCount.size() != constantCount)
+            {
+                m_constantInputCompileCount.assign(constantCount, compileCount);
+            }
+            if (m_bufferInputCompileCount.size() != bufferCount)
+            {
+                m_bufferInputCompileCount.assign(bufferCount, compileCount);
+            }
+            if (m_imageInputCompileCount.size() != imageCount)
+            {
+                m_imageInputCompileCount.assign(imageCount, compileCount);
+            }
+
+            const auto enableUpdatedInputs = [compileCount](AZStd::vector<uint8_t>& inputCompileCount, auto isInputUpdated)
+            {
+                bool isAnyInputUpdated = false;
+                for (uint32_t inputIndex = 0; inputIndex < static_cast<uint32_t>(inputCompileCount.size()); ++inputIndex)
+                {
+                    if (isInputUpdated(inputIndex))
+                    {
+                        inputCompileCount[inputIndex] = compileCount;
+                        isAnyInputUpdated = true;
+                    }
+                }
+
+                // The resource type was flagged without naming any input, so all of its inputs have to be written.
+                if (!isAnyInputUpdated)
+                {
+                    AZStd::fill(inputCompileCount.begin(), inputCompileCount.end(), compileCount);
+                }
+            };
+
+            using ResourceTypeMask = ShaderResourceGroupData::ResourceTypeMask;
+            const uint32_t sourceUpdateMask = data.GetUpdateMask();
+            if (RHI::CheckBitsAny(sourceUpdateMask, static_cast<uint32_t>(ResourceTypeMask::ConstantDataMask)))
+            {
+                enableUpdatedInputs(m_constantInputCompileCount, [&data](uint32_t inputIndex)
+                {
+                    return data.IsConstantInputUpdated(ShaderInputConstantIndex(inputIndex));
+                });
+            }
+            if (RHI::CheckBitsAny(sourceUpdateMask, static_cast<uint32_t>(ResourceTypeMask::BufferViewMask)))
+            {
+                enableUpdatedInputs(m_bufferInputCompileCount, [&data](uint32_t inputIndex)
+                {
+                    return data.IsBufferInputUpdated(ShaderInputBufferIndex(inputIndex));
+                });
+            }
+            if (RHI::CheckBitsAny(sourceUpdateMask, static_cast<uint32_t>(ResourceTypeMask::ImageViewMask)))
+            {
+                enableUpdatedInputs(m_imageInputCompileCount, [&data](uint32_t inputIndex)
+                {
+                    return data.IsImageInputUpdated(ShaderInputImageIndex(inputIndex));
+                });
+            }
+        }
+
+        void ShaderResourceGroup::UpdateConstantIntervalsToCompile()
+        {
+            m_constantIntervalsToCompile.clear();
+            if (!IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask)) ||
+                !m_data.GetLayout())
+            {
+                return;
+            }
+
+            const ConstantsLayout& constantsLayout = *m_data.GetLayout()->GetConstantsLayout();
+            for (uint32_t inputIndex = 0; inputIndex < static_cast<uint32_t>(m_constantInputCompileCount.size()); ++inputIndex)
+            {
+                if (m_constantInputCompileCount[inputIndex] == 0)
+                {
+                    continue;
+                }
+
+                const Interval interval = constantsLayout.GetInterval(ShaderInputConstantIndex(inputIndex));
+                if (!m_constantIntervalsToCompile.empty())
+                {
+                    Interval& previous = m_constantIntervalsToCompile.back();
+                    if (previous.m_min <= interval.m_min && interval.m_min <= previous.m_max + ConstantIntervalMergeGap)
+                    {
+                        previous.m_max = AZStd::max(previous.m_max, interval.m_max);
+                        continue;
+                    }
+                }
+                m_constantIntervalsToCompile.push_back(interval);
+            }
         }
 
         void ShaderResourceGroup::DisableCompilationForAllResourceTypes()
         {
+            // Inputs count down with the compiles that wrote their resource type.
+            using ResourceTypeMask = ShaderResourceGroupData::ResourceTypeMask;
+            if (IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::ConstantDataMask)))
+            {
+                DecrementInputCompileCount(m_constantInputCompileCount);
+            }
+            if (IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::BufferViewMask)))
+            {
+                DecrementInputCompileCount(m_bufferInputCompileCount);
+            }
+            if (IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceTypeMask::ImageViewMask)))
+            {
+                DecrementInputCompileCount(m_imageInputCompileCount);
+            }
+
             for (uint32_t i = 0; i < static_cast<uint32_t>(ShaderResourceGroupData::ResourceType::Count); i++)
             {
                 if (RHI::CheckBit(m_rhiUpdateMask, static_cast<AZ::u8>(i)))
@@ -108,6 +241,59 @@ namespace AZ
             m_resourceTypeIteration[static_cast<uint32_t>(resourceType)] = 0;
         }
 
+        void ShaderResourceGroup::EnableRhiCompilationForAllResourceTypes()
+        {
+            for (uint32_t i = 0; i < static_cast<uint32_t>(ShaderResourceGroupData::ResourceType::Count); i++)
+            {
+                EnableRhiResourceTypeCompilation(static_cast<ShaderResourceGroupData::ResourceTypeMask>(AZ_BIT(i)));
+            }
+
+            const uint8_t compileCount = static_cast<uint8_t>(m_updateMaskResetLatency + 1);
+            AZStd::fill(m_constantInputCompileCount.begin(), m_constantInputCompileCount.end(), compileCount);
+            AZStd::fill(m_bufferInputCompileCount.begin(), m_bufferInputCompileCount.end(), compileCount);
+            AZStd::fill(m_imageInputCompileCount.begin(), m_imageInputCompileCount.end(), compileCount);
+        }
+
+        void ShaderResourceGroup::EnableRhiBufferInputCompilation(ShaderInputBufferIndex inputIndex)
+        {
+            EnableRhiResourceTypeCompilation(ShaderResourceGroupData::ResourceTypeMask::BufferViewMask);
+            ResetResourceTypeIteration(ShaderResourceGroupData::ResourceType::BufferView);
+            if (inputIndex.GetIndex() < m_bufferInputCompileCount.size())
+            {
+                m_bufferInputCompileCount[inputIndex.GetIndex()] = static_cast<uint8_t>(m_updateMaskResetLatency + 1);
+            }
+        }
+
+        void ShaderResourceGroup::EnableRhiImageInputCompilation(ShaderInputImageIndex inputIndex)
+        {
+            EnableRhiResourceTypeCompilation(ShaderResourceGroupData::ResourceTypeMask::ImageViewMask);
+            ResetResourceTypeIteration(ShaderResourceGroupData::ResourceType::ImageView);
+            if (inputIndex.GetIndex() < m_imageInputCompileCount.size())
+            {
+                m_imageInputCompileCount[inputIndex.GetIndex()] = static_cast<uint8_t>(m_updateMaskResetLatency + 1);
+            }
+        }
+
+        bool ShaderResourceGroup::IsConstantInputEnabledForCompilation(ShaderInputConstantIndex inputIndex) const
+        {
+            return IsInputEnabled(m_constantInputCompileCount, inputIndex.GetIndex());
+        }
+
+        bool ShaderResourceGroup::IsBufferInputEnabledForCompilation(ShaderInputBufferIndex inputIndex) const
+        {
+            return IsInputEnabled(m_bufferInputCompileCount, inputIndex.GetIndex());
+        }
+
+        bool ShaderResourceGroup::IsImageInputEnabledForCompilation(ShaderInputImageIndex inputIndex) const
+        {
+            return IsInputEnabled(m_imageInputCompileCount, inputIndex.GetIndex());
+        }
+
+        AZStd::span<const Interval> ShaderResourceGroup::GetConstantIntervalsToCompile() const
+        {
+            return m_constantIntervalsToCompile;
+        }
+
         HashValue64 ShaderResourceGroup::GetViewHash(const AZ::Name& viewName)
         {
             return m_viewHash[viewName];
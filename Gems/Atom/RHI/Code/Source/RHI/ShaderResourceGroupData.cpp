@@ -8,11 +8,37 @@
 #include <Atom/RHI/ShaderResourceGroupData.h>
 #include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI.Reflect/Bits.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            constexpr uint32_t UpdateMaskBitsPerWord = 64;
+
+            void SetUpdateMaskBit(AZStd::vector<uint64_t>& updateMask, uint32_t inputIndex)
+            {
+                const uint32_t wordIndex = inputIndex / UpdateMaskBitsPerWord;
+                if (wordIndex < updateMask.size())
+                {
+                    updateMask[wordIndex] |= uint64_t(1) << (inputIndex % UpdateMaskBitsPerWord);
+                }
+            }
+
+            bool CheckUpdateMaskBit(const AZStd::vector<uint64_t>& updateMask, uint32_t inputIndex)
+            {
+                const uint32_t wordIndex = inputIndex / UpdateMaskBitsPerWord;
+                return wordIndex < updateMask.size() && (updateMask[wordIndex] & (uint64_t(1) << (inputIndex % UpdateMaskBitsPerWord))) != 0;
+            }
+
+            void ResizeUpdateMask(AZStd::vector<uint64_t>& updateMask, size_t inputCount)
+            {
+                updateMask.resize((inputCount + UpdateMaskBitsPerWord - 1) / UpdateMaskBitsPerWord, 0);
+            }
+        }
+
         const ConstPtr<ImageView> ShaderResourceGroupData::s_nullImageView;
         const ConstPtr<BufferView> ShaderResourceGroupData::s_nullBufferView;
         const SamplerState ShaderResourceGroupData::s_nullSamplerState{};
@@ -35,6 +61,10 @@ namespace AZ
             m_imageViews.resize(layout->GetGroupSizeForImages());
             m_bufferViews.resize(layout->GetGroupSizeForBuffers());
             m_samplers.resize(layout->GetGroupSizeForSamplers());
+
+            ResizeUpdateMask(m_constantInputUpdateMask, layout->GetShaderInputListForConstants().size());
+            ResizeUpdateMask(m_bufferInputUpdateMask, layout->GetShaderInputListForBuffers().size());
+            ResizeUpdateMask(m_imageInputUpdateMask, layout->GetShaderInputListForImages().size());
         }
 
         const ShaderResourceGroupLayout* ShaderResourceGroupData::GetLayout() const
@@ -130,7 +160,7 @@ namespace AZ
 
                 if(!imageViews.empty())
                 {
-                    EnableResourceTypeCompilation(ResourceTypeMask::ImageViewMask);
+                    EnableImageInputCompilation(inputIndex);
                 }
 
                 return isValidAll;
@@ -187,7 +217,7 @@ namespace AZ
 
                 if (!bufferViews.empty())
                 {
-                    EnableResourceTypeCompilation(ResourceTypeMask::BufferViewMask);
+                    EnableBufferInputCompilation(inputIndex);
                 }
                 return isValidAll;
             }
@@ -250,19 +280,19 @@ namespace AZ
 
         bool ShaderResourceGroupData::SetConstantRaw(ShaderInputConstantIndex inputIndex, const void* bytes, uint32_t byteOffset, uint32_t byteCount)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            EnableConstantInputCompilation(inputIndex);
             return m_constantsData.SetConstantRaw(inputIndex, bytes, byteOffset, byteCount);
         }
 
         bool ShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteCount)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            EnableConstantRangeCompilation(0, byteCount);
             return m_constantsData.SetConstantData(bytes, byteCount);
         }
 
         bool ShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteOffset, uint32_t byteCount)
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            EnableConstantRangeCompilation(byteOffset, byteCount);
             return m_constantsData.SetConstantData(bytes, byteOffset, byteCount);
         }
 
@@ -391,6 +421,62 @@ namespace AZ
         void ShaderResourceGroupData::ResetUpdateMask()
         {
             m_updateMask = 0;
+            AZStd::fill(m_constantInputUpdateMask.begin(), m_constantInputUpdateMask.end(), 0);
+            AZStd::fill(m_bufferInputUpdateMask.begin(), m_bufferInputUpdateMask.end(), 0);
+            AZStd::fill(m_imageInputUpdateMask.begin(), m_imageInputUpdateMask.end(), 0);
+        }
+
+        void ShaderResourceGroupData::EnableConstantInputCompilation(ShaderInputConstantIndex inputIndex)
+        {
+            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            SetUpdateMaskBit(m_constantInputUpdateMask, inputIndex.GetIndex());
+        }
+
+        void ShaderResourceGroupData::EnableBufferInputCompilation(ShaderInputBufferIndex inputIndex)
+        {
+            EnableResourceTypeCompilation(ResourceTypeMask::BufferViewMask);
+            SetUpdateMaskBit(m_bufferInputUpdateMask, inputIndex.GetIndex());
+        }
+
+        void ShaderResourceGroupData::EnableImageInputCompilation(ShaderInputImageIndex inputIndex)
+        {
+            EnableResourceTypeCompilation(ResourceTypeMask::ImageViewMask);
+            SetUpdateMaskBit(m_imageInputUpdateMask, inputIndex.GetIndex());
+        }
+
+        void ShaderResourceGroupData::EnableConstantRangeCompilation(uint32_t byteOffset, uint32_t byteCount)
+        {
+            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            if (!m_shaderResourceGroupLayout)
+            {
+                return;
+            }
+
+            const ConstantsLayout& constantsLayout = *m_shaderResourceGroupLayout->GetConstantsLayout();
+            const uint32_t inputCount = static_cast<uint32_t>(constantsLayout.GetShaderInputList().size());
+            for (uint32_t inputIndex = 0; inputIndex < inputCount; ++inputIndex)
+            {
+                const Interval interval = constantsLayout.GetInterval(ShaderInputConstantIndex(inputIndex));
+                if (interval.m_min < byteOffset + byteCount && byteOffset < interval.m_max)
+                {
+                    SetUpdateMaskBit(m_constantInputUpdateMask, inputIndex);
+                }
+            }
+        }
+
+        bool ShaderResourceGroupData::IsConstantInputUpdated(ShaderInputConstantIndex inputIndex) const
+        {
+            return CheckUpdateMaskBit(m_constantInputUpdateMask, inputIndex.GetIndex());
+        }
+
+        bool ShaderResourceGroupData::IsBufferInputUpdated(ShaderInputBufferIndex inputIndex) const
+        {
+            return CheckUpdateMaskBit(m_bufferInputUpdateMask, inputIndex.GetIndex());
+        }
+
+        bool ShaderResourceGroupData::IsImageInputUpdated(ShaderInputImageIndex inputIndex) const
+        {
+            return CheckUpdateMaskBit(m_imageInputUpdateMask, inputIndex.GetIndex());
         }
  
     } // namespace RHI
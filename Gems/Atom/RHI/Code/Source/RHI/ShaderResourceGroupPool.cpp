@@ -265,7 +265,7 @@ namespace AZ
         }
 
         template<typename T>
-        void ShaderResourceGroupPool::UpdateMaskBasedOnViewHash(
+        bool ShaderResourceGroupPool::UpdateMaskBasedOnViewHash(
             ShaderResourceGroup& shaderResourceGroup, Name entryName, AZStd::span<const RHI::ConstPtr<T>> views,
             ShaderResourceGroupData::ResourceType resourceType)
         {
@@ -276,7 +276,9 @@ namespace AZ
                 shaderResourceGroup.EnableRhiResourceTypeCompilation(static_cast<ShaderResourceGroupData::ResourceTypeMask>(AZ_BIT(static_cast<uint32_t>(resourceType))));
                 shaderResourceGroup.ResetResourceTypeIteration(resourceType);
                 shaderResourceGroup.UpdateViewHash(entryName, viewHash);
+                return true;
             }
+            return false;
         }
 
         void ShaderResourceGroupPool::ResetUpdateMaskForModifiedViews(
@@ -288,9 +290,12 @@ namespace AZ
             for (const RHI::ShaderInputImageDescriptor& shaderInputImage : groupLayout.GetShaderInputListForImages())
             {
                 const RHI::ShaderInputImageIndex imageInputIndex(shaderInputIndex);
-                UpdateMaskBasedOnViewHash<RHI::ImageView>(
-                    shaderResourceGroup, shaderInputImage.m_name, shaderResourceGroupData.GetImageViewArray(imageInputIndex),
-                    ShaderResourceGroupData::ResourceType::ImageView);
+                if (UpdateMaskBasedOnViewHash<RHI::ImageView>(
+                        shaderResourceGroup, shaderInputImage.m_name, shaderResourceGroupData.GetImageViewArray(imageInputIndex),
+                        ShaderResourceGroupData::ResourceType::ImageView))
+                {
+                    shaderResourceGroup.EnableRhiImageInputCompilation(imageInputIndex);
+                }
                 ++shaderInputIndex;
             }
 
@@ -299,9 +304,12 @@ namespace AZ
             for (const RHI::ShaderInputBufferDescriptor& shaderInputBuffer : groupLayout.GetShaderInputListForBuffers())
             {
                 const RHI::ShaderInputBufferIndex bufferInputIndex(shaderInputIndex);
-                UpdateMaskBasedOnViewHash<RHI::BufferView>(
-                    shaderResourceGroup, shaderInputBuffer.m_name, shaderResourceGroupData.GetBufferViewArray(bufferInputIndex),
-                    ShaderResourceGroupData::ResourceType::BufferView);
+                if (UpdateMaskBasedOnViewHash<RHI::BufferView>(
+                        shaderResourceGroup, shaderInputBuffer.m_name, shaderResourceGroupData.GetBufferViewArray(bufferInputIndex),
+                        ShaderResourceGroupData::ResourceType::BufferView))
+                {
+                    shaderResourceGroup.EnableRhiBufferInputCompilation(bufferInputIndex);
+                }
                 ++shaderInputIndex;
             }
 
@@ -335,11 +343,8 @@ namespace AZ
         {
             if (r_DisablePartialSrgCompilation)
             {
-                //Reset m_rhiUpdateMask for all resource types which will disable partial SRG compilation
-                for (uint32_t i = 0; i < static_cast<uint32_t>(ShaderResourceGroupData::ResourceType::Count); i++)
-                {
-                    shaderResourceGroup.EnableRhiResourceTypeCompilation(static_cast<ShaderResourceGroupData::ResourceTypeMask>(AZ_BIT(i)));
-                }
+                //Set m_rhiUpdateMask for all resource types and inputs which will disable partial SRG compilation
+                shaderResourceGroup.EnableRhiCompilationForAllResourceTypes();
             }
 
             //Modify m_rhiUpdateMask in case a view was modified. This can happen if a view is invalidated
@@ -348,6 +353,7 @@ namespace AZ
             //Check if any part of the Srg was updated before trying to compile it
             if (shaderResourceGroup.IsAnyResourceTypeUpdated())
             {
+                shaderResourceGroup.UpdateConstantIntervalsToCompile();
                 ResultCode resultCode = CompileGroupInternal(shaderResourceGroup, shaderResourceGroupData);
                 
                 //Reset update mask if the latency check has been fulfilled
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+
+#include <Atom/RHI/DrawList.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/sort.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace
+    {
+        // Builds draw items shaped like a large view: a limited number of distinct sort keys (one per pipeline state and material
+        // combination, including negative keys), and depths spread over the view with some duplicates.
+        RHI::DrawList BuildDrawList(size_t itemCount, uint32_t seed)
+        {
+            SimpleLcgRandom random(seed);
+
+            RHI::DrawList drawList;
+            drawList.reserve(itemCount);
+            for (size_t i = 0; i < itemCount; ++i)
+            {
+                RHI::DrawItemProperties item;
+                item.m_item = reinterpret_cast<const RHI::DrawItem*>(i + 1);
+                item.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 512) - 256;
+                item.m_sortKey <<= 20;
+                item.m_depth = static_cast<float>(random.GetRandom() % 4096) * 0.25f - 16.0f;
+                drawList.push_back(item);
+            }
+            return drawList;
+        }
+
+        template<typename Compare>
+        void ExpectSortedLike(RHI::DrawList drawList, RHI::DrawListSortType sortType, Compare compare)
+        {
+            RHI::DrawList expected = drawList;
+            AZStd::sort(expected.begin(), expected.end(), compare);
+
+            RHI::SortDrawList(drawList, sortType);
+
+            ASSERT_EQ(expected.size(), drawList.size());
+            for (size_t i = 0; i < drawList.size(); ++i)
+            {
+                // Items with equal keys and depths may be in a different order, so only the keys are compared.
+                EXPECT_EQ(expected[i].m_sortKey, drawList[i].m_sortKey);
+                EXPECT_EQ(expected[i].m_depth, drawList[i].m_depth);
+            }
+        }
+    } // namespace
+
+    class DrawListSortTest
+        : public RHITestFixture
+    {
+    };
+
+    TEST_F(DrawListSortTest, SortDrawList_KeyThenDepth_LargeList_SortedByKeyThenDepth)
+    {
+        ExpectSortedLike(BuildDrawList(10000, 1234), RHI::DrawListSortType::KeyThenDepth,
+            [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth < b.m_depth;
+            });
+    }
+
+    TEST_F(DrawListSortTest, SortDrawList_KeyThenReverseDepth_LargeList_SortedByKeyThenReverseDepth)
+    {
+        ExpectSortedLike(BuildDrawList(10000, 5678), RHI::DrawListSortType::KeyThenReverseDepth,
+            [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth > b.m_depth;
+            });
+    }
+
+    TEST_F(DrawListSortTest, SortDrawList_KeyThenDepth_EqualKeysAndDepths_KeepsInsertionOrder)
+    {
+        RHI::DrawList drawList = BuildDrawList(1000, 42);
+        for (RHI::DrawItemProperties& item : drawList)
+        {
+            item.m_sortKey = 7;
+            item.m_depth = 1.0f;
+        }
+        const RHI::DrawList original = drawList;
+
+        RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+
+        EXPECT_EQ(original, drawList);
+    }
+
+    TEST_F(DrawListSortTest, SortDrawList_KeyThenDepth_NegativeAndSignedZeroDepths_SortedByValue)
+    {
+        RHI::DrawList drawList = BuildDrawList(1000, 99);
+        for (size_t i = 0; i < drawList.size(); i += 7)
+        {
+            drawList[i].m_depth = (i % 2) ? -0.0f : 0.0f;
+        }
+
+        ExpectSortedLike(drawList, RHI::DrawListSortType::KeyThenDepth,
+            [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth < b.m_depth;
+            });
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class DrawListSortBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    };
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, SortDrawList_KeyThenDepth)(benchmark::State& state)
+    {
+        const RHI::DrawList source = BuildDrawList(aznumeric_cast<size_t>(state.range(0)), 1234);
+        RHI::DrawList drawList;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            drawList = source;
+            state.ResumeTiming();
+
+            RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+            benchmark::DoNotOptimize(drawList.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, SortDrawList_KeyThenDepth)
+        ->Arg(1000)->Arg(10000)->Arg(100000)->Arg(400000)->Unit(benchmark::kMicrosecond);
+
+    // The comparison sort used for all sort types before the radix sort, kept as the baseline.
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, ComparisonSort_KeyThenDepth)(benchmark::State& state)
+    {
+        const RHI::DrawList source = BuildDrawList(aznumeric_cast<size_t>(state.range(0)), 1234);
+        RHI::DrawList drawList;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            drawList = source;
+            state.ResumeTiming();
+
+            AZStd::sort(drawList.begin(), drawList.end(), [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+                {
+                    return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth < b.m_depth;
+                });
+            benchmark::DoNotOptimize(drawList.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, ComparisonSort_KeyThenDepth)
+        ->Arg(1000)->Arg(10000)->Arg(100000)->Arg(400000)->Unit(benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
+} // namespace UnitTest
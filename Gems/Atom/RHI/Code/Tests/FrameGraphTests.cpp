@@ -14,6 +14,7 @@
 #include <Atom/RHI/BufferFrameAttachment.h>
 #include <Atom/RHI/ImageScopeAttachment.h>
 #include <Atom/RHI/BufferScopeAttachment.h>
+#include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/Math/Random.h>
 
 namespace UnitTest
@@ -437,6 +438,115 @@ namespace UnitTest
             }
         }
 
+        // Three scopes on the graphics queue. A transient image is written by the first scope and read by readScopeIndex,
+        // a transient buffer is written by the second scope and read by the last one.
+        void BuildTransientGraph(RHI::FrameGraph& frameGraph, uint32_t readScopeIndex)
+        {
+            const RHI::AttachmentId transientImageId{ "TransientImage" };
+            const RHI::AttachmentId transientBufferId{ "TransientBuffer" };
+
+            RHI::ImageScopeAttachmentDescriptor imageBindingDesc;
+            imageBindingDesc.m_attachmentId = transientImageId;
+
+            RHI::BufferScopeAttachmentDescriptor bufferBindingDesc;
+            bufferBindingDesc.m_attachmentId = transientBufferId;
+            bufferBindingDesc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+
+            frameGraph.Begin();
+
+            for (uint32_t scopeIdx = 0; scopeIdx < 3; ++scopeIdx)
+            {
+                frameGraph.BeginScope(*m_state->m_scopes[scopeIdx]);
+
+                if (scopeIdx == 0)
+                {
+                    frameGraph.GetAttachmentDatabase().CreateTransientImage(RHI::TransientImageDescriptor{
+                        transientImageId,
+                        RHI::ImageDescriptor::Create2D(RHI::ImageBindFlags::ShaderReadWrite, ImageSize, ImageSize, RHI::Format::R8G8B8A8_UNORM) });
+                    frameGraph.UseShaderAttachment(imageBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+                }
+                else if (scopeIdx == readScopeIndex)
+                {
+                    frameGraph.UseShaderAttachment(imageBindingDesc, RHI::ScopeAttachmentAccess::Read);
+                }
+
+                if (scopeIdx == 1)
+                {
+                    frameGraph.GetAttachmentDatabase().CreateTransientBuffer(RHI::TransientBufferDescriptor{
+                        transientBufferId, RHI::BufferDescriptor(RHI::BufferBindFlags::ShaderReadWrite, BufferSize) });
+                    frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+                }
+                else if (scopeIdx == 2)
+                {
+                    frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::Read);
+                }
+
+                frameGraph.EndScope();
+            }
+
+            frameGraph.End();
+        }
+
+        void TestTopologyCache()
+        {
+            RHI::Ptr<RHI::TransientAttachmentPool> transientAttachmentPool = RHI::Factory::Get().CreateTransientAttachmentPool();
+            {
+                RHI::TransientAttachmentPoolDescriptor desc;
+                desc.m_bufferBudgetInBytes = 16 * 1024;
+                desc.m_imageBudgetInBytes = 16 * 1024;
+                transientAttachmentPool->Init(m_state->m_frameGraphCompiler->GetDevice(), desc);
+            }
+
+            RHI::FrameGraph frameGraph;
+
+            // The topology changes on the first frame and when the image is read by a different scope.
+            const uint32_t readScopeIndices[] = { 1, 1, 1, 2, 2 };
+            const bool expectTopologyUnchanged[] = { false, true, true, false, true };
+
+            for (uint32_t frameIdx = 0; frameIdx < AZ_ARRAY_SIZE(readScopeIndices); ++frameIdx)
+            {
+                BuildTransientGraph(frameGraph, readScopeIndices[frameIdx]);
+
+                {
+                    RHI::FrameGraphCompileRequest request;
+                    request.m_frameGraph = &frameGraph;
+                    request.m_transientAttachmentPool = transientAttachmentPool.get();
+                    ASSERT_TRUE(m_state->m_frameGraphCompiler->Compile(request).IsSuccess());
+                }
+
+                EXPECT_EQ(m_state->m_frameGraphCompiler->IsTopologyUnchanged(), expectTopologyUnchanged[frameIdx]);
+
+                // Reused results must match what a full compile produces for this frame's graph.
+                const RHI::FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+                ASSERT_EQ(attachmentDatabase.GetTransientImageAttachments().size(), 1u);
+                ASSERT_EQ(attachmentDatabase.GetTransientBufferAttachments().size(), 1u);
+
+                const RHI::ImageFrameAttachment* transientImage = attachmentDatabase.GetTransientImageAttachments()[0];
+                EXPECT_EQ(transientImage->GetFirstScope(), m_state->m_scopes[0].get());
+                EXPECT_EQ(transientImage->GetLastScope(), m_state->m_scopes[readScopeIndices[frameIdx]].get());
+                EXPECT_TRUE(transientImage->GetImage() != nullptr);
+
+                const RHI::BufferFrameAttachment* transientBuffer = attachmentDatabase.GetTransientBufferAttachments()[0];
+                EXPECT_EQ(transientBuffer->GetFirstScope(), m_state->m_scopes[1].get());
+                EXPECT_EQ(transientBuffer->GetLastScope(), m_state->m_scopes[2].get());
+                EXPECT_TRUE(transientBuffer->GetBuffer() != nullptr);
+
+                // The queue links are rebuilt on this frame's scopes.
+                EXPECT_EQ(m_state->m_scopes[0]->GetConsumerOnSameQueue(), m_state->m_scopes[1].get());
+                EXPECT_EQ(m_state->m_scopes[1]->GetConsumerOnSameQueue(), m_state->m_scopes[2].get());
+                EXPECT_EQ(m_state->m_scopes[2]->GetProducerOnSameQueue(), m_state->m_scopes[1].get());
+
+                for (const RHI::ScopeAttachment* scopeAttachment = transientImage->GetFirstScopeAttachment();
+                    scopeAttachment;
+                    scopeAttachment = scopeAttachment->GetNext())
+                {
+                    EXPECT_TRUE(scopeAttachment->GetResourceView() != nullptr);
+                }
+            }
+
+            transientAttachmentPool->Shutdown();
+        }
+
     private:
         static const uint32_t FrameIterationCount = 32;
         static const uint32_t ImageCount = 256;
@@ -493,4 +603,9 @@ namespace UnitTest
     {
         TestScopeGraph();
     }
+
+    TEST_F(FrameGraphTests, TestTopologyCache)
+    {
+        TestTopologyCache();
+    }
 }
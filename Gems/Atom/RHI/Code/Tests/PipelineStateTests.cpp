@@ -362,4 +362,96 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_PrewarmLibrary_ServesPrewarmedPipelineStates)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        static const uint32_t PipelineStateCount = 32;
+        AZStd::vector<RHI::PipelineStateCache::PrewarmDescriptor> prewarmDescriptors;
+        for (uint32_t i = 0; i < PipelineStateCount; ++i)
+        {
+            prewarmDescriptors.push_back({ CreatePipelineStateDescriptor(i), 0 });
+        }
+
+        // There is no global job context in the tests, so the pipeline states are compiled before returning.
+        pipelineStateCache->PrewarmLibrary(libraryHandle, AZStd::move(prewarmDescriptors));
+        EXPECT_EQ(pipelineStateCache->GetPrewarmStatistics().m_prewarmedCount, PipelineStateCount);
+
+        for (uint32_t i = 0; i < PipelineStateCount; ++i)
+        {
+            const RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(i);
+            const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
+            ASSERT_NE(pipelineState, nullptr);
+            EXPECT_TRUE(pipelineState->IsInitialized());
+            EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+        }
+        pipelineStateCache->AcquirePipelineState(libraryHandle, CreatePipelineStateDescriptor(PipelineStateCount));
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+
+        const RHI::PipelineStateCache::PrewarmStatistics statistics = pipelineStateCache->GetPrewarmStatistics();
+        EXPECT_EQ(statistics.m_warmHitCount, PipelineStateCount);
+        EXPECT_EQ(statistics.m_coldCompileCount, 1u);
+        EXPECT_FLOAT_EQ(statistics.GetWarmHitRate(), static_cast<float>(PipelineStateCount) / static_cast<float>(PipelineStateCount + 1));
+
+        uint32_t visitedCount = 0;
+        pipelineStateCache->ForEachPipelineState(libraryHandle, [&visitedCount](const RHI::PipelineStateDescriptor&, uint32_t unusedSessionCount)
+        {
+            EXPECT_EQ(unusedSessionCount, 0u);
+            ++visitedCount;
+        });
+        EXPECT_EQ(visitedCount, PipelineStateCount + 1);
+
+        pipelineStateCache->ReleaseLibrary(libraryHandle);
+    }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_ForEachPipelineState_CountsSessionsPrewarmedPipelineStatesWentUnused)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        const RHI::PipelineStateDescriptorForDraw unusedDescriptor = CreatePipelineStateDescriptor(0);
+        const RHI::PipelineStateDescriptorForDraw usedDescriptor = CreatePipelineStateDescriptor(1);
+        AZStd::vector<RHI::PipelineStateCache::PrewarmDescriptor> prewarmDescriptors;
+        prewarmDescriptors.push_back({ unusedDescriptor, 2 });
+        prewarmDescriptors.push_back({ usedDescriptor, 2 });
+        pipelineStateCache->PrewarmLibrary(libraryHandle, AZStd::move(prewarmDescriptors));
+
+        pipelineStateCache->AcquirePipelineState(libraryHandle, usedDescriptor);
+        pipelineStateCache->Compact();
+
+        AZStd::unordered_map<uint64_t, uint32_t> unusedSessionCounts;
+        pipelineStateCache->ForEachPipelineState(libraryHandle, [&unusedSessionCounts](const RHI::PipelineStateDescriptor& descriptor, uint32_t unusedSessionCount)
+        {
+            unusedSessionCounts.emplace(static_cast<uint64_t>(descriptor.GetHash()), unusedSessionCount);
+        });
+        ASSERT_EQ(unusedSessionCounts.size(), 2u);
+        EXPECT_EQ(unusedSessionCounts[static_cast<uint64_t>(unusedDescriptor.GetHash())], 3u);
+        EXPECT_EQ(unusedSessionCounts[static_cast<uint64_t>(usedDescriptor.GetHash())], 0u);
+
+        pipelineStateCache->ReleaseLibrary(libraryHandle);
+    }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_PrewarmLibrary_SkipsAcquiredPipelineStates)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        const RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(0);
+        const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
+
+        AZStd::vector<RHI::PipelineStateCache::PrewarmDescriptor> prewarmDescriptors;
+        prewarmDescriptors.push_back({ descriptor, 0 });
+        pipelineStateCache->PrewarmLibrary(libraryHandle, AZStd::move(prewarmDescriptors));
+        EXPECT_EQ(pipelineStateCache->GetPrewarmStatistics().m_prewarmedCount, 0u);
+
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+        pipelineStateCache->Compact();
+        pipelineStateCache->ReleaseLibrary(libraryHandle);
+    }
 }
@@ -22,6 +22,10 @@
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Matrix4x4.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace UnitTest
 {
     using namespace AZ;
@@ -763,4 +767,273 @@ namespace UnitTest
             EXPECT_NE(otherLayout->GetHash(), layout->GetHash());
         }
     }
+
+    TEST_F(ShaderResourceGroupTests, SRGDataSetShaderInputs_FlagsOnlyAssignedInputs)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        RHI::ShaderResourceGroupData srgData(srgLayout.get());
+
+        const RHI::ShaderInputConstantIndex floatIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+        const RHI::ShaderInputConstantIndex float4Index = srgLayout->FindShaderInputConstantIndex(Name("m_float4Value"));
+        const RHI::ShaderInputConstantIndex vector4Index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+        const RHI::ShaderInputBufferIndex constantBufferIndex = srgLayout->FindShaderInputBufferIndex(Name("m_constantBuffer"));
+        const RHI::ShaderInputBufferIndex readBufferIndex = srgLayout->FindShaderInputBufferIndex(Name("m_readBuffer"));
+
+        EXPECT_TRUE(srgData.SetConstant(vector4Index, Vector4::CreateOne()));
+        EXPECT_TRUE(srgData.SetBufferView(readBufferIndex, nullptr));
+        EXPECT_TRUE(srgData.IsConstantInputUpdated(vector4Index));
+        EXPECT_FALSE(srgData.IsConstantInputUpdated(floatIndex));
+        EXPECT_TRUE(srgData.IsBufferInputUpdated(readBufferIndex));
+        EXPECT_FALSE(srgData.IsBufferInputUpdated(constantBufferIndex));
+        EXPECT_TRUE(RHI::CheckBitsAll(
+            srgData.GetUpdateMask(), static_cast<uint32_t>(RHI::ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask)));
+
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(srgData.GetUpdateMask(), 0u);
+        EXPECT_FALSE(srgData.IsConstantInputUpdated(vector4Index));
+        EXPECT_FALSE(srgData.IsBufferInputUpdated(readBufferIndex));
+
+        // Raw constant data flags the inputs overlapping the assigned bytes.
+        const RHI::Interval float4Interval = srgLayout->GetConstantsLayout()->GetInterval(float4Index);
+        const AZStd::vector<uint8_t> bytes(float4Interval.m_max - float4Interval.m_min, 0);
+        EXPECT_TRUE(srgData.SetConstantData(bytes.data(), float4Interval.m_min, static_cast<uint32_t>(bytes.size())));
+        EXPECT_TRUE(srgData.IsConstantInputUpdated(float4Index));
+        EXPECT_FALSE(srgData.IsConstantInputUpdated(floatIndex));
+        EXPECT_FALSE(srgData.IsConstantInputUpdated(vector4Index));
+    }
+
+    TEST_F(ShaderResourceGroupTests, SRGCompile_AfterEveryCopyIsWritten_OnlyCompilesChangedConstants)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        const RHI::ShaderInputConstantIndex floatIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+        const RHI::ShaderInputConstantIndex vector4Index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+        RHI::ShaderResourceGroupData srgData(*srg);
+
+        // The first compiles write every constant, so all the buffered copies of the group are initialized.
+        for (uint32_t compileIndex = 0; compileIndex < RHI::Limits::Device::FrameCountMax; ++compileIndex)
+        {
+            srgData.SetConstant(vector4Index, Vector4(static_cast<float>(compileIndex)));
+            srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+            srgData.ResetUpdateMask();
+
+            ASSERT_FALSE(srg->GetConstantIntervalsToCompile().empty());
+            EXPECT_EQ(srg->GetConstantIntervalsToCompile().front().m_min, 0u);
+        }
+        EXPECT_FALSE(srg->IsConstantInputEnabledForCompilation(floatIndex));
+
+        srgData.SetConstant(vector4Index, Vector4(-1.0f));
+        srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        srgData.ResetUpdateMask();
+
+        AZStd::span<const RHI::Interval> intervals = srg->GetConstantIntervalsToCompile();
+        ASSERT_EQ(intervals.size(), 1u);
+        EXPECT_EQ(intervals[0], srgLayout->GetConstantsLayout()->GetInterval(vector4Index));
+
+        // An unchanged group keeps writing the last change until every copy received it.
+        for (uint32_t compileIndex = 1; compileIndex < RHI::Limits::Device::FrameCountMax; ++compileIndex)
+        {
+            EXPECT_TRUE(srg->IsConstantInputEnabledForCompilation(vector4Index));
+            srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        }
+        EXPECT_FALSE(srg->IsConstantInputEnabledForCompilation(vector4Index));
+        EXPECT_FALSE(srg->IsAnyResourceTypeUpdated());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Writes the SRG constants into a ring of per group memory, like the platform pools do with their constant buffers.
+    class ConstantUploadShaderResourceGroup final
+        : public RHI::ShaderResourceGroup
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ConstantUploadShaderResourceGroup, AZ::SystemAllocator, 0);
+
+        AZStd::vector<uint8_t> m_constantMemory;
+        uint32_t m_compiledDataIndex = 0;
+    };
+
+    class ConstantUploadShaderResourceGroupPool final
+        : public RHI::ShaderResourceGroupPool
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ConstantUploadShaderResourceGroupPool, AZ::SystemAllocator, 0);
+
+        //! When false, the whole constant data is uploaded on every compile, like the pools did before partial uploads.
+        bool m_isPartialUploadEnabled = true;
+
+    private:
+        RHI::ResultCode InitGroupInternal(RHI::ShaderResourceGroup& groupBase) override
+        {
+            auto& group = static_cast<ConstantUploadShaderResourceGroup&>(groupBase);
+            group.m_constantMemory.resize(GetLayout()->GetConstantDataSize() * RHI::Limits::Device::FrameCountMax);
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode CompileGroupInternal(RHI::ShaderResourceGroup& groupBase, const RHI::ShaderResourceGroupData& groupData) override
+        {
+            auto& group = static_cast<ConstantUploadShaderResourceGroup&>(groupBase);
+            group.m_compiledDataIndex = (group.m_compiledDataIndex + 1) % RHI::Limits::Device::FrameCountMax;
+
+            uint8_t* constantMemory = group.m_constantMemory.data() + group.m_compiledDataIndex * GetLayout()->GetConstantDataSize();
+            AZStd::span<const uint8_t> constantData = groupData.GetConstantData();
+            if (!m_isPartialUploadEnabled)
+            {
+                memcpy(constantMemory, constantData.data(), constantData.size());
+                return RHI::ResultCode::Success;
+            }
+
+            for (const RHI::Interval& interval : group.GetConstantIntervalsToCompile())
+            {
+                memcpy(constantMemory + interval.m_min, constantData.data() + interval.m_min, interval.m_max - interval.m_min);
+            }
+            return RHI::ResultCode::Success;
+        }
+    };
+
+    // Compiles a pool of material-like groups every frame, with a number of animated constants per material.
+    class ShaderResourceGroupCompileBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t MaterialConstantCount = 32;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            InternalSetUp(st);
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            InternalSetUp(st);
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+    protected:
+        void InternalSetUp(const ::benchmark::State& st)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+            AZ::NameDictionary::Create();
+            m_factory.reset(aznew Factory);
+            m_device = MakeTestDevice();
+
+            RHI::Ptr<RHI::ShaderResourceGroupLayout> layout = RHI::ShaderResourceGroupLayout::Create();
+            layout->SetBindingSlot(0);
+            for (uint32_t constantIndex = 0; constantIndex < MaterialConstantCount; ++constantIndex)
+            {
+                const uint32_t byteCount = sizeof(float) * 4;
+                layout->AddShaderInput(RHI::ShaderInputConstantDescriptor{
+                    Name(AZStd::string::format("m_constant%u", constantIndex)), constantIndex * byteCount, byteCount, 0 });
+            }
+            layout->Finalize();
+
+            m_pool = aznew ConstantUploadShaderResourceGroupPool;
+            RHI::ShaderResourceGroupPoolDescriptor descriptor;
+            descriptor.m_layout = layout;
+            m_pool->Init(*m_device, descriptor);
+
+            const size_t groupCount = aznumeric_cast<size_t>(st.range(0));
+            m_groups.reserve(groupCount);
+            m_groupData.reserve(groupCount);
+            for (size_t groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+            {
+                RHI::Ptr<ConstantUploadShaderResourceGroup> group = aznew ConstantUploadShaderResourceGroup;
+                m_pool->InitGroup(*group);
+                m_groupData.emplace_back(*group);
+                m_groups.push_back(AZStd::move(group));
+            }
+        }
+
+        void InternalTearDown()
+        {
+            m_groupData = {};
+            m_pool->Shutdown();
+            m_groups = {};
+            m_pool = nullptr;
+            m_device = nullptr;
+            m_factory.reset();
+            AZ::SystemTickBus::ClearQueuedEvents();
+            AZ::NameDictionary::Destroy();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        AZStd::unique_ptr<Factory> m_factory;
+        RHI::Ptr<RHI::Device> m_device;
+        RHI::Ptr<ConstantUploadShaderResourceGroupPool> m_pool;
+        AZStd::vector<RHI::Ptr<ConstantUploadShaderResourceGroup>> m_groups;
+        AZStd::vector<RHI::ShaderResourceGroupData> m_groupData;
+
+        // Compiles every group each iteration, after animating the first state.range(1) constants of each material.
+        void CompileAnimatedMaterials(benchmark::State& state)
+        {
+            const uint32_t animatedConstantCount = aznumeric_cast<uint32_t>(state.range(1));
+            float time = 0.0f;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                time += 1.0f / 60.0f;
+                for (size_t groupIndex = 0; groupIndex < m_groups.size(); ++groupIndex)
+                {
+                    RHI::ShaderResourceGroupData& groupData = m_groupData[groupIndex];
+                    for (uint32_t constantIndex = 0; constantIndex < animatedConstantCount; ++constantIndex)
+                    {
+                        groupData.SetConstant(RHI::ShaderInputConstantIndex(constantIndex), Vector4(time));
+                    }
+                    m_groups[groupIndex]->Compile(groupData);
+                    groupData.ResetUpdateMask();
+                }
+
+                m_pool->CompileGroupsBegin();
+                m_pool->CompileGroupsForInterval(RHI::Interval(0, m_pool->GetGroupsToCompileCount()));
+                m_pool->CompileGroupsEnd();
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_groups.size());
+        }
+    };
+
+    BENCHMARK_DEFINE_F(ShaderResourceGroupCompileBenchmark, CompileAnimatedMaterials)(benchmark::State& state)
+    {
+        CompileAnimatedMaterials(state);
+    }
+    BENCHMARK_REGISTER_F(ShaderResourceGroupCompileBenchmark, CompileAnimatedMaterials)
+        ->Args({ 1000, 1 })
+        ->Args({ 1000, ShaderResourceGroupCompileBenchmark::MaterialConstantCount })
+        ->Args({ 10000, 1 })
+        ->Args({ 10000, ShaderResourceGroupCompileBenchmark::MaterialConstantCount })
+        ->Unit(benchmark::kMicrosecond);
+
+    // Baseline for CompileAnimatedMaterials that uploads the whole constant data of every compiled group.
+    BENCHMARK_DEFINE_F(ShaderResourceGroupCompileBenchmark, CompileAnimatedMaterials_FullUpload)(benchmark::State& state)
+    {
+        m_pool->m_isPartialUploadEnabled = false;
+        CompileAnimatedMaterials(state);
+    }
+    BENCHMARK_REGISTER_F(ShaderResourceGroupCompileBenchmark, CompileAnimatedMaterials_FullUpload)
+        ->Args({ 1000, 1 })
+        ->Args({ 10000, 1 })
+        ->Unit(benchmark::kMicrosecond);
+#endif // defined(HAVE_BENCHMARK)
 }
@@ -208,7 +208,17 @@ namespace AZ
             
             if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                // Only upload the constant ranges that changed within the last FrameCountMax compiles.
+                AZStd::span<const uint8_t> constantData = groupData.GetConstantData();
+                CpuVirtualAddress cpuConstantAddress = group.GetCompiledData().m_cpuConstantAddress;
+                for (const RHI::Interval& interval : groupBase.GetConstantIntervalsToCompile())
+                {
+                    const uint32_t intervalMax = AZStd::min(interval.m_max, static_cast<uint32_t>(constantData.size()));
+                    if (interval.m_min < intervalMax)
+                    {
+                        memcpy(cpuConstantAddress + interval.m_min, constantData.data() + interval.m_min, intervalMax - interval.m_min);
+                    }
+                }
             }
 
             if (m_viewsDescriptorTableSize)
@@ -279,6 +289,11 @@ namespace AZ
                 for (const RHI::ShaderInputBufferDescriptor& shaderInputBuffer : groupLayout.GetShaderInputListForBuffers())
                 {
                     const RHI::ShaderInputBufferIndex bufferInputIndex(shaderInputIndex);
+                    if (!forceUpdateViews && !group.IsBufferInputEnabledForCompilation(bufferInputIndex))
+                    {
+                        ++shaderInputIndex;
+                        continue;
+                    }
 
                     AZStd::span<const RHI::ConstPtr<RHI::BufferView>> bufferViews = groupData.GetBufferViewArray(bufferInputIndex);
                     D3D12_DESCRIPTOR_RANGE_TYPE descriptorRangeType = ConvertShaderInputBufferAccess(shaderInputBuffer.m_access);
@@ -316,6 +331,11 @@ namespace AZ
                 for (const RHI::ShaderInputImageDescriptor& shaderInputImage : groupLayout.GetShaderInputListForImages())
                 {
                     const RHI::ShaderInputImageIndex imageInputIndex(shaderInputIndex);
+                    if (!forceUpdateViews && !group.IsImageInputEnabledForCompilation(imageInputIndex))
+                    {
+                        ++shaderInputIndex;
+                        continue;
+                    }
 
                     AZStd::span<const RHI::ConstPtr<RHI::ImageView>> imageViews = groupData.GetImageViewArray(imageInputIndex);
                     D3D12_DESCRIPTOR_RANGE_TYPE descriptorRangeType = ConvertShaderInputImageAccess(shaderInputImage.m_access);
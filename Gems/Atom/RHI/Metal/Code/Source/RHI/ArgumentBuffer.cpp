@@ -325,12 +325,20 @@ namespace AZ
             }
         }
 
-        void ArgumentBuffer::UpdateConstantBufferViews(AZStd::span<const uint8_t> rawData)
+        void ArgumentBuffer::UpdateConstantBufferViews(AZStd::span<const uint8_t> rawData, AZStd::span<const RHI::Interval> intervals)
         {
             AZ_Assert(rawData.size() <= m_constantBufferSize, "rawData size can not be bigger than constant Buffer Size");
             if ( (m_constantBufferSize > 0) && (rawData.size() <= m_constantBufferSize))
             {
-                memcpy(m_constantBuffer.GetCpuAddress(), rawData.data(), rawData.size());
+                uint8_t* constantBuffer = static_cast<uint8_t*>(m_constantBuffer.GetCpuAddress());
+                for (const RHI::Interval& interval : intervals)
+                {
+                    const uint32_t intervalMax = AZStd::min(interval.m_max, static_cast<uint32_t>(rawData.size()));
+                    if (interval.m_min < intervalMax)
+                    {
+                        memcpy(constantBuffer + interval.m_min, rawData.data() + interval.m_min, intervalMax - interval.m_min);
+                    }
+                }
             }
         }
 
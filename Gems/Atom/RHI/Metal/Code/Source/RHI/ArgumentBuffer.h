@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RHI/DeviceObject.h>
+#include <Atom/RHI.Reflect/Interval.h>
 #include <Atom/RHI.Reflect/Metal/PipelineLayoutDescriptor.h>
 #include <Atom/RHI.Reflect/SamplerState.h>
 #include <AzCore/Debug/Trace.h>
@@ -91,7 +92,8 @@ namespace AZ
             void UpdateBufferViews(const RHI::ShaderInputBufferDescriptor& shaderInputBuffer,
                                    const AZStd::span<const RHI::ConstPtr<RHI::BufferView>>& bufferViews);
 
-            void UpdateConstantBufferViews(AZStd::span<const uint8_t> rawData);
+            //! Copies the given byte intervals of rawData to the constant buffer.
+            void UpdateConstantBufferViews(AZStd::span<const uint8_t> rawData, AZStd::span<const RHI::Interval> intervals);
 
             id<MTLBuffer> GetArgEncoderBuffer() const;
             size_t GetOffset() const;
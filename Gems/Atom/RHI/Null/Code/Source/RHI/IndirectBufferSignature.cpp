@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <RHI/IndirectBufferSignature.h>
+#include <RHI/IndirectBufferWriter.h>
+#include <RHI/PipelineState.h>
+
+namespace AZ
+{
+    namespace Null
+    {
+        RHI::Ptr<IndirectBufferSignature> IndirectBufferSignature::Create()
+        {
+            return aznew IndirectBufferSignature();
+        }
+
+        RHI::ResultCode IndirectBufferSignature::InitInternal([[maybe_unused]] RHI::Device& device, const RHI::IndirectBufferSignatureDescriptor& descriptor)
+        {
+            auto commands = descriptor.m_layout.GetCommands();
+            const PipelineState* pipelineState = static_cast<const PipelineState*>(descriptor.m_pipelineState);
+
+            // Calculate the offset of the commands and the stride of the whole sequence.
+            m_stride = 0;
+            m_offsets.resize(commands.size());
+            for (uint32_t i = 0; i < commands.size(); ++i)
+            {
+                m_offsets[i] = m_stride;
+                switch (commands[i].m_type)
+                {
+                case RHI::IndirectCommandType::Draw:
+                    m_stride += sizeof(IndirectBufferWriter::DrawArguments);
+                    break;
+                case RHI::IndirectCommandType::DrawIndexed:
+                    m_stride += sizeof(IndirectBufferWriter::DrawIndexedArguments);
+                    break;
+                case RHI::IndirectCommandType::Dispatch:
+                    m_stride += sizeof(IndirectBufferWriter::DispatchArguments);
+                    break;
+                case RHI::IndirectCommandType::VertexBufferView:
+                case RHI::IndirectCommandType::IndexBufferView:
+                    m_stride += sizeof(IndirectBufferWriter::BufferViewArguments);
+                    break;
+                case RHI::IndirectCommandType::RootConstants:
+                {
+                    if (!pipelineState)
+                    {
+                        AZ_Assert(pipelineState, "PipelineState is required when using inline constant commands");
+                        return RHI::ResultCode::InvalidArgument;
+                    }
+                    m_stride += pipelineState->GetRootConstantsByteSize();
+                    break;
+                }
+                default:
+                    AZ_Assert(false, "Invalid indirect argument type");
+                    return RHI::ResultCode::InvalidArgument;
+                }
+            }
+
+            return RHI::ResultCode::Success;
+        }
+
+        uint32_t IndirectBufferSignature::GetByteStrideInternal() const
+        {
+            return m_stride;
+        }
+
+        uint32_t IndirectBufferSignature::GetOffsetInternal(RHI::IndirectCommandIndex index) const
+        {
+            return m_offsets[index.GetIndex()];
+        }
+
+        void IndirectBufferSignature::ShutdownInternal()
+        {
+            m_stride = 0;
+            m_offsets.clear();
+        }
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/IndirectBufferSignature.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace Null
+    {
+        //! Null implementation of the RHI IndirectBufferSignature.
+        //! Commands are tightly packed in the order of the layout, using the same argument sizes as DX12,
+        //! so that code writing indirect buffers can be validated on the CPU.
+        class IndirectBufferSignature final
+            : public RHI::IndirectBufferSignature
+        {
+            using Base = RHI::IndirectBufferSignature;
+        public:
+            AZ_CLASS_ALLOCATOR(IndirectBufferSignature, AZ::ThreadPoolAllocator, 0);
+            AZ_RTTI(IndirectBufferSignature, "{5C0E2B4D-8A5B-4F0E-9D0B-3E7A1F6C2D84}", Base);
+
+            static RHI::Ptr<IndirectBufferSignature> Create();
+
+        private:
+            IndirectBufferSignature() = default;
+
+            //////////////////////////////////////////////////////////////////////////
+            // RHI::IndirectBufferSignature
+            RHI::ResultCode InitInternal(RHI::Device& device, const RHI::IndirectBufferSignatureDescriptor& descriptor) override;
+            uint32_t GetByteStrideInternal() const override;
+            uint32_t GetOffsetInternal(RHI::IndirectCommandIndex index) const override;
+            void ShutdownInternal() override;
+            //////////////////////////////////////////////////////////////////////////
+
+            uint32_t m_stride = 0;
+            AZStd::vector<uint32_t> m_offsets;
+        };
+    }
+}
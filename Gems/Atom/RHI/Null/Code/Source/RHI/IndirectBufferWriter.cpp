@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RHI/IndexBufferView.h>
+#include <Atom/RHI/IndirectBufferSignature.h>
+#include <Atom/RHI/StreamBufferView.h>
+#include <RHI/IndirectBufferWriter.h>
+
+namespace AZ
+{
+    namespace Null
+    {
+        RHI::Ptr<IndirectBufferWriter> IndirectBufferWriter::Create()
+        {
+            return aznew IndirectBufferWriter();
+        }
+
+        void IndirectBufferWriter::SetVertexViewInternal(RHI::IndirectCommandIndex index, const RHI::StreamBufferView& view)
+        {
+            if (auto* command = reinterpret_cast<BufferViewArguments*>(GetCommandTargetMemory(index)))
+            {
+                command->m_byteOffset = view.GetByteOffset();
+                command->m_byteCount = view.GetByteCount();
+                command->m_byteStrideOrFormat = view.GetByteStride();
+            }
+        }
+
+        void IndirectBufferWriter::SetIndexViewInternal(RHI::IndirectCommandIndex index, const RHI::IndexBufferView& view)
+        {
+            if (auto* command = reinterpret_cast<BufferViewArguments*>(GetCommandTargetMemory(index)))
+            {
+                command->m_byteOffset = view.GetByteOffset();
+                command->m_byteCount = view.GetByteCount();
+                command->m_byteStrideOrFormat = static_cast<uint32_t>(view.GetIndexFormat());
+            }
+        }
+
+        void IndirectBufferWriter::DrawInternal(RHI::IndirectCommandIndex index, const RHI::DrawLinear& arguments)
+        {
+            if (auto* command = reinterpret_cast<DrawArguments*>(GetCommandTargetMemory(index)))
+            {
+                command->m_vertexCount = arguments.m_vertexCount;
+                command->m_instanceCount = arguments.m_instanceCount;
+                command->m_vertexOffset = arguments.m_vertexOffset;
+                command->m_instanceOffset = arguments.m_instanceOffset;
+            }
+        }
+
+        void IndirectBufferWriter::DrawIndexedInternal(RHI::IndirectCommandIndex index, const RHI::DrawIndexed& arguments)
+        {
+            if (auto* command = reinterpret_cast<DrawIndexedArguments*>(GetCommandTargetMemory(index)))
+            {
+                command->m_indexCount = arguments.m_indexCount;
+                command->m_instanceCount = arguments.m_instanceCount;
+                command->m_indexOffset = arguments.m_indexOffset;
+                command->m_vertexOffset = static_cast<int32_t>(arguments.m_vertexOffset);
+                command->m_instanceOffset = arguments.m_instanceOffset;
+            }
+        }
+
+        void IndirectBufferWriter::DispatchInternal(RHI::IndirectCommandIndex index, const RHI::DispatchDirect& arguments)
+        {
+            if (auto* command = reinterpret_cast<DispatchArguments*>(GetCommandTargetMemory(index)))
+            {
+                command->m_groupCountX = arguments.GetNumberOfGroupsX();
+                command->m_groupCountY = arguments.GetNumberOfGroupsY();
+                command->m_groupCountZ = arguments.GetNumberOfGroupsZ();
+            }
+        }
+
+        void IndirectBufferWriter::SetRootConstantsInternal(RHI::IndirectCommandIndex index, const uint8_t* data, uint32_t byteSize)
+        {
+            if (uint8_t* command = GetCommandTargetMemory(index))
+            {
+                ::memcpy(command, data, byteSize);
+            }
+        }
+
+        uint8_t* IndirectBufferWriter::GetCommandTargetMemory(RHI::IndirectCommandIndex index) const
+        {
+            uint8_t* targetMemory = GetTargetMemory();
+            return targetMemory ? targetMemory + GetCurrentSequenceIndex() * m_sequenceStride + m_signature->GetOffset(index) : nullptr;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/IndirectBufferWriter.h>
+#include <AzCore/Memory/PoolAllocator.h>
+
+namespace AZ
+{
+    namespace Null
+    {
+        //! Null implementation of the RHI IndirectBufferWriter.
+        //! Commands written to memory are stored with the layouts below, which mirror the DX12 argument structs.
+        //! Null buffers have no backing memory, so commands written to a buffer are discarded.
+        class IndirectBufferWriter final
+            : public RHI::IndirectBufferWriter
+        {
+            using Base = RHI::IndirectBufferWriter;
+        public:
+            AZ_CLASS_ALLOCATOR(IndirectBufferWriter, AZ::ThreadPoolAllocator, 0);
+            AZ_RTTI(IndirectBufferWriter, "{A0F6B9D2-3E1C-4B7A-8D55-6C2E94F1B073}", Base);
+
+            struct DrawArguments
+            {
+                uint32_t m_vertexCount;
+                uint32_t m_instanceCount;
+                uint32_t m_vertexOffset;
+                uint32_t m_instanceOffset;
+            };
+
+            struct DrawIndexedArguments
+            {
+                uint32_t m_indexCount;
+                uint32_t m_instanceCount;
+                uint32_t m_indexOffset;
+                int32_t m_vertexOffset;
+                uint32_t m_instanceOffset;
+            };
+
+            struct DispatchArguments
+            {
+                uint32_t m_groupCountX;
+                uint32_t m_groupCountY;
+                uint32_t m_groupCountZ;
+            };
+
+            //! Used by both vertex and index buffer views. There is no GPU address, so the byte offset into the buffer is stored.
+            struct BufferViewArguments
+            {
+                uint64_t m_byteOffset;
+                uint32_t m_byteCount;
+                uint32_t m_byteStrideOrFormat;
+            };
+
+            static RHI::Ptr<IndirectBufferWriter> Create();
+
+        private:
+            IndirectBufferWriter() = default;
+
+            //////////////////////////////////////////////////////////////////////////
+            // RHI::IndirectBufferWriter
+            void SetVertexViewInternal(RHI::IndirectCommandIndex index, const RHI::StreamBufferView& view) override;
+            void SetIndexViewInternal(RHI::IndirectCommandIndex index, const RHI::IndexBufferView& view) override;
+            void DrawInternal(RHI::IndirectCommandIndex index, const RHI::DrawLinear& arguments) override;
+            void DrawIndexedInternal(RHI::IndirectCommandIndex index, const RHI::DrawIndexed& arguments) override;
+            void DispatchInternal(RHI::IndirectCommandIndex index, const RHI::DispatchDirect& arguments) override;
+            void SetRootConstantsInternal(RHI::IndirectCommandIndex index, const uint8_t* data, uint32_t byteSize) override;
+            //////////////////////////////////////////////////////////////////////////
+
+            //! Returns null when writing into a Null buffer.
+            uint8_t* GetCommandTargetMemory(RHI::IndirectCommandIndex index) const;
+        };
+    }
+}
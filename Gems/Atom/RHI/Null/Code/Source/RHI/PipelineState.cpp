@@ -15,5 +15,12 @@ namespace AZ
         {
             return aznew PipelineState;
         }
+
+        void PipelineState::InitRootConstants(const RHI::PipelineStateDescriptor& descriptor)
+        {
+            const RHI::ConstantsLayout* rootConstantsLayout =
+                descriptor.m_pipelineLayoutDescriptor ? descriptor.m_pipelineLayoutDescriptor->GetRootConstantsLayout() : nullptr;
+            m_rootConstantsByteSize = rootConstantsLayout ? rootConstantsLayout->GetDataSize() : 0;
+        }
     }
 }
@@ -20,17 +20,24 @@ namespace AZ
             AZ_CLASS_ALLOCATOR(PipelineState, AZ::SystemAllocator, 0);
 
             static RHI::Ptr<PipelineState> Create();
+
+            //! The size of the root constants of the pipeline layout, used by indirect signatures that set them.
+            uint32_t GetRootConstantsByteSize() const { return m_rootConstantsByteSize; }
             
         private:
             PipelineState() = default;
+
+            void InitRootConstants(const RHI::PipelineStateDescriptor& descriptor);
             
             //////////////////////////////////////////////////////////////////////////
             // RHI::PipelineState
-            RHI::ResultCode InitInternal([[maybe_unused]] RHI::Device& device, [[maybe_unused]] const RHI::PipelineStateDescriptorForDraw& descriptor, [[maybe_unused]] RHI::PipelineLibrary* pipelineLibrary) override { return RHI::ResultCode::Success;}
-            RHI::ResultCode InitInternal([[maybe_unused]] RHI::Device& device, [[maybe_unused]] const RHI::PipelineStateDescriptorForDispatch& descriptor, [[maybe_unused]] RHI::PipelineLibrary* pipelineLibrary) override { return RHI::ResultCode::Success;}
+            RHI::ResultCode InitInternal([[maybe_unused]] RHI::Device& device, const RHI::PipelineStateDescriptorForDraw& descriptor, [[maybe_unused]] RHI::PipelineLibrary* pipelineLibrary) override { InitRootConstants(descriptor); return RHI::ResultCode::Success;}
+            RHI::ResultCode InitInternal([[maybe_unused]] RHI::Device& device, const RHI::PipelineStateDescriptorForDispatch& descriptor, [[maybe_unused]] RHI::PipelineLibrary* pipelineLibrary) override { InitRootConstants(descriptor); return RHI::ResultCode::Success;}
             RHI::ResultCode InitInternal([[maybe_unused]] RHI::Device& device, [[maybe_unused]] const RHI::PipelineStateDescriptorForRayTracing& descriptor, [[maybe_unused]] RHI::PipelineLibrary* pipelineLibrary) override { return RHI::ResultCode::Success;}
-            void ShutdownInternal() override {}
+            void ShutdownInternal() override { m_rootConstantsByteSize = 0; }
             //////////////////////////////////////////////////////////////////////////
+
+            uint32_t m_rootConstantsByteSize = 0;
         };
     }
 }
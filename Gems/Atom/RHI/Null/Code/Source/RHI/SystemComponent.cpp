@@ -7,8 +7,6 @@
  */
 #include <Atom/RHI/FactoryManagerBus.h>
 #include <Atom/RHI/Fence.h>
-#include <Atom/RHI/IndirectBufferSignature.h>
-#include <Atom/RHI/IndirectBufferWriter.h>
 #include <Atom/RHI/PhysicalDevice.h>
 #include <Atom/RHI/QueryPool.h>
 #include <Atom/RHI.Reflect/Null/Base.h>
@@ -21,6 +19,8 @@
 #include <RHI/Image.h>
 #include <RHI/ImageView.h>
 #include <RHI/ImagePool.h>
+#include <RHI/IndirectBufferSignature.h>
+#include <RHI/IndirectBufferWriter.h>
 #include <RHI/PhysicalDevice.h>
 #include <RHI/PipelineLibrary.h>
 #include <RHI/PipelineState.h>
@@ -194,12 +194,12 @@ namespace AZ
 
         RHI::Ptr<RHI::IndirectBufferSignature> SystemComponent::CreateIndirectBufferSignature()
         {
-            return RHI::Ptr<RHI::IndirectBufferSignature>();
+            return IndirectBufferSignature::Create();
         }
 
         RHI::Ptr<RHI::IndirectBufferWriter> SystemComponent::CreateIndirectBufferWriter()
         {
-            return RHI::Ptr<RHI::IndirectBufferWriter>();
+            return IndirectBufferWriter::Create();
         }
         RHI::Ptr<RHI::RayTracingBufferPools> SystemComponent::CreateRayTracingBufferPools()
         {
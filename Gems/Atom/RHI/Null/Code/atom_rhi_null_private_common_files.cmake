@@ -33,6 +33,10 @@ set(FILES
     Source/RHI/ImagePool.h
     Source/RHI/ImageView.cpp
     Source/RHI/ImageView.h
+    Source/RHI/IndirectBufferSignature.cpp
+    Source/RHI/IndirectBufferSignature.h
+    Source/RHI/IndirectBufferWriter.cpp
+    Source/RHI/IndirectBufferWriter.h
     Source/RHI/PhysicalDevice.cpp
     Source/RHI/PhysicalDevice.h
     Source/RHI/PipelineState.cpp
@@ -49,6 +49,8 @@ namespace AZ
     namespace RPI
     {
         class Scene;
+        struct ViewVisibilityCache;
+        class CullingWorkspacePool;
 
         struct Cullable
         {
@@ -182,6 +184,8 @@ namespace AZ
                     m_numJobs = 0;
                     m_numVisibleCullables = 0;
                     m_numVisibleDrawPackets = 0;
+                    m_numNodeCacheHits = 0;
+                    m_numNodeCacheMisses = 0;
                 }
 
                 AZ::Name m_name;
@@ -189,6 +193,10 @@ namespace AZ
                 AZStd::atomic_uint32_t m_numJobs = 0;
                 AZStd::atomic_uint32_t m_numVisibleCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleDrawPackets = 0;
+                //! Number of octree nodes that reused the visibility results of the previous frame
+                AZStd::atomic_uint32_t m_numNodeCacheHits = 0;
+                //! Number of octree nodes that had to be culled again
+                AZStd::atomic_uint32_t m_numNodeCacheMisses = 0;
             };
 
             CullingDebugContext() = default;
@@ -221,6 +229,9 @@ namespace AZ
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
 
+        //! Adds the DrawPackets of the lods matching an already calculated screen percentage (see ModelLodUtils::ApproxScreenPercentage) to the view.
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view);
+
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingScene via their parent Scene.
@@ -231,8 +242,8 @@ namespace AZ
             AZ_CLASS_ALLOCATOR(CullingScene, AZ::SystemAllocator, 0);
             AZ_DISABLE_COPY_MOVE(CullingScene);
 
-            CullingScene() = default;
-            virtual ~CullingScene() = default;
+            CullingScene();
+            virtual ~CullingScene();
 
             void Activate(const class Scene* parentScene);
             void Deactivate();
@@ -250,7 +261,11 @@ namespace AZ
             using OcclusionPlaneVector = AZStd::vector<OcclusionPlane>;
 
             //! Sets a list of occlusion planes to be used during the culling process.
-            void SetOcclusionPlanes(const OcclusionPlaneVector& occlusionPlanes) { m_occlusionPlanes = occlusionPlanes; }
+            void SetOcclusionPlanes(const OcclusionPlaneVector& occlusionPlanes)
+            {
+                m_occlusionPlanes = occlusionPlanes;
+                ++m_occlusionPlanesVersion;
+            }
 
             //! Notifies the CullingScene that culling will begin for this frame.
             void BeginCulling(const AZStd::vector<ViewPtr>& views);
@@ -298,13 +313,23 @@ namespace AZ
             void BeginCullingTaskGraph(const AZStd::vector<ViewPtr>& views);
             void BeginCullingJobs(const AZStd::vector<ViewPtr>& views);
             void ProcessCullablesCommon(const Scene& scene, View& view, AZ::Frustum& frustum, void*& maskedOcclusionCulling);
+            ViewVisibilityCache* PrepareVisibilityCache(const View& view, const AZ::Frustum& frustum, bool useOcclusionCulling);
+            void UpdateVisibilityCaches(const AZStd::vector<ViewPtr>& views);
 
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+            uint32_t m_occlusionPlanesVersion = 0;
             AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
+
+            //! Per-view visibility results of the octree nodes from the previous frame, see r_CullVisibilityCache.
+            //! Only added to or removed from in BeginCulling, so views can look up their cache in parallel.
+            AZStd::unordered_map<const View*, AZStd::unique_ptr<ViewVisibilityCache>> m_visibilityCaches;
+
+            //! Scratch memory of the worklist jobs, kept across frames so processing a worklist doesn't allocate.
+            AZStd::unique_ptr<CullingWorkspacePool> m_workspacePool;
         };
         
 
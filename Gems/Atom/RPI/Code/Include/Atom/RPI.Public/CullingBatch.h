@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Structure-of-arrays batch of bounding spheres that are culled and lod tested LaneCount objects at a time.
+        //! The culling system fills a batch with the cullables of an octree node that passed the view's filters, so the
+        //! frustum tests and screen coverage calculations run over packed floats instead of going through each Cullable.
+        //! The arrays are padded to a multiple of LaneCount, so the kernels don't need a scalar loop for the remainder.
+        class CullingBatch
+        {
+        public:
+            static constexpr uint32_t LaneCount = static_cast<uint32_t>(Simd::Vec4::ElementCount);
+
+            //! Removes all spheres, keeping the allocated memory.
+            void Clear();
+
+            //! Adds a sphere and returns its index within the batch.
+            //! @param lodSelectionRadius The radius used for screen coverage, see Cullable::LodData::m_lodSelectionRadius.
+            uint32_t Add(const Vector3& center, float radius, float lodSelectionRadius);
+
+            uint32_t GetSize() const
+            {
+                return m_size;
+            }
+
+            //! Classifies every sphere against the frustum, following the same rules as Frustum::IntersectSphere.
+            //! Indices of spheres fully inside the frustum are appended to interiorIndices and indices of spheres crossing any
+            //! of the frustum planes to overlappingIndices. Spheres outside of the frustum aren't reported.
+            //! The plane distances may round differently than the scalar test, so spheres that touch a plane can end up in a
+            //! neighboring classification.
+            void ClassifySpheres(
+                const Frustum& frustum, AZStd::vector<uint32_t>& interiorIndices, AZStd::vector<uint32_t>& overlappingIndices) const;
+
+            //! Calculates ModelLodUtils::ApproxScreenPercentage for every sphere using its lod selection radius.
+            //! screenPercentages is resized to the size of the batch.
+            void CalculateScreenPercentages(
+                const Vector3& cameraPosition, float yScale, bool isPerspective, AZStd::vector<float>& screenPercentages) const;
+
+        private:
+            AZStd::vector<float> m_centerX;
+            AZStd::vector<float> m_centerY;
+            AZStd::vector<float> m_centerZ;
+            AZStd::vector<float> m_radius;
+            AZStd::vector<float> m_lodSelectionRadius;
+            uint32_t m_size = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -67,6 +67,10 @@ namespace AZ
             void* m_address = nullptr;
             uint32_t m_size;
 
+            // The page buffer of the allocator which contains this DynamicBuffer, and the offset of this DynamicBuffer in it
+            Buffer* m_pageBuffer = nullptr;
+            uint32_t m_pageOffset = 0;
+
             // The allocator which allocated this DyanmicBuffer. 
             DynamicBufferAllocator* m_allocator;
         };
@@ -12,10 +12,17 @@
 
 #include <Atom/RHI/IndexBufferView.h>
 #include <Atom/RHI/StreamBufferView.h>
+#include <Atom/RHI/ThreadLocalContext.h>
 
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
 
 namespace AZ
 {
@@ -23,29 +30,71 @@ namespace AZ
     {
         class DynamicBuffer;
 
-        //! DynamicBufferAllocator allocates DynamicBuffers within a big pre-allocated buffer by using ring buffer allocation
-        //! The addresses of allocated DynamicBuffers would be available after AZ::RHI::Limits::Device::FrameCountMax frames.
+        //! DynamicBufferAllocator allocates DynamicBuffers within pages of pre-allocated buffers by using ring buffer allocation
+        //! The pages used by a frame are recycled after AZ::RHI::Limits::Device::FrameCountMax frames.
+        //! Each thread sub-allocates from its own block of a page, so allocations from different threads don't contend
+        //! with each other, and only take a lock when a thread needs a new block.
         //! Since the allocations are sub-allocations they almost have zero cost with both cpu and gpu.
-        //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
-        //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
-        //!     to increase the ring buffer's size. 
+        //! When the pages of a frame run out, new pages are created as long as the pool stays within its maximum size, so
+        //! the allocation only fails if the pool can't grow any more.
+        //! Allocate() may be called from any thread, but not while FrameEnd() is running.
         class DynamicBufferAllocator
         {
             AZ_RTTI(AZ::RPI::DynamicBufferAllocator, "{82B047B3-C845-4F77-9852-747E39C53081}");
         public:
+            //! The dynamic buffer allocations of one consumer, e.g. AuxGeom or LyShine
+            struct ConsumerStatistics
+            {
+                //! The name passed to Allocate(). Allocations without a name are accounted under an empty name.
+                Name m_consumer;
+
+                //! The allocations of the last frame
+                uint32_t m_allocationCount = 0;
+                uint32_t m_failedAllocationCount = 0;
+                AZ::u64 m_allocatedBytes = 0;
+
+                //! The most memory allocated in a single frame since Init() or ResetHighWaterMarks()
+                AZ::u64 m_highWaterBytes = 0;
+            };
+
+            struct Statistics
+            {
+                //! The pages of the pool and their memory
+                uint32_t m_pageCount = 0;
+                AZ::u64 m_reservedBytes = 0;
+
+                //! The memory given to the threads in blocks in the last frame. It includes the unused end of the blocks.
+                AZ::u64 m_blockBytes = 0;
+
+                //! The allocations of the last frame from all the consumers
+                uint32_t m_allocationCount = 0;
+                uint32_t m_failedAllocationCount = 0;
+                AZ::u64 m_allocatedBytes = 0;
+
+                //! The most memory allocated in a single frame since Init() or ResetHighWaterMarks()
+                AZ::u64 m_highWaterBytes = 0;
+
+                AZStd::vector<ConsumerStatistics> m_consumers;
+            };
+
+            //! The size of the blocks the threads sub-allocate from. Larger allocations get a block of their own size.
+            static constexpr uint32_t BlockSize = 64 * 1024;
 
             DynamicBufferAllocator() = default;
             virtual ~DynamicBufferAllocator() = default;
 
             //! One time initialization
-            //! This operation may be slow since it will allocate large size gpu resource. 
-            void Init(uint32_t ringBufferSize);
+            //! This operation may be slow since it will allocate large size gpu resource.
+            //! @param poolSize The size of the pages created at initialization, which are split evenly between the frames in flight.
+            //! @param maxPoolSize The size the pool may grow to when a frame needs more memory. No growth if not larger than poolSize.
+            void Init(uint32_t poolSize, uint32_t maxPoolSize = 0);
 
             void Shutdown();
 
             //! Allocate a dynamic buffer with specified size and alignment
-            //! It may return nullptr if the input size is larger than ring buffer size or there isn't enough unused memory available within the ring buffer
-            RHI::Ptr<DynamicBuffer> Allocate(uint32_t size, uint32_t alignment);
+            //! It may return nullptr if there isn't enough unused memory available and the pool can't grow any more.
+            //! @param consumer The name the allocation is accounted under in the Statistics
+            RHI::Ptr<DynamicBuffer> Allocate(uint32_t size, uint32_t alignment, const Name& consumer = Name());
 
             //! Get an IndexBufferView for a DynamicBuffer used as an index buffer
             RHI::IndexBufferView GetIndexBufferView(RHI::Ptr<DynamicBuffer> subBuffer, RHI::IndexFormat format);
@@ -54,29 +103,74 @@ namespace AZ
             RHI::StreamBufferView GetStreamBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, uint32_t strideByteCount);
 
             //! Submit allocated dynamic buffer to gpu for current frame
+            //! This also collects the statistics of the frame and reports them to the profiler.
             void FrameEnd();
 
             //! Enable/disable buffer allocation warning if allocation fails
             void SetEnableAllocationWarning(bool enable);
 
+            //! Returns the statistics of the last frame, updated by FrameEnd()
+            const Statistics& GetStatistics() const;
+
+            //! Restarts the tracking of the high water marks from the next frame
+            void ResetHighWaterMarks();
+
         private:
+            // A buffer which is sub-allocated by the threads in blocks
+            struct Page
+            {
+                Data::Instance<Buffer> m_buffer;
+                uint8_t* m_address = nullptr;
+                uint32_t m_size = 0;
+            };
+
+            // The block a thread sub-allocates from and the allocations of the thread in the current frame
+            struct ThreadBlock
+            {
+                // The frame the block was taken in. The block can't be used in later frames.
+                AZ::u64 m_frameIndex = AZStd::numeric_limits<AZ::u64>::max();
+                Page* m_page = nullptr;
+                uint32_t m_position = 0;
+                uint32_t m_endPosition = 0;
+
+                AZStd::vector<ConsumerStatistics> m_consumers;
+            };
+
             // Get buffer's offset;
             uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
 
-            // The position where the buffer is available.
+            // Creates a page and adds it to the pool, returns nullptr if the pool can't grow
+            Page* CreatePage(uint32_t size);
+            void ReleasePage(Page* page);
+
+            // Gives a new block of at least the size to the thread, returns false if the pool can't grow
+            bool AcquireBlock(ThreadBlock& threadBlock, uint32_t size);
+
+            ConsumerStatistics& GetConsumerStatistics(ThreadBlock& threadBlock, const Name& consumer);
+
+            // All the pages of the pool. Pages larger than the page size are only used by one frame, then released.
+            AZStd::vector<AZStd::unique_ptr<Page>> m_pages;
+            AZStd::vector<Page*> m_freePages;
+            uint32_t m_pageSize = 0;
+            AZ::u64 m_reservedSize = 0;
+            AZ::u64 m_maxPoolSize = 0;
+
+            // The page the blocks are taken from, the position of the next block and the memory of the blocks taken this frame
+            Page* m_currentPage = nullptr;
             uint32_t m_currentPosition = 0;
-            // The upper bound limit of the allocation of current frame 
-            uint32_t m_endPositionLimit = 0;
-            // The allocated buffer size of current frame
-            uint32_t m_currentAllocatedSize = 0;
+            AZ::u64 m_frameBlockBytes = 0;
 
-            uint32_t m_ringBufferSize = 0;
-            void* m_ringBufferStartAddress = 0;
-            Data::Instance<Buffer> m_ringBuffer;
+            // Guards the pages when the threads take new blocks
+            AZStd::mutex m_pageMutex;
 
-            // Allocation history which are in use by GPU. 
-            uint32_t m_frameStartPositions[AZ::RHI::Limits::Device::FrameCountMax];
+            RHI::ThreadLocalContext<ThreadBlock> m_threadBlocks;
+
+            // The pages used by the frames which may still be in use by GPU.
+            AZStd::vector<Page*> m_framePages[AZ::RHI::Limits::Device::FrameCountMax];
             uint32_t m_currentFrame = 0;
+            AZ::u64 m_frameIndex = 0;
+
+            Statistics m_statistics;
 
             bool m_enableAllocationWarning = false;
         };
@@ -12,6 +12,7 @@
 
 #include <Atom/RPI.Public/PipelineState.h>
 
+#include <AzCore/Name/Name.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 
 namespace AZ
@@ -75,6 +76,8 @@ namespace AZ
             void InitVertexFormat(const AZStd::vector<VertexChannel>& vertexChannels);
             //! Initialize draw list tag of this 
             void InitDrawListTag(RHI::DrawListTag drawListTag);
+            //! Initialize the name the dynamic buffers of this context are accounted under, see DynamicBufferAllocator::Statistics
+            void InitBufferConsumer(const Name& consumer);
 
             //! Customize pipeline state through a function
             //! This function is intended to do pipeline state customization after all initialization function calls but before EndInit
@@ -249,6 +252,9 @@ namespace AZ
             // and also for submitting draw items to views 
             RHI::DrawListTag m_drawListTag;
 
+            // The name the dynamic buffers of this context are accounted under
+            Name m_bufferConsumer;
+
             // Output scope related
             enum class OutputScopeType
             {
@@ -54,7 +54,11 @@ namespace AZ
 
             //! Get a DynamicBuffer from DynamicDrawSystem.
             //! The returned buffer will be invalidated every time the RPISystem's RenderTick is called
-            virtual RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment) = 0;
+            //! @param consumer The name the buffer is accounted under in the statistics, e.g. "AuxGeom"
+            virtual RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment, const Name& consumer = Name()) = 0;
+
+            //! Get the statistics of the dynamic buffers allocated in the last frame, per consumer
+            virtual DynamicBufferAllocator::Statistics GetDynamicBufferStatistics() const = 0;
 
             //! Draw a geometry to a scene with a given material
             virtual void DrawGeometry(Data::Instance<Material> material, const GeometryData& geometry, ScenePtr scene) = 0;
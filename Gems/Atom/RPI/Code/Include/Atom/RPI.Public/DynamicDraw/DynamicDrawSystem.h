@@ -12,6 +12,8 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicBufferAllocator.h>
 #include <Atom/RPI.Reflect/RPISystemDescriptor.h>
 
+#include <AzCore/Console/IConsole.h>
+
 
 namespace AZ
 {
@@ -32,7 +34,8 @@ namespace AZ
 
             // DynamicDrawInterface overrides...
             RHI::Ptr<DynamicDrawContext> CreateDynamicDrawContext() override;
-            RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment) override;
+            RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment, const Name& consumer = Name()) override;
+            DynamicBufferAllocator::Statistics GetDynamicBufferStatistics() const override;
             void DrawGeometry(Data::Instance<Material> material, const GeometryData& geometry, ScenePtr scene) override;
             void AddDrawPacket(Scene* scene, AZStd::unique_ptr<const RHI::DrawPacket> drawPacket) override;
             void AddDrawPacket(Scene* scene, ConstPtr<RHI::DrawPacket> drawPacket) override;
@@ -46,7 +49,16 @@ namespace AZ
             void FrameEnd();
 
         private:
-            AZStd::mutex m_mutexBufferAlloc;
+            void DumpDynamicBufferStatistics(const AZ::ConsoleCommandContainer& arguments);
+            AZ_CONSOLEFUNC(DynamicDrawSystem,
+                DumpDynamicBufferStatistics,
+                AZ::ConsoleFunctorFlags::Null,
+                "Prints the dynamic buffer memory used in the last frame and the high water marks, in total and per consumer. "
+                "Pass 'reset' to reset the high water marks after printing them."
+            );
+
+            // The buffer allocator sub-allocates per thread without locking, this only guards its FrameEnd and statistics
+            mutable AZStd::mutex m_mutexBufferAlloc;
             AZStd::unique_ptr<DynamicBufferAllocator> m_bufferAlloc;
 
             AZStd::mutex m_mutexDrawContext;
@@ -85,6 +85,13 @@ namespace AZ
             //! 
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Requests the mip level that matches the screen space texel density of a surface sampling the image, see
+            //! TexelDensityMipSelector::EstimateScreenPixelsPerUv(). Like SetTargetMip(), this should be called each frame
+            //! the surface is visible, typically after culling, and the controller tracks the most detailed request. The
+            //! fraction of the mip level is kept for controllers that apply hysteresis, like TexelDensityStreamingImageController.
+            //! @param screenPixelsPerUv The screen pixels covered by one unit of texture coordinates.
+            void SetTargetTexelDensity(float screenPixelsPerUv);
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
@@ -50,6 +50,10 @@ namespace AZ
             //! Returns the target mip level requested for the image.
             uint16_t GetTargetMip() const;
 
+            //! Returns the target mip level requested for the image, including the fraction of a level requested through
+            //! StreamingImage::SetTargetTexelDensity(). Requests made through StreamingImage::SetTargetMip() are whole levels.
+            float GetFractionalTargetMip() const;
+
             //! Returns the timestamp of last access.
             size_t GetLastAccessTimestamp() const;
 
@@ -67,6 +71,9 @@ namespace AZ
             // Tracks the requested target mip level.
             AZStd::atomic_uint16_t m_mipLevelTarget = {RHI::Limits::Image::MipCountMax};
 
+            // Tracks the requested target mip level, including the fraction of a level.
+            AZStd::atomic<float> m_fractionalMipLevelTarget = {static_cast<float>(RHI::Limits::Image::MipCountMax)};
+
             // Tracks the last timestamp the image was requested.
             AZStd::atomic_size_t m_lastAccessTimestamp = {0};
         };
@@ -28,6 +28,7 @@ namespace AZ
     namespace RPI
     {
         class StreamingImage;
+        class StreamingImageAsset;
 
         class StreamingImageController
             : public Data::InstanceData
@@ -58,6 +59,7 @@ namespace AZ
 
             //! Called by the streaming image when events occur.
             void OnSetTargetMip(StreamingImage* image, uint16_t targetMipLevel);
+            void OnSetFractionalTargetMip(StreamingImage* image, float targetMipLevel);
             void OnMipChainAssetReady(StreamingImage* image);
 
         protected:
@@ -69,6 +71,9 @@ namespace AZ
             void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
             void TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
 
+            //! Returns the asset of the image, which describes how the mips of the image are grouped into mip chains.
+            const StreamingImageAsset& GetImageAsset(const StreamingImage* image) const;
+
         private:
 
             ///////////////////////////////////////////////////////////////////
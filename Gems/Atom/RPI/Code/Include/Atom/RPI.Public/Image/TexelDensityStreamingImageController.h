@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/TexelDensityStreamingImageControllerAsset.h>
+
+#include <Atom/RPI.Public/Image/StreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImageContext.h>
+
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Selects the mip chains each streaming image keeps resident from the mip levels requested for it, applying
+        //! hysteresis to trims and a strict memory budget. It only works on the sizes of the mip chains, so the policy of
+        //! the TexelDensityStreamingImageController can be simulated without a GPU or any streaming image.
+        class TexelDensityMipSelector
+        {
+        public:
+            //! The requested mip of an image that wasn't used since the last update.
+            static constexpr float NoRequest = static_cast<float>(RHI::Limits::Image::MipCountMax);
+
+            //! A group of mips that are streamed together, see StreamingImageAsset.
+            struct MipChain
+            {
+                //! The most detailed mip level of the chain.
+                uint16_t m_mipLevel = 0;
+
+                //! The GPU memory taken by the mips of the chain.
+                AZ::u64 m_byteCount = 0;
+            };
+
+            struct ImageState
+            {
+                //! The mip chains of the image, from the most detailed to the tail. The tail is always resident.
+                AZStd::fixed_vector<MipChain, RHI::Limits::Image::MipCountMax> m_mipChains;
+
+                //! The most detailed mip level requested since the last update, or NoRequest.
+                float m_requestedMip = NoRequest;
+
+                //! Whether the image was requested in any update. Images that never were stream in all their mips.
+                bool m_wasRequested = false;
+
+                //! The most detailed mip chain kept resident, updated by Update(). Starts at the tail.
+                uint16_t m_targetMipChain = RHI::Limits::Image::MipCountMax;
+
+                //! The number of consecutive updates the request was less detailed than the target, see
+                //! TexelDensityStreamingSettings::m_trimDelay.
+                uint32_t m_trimRequestCount = 0;
+            };
+
+            struct Statistics
+            {
+                //! The memory of the target mip chains of all the images after the update.
+                AZ::u64 m_residentBytes = 0;
+
+                //! The memory of the mip chains queued for streaming by the update.
+                AZ::u64 m_expandedBytes = 0;
+
+                //! The memory of the mip chains trimmed by the update.
+                AZ::u64 m_trimmedBytes = 0;
+
+                uint32_t m_expandedMipChainCount = 0;
+                uint32_t m_trimmedMipChainCount = 0;
+
+                //! The number of images left less detailed than requested because of the budget or the expand limit.
+                uint32_t m_deferredImageCount = 0;
+            };
+
+            //! Returns the mip level at which one texel of an image covers one screen pixel.
+            //! @param texelsPerUv The size of the most detailed mip of the image, i.e. its texels per unit of texture coordinates.
+            //! @param screenPixelsPerUv The screen pixels covered by one unit of texture coordinates, see EstimateScreenPixelsPerUv().
+            static float GetMipLevelForTexelDensity(uint32_t texelsPerUv, float screenPixelsPerUv);
+
+            //! Estimates the screen pixels covered by one unit of texture coordinates on an object, from values gathered during culling.
+            //! @param objectScreenSize The size of the object on screen in pixels, e.g. the projected diameter of its bounding sphere.
+            //! @param uvDensity The fraction of the object covered by one unit of texture coordinates, which is 1 for a texture
+            //!                  mapped once across the mesh and 0.25 for a texture tiled four times.
+            static float EstimateScreenPixelsPerUv(float objectScreenSize, float uvDensity);
+
+            TexelDensityMipSelector() = default;
+            explicit TexelDensityMipSelector(const TexelDensityStreamingSettings& settings);
+
+            const TexelDensityStreamingSettings& GetSettings() const;
+
+            //! Updates the target mip chain of every image from its requested mip, then resets the requests.
+            //! Images that need more detail are expanded in order of need while they fit in the budget, trimming the mips
+            //! that are needed the least to make room. Images that need less detail are trimmed once the request stays
+            //! below the hysteresis for the trim delay. Images without a request keep their resident mips unless the
+            //! budget needs room, and images that were never requested are expanded last to all their mips.
+            Statistics Update(AZStd::span<ImageState* const> images);
+
+        private:
+            TexelDensityStreamingSettings m_settings;
+        };
+
+        //! A streaming image controller that streams the mips that match the screen space texel density requested for
+        //! each image, see StreamingImage::SetTargetTexelDensity(), within the memory budget of its asset.
+        class TexelDensityStreamingImageController final
+            : public StreamingImageController
+        {
+            friend class ImageSystem;
+        public:
+            AZ_RTTI(TexelDensityStreamingImageController, "{4E91C2A7-6B3D-4F58-9C0E-A27D15B8E364}", StreamingImageController)
+
+            static Data::Instance<TexelDensityStreamingImageController> FindOrCreate(const Data::Asset<TexelDensityStreamingImageControllerAsset>& asset);
+
+            //! Returns the statistics of the last update.
+            const TexelDensityMipSelector::Statistics& GetStatistics() const;
+
+        private:
+            class Context final
+                : public StreamingImageContext
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(Context, AZ::ThreadPoolAllocator, 0);
+
+                TexelDensityMipSelector::ImageState m_imageState;
+                bool m_isImageStateInitialized = false;
+            };
+
+            // Standard init for InstanceData subclass
+            TexelDensityStreamingImageController() = default;
+            static Data::Instance<TexelDensityStreamingImageController> CreateInternal(Data::AssetData* assetData);
+            RHI::ResultCode Init(TexelDensityStreamingImageControllerAsset& imageControllerAsset);
+
+            // Fills the mip chains of the image state from the image asset.
+            void InitImageState(StreamingImage& image, TexelDensityMipSelector::ImageState& imageState) const;
+
+            ///////////////////////////////////////////////////////////////////
+            // StreamingImageController Overrides
+            StreamingImageContextPtr CreateContextInternal() override;
+            void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
+            ///////////////////////////////////////////////////////////////////
+
+            TexelDensityMipSelector m_mipSelector;
+            TexelDensityMipSelector::Statistics m_statistics;
+
+            // The contexts of the attached images. Contexts of detached images are removed in the next update.
+            AZStd::vector<AZStd::intrusive_ptr<Context>> m_attachedContexts;
+
+            // The image states and target mip chains of the contexts before the update, kept to avoid reallocating every update.
+            AZStd::vector<TexelDensityMipSelector::ImageState*> m_imageStates;
+            AZStd::vector<uint16_t> m_previousTargetMipChains;
+        };
+    }
+}
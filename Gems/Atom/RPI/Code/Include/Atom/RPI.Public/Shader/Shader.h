@@ -13,6 +13,7 @@
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Shader/IShaderVariantFinder.h>
+#include <Atom/RPI.Reflect/Shader/PipelineStateCacheData.h>
 
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/PipelineLibrary.h>
@@ -148,6 +149,16 @@ namespace AZ
 
             ConstPtr<RHI::PipelineLibraryData> LoadPipelineLibrary() const;
             void SavePipelineLibrary() const;
+
+            ConstPtr<PipelineStateCacheData> LoadPipelineStateCacheData() const;
+            void SavePipelineStateCacheData();
+
+            //! Prewarms the recorded pipeline states of the variants that are loaded, and requests the other variants,
+            //! whose pipeline states are prewarmed when they are ready.
+            void PrewarmPipelineStates(const PipelineStateCacheData& cacheData);
+
+            //! Rebuilds the descriptors of the recorded pipeline states from the variant and prewarms them in jobs.
+            void PrewarmPipelineStates(const ShaderVariant& shaderVariant, AZStd::span<const PipelineStateCacheRecord> records);
             
             const ShaderVariant& GetVariantInternal(ShaderVariantStableId shaderVariantStableId);
 
@@ -187,6 +198,10 @@ namespace AZ
             //! Local cache of ShaderVariants (except for the root variant), searchable by StableId.
             //! Gets populated when GetVariant() is called.
             AZStd::unordered_map<ShaderVariantStableId, ShaderVariant> m_shaderVariants;
+
+            //! Recorded pipeline states of variants that were not loaded yet when the shader was initialized.
+            //! Guarded by m_variantCacheMutex.
+            AZStd::unordered_map<ShaderVariantStableId, AZStd::vector<PipelineStateCacheRecord>> m_pendingPrewarmRecords;
             
             //! DrawListTag associated with this shader.
             RHI::DrawListTag m_drawListTag;
@@ -194,6 +209,9 @@ namespace AZ
             //! PipelineLibrary file name
             char m_pipelineLibraryPath[AZ_MAX_PATH_LEN] = { 0 };
 
+            //! File name of the pipeline state descriptors recorded for prewarming the pipeline library
+            char m_pipelineStateCacheDataPath[AZ_MAX_PATH_LEN] = { 0 };
+
             //! During OnAssetReloaded, the internal references to ShaderVariantAsset inside
             //! ShaderAsset are not updated correctly. We store here a reference to the root ShaderVariantAsset
             //! when it got reloaded, later when We get OnAssetReloaded for the ShaderAsset We update its internal
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <Atom/RPI.Reflect/Image/TexelDensityStreamingImageControllerAsset.h>
 #include <AzCore/RTTI/RTTI.h>
 
 namespace AZ
@@ -32,6 +33,14 @@ namespace AZ
             //! The maximum size of the image pool used for streaming images load from assets
             //! Check ImageSystemInterface::GetStreamingPool() for detail of this image pool
             uint64_t m_assetStreamingImagePoolSize = 2u * 1024u * 1024u * 1024u;
+
+            //! Streams the images of the asset streaming pool with a TexelDensityStreamingImageController, which streams the mips
+            //! matching the texel density requested for each image, instead of streaming in all the mips. The requests come
+            //! from StreamingImage::SetTargetTexelDensity(), images that never get one stream in all their mips while they fit in the budget.
+            bool m_useTexelDensityStreaming = false;
+
+            //! The settings of the TexelDensityStreamingImageController. A memory budget of zero uses the size of the asset streaming pool.
+            TexelDensityStreamingSettings m_texelDensityStreamingSettings;
         };
     } // namespace RPI
 } // namespace AZ
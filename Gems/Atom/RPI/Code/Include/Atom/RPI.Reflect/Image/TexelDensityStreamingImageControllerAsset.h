@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/StreamingImageControllerAsset.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Configuration of the TexelDensityStreamingImageController.
+        struct TexelDensityStreamingSettings
+        {
+            AZ_TYPE_INFO(TexelDensityStreamingSettings, "{2B7D4E61-0C9A-4F3B-8E25-7A1D6C3F9B40}");
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! The GPU memory the images of the pool may keep resident. Mips that don't fit are not streamed in, and the least
+            //! needed mips are trimmed to make room for more needed ones. Zero disables the budget.
+            AZ::u64 m_memoryBudgetInBytes = 0;
+
+            //! Added to the mip level computed from the texel density of every request. Positive values lower the quality.
+            float m_mipBias = 0.0f;
+
+            //! How many mip levels less detailed than the resident mips a request must be before they are trimmed.
+            float m_trimHysteresis = 0.5f;
+
+            //! The number of consecutive updates a request must stay less detailed than the resident mips before they are
+            //! trimmed. Trimming to fit in the memory budget doesn't wait.
+            uint32_t m_trimDelay = 30;
+
+            //! The maximum number of mip chains queued for streaming per update.
+            uint32_t m_maxExpandsPerUpdate = 20;
+        };
+
+        //! The asset of the TexelDensityStreamingImageController, which streams the mips of each image according to the
+        //! screen space texel density requested through StreamingImage::SetTargetTexelDensity().
+        class TexelDensityStreamingImageControllerAsset
+            : public StreamingImageControllerAsset
+        {
+        public:
+            AZ_RTTI(TexelDensityStreamingImageControllerAsset, "{8F3A6C12-5D7E-4B09-A1C4-93E2B7F06D58}", StreamingImageControllerAsset);
+            AZ_CLASS_ALLOCATOR(TexelDensityStreamingImageControllerAsset, SystemAllocator, 0);
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            TexelDensityStreamingImageControllerAsset();
+            explicit TexelDensityStreamingImageControllerAsset(const TexelDensityStreamingSettings& settings);
+
+            const TexelDensityStreamingSettings& GetSettings() const;
+
+        private:
+            TexelDensityStreamingSettings m_settings;
+        };
+    }
+}
@@ -23,6 +23,9 @@ namespace AZ
 
             //! The maxinum size of pool which is used to allocate dynamic buffers for dynamic draw system
             uint32_t m_dynamicBufferPoolSize = 3 * 16 * 1024 * 1024;
+
+            //! The size the pool may grow to when the dynamic buffers of a frame don't fit in it, e.g. in UI or debug draw heavy frames
+            uint32_t m_dynamicBufferMaxPoolSize = 3 * 64 * 1024 * 1024;
         };
 
         struct RPISystemDescriptor final
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! The serialized form of one pipeline state a shader acquired. The shader parts of the descriptor are
+        //! identified by the shader asset and variant they came from, and are rebuilt from the loaded variant,
+        //! so a record never refers to bytecode that is out of date or specific to a backend.
+        struct PipelineStateCacheRecord
+        {
+            AZ_TYPE_INFO(PipelineStateCacheRecord, "{00FED897-8F78-4F41-899C-86EF7D22EB91}");
+
+            static void Reflect(ReflectContext* context);
+
+            Data::AssetId m_shaderAssetId;
+            ShaderVariantStableId m_shaderVariantStableId;
+
+            //! Fixed function state, only used by draw pipeline states.
+            RHI::InputStreamLayout m_inputStreamLayout;
+            RHI::RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+            RHI::RenderStates m_renderStates;
+
+            //! The number of consecutive sessions in which the pipeline state was prewarmed but never acquired.
+            uint32_t m_unusedSessionCount = 0;
+        };
+
+        //! A record of the pipeline states a shader acquired in previous sessions. Shader saves it when it shuts down
+        //! and prewarms the recorded pipeline states when it is loaded again. Unlike RHI::PipelineLibraryData, it holds
+        //! no driver data, so it also helps on platforms that don't serialize pipeline libraries and after a driver
+        //! update invalidates them.
+        class PipelineStateCacheData final
+            : public AZStd::intrusive_base
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(PipelineStateCacheData, SystemAllocator, 0);
+            AZ_TYPE_INFO(PipelineStateCacheData, "{F8CC5F9E-1E29-4178-AABE-9A69700085B7}");
+
+            static void Reflect(ReflectContext* context);
+
+            //! Recorded pipeline states that were not acquired for this many sessions are dropped.
+            static const uint32_t UnusedSessionCountMax = 4;
+
+            void AddRecord(PipelineStateCacheRecord&& record);
+
+            AZStd::span<const PipelineStateCacheRecord> GetRecords() const;
+
+        private:
+            AZStd::vector<PipelineStateCacheRecord> m_records;
+        };
+    }
+}
@@ -9,6 +9,7 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/CullingBatch.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -42,6 +43,8 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(bool, r_CullVisibilityCache, true, nullptr, ConsoleFunctorFlags::Null,
+            "Reuse the culling results of octree nodes that didn't change since the previous frame, as long as the view doesn't move");
 
 #ifdef AZ_CULL_DEBUG_ENABLED
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
@@ -268,9 +271,12 @@ namespace AZ
         }
 
 
+        class CullingWorkspacePool;
+
         struct WorklistData
         {
             CullingDebugContext* m_debugCtx = nullptr;
+            CullingWorkspacePool* m_workspacePool = nullptr;
             const Scene* m_scene = nullptr;
             View* m_view = nullptr;
             Frustum m_frustum;
@@ -281,6 +287,7 @@ namespace AZ
 
         static AZStd::shared_ptr<WorklistData> MakeWorklistData(
             CullingDebugContext& debugCtx,
+            CullingWorkspacePool& workspacePool,
             const Scene& scene,
             View& view,
             Frustum& frustum,
@@ -288,6 +295,7 @@ namespace AZ
         {
             AZStd::shared_ptr<WorklistData> worklistData = AZStd::make_shared<WorklistData>();
             worklistData->m_debugCtx = &debugCtx;
+            worklistData->m_workspacePool = &workspacePool;
             worklistData->m_scene = &scene;
             worklistData->m_view = &view;
             worklistData->m_frustum = frustum;
@@ -297,8 +305,72 @@ namespace AZ
             return worklistData;
         }
 
+        //! Culling results of the entries of one octree node for one view, stored in the same order as the node's entries.
+        struct NodeVisibilityCache
+        {
+            enum class EntryVisibility : uint8_t
+            {
+                //! The entry was filtered out by the view, so its bounds haven't been tested yet
+                Untested,
+                Visible,
+                Culled
+            };
+
+            uint64_t m_nodeVersion = 0;
+            uint64_t m_lastUsedFrame = 0;
+            bool m_isContainedInFrustum = false;
+            AZStd::vector<EntryVisibility> m_entryVisibility;
+        };
+
+        //! Culling results of all the octree nodes visited by a view in the previous frame.
+        //! The results stay valid until the view, the frustum culling options or the occlusion planes change.
+        struct ViewVisibilityCache
+        {
+            Matrix4x4 m_worldToClip = Matrix4x4::CreateZero();
+            Frustum m_frustum;
+            uint32_t m_occlusionPlanesVersion = 0;
+            bool m_useOcclusionCulling = false;
+            bool m_enableFrustumCulling = true;
+            uint64_t m_frameIndex = 0;
+            //! Keyed by the entry list of the node, which identifies the node for as long as it exists
+            AZStd::unordered_map<const AZStd::vector<AzFramework::VisibilityEntry*>*, NodeVisibilityCache> m_nodes;
+        };
+
+        static bool AreFrustumsEqual(const Frustum& lhs, const Frustum& rhs)
+        {
+            for (int planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                if (!(lhs.GetPlane(Frustum::PlaneId(planeId)) == rhs.GetPlane(Frustum::PlaneId(planeId))))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //! Returns the cached results for a node, or nullptr if the view doesn't use the cache.
+        //! Must be called from the thread enumerating the nodes for the view, before the node is handed to a worker.
+        static NodeVisibilityCache* GetNodeVisibilityCache(ViewVisibilityCache* viewCache, const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            if (!viewCache)
+            {
+                return nullptr;
+            }
+
+            // Elements of the unordered_map are never moved, so workers can keep using them while other nodes are added
+            NodeVisibilityCache& nodeCache = viewCache->m_nodes[&nodeData.m_entries];
+            nodeCache.m_lastUsedFrame = viewCache->m_frameIndex;
+            return &nodeCache;
+        }
+
+        struct WorkItem
+        {
+            AzFramework::IVisibilityScene::NodeData m_nodeData;
+            NodeVisibilityCache* m_nodeCache = nullptr;
+        };
+
         constexpr size_t WorkListCapacity = 5;
-        using WorkListType = AZStd::fixed_vector<AzFramework::IVisibilityScene::NodeData, WorkListCapacity>;
+        using WorkListType = AZStd::fixed_vector<WorkItem, WorkListCapacity>;
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
         static MaskedOcclusionCulling::CullingResult TestOcclusionCulling(
@@ -306,6 +378,68 @@ namespace AZ
                     AzFramework::VisibilityEntry* visibleEntry);
 #endif
 
+        //! Tests a cullable that passed the view's filters and the frustum tests against the occlusion planes.
+        static bool PassesOcclusionCulling(
+            [[maybe_unused]] const AZStd::shared_ptr<WorklistData>& worklistData,
+            [[maybe_unused]] AzFramework::VisibilityEntry* visibleEntry)
+        {
+#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
+            return TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE;
+#else
+            return true;
+#endif
+        }
+
+        //! Scratch memory for the batched frustum tests and lod selection of one worklist.
+        struct CullingWorkspace
+        {
+            //! Cullables of the current node that need frustum tests, and their index in the node's entries
+            CullingBatch m_frustumBatch;
+            AZStd::vector<uint32_t> m_frustumBatchEntryIndices;
+            AZStd::vector<uint32_t> m_interiorIndices;
+            AZStd::vector<uint32_t> m_overlappingIndices;
+
+            //! Visible cullables of all the nodes in the worklist, which get their lods selected together
+            CullingBatch m_lodBatch;
+            AZStd::vector<Cullable*> m_visibleCullables;
+            AZStd::vector<float> m_screenPercentages;
+
+            void Clear()
+            {
+                m_lodBatch.Clear();
+                m_visibleCullables.clear();
+            }
+        };
+
+        //! Workspaces that aren't used by a worklist at the moment. They keep their capacity, so once the pool has warmed up
+        //! worklists are processed without allocating.
+        class CullingWorkspacePool
+        {
+        public:
+            AZStd::unique_ptr<CullingWorkspace> Acquire()
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                if (m_freeWorkspaces.empty())
+                {
+                    return AZStd::make_unique<CullingWorkspace>();
+                }
+                AZStd::unique_ptr<CullingWorkspace> workspace = AZStd::move(m_freeWorkspaces.back());
+                m_freeWorkspaces.pop_back();
+                return workspace;
+            }
+
+            void Release(AZStd::unique_ptr<CullingWorkspace> workspace)
+            {
+                workspace->Clear();
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                m_freeWorkspaces.push_back(AZStd::move(workspace));
+            }
+
+        private:
+            AZStd::mutex m_mutex;
+            AZStd::vector<AZStd::unique_ptr<CullingWorkspace>> m_freeWorkspaces;
+        };
+
         static void ProcessWorklist(const AZStd::shared_ptr<WorklistData>& worklistData, const WorkListType& worklist)
         {
             AZ_PROFILE_SCOPE(RPI, "AddObjectsToViewJob: Process");
@@ -316,100 +450,148 @@ namespace AZ
                 // These variable are only used for the gathering of debug information.
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
+                uint32_t numNodeCacheHits = 0;
+                uint32_t numNodeCacheMisses = 0;
             #endif
 
             AZ_Assert(worklist.size() > 0, "Received empty worklist in ProcessWorklist");
 
-            for (const AzFramework::IVisibilityScene::NodeData& nodeData : worklist)
+            AZStd::unique_ptr<CullingWorkspace> workspacePtr = worklistData->m_workspacePool->Acquire();
+            CullingWorkspace& workspace = *workspacePtr;
+            auto addVisibleCullable = [&workspace](Cullable* c)
             {
-                //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
-                bool nodeIsContainedInFrustum =
-                    !worklistData->m_debugCtx->m_enableFrustumCulling ||
-                    ShapeIntersection::Contains(worklistData->m_frustum, nodeData.m_bounds);
+                workspace.m_visibleCullables.push_back(c);
+                workspace.m_lodBatch.Add(
+                    c->m_cullData.m_boundingSphere.GetCenter(), c->m_cullData.m_boundingSphere.GetRadius(), c->m_lodData.m_lodSelectionRadius);
+                c->m_isVisible = true;
+            };
+
+            for (const WorkItem& workItem : worklist)
+            {
+                const AzFramework::IVisibilityScene::NodeData& nodeData = workItem.m_nodeData;
+                NodeVisibilityCache* nodeCache = workItem.m_nodeCache;
+
+                bool nodeIsContainedInFrustum;
+                if (nodeCache && nodeCache->m_nodeVersion == nodeData.m_version && nodeCache->m_entryVisibility.size() == nodeData.m_entries.size())
+                {
+                    // The node didn't change since the previous frame, so only the entries that weren't tested yet need culling
+                    nodeIsContainedInFrustum = nodeCache->m_isContainedInFrustum;
+                    #ifdef AZ_CULL_DEBUG_ENABLED
+                        ++numNodeCacheHits;
+                    #endif
+                }
+                else
+                {
+                    nodeIsContainedInFrustum =
+                        !worklistData->m_debugCtx->m_enableFrustumCulling ||
+                        ShapeIntersection::Contains(worklistData->m_frustum, nodeData.m_bounds);
+
+                    if (nodeCache)
+                    {
+                        nodeCache->m_nodeVersion = nodeData.m_version;
+                        nodeCache->m_isContainedInFrustum = nodeIsContainedInFrustum;
+                        nodeCache->m_entryVisibility.assign(nodeData.m_entries.size(), NodeVisibilityCache::EntryVisibility::Untested);
+                        #ifdef AZ_CULL_DEBUG_ENABLED
+                            ++numNodeCacheMisses;
+                        #endif
+                    }
+                }
 
 #ifdef AZ_CULL_PROFILE_VERBOSE
                 AZ_PROFILE_SCOPE(RPI, "process node (view: %s, skip fine cull: %ds",
                     worklistData->m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? "true" : "false");
 #endif
 
-                if (nodeIsContainedInFrustum)
+                CullingBatch& frustumBatch = workspace.m_frustumBatch;
+                frustumBatch.Clear();
+                workspace.m_frustumBatchEntryIndices.clear();
+
+                for (size_t entryIndex = 0; entryIndex < nodeData.m_entries.size(); ++entryIndex)
                 {
-                    //Add all objects within this node to the view, without any extra culling
-                    for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                    AzFramework::VisibilityEntry* visibleEntry = nodeData.m_entries[entryIndex];
+                    if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                     {
-                        {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                            {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                        Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
 
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != worklistData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                    c->m_isHidden)
-                                {
-                                    continue;
-                                }
+                        // The filters are cheap and may change without the cullable being updated, so they aren't cached
+                        if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                            c->m_cullData.m_hideFlags & viewFlags ||
+                            c->m_cullData.m_scene != worklistData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                            c->m_isHidden)
+                        {
+                            continue;
+                        }
 
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                {
-                                    // There are ways to write this without [[maybe_unused]], but they are brittle.
-                                    // For example, using #else could cause a bug where the function's parameter
-                                    // is changed in #ifdef but not in #else.
-                                    [[maybe_unused]] const uint32_t drawPacketCount=AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
-                                    #ifdef AZ_CULL_DEBUG_ENABLED
-                                        ++numVisibleCullables;
-                                        numDrawPackets += drawPacketCount;
-                                    #endif
-
-                                    c->m_isVisible = true;
-                                }
+                        if (nodeCache && nodeCache->m_entryVisibility[entryIndex] != NodeVisibilityCache::EntryVisibility::Untested)
+                        {
+                            if (nodeCache->m_entryVisibility[entryIndex] == NodeVisibilityCache::EntryVisibility::Visible)
+                            {
+                                addVisibleCullable(c);
+                            }
+                        }
+                        else if (nodeIsContainedInFrustum)
+                        {
+                            //The node is entirely contained within the frustum, so we can skip the fine grained culling.
+                            const bool isVisible = PassesOcclusionCulling(worklistData, visibleEntry);
+                            if (nodeCache)
+                            {
+                                nodeCache->m_entryVisibility[entryIndex] = isVisible
+                                    ? NodeVisibilityCache::EntryVisibility::Visible
+                                    : NodeVisibilityCache::EntryVisibility::Culled;
+                            }
+                            if (isVisible)
+                            {
+                                addVisibleCullable(c);
                             }
                         }
+                        else
+                        {
+                            frustumBatch.Add(c->m_cullData.m_boundingSphere.GetCenter(), c->m_cullData.m_boundingSphere.GetRadius(), c->m_lodData.m_lodSelectionRadius);
+                            workspace.m_frustumBatchEntryIndices.push_back(aznumeric_cast<uint32_t>(entryIndex));
+                        }
                     }
                 }
-                else
+
+                if (frustumBatch.GetSize() > 0)
                 {
-                    //Do fine-grained culling before adding objects to the view
-                    for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                    //Do fine-grained culling of the bounding spheres a few at a time, then test the boxes of the spheres crossing the frustum planes
+                    workspace.m_interiorIndices.clear();
+                    workspace.m_overlappingIndices.clear();
+                    frustumBatch.ClassifySpheres(worklistData->m_frustum, workspace.m_interiorIndices, workspace.m_overlappingIndices);
+
+                    if (nodeCache)
                     {
-                        if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                        for (uint32_t entryIndex : workspace.m_frustumBatchEntryIndices)
                         {
-                            Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                            nodeCache->m_entryVisibility[entryIndex] = NodeVisibilityCache::EntryVisibility::Culled;
+                        }
+                    }
 
-                            if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                c->m_cullData.m_hideFlags & viewFlags ||
-                                c->m_cullData.m_scene != worklistData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                c->m_isHidden)
-                            {
-                                continue;
-                            }
+                    auto addIfVisible = [&](uint32_t batchIndex, bool testObb)
+                    {
+                        const uint32_t entryIndex = workspace.m_frustumBatchEntryIndices[batchIndex];
+                        AzFramework::VisibilityEntry* visibleEntry = nodeData.m_entries[entryIndex];
+                        Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                        if ((testObb && !ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb)) ||
+                            !PassesOcclusionCulling(worklistData, visibleEntry))
+                        {
+                            return;
+                        }
 
-                            IntersectResult res = ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
-                            if (res == IntersectResult::Exterior)
-                            {
-                                continue;
-                            }
-                            else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb))
-                            {
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                {
-                                    // There are ways to write this without [[maybe_unused]], but they are brittle.
-                                    // For example, using #else could cause a bug where the function's parameter
-                                    // is changed in #ifdef but not in #else.
-                                    [[maybe_unused]] const uint32_t drawPacketCount=AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
-                                    #ifdef AZ_CULL_DEBUG_ENABLED
-                                        ++numVisibleCullables;
-                                        numDrawPackets += drawPacketCount;
-                                    #endif
-
-                                    c->m_isVisible = true;
-                                }
-                            }
+                        if (nodeCache)
+                        {
+                            nodeCache->m_entryVisibility[entryIndex] = NodeVisibilityCache::EntryVisibility::Visible;
                         }
+                        addVisibleCullable(c);
+                    };
+
+                    for (uint32_t batchIndex : workspace.m_interiorIndices)
+                    {
+                        addIfVisible(batchIndex, false);
+                    }
+                    for (uint32_t batchIndex : workspace.m_overlappingIndices)
+                    {
+                        addIfVisible(batchIndex, true);
                     }
                 }
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -467,6 +649,36 @@ namespace AZ
 #endif
             }
 
+            if (!workspace.m_visibleCullables.empty())
+            {
+                AZ_PROFILE_SCOPE(RPI, "AddObjectsToViewJob: SelectLods");
+
+                // Same projection values as AddLodDataToView, calculated once for all the visible cullables
+                View& view = *worklistData->m_view;
+                const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+                const float yScale = viewToClip.GetElement(1, 1);
+                const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
+                workspace.m_lodBatch.CalculateScreenPercentages(cameraPos, yScale, isPerspective, workspace.m_screenPercentages);
+
+                for (size_t visibleIndex = 0; visibleIndex < workspace.m_visibleCullables.size(); ++visibleIndex)
+                {
+                    const Cullable* c = workspace.m_visibleCullables[visibleIndex];
+
+                    // There are ways to write this without [[maybe_unused]], but they are brittle.
+                    // For example, using #else could cause a bug where the function's parameter
+                    // is changed in #ifdef but not in #else.
+                    [[maybe_unused]] const uint32_t drawPacketCount = AddLodDataToView(
+                        c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, workspace.m_screenPercentages[visibleIndex], view);
+                    #ifdef AZ_CULL_DEBUG_ENABLED
+                        ++numVisibleCullables;
+                        numDrawPackets += drawPacketCount;
+                    #endif
+                }
+            }
+
+            worklistData->m_workspacePool->Release(AZStd::move(workspacePtr));
+
 #ifdef AZ_CULL_DEBUG_ENABLED
             if (worklistData->m_debugCtx->m_enableStats)
             {
@@ -475,6 +687,8 @@ namespace AZ
                 //no need for mutex here since these are all atomics
                 cullStats.m_numVisibleDrawPackets += numDrawPackets;
                 cullStats.m_numVisibleCullables += numVisibleCullables;
+                cullStats.m_numNodeCacheHits += numNodeCacheHits;
+                cullStats.m_numNodeCacheMisses += numNodeCacheMisses;
                 ++cullStats.m_numJobs;
             }
 #endif //AZ_CULL_DEBUG_ENABLED
@@ -627,6 +841,70 @@ namespace AZ
 #endif
         }
 
+        ViewVisibilityCache* CullingScene::PrepareVisibilityCache(const View& view, const AZ::Frustum& frustum, bool useOcclusionCulling)
+        {
+            auto cacheIter = m_visibilityCaches.find(&view);
+            if (cacheIter == m_visibilityCaches.end())
+            {
+                return nullptr;
+            }
+
+            ViewVisibilityCache& viewCache = *cacheIter->second;
+            const Matrix4x4& worldToClip = view.GetWorldToClipMatrix();
+            if (viewCache.m_worldToClip != worldToClip ||
+                !AreFrustumsEqual(viewCache.m_frustum, frustum) ||
+                viewCache.m_enableFrustumCulling != m_debugCtx.m_enableFrustumCulling ||
+                viewCache.m_useOcclusionCulling != useOcclusionCulling ||
+                (useOcclusionCulling && viewCache.m_occlusionPlanesVersion != m_occlusionPlanesVersion))
+            {
+                // Every result depends on the view, so none of them can be reused
+                viewCache.m_nodes.clear();
+                viewCache.m_worldToClip = worldToClip;
+                viewCache.m_frustum = frustum;
+                viewCache.m_enableFrustumCulling = m_debugCtx.m_enableFrustumCulling;
+                viewCache.m_useOcclusionCulling = useOcclusionCulling;
+                viewCache.m_occlusionPlanesVersion = m_occlusionPlanesVersion;
+            }
+            else
+            {
+                // Nodes that weren't visited in the previous frame have been emptied or released by the octree
+                const uint64_t previousFrame = viewCache.m_frameIndex;
+                AZStd::erase_if(viewCache.m_nodes, [previousFrame](const auto& nodeCache)
+                {
+                    return nodeCache.second.m_lastUsedFrame != previousFrame;
+                });
+            }
+
+            ++viewCache.m_frameIndex;
+            return &viewCache;
+        }
+
+        void CullingScene::UpdateVisibilityCaches(const AZStd::vector<ViewPtr>& views)
+        {
+            if (!r_CullVisibilityCache)
+            {
+                m_visibilityCaches.clear();
+                return;
+            }
+
+            AZStd::erase_if(m_visibilityCaches, [&views](const auto& viewCache)
+            {
+                return AZStd::find_if(views.begin(), views.end(), [&viewCache](const ViewPtr& view)
+                {
+                    return view.get() == viewCache.first;
+                }) == views.end();
+            });
+
+            for (const ViewPtr& view : views)
+            {
+                AZStd::unique_ptr<ViewVisibilityCache>& viewCache = m_visibilityCaches[view.get()];
+                if (!viewCache)
+                {
+                    viewCache = AZStd::make_unique<ViewVisibilityCache>();
+                }
+            }
+        }
+
         void CullingScene::ProcessCullablesJobs(const Scene& scene, View& view, AZ::Job& parentJob)
         {
             AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCullablesJobs() - %s", view.GetName().GetCStr());
@@ -636,12 +914,13 @@ namespace AZ
 
             void* maskedOcclusionCulling = nullptr;
             ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
+            ViewVisibilityCache* viewCache = PrepareVisibilityCache(view, frustum, maskedOcclusionCulling != nullptr);
 
             WorkListType worklist;
 
-            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling);
+            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, *m_workspacePool, scene, view, frustum, maskedOcclusionCulling);
 
-            auto nodeVisitorLambda = [worklistData, &parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
+            auto nodeVisitorLambda = [worklistData, viewCache, &parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
                 AZ_PROFILE_SCOPE(RPI, "nodeVisitorLambda()");
                 AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
@@ -649,7 +928,7 @@ namespace AZ
 
                 //Queue up a small list of work items (NodeData*) which will be pushed to a worker job (AddObjectsToViewJob) once the queue is full.
                 //This reduces the number of jobs in flight, reducing job-system overhead.
-                worklist.emplace_back(AZStd::move(nodeData));
+                worklist.push_back(WorkItem{ nodeData, GetNodeVisibilityCache(viewCache, nodeData) });
 
                 if (worklist.size() == worklist.capacity())
                 {
@@ -698,13 +977,14 @@ namespace AZ
 
             void* maskedOcclusionCulling = nullptr;
             ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
+            ViewVisibilityCache* viewCache = PrepareVisibilityCache(view, frustum, maskedOcclusionCulling != nullptr);
 
             AZStd::unique_ptr<WorkListType> worklist = AZStd::make_unique<WorkListType>();
 
-            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling);
+            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, *m_workspacePool, scene, view, frustum, maskedOcclusionCulling);
             static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
 
-            auto nodeVisitorLambda = [worklistData, &taskGraph, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
+            auto nodeVisitorLambda = [worklistData, viewCache, &taskGraph, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
                 AZ_PROFILE_SCOPE(RPI, "nodeVisitorLambda()");
                 AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
@@ -712,7 +992,7 @@ namespace AZ
 
                 //Queue up a small list of work items (NodeData*) which will be pushed to a worker task once the queue is full.
                 //This reduces the number of tasks in flight, reducing task-system overhead.
-                worklist->emplace_back(AZStd::move(nodeData));
+                worklist->push_back(WorkItem{ nodeData, GetNodeVisibilityCache(viewCache, nodeData) });
 
                 if (worklist->size() == worklist->capacity())
                 {
@@ -763,6 +1043,11 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            return AddLodDataToView(pos, lodData, approxScreenPercentage, view);
+        }
+
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view)
+        {
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
@@ -816,8 +1101,17 @@ namespace AZ
 #endif
         }
 
+        CullingScene::CullingScene()
+            : m_workspacePool(AZStd::make_unique<CullingWorkspacePool>())
+        {
+        }
+
+        CullingScene::~CullingScene() = default;
+
         void CullingScene::Deactivate()
         {
+            m_visibilityCaches.clear();
+
 #ifdef AZ_CULL_DEBUG_ENABLED
             AZ_Assert(CountObjectsInScene() == 0, "All culling entries must be removed from the scene before shutdown.");
 #endif
@@ -879,6 +1173,8 @@ namespace AZ
             m_debugCtx.ResetCullStats();
             m_debugCtx.m_numCullablesInScene = GetNumCullables();
 
+            UpdateVisibilityCaches(views);
+
             m_taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
 
             if(views.size() == 1) // avoid job overhead when only 1 job
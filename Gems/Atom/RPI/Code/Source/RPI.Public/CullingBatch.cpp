@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/CullingBatch.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void CullingBatch::Clear()
+        {
+            m_centerX.clear();
+            m_centerY.clear();
+            m_centerZ.clear();
+            m_radius.clear();
+            m_lodSelectionRadius.clear();
+            m_size = 0;
+        }
+
+        uint32_t CullingBatch::Add(const Vector3& center, float radius, float lodSelectionRadius)
+        {
+            if (m_size % LaneCount == 0)
+            {
+                // Grow by a full set of lanes, the padding is never reported by the kernels
+                const size_t paddedSize = m_size + LaneCount;
+                m_centerX.resize(paddedSize, 0.0f);
+                m_centerY.resize(paddedSize, 0.0f);
+                m_centerZ.resize(paddedSize, 0.0f);
+                m_radius.resize(paddedSize, 0.0f);
+                m_lodSelectionRadius.resize(paddedSize, 0.0f);
+            }
+
+            const uint32_t index = m_size++;
+            m_centerX[index] = center.GetX();
+            m_centerY[index] = center.GetY();
+            m_centerZ[index] = center.GetZ();
+            m_radius[index] = radius;
+            m_lodSelectionRadius[index] = lodSelectionRadius;
+            return index;
+        }
+
+        void CullingBatch::ClassifySpheres(
+            const Frustum& frustum, AZStd::vector<uint32_t>& interiorIndices, AZStd::vector<uint32_t>& overlappingIndices) const
+        {
+            using Simd::Vec4;
+
+            Vec4::FloatType planeX[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeY[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeZ[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeW[Frustum::PlaneId::MAX];
+            for (int planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vector4 coefficients = frustum.GetPlane(Frustum::PlaneId(planeId)).GetPlaneEquationCoefficients();
+                planeX[planeId] = Vec4::Splat(coefficients.GetX());
+                planeY[planeId] = Vec4::Splat(coefficients.GetY());
+                planeZ[planeId] = Vec4::Splat(coefficients.GetZ());
+                planeW[planeId] = Vec4::Splat(coefficients.GetW());
+            }
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            for (uint32_t baseIndex = 0; baseIndex < m_size; baseIndex += LaneCount)
+            {
+                const Vec4::FloatType centerX = Vec4::LoadUnaligned(&m_centerX[baseIndex]);
+                const Vec4::FloatType centerY = Vec4::LoadUnaligned(&m_centerY[baseIndex]);
+                const Vec4::FloatType centerZ = Vec4::LoadUnaligned(&m_centerZ[baseIndex]);
+                const Vec4::FloatType radius = Vec4::LoadUnaligned(&m_radius[baseIndex]);
+                const Vec4::FloatType negativeRadius = Vec4::Sub(zero, radius);
+
+                // A sphere is outside if it is behind any plane, and overlapping if it crosses any plane without being outside
+                Vec4::FloatType exterior = zero;
+                Vec4::FloatType overlaps = zero;
+                for (int planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Vec4::FloatType distance =
+                        Vec4::Madd(centerZ, planeZ[planeId], Vec4::Madd(centerY, planeY[planeId], Vec4::Madd(centerX, planeX[planeId], planeW[planeId])));
+                    exterior = Vec4::Or(exterior, Vec4::CmpLt(distance, negativeRadius));
+                    overlaps = Vec4::Or(overlaps, Vec4::CmpLt(Vec4::Abs(distance), radius));
+                }
+
+                int32_t exteriorLanes[LaneCount];
+                int32_t overlapLanes[LaneCount];
+                Vec4::StoreUnaligned(exteriorLanes, Vec4::CastToInt(exterior));
+                Vec4::StoreUnaligned(overlapLanes, Vec4::CastToInt(overlaps));
+
+                const uint32_t laneCount = AZStd::min(LaneCount, m_size - baseIndex);
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    if (exteriorLanes[lane] != 0)
+                    {
+                        continue;
+                    }
+
+                    AZStd::vector<uint32_t>& indices = (overlapLanes[lane] != 0) ? overlappingIndices : interiorIndices;
+                    indices.push_back(baseIndex + lane);
+                }
+            }
+        }
+
+        void CullingBatch::CalculateScreenPercentages(
+            const Vector3& cameraPosition, float yScale, bool isPerspective, AZStd::vector<float>& screenPercentages) const
+        {
+            using Simd::Vec4;
+
+            // Store full lanes, then drop the padding
+            screenPercentages.resize(m_centerX.size());
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType yScaleSplat = Vec4::Splat(yScale);
+            const Vec4::FloatType cameraX = Vec4::Splat(cameraPosition.GetX());
+            const Vec4::FloatType cameraY = Vec4::Splat(cameraPosition.GetY());
+            const Vec4::FloatType cameraZ = Vec4::Splat(cameraPosition.GetZ());
+            for (uint32_t baseIndex = 0; baseIndex < m_size; baseIndex += LaneCount)
+            {
+                const Vec4::FloatType projectedSize = Vec4::Mul(yScaleSplat, Vec4::LoadUnaligned(&m_lodSelectionRadius[baseIndex]));
+                Vec4::FloatType screenPercentage;
+                if (isPerspective)
+                {
+                    // See ModelLodUtils::ApproxScreenPercentage for the derivation
+                    const Vec4::FloatType toCenterX = Vec4::Sub(cameraX, Vec4::LoadUnaligned(&m_centerX[baseIndex]));
+                    const Vec4::FloatType toCenterY = Vec4::Sub(cameraY, Vec4::LoadUnaligned(&m_centerY[baseIndex]));
+                    const Vec4::FloatType toCenterZ = Vec4::Sub(cameraZ, Vec4::LoadUnaligned(&m_centerZ[baseIndex]));
+                    const Vec4::FloatType distance =
+                        Vec4::Sqrt(Vec4::Madd(toCenterZ, toCenterZ, Vec4::Madd(toCenterY, toCenterY, Vec4::Mul(toCenterX, toCenterX))));
+                    screenPercentage = Vec4::Div(projectedSize, distance);
+                }
+                else
+                {
+                    screenPercentage = projectedSize;
+                }
+
+                Vec4::StoreUnaligned(&screenPercentages[baseIndex], Vec4::Min(screenPercentage, one));
+            }
+
+            screenPercentages.resize(m_size);
+        }
+    } // namespace RPI
+} // namespace AZ
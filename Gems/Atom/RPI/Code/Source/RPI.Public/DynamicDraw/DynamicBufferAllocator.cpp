@@ -15,124 +15,240 @@ namespace AZ
 {
     namespace RPI
     {
-        void DynamicBufferAllocator::Init(uint32_t ringBufferSize)
+        void DynamicBufferAllocator::Init(uint32_t poolSize, uint32_t maxPoolSize)
         {
-            if (m_ringBuffer)
+            if (!m_pages.empty())
             {
                 AZ_Assert(false, "DynamicBufferAllocator was already initialized");
                 return;
             }
 
-            // Create the ring buffer from common pool
-            RPI::CommonBufferDescriptor desc;
-            desc.m_poolType = RPI::CommonBufferPoolType::DynamicInputAssembly;
-            desc.m_bufferName = "DyanmicBufferRing";
-            desc.m_elementSize = 1;
-            desc.m_byteCount = ringBufferSize;
-            m_ringBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            // Each frame in flight starts with one page
+            m_pageSize = AZStd::max(poolSize / AZ::RHI::Limits::Device::FrameCountMax, BlockSize);
+            m_maxPoolSize = AZStd::max(AZ::u64(m_pageSize) * AZ::RHI::Limits::Device::FrameCountMax, AZ::u64(maxPoolSize));
+            for (uint32_t frame = 0; frame < AZ::RHI::Limits::Device::FrameCountMax; frame++)
+            {
+                Page* page = CreatePage(m_pageSize);
+                if (!page)
+                {
+                    break;
+                }
+                m_freePages.push_back(page);
+            }
 
-            if (m_ringBuffer.get() == nullptr)
+            //The pages can't be mapped for Null back end
+            if (m_pages.empty())
             {
-                AZ_Assert(false, "Failed to initialize DyanmicBufferAllocator");
+                m_pageSize = 0;
                 return;
             }
-            
-            m_ringBufferSize = ringBufferSize;
-            m_ringBufferStartAddress = m_ringBuffer->Map(m_ringBufferSize, 0);
-            
+
+            m_currentPage = nullptr;
             m_currentPosition = 0;
-            m_endPositionLimit = 0;
             m_currentFrame = 0;
-            for (uint32_t frame = 0; frame < AZ::RHI::Limits::Device::FrameCountMax; frame++)
-            {
-                m_frameStartPositions[frame] = 0;
-            }
+            m_frameIndex = 0;
+            m_statistics = {};
+            m_statistics.m_pageCount = aznumeric_cast<uint32_t>(m_pages.size());
+            m_statistics.m_reservedBytes = m_reservedSize;
         }
 
         void DynamicBufferAllocator::Shutdown()
         {
-            m_ringBuffer->Unmap();
-            m_ringBuffer = nullptr;
-            m_ringBufferStartAddress = nullptr;
+            for (AZStd::unique_ptr<Page>& page : m_pages)
+            {
+                page->m_buffer->Unmap();
+            }
+            m_pages.clear();
+            m_freePages.clear();
+            for (AZStd::vector<Page*>& framePages : m_framePages)
+            {
+                framePages.clear();
+            }
+            m_threadBlocks.Clear();
+
+            m_currentPage = nullptr;
+            m_pageSize = 0;
+            m_reservedSize = 0;
         }
 
-        // [GFX TODO][ATOM-13182] Add unit tests for DynamicBufferAllocator's Allocate function 
-        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, [[maybe_unused]]uint32_t alignment)
+        DynamicBufferAllocator::Page* DynamicBufferAllocator::CreatePage(uint32_t size)
         {
-            size = RHI::AlignUp(size, alignment);
-            uint32_t allocatePosition = 0;
-
-            //m_ringBufferStartAddress can be null for Null back end
-            if (!m_ringBufferStartAddress)
+            if (m_reservedSize + size > m_maxPoolSize)
             {
                 return nullptr;
             }
 
-            if (size > m_ringBufferSize)
+            // Create the page from common pool
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::DynamicInputAssembly;
+            desc.m_bufferName = "DynamicBufferPage";
+            desc.m_elementSize = 1;
+            desc.m_byteCount = size;
+            Data::Instance<Buffer> buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            if (!buffer)
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: try to allocate buffer which size is larger than the ring buffer size");
+                AZ_Error("RPI", false, "DynamicBufferAllocator failed to create a page of %u bytes", size);
                 return nullptr;
             }
 
-            // Return if the allocation of current frame has reached limit
-            if (m_endPositionLimit == m_currentPosition && m_currentAllocatedSize > 0)
+            void* address = buffer->Map(size, 0);
+            if (!address)
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer is available");
                 return nullptr;
             }
 
-            if (m_endPositionLimit > m_currentPosition)
+            AZStd::unique_ptr<Page> page = AZStd::make_unique<Page>();
+            page->m_buffer = AZStd::move(buffer);
+            page->m_address = static_cast<uint8_t*>(address);
+            page->m_size = size;
+            m_reservedSize += size;
+            m_pages.emplace_back(AZStd::move(page));
+            return m_pages.back().get();
+        }
+
+        void DynamicBufferAllocator::ReleasePage(Page* page)
+        {
+            auto pageIt = AZStd::find_if(m_pages.begin(), m_pages.end(), [page](const AZStd::unique_ptr<Page>& pagePtr)
+            {
+                return pagePtr.get() == page;
+            });
+            if (pageIt != m_pages.end())
+            {
+                m_reservedSize -= page->m_size;
+                page->m_buffer->Unmap();
+                m_pages.erase(pageIt);
+            }
+        }
+
+        bool DynamicBufferAllocator::AcquireBlock(ThreadBlock& threadBlock, uint32_t size)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pageMutex);
+
+            uint32_t blockSize = AZStd::max(size, BlockSize);
+            if (blockSize > m_pageSize)
+            {
+                // Allocations larger than a page get a page of their own
+                Page* page = CreatePage(blockSize);
+                if (!page)
+                {
+                    return false;
+                }
+                m_framePages[m_currentFrame].push_back(page);
+                threadBlock.m_page = page;
+                threadBlock.m_position = 0;
+                threadBlock.m_endPosition = blockSize;
+                m_frameBlockBytes += blockSize;
+                return true;
+            }
+
+            const uint32_t pageSpace = m_currentPage ? m_currentPage->m_size - m_currentPosition : 0;
+            if (pageSpace < blockSize)
             {
-                if (m_endPositionLimit - m_currentPosition >= size)
+                Page* page = nullptr;
+                if (!m_freePages.empty())
                 {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
+                    page = m_freePages.back();
+                    m_freePages.pop_back();
                 }
                 else
                 {
-                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit - m_currentPosition);
-                    return nullptr;
+                    page = CreatePage(m_pageSize);
+                }
+
+                if (page)
+                {
+                    m_framePages[m_currentFrame].push_back(page);
+                    m_currentPage = page;
+                    m_currentPosition = 0;
+                }
+                else if (pageSpace >= size)
+                {
+                    // The pool can't grow, use what is left of the current page
+                    blockSize = pageSpace;
+                }
+                else
+                {
+                    return false;
                 }
             }
-            else
+
+            threadBlock.m_page = m_currentPage;
+            threadBlock.m_position = m_currentPosition;
+            threadBlock.m_endPosition = m_currentPosition + blockSize;
+            m_currentPosition = AZStd::min(RHI::AlignUp(threadBlock.m_endPosition, RHI::Alignment::Constant), m_currentPage->m_size);
+            m_frameBlockBytes += blockSize;
+            return true;
+        }
+
+        DynamicBufferAllocator::ConsumerStatistics& DynamicBufferAllocator::GetConsumerStatistics(ThreadBlock& threadBlock, const Name& consumer)
+        {
+            for (ConsumerStatistics& consumerStatistics : threadBlock.m_consumers)
             {
-                if (m_ringBufferSize - m_currentPosition >= size)
+                if (consumerStatistics.m_consumer == consumer)
                 {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                    if (m_ringBufferSize == m_currentPosition)
-                    {
-                        m_currentPosition = 0;
-                    }
+                    return consumerStatistics;
                 }
-                else
+            }
+            ConsumerStatistics& consumerStatistics = threadBlock.m_consumers.emplace_back();
+            consumerStatistics.m_consumer = consumer;
+            return consumerStatistics;
+        }
+
+        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, uint32_t alignment, const Name& consumer)
+        {
+            //The pages can't be mapped for Null back end
+            if (m_pageSize == 0)
+            {
+                return nullptr;
+            }
+
+            size = RHI::AlignUp(size, alignment);
+
+            // The block and the statistics of this thread are only used by this thread until FrameEnd, so no lock is needed
+            ThreadBlock& threadBlock = m_threadBlocks.GetStorage();
+            if (threadBlock.m_frameIndex != m_frameIndex)
+            {
+                threadBlock.m_frameIndex = m_frameIndex;
+                threadBlock.m_page = nullptr;
+                threadBlock.m_position = 0;
+                threadBlock.m_endPosition = 0;
+            }
+
+            ConsumerStatistics& consumerStatistics = GetConsumerStatistics(threadBlock, consumer);
+
+            uint32_t allocatePosition = RHI::AlignUp(threadBlock.m_position, alignment);
+            if (!threadBlock.m_page || allocatePosition > threadBlock.m_endPosition || threadBlock.m_endPosition - allocatePosition < size)
+            {
+                // The blocks are aligned to RHI::Alignment::Constant, only larger alignments need extra space
+                const uint32_t alignmentPadding = alignment > RHI::Alignment::Constant ? alignment : 0;
+                if (!AcquireBlock(threadBlock, size + alignmentPadding))
                 {
-                    if (m_endPositionLimit >= size)
-                    {
-                        allocatePosition = 0;
-                        m_currentPosition = size;
-                    }
-                    else
-                    {
-                        AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit);
-                        return nullptr;
-                    }
+                    ++consumerStatistics.m_failedAllocationCount;
+                    AZ_WarningOnce("RPI", !m_enableAllocationWarning,
+                        "DynamicBufferAllocator::Allocate: failed to allocate %u bytes, the pool reached its maximum size (%llu bytes)",
+                        size, static_cast<unsigned long long>(m_maxPoolSize));
+                    return nullptr;
                 }
+                allocatePosition = RHI::AlignUp(threadBlock.m_position, alignment);
             }
 
-            m_currentAllocatedSize += size;
+            threadBlock.m_position = allocatePosition + size;
+            ++consumerStatistics.m_allocationCount;
+            consumerStatistics.m_allocatedBytes += size;
 
             RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
-            allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
+            allocatedBuffer->m_address = threadBlock.m_page->m_address + allocatePosition;
             allocatedBuffer->m_size = size;
             allocatedBuffer->m_allocator = this;
+            allocatedBuffer->m_pageBuffer = threadBlock.m_page->m_buffer.get();
+            allocatedBuffer->m_pageOffset = allocatePosition;
             return allocatedBuffer;
         }
 
         RHI::IndexBufferView DynamicBufferAllocator::GetIndexBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, RHI::IndexFormat format)
         {
             return RHI::IndexBufferView(
-                *m_ringBuffer->GetRHIBuffer(),
+                *dynamicBuffer->m_pageBuffer->GetRHIBuffer(),
                 GetBufferAddressOffset(dynamicBuffer),
                 dynamicBuffer->m_size,
                 format
@@ -142,7 +258,7 @@ namespace AZ
         RHI::StreamBufferView DynamicBufferAllocator::GetStreamBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, uint32_t strideByteCount)
         {
             return RHI::StreamBufferView(
-                *m_ringBuffer->GetRHIBuffer(),
+                *dynamicBuffer->m_pageBuffer->GetRHIBuffer(),
                 GetBufferAddressOffset(dynamicBuffer),
                 dynamicBuffer->m_size,
                 strideByteCount
@@ -151,7 +267,7 @@ namespace AZ
 
         uint32_t DynamicBufferAllocator::GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer)
         {
-            return aznumeric_cast<uint32_t>((uint8_t*)dynamicBuffer->m_address - (uint8_t*)m_ringBufferStartAddress);
+            return dynamicBuffer->m_pageOffset;
         }
 
         void DynamicBufferAllocator::SetEnableAllocationWarning(bool enable)
@@ -159,20 +275,100 @@ namespace AZ
             m_enableAllocationWarning = enable;
         }
 
+        const DynamicBufferAllocator::Statistics& DynamicBufferAllocator::GetStatistics() const
+        {
+            return m_statistics;
+        }
+
+        void DynamicBufferAllocator::ResetHighWaterMarks()
+        {
+            m_statistics.m_highWaterBytes = 0;
+            for (ConsumerStatistics& consumerStatistics : m_statistics.m_consumers)
+            {
+                consumerStatistics.m_highWaterBytes = 0;
+            }
+        }
+
         void DynamicBufferAllocator::FrameEnd()
         {
-            uint32_t nextFrame = (m_currentFrame + 1) % AZ::RHI::Limits::Device::FrameCountMax;
+            // Gather the allocations of the frame from all the threads. The consumers stay in the statistics once they
+            // allocated, so their high water marks are kept.
+            m_statistics.m_allocationCount = 0;
+            m_statistics.m_failedAllocationCount = 0;
+            m_statistics.m_allocatedBytes = 0;
+            for (ConsumerStatistics& consumerStatistics : m_statistics.m_consumers)
+            {
+                consumerStatistics.m_allocationCount = 0;
+                consumerStatistics.m_failedAllocationCount = 0;
+                consumerStatistics.m_allocatedBytes = 0;
+            }
 
-            // The saved frame start position will become available since it's old than FrameCountMax. The saved start position of next frame is the new limit
-            m_endPositionLimit = m_frameStartPositions[nextFrame];
+            m_threadBlocks.ForEach([this](ThreadBlock& threadBlock)
+            {
+                for (ConsumerStatistics& threadStatistics : threadBlock.m_consumers)
+                {
+                    ConsumerStatistics* consumerStatistics = nullptr;
+                    for (ConsumerStatistics& frameStatistics : m_statistics.m_consumers)
+                    {
+                        if (frameStatistics.m_consumer == threadStatistics.m_consumer)
+                        {
+                            consumerStatistics = &frameStatistics;
+                            break;
+                        }
+                    }
+                    if (!consumerStatistics)
+                    {
+                        consumerStatistics = &m_statistics.m_consumers.emplace_back();
+                        consumerStatistics->m_consumer = threadStatistics.m_consumer;
+                    }
 
-            // Save start position for current frame
-            m_frameStartPositions[m_currentFrame] = m_currentPosition;
+                    consumerStatistics->m_allocationCount += threadStatistics.m_allocationCount;
+                    consumerStatistics->m_failedAllocationCount += threadStatistics.m_failedAllocationCount;
+                    consumerStatistics->m_allocatedBytes += threadStatistics.m_allocatedBytes;
 
-            m_currentFrame = nextFrame;
+                    threadStatistics.m_allocationCount = 0;
+                    threadStatistics.m_failedAllocationCount = 0;
+                    threadStatistics.m_allocatedBytes = 0;
+                }
+            });
+
+            for (ConsumerStatistics& consumerStatistics : m_statistics.m_consumers)
+            {
+                consumerStatistics.m_highWaterBytes = AZStd::max(consumerStatistics.m_highWaterBytes, consumerStatistics.m_allocatedBytes);
+                m_statistics.m_allocationCount += consumerStatistics.m_allocationCount;
+                m_statistics.m_failedAllocationCount += consumerStatistics.m_failedAllocationCount;
+                m_statistics.m_allocatedBytes += consumerStatistics.m_allocatedBytes;
 
-            m_currentAllocatedSize = 0;
+            }
+            m_statistics.m_highWaterBytes = AZStd::max(m_statistics.m_highWaterBytes, m_statistics.m_allocatedBytes);
+            m_statistics.m_blockBytes = m_frameBlockBytes;
+            m_frameBlockBytes = 0;
+
+            // The pages used FrameCountMax - 1 frames ago are no longer used by GPU. Pages of the regular size are reused
+            // by the next frames, larger pages are released.
+            uint32_t nextFrame = (m_currentFrame + 1) % AZ::RHI::Limits::Device::FrameCountMax;
+            for (Page* page : m_framePages[nextFrame])
+            {
+                if (page->m_size == m_pageSize)
+                {
+                    m_freePages.push_back(page);
+                }
+                else
+                {
+                    ReleasePage(page);
+                }
+            }
+            m_framePages[nextFrame].clear();
+
+            // The next frame starts a new page, so that each page is only used by one frame. Blocks of the threads from
+            // this frame are dropped on their next allocation.
+            m_currentPage = nullptr;
+            m_currentPosition = 0;
+            m_currentFrame = nextFrame;
+            ++m_frameIndex;
 
+            m_statistics.m_pageCount = aznumeric_cast<uint32_t>(m_pages.size());
+            m_statistics.m_reservedBytes = m_reservedSize;
         }
     }
 }
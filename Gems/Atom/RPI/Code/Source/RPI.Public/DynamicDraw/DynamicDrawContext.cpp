@@ -163,6 +163,12 @@ namespace AZ
             m_drawListTag = drawListTag;
         }
 
+        void DynamicDrawContext::InitBufferConsumer(const Name& consumer)
+        {
+            AZ_Assert(!m_initialized, "Can't call InitBufferConsumer after context was initialized (EndInit was called)");
+            m_bufferConsumer = consumer;
+        }
+
         void DynamicDrawContext::CustomizePipelineState(AZStd::function<void(Ptr<PipelineStateForDraw>)> updatePipelineState)
         {
             AZ_Assert(!m_initialized, "Can't call CustomizePipelineState after context was initialized (EndInit was called)");
@@ -477,10 +483,10 @@ namespace AZ
             // Get dynamic buffers for vertex and index buffer. Skip draw if failed to allocate buffers
             uint32_t vertexDataSize = vertexCount * m_perVertexDataSize;
             RHI::Ptr<DynamicBuffer> vertexBuffer;
-            vertexBuffer = DynamicDrawInterface::Get()->GetDynamicBuffer(vertexDataSize, RHI::Alignment::InputAssembly);
+            vertexBuffer = DynamicDrawInterface::Get()->GetDynamicBuffer(vertexDataSize, RHI::Alignment::InputAssembly, m_bufferConsumer);
 
             uint32_t indexDataSize = indexCount * RHI::GetIndexFormatSize(indexFormat);
-            RHI::Ptr<DynamicBuffer> indexBuffer = DynamicDrawInterface::Get()->GetDynamicBuffer(indexDataSize, RHI::Alignment::InputAssembly);
+            RHI::Ptr<DynamicBuffer> indexBuffer = DynamicDrawInterface::Get()->GetDynamicBuffer(indexDataSize, RHI::Alignment::InputAssembly, m_bufferConsumer);
 
             if (indexBuffer == nullptr || vertexBuffer == nullptr)
             {
@@ -574,7 +580,7 @@ namespace AZ
             // Get dynamic buffers for vertex and index buffer. Skip draw if failed to allocate buffers
             uint32_t vertexDataSize = vertexCount * m_perVertexDataSize;
             RHI::Ptr<DynamicBuffer> vertexBuffer;
-            vertexBuffer = DynamicDrawInterface::Get()->GetDynamicBuffer(vertexDataSize, RHI::Alignment::InputAssembly);
+            vertexBuffer = DynamicDrawInterface::Get()->GetDynamicBuffer(vertexDataSize, RHI::Alignment::InputAssembly, m_bufferConsumer);
 
             if (vertexBuffer == nullptr)
             {
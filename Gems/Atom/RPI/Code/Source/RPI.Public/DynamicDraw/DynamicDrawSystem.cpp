@@ -31,7 +31,7 @@ namespace AZ
             m_bufferAlloc = AZStd::make_unique<DynamicBufferAllocator>();
             if (m_bufferAlloc)
             {
-                m_bufferAlloc->Init(descriptor.m_dynamicBufferPoolSize);
+                m_bufferAlloc->Init(descriptor.m_dynamicBufferPoolSize, descriptor.m_dynamicBufferMaxPoolSize);
                 Interface<DynamicDrawInterface>::Register(this);
             }
         }
@@ -47,10 +47,42 @@ namespace AZ
             m_dynamicDrawContexts.clear();
         }
 
-        RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicBuffer(uint32_t size, uint32_t alignment)
+        RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicBuffer(uint32_t size, uint32_t alignment, const Name& consumer)
+        {
+            return m_bufferAlloc->Allocate(size, alignment, consumer);
+        }
+
+        DynamicBufferAllocator::Statistics DynamicDrawSystem::GetDynamicBufferStatistics() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
+            return m_bufferAlloc->GetStatistics();
+        }
+
+        void DynamicDrawSystem::DumpDynamicBufferStatistics(const AZ::ConsoleCommandContainer& arguments)
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
-            return m_bufferAlloc->Allocate(size, alignment);
+            if (!m_bufferAlloc)
+            {
+                return;
+            }
+
+            const DynamicBufferAllocator::Statistics& statistics = m_bufferAlloc->GetStatistics();
+            AZ_Printf("DynamicDrawSystem", "Dynamic buffer pool: %u pages, %llu bytes reserved, %llu bytes in blocks\n",
+                statistics.m_pageCount, statistics.m_reservedBytes, statistics.m_blockBytes);
+            AZ_Printf("DynamicDrawSystem", "Total: %u allocations (%u failed), %llu bytes allocated, %llu bytes high water mark\n",
+                statistics.m_allocationCount, statistics.m_failedAllocationCount, statistics.m_allocatedBytes, statistics.m_highWaterBytes);
+            for (const DynamicBufferAllocator::ConsumerStatistics& consumerStatistics : statistics.m_consumers)
+            {
+                AZ_Printf("DynamicDrawSystem", "  %s: %u allocations (%u failed), %llu bytes allocated, %llu bytes high water mark\n",
+                    consumerStatistics.m_consumer.IsEmpty() ? "Unnamed" : consumerStatistics.m_consumer.GetCStr(),
+                    consumerStatistics.m_allocationCount, consumerStatistics.m_failedAllocationCount,
+                    consumerStatistics.m_allocatedBytes, consumerStatistics.m_highWaterBytes);
+            }
+
+            if (!arguments.empty() && arguments.front() == "reset")
+            {
+                m_bufferAlloc->ResetHighWaterMarks();
+            }
         }
 
         RHI::Ptr<DynamicDrawContext> DynamicDrawSystem::CreateDynamicDrawContext()
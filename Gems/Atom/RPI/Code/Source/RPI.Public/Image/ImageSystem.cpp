@@ -12,6 +12,7 @@
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
+#include <Atom/RPI.Public/Image/TexelDensityStreamingImageController.h>
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Reflect/Image/AttachmentImageAssetCreator.h>
@@ -52,6 +53,7 @@ namespace AZ
             StreamingImagePoolAsset::Reflect(context);
             StreamingImageControllerAsset::Reflect(context);
             DefaultStreamingImageControllerAsset::Reflect(context);
+            TexelDensityStreamingImageControllerAsset::Reflect(context);
             AttachmentImageAsset::Reflect(context);
         }
 
@@ -131,7 +133,14 @@ namespace AZ
             // Register streaming image controller instance database.
             {
                 Data::InstanceHandler<StreamingImageController> handler;
-                handler.m_createFunction = DefaultStreamingImageController::CreateInternal;
+                handler.m_createFunction = [](Data::AssetData* controllerAsset) -> Data::Instance<StreamingImageController>
+                {
+                    if (azrtti_istypeof<TexelDensityStreamingImageControllerAsset>(controllerAsset))
+                    {
+                        return TexelDensityStreamingImageController::CreateInternal(controllerAsset);
+                    }
+                    return DefaultStreamingImageController::CreateInternal(controllerAsset);
+                };
                 Data::InstanceDatabase<StreamingImageController>::Create(azrtti_typeid<StreamingImageControllerAsset>(), handler);
             }
 
@@ -314,7 +323,20 @@ namespace AZ
                 StreamingImagePoolAssetCreator poolAssetCreator;
                 poolAssetCreator.Begin(assetStreamingPoolDescriptor.m_assetId);
                 poolAssetCreator.SetPoolDescriptor(AZStd::move(imagePoolDescriptor));
-                poolAssetCreator.SetControllerAsset(m_defaultStreamingImageControllerAsset);
+                if (desc.m_useTexelDensityStreaming)
+                {
+                    TexelDensityStreamingSettings settings = desc.m_texelDensityStreamingSettings;
+                    if (settings.m_memoryBudgetInBytes == 0)
+                    {
+                        settings.m_memoryBudgetInBytes = assetStreamingPoolDescriptor.m_budgetInBytes;
+                    }
+                    poolAssetCreator.SetControllerAsset(Data::Asset<TexelDensityStreamingImageControllerAsset>(
+                        aznew TexelDensityStreamingImageControllerAsset(settings), AZ::Data::AssetLoadBehavior::PreLoad));
+                }
+                else
+                {
+                    poolAssetCreator.SetControllerAsset(m_defaultStreamingImageControllerAsset);
+                }
                 poolAssetCreator.SetPoolName(assetStreamingPoolDescriptor.m_name);
                 [[maybe_unused]] const bool created = poolAssetCreator.End(poolAsset);
                 AZ_Assert(created, "Failed to build streaming image pool for assets");
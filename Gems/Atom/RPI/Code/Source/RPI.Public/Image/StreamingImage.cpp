@@ -10,6 +10,7 @@
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/Image/StreamingImageController.h>
+#include <Atom/RPI.Public/Image/TexelDensityStreamingImageController.h>
 
 #include <Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h>
@@ -247,6 +248,18 @@ namespace AZ
                 m_streamingController->OnSetTargetMip(this, targetMipLevel);
             }
         }
+
+        void StreamingImage::SetTargetTexelDensity(float screenPixelsPerUv)
+        {
+            if (m_streamingController)
+            {
+                const RHI::ImageDescriptor& descriptor = m_imageAsset->GetImageDescriptor();
+                const float mipLevel = TexelDensityMipSelector::GetMipLevelForTexelDensity(
+                    AZStd::max(descriptor.m_size.m_width, descriptor.m_size.m_height), screenPixelsPerUv);
+                m_streamingController->OnSetFractionalTargetMip(
+                    this, AZStd::min(mipLevel, static_cast<float>(descriptor.m_mipLevels - 1)));
+            }
+        }
         
         uint16_t StreamingImage::GetResidentMipLevel()
         {
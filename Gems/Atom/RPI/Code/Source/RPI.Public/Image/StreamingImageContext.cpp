@@ -22,6 +22,11 @@ namespace AZ
             return m_mipLevelTarget;
         }
 
+        float StreamingImageContext::GetFractionalTargetMip() const
+        {
+            return m_fractionalMipLevelTarget;
+        }
+
         size_t StreamingImageContext::GetLastAccessTimestamp() const
         {
             return m_lastAccessTimestamp;
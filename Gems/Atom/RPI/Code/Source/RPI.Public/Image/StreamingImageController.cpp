@@ -112,6 +112,7 @@ namespace AZ
             {
                 context->m_queuedForMipTargetReset = false;
                 context->m_mipLevelTarget = RHI::Limits::Image::MipCountMax;
+                context->m_fractionalMipLevelTarget = static_cast<float>(RHI::Limits::Image::MipCountMax);
             }
             m_mipTargetResetQueue.clear();
             m_mipTargetResetMutex.unlock();
@@ -125,14 +126,24 @@ namespace AZ
         }
 
         void StreamingImageController::OnSetTargetMip(StreamingImage* image, uint16_t mipLevelTarget)
+        {
+            OnSetFractionalTargetMip(image, static_cast<float>(mipLevelTarget));
+        }
+
+        void StreamingImageController::OnSetFractionalTargetMip(StreamingImage* image, float fractionalMipLevelTarget)
         {
             StreamingImageContext* context = image->m_streamingContext.get();
 
             // Atomic min operation on target mip level. OnSetTargetMip can be called many times per frame and
             // we want to keep the minimum (most detailed) mip level.
+            const uint16_t mipLevelTarget = static_cast<uint16_t>(fractionalMipLevelTarget);
             uint16_t mipLevelPrev = context->m_mipLevelTarget;
             while (mipLevelPrev > mipLevelTarget && !context->m_mipLevelTarget.compare_exchange_weak(mipLevelPrev, mipLevelTarget));
 
+            float fractionalMipLevelPrev = context->m_fractionalMipLevelTarget;
+            while (fractionalMipLevelPrev > fractionalMipLevelTarget &&
+                !context->m_fractionalMipLevelTarget.compare_exchange_weak(fractionalMipLevelPrev, fractionalMipLevelTarget));
+
             context->m_lastAccessTimestamp = m_timestamp;
 
             // Any time a lower mip value is requested, we need to make sure that image is queued for a reset between frames
@@ -173,6 +184,11 @@ namespace AZ
             image->TrimToMipChainLevel(mipChainIndex);
         }
 
+        const StreamingImageAsset& StreamingImageController::GetImageAsset(const StreamingImage* image) const
+        {
+            return *image->m_imageAsset;
+        }
+
         StreamingImageContextPtr StreamingImageController::CreateContextInternal()
         {
             return aznew StreamingImageContext();
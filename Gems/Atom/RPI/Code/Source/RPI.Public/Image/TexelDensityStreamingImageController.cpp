@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/TexelDensityStreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
+#include <AtomCore/Instance/InstanceDatabase.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            // Returns the least detailed mip chain whose most detailed mip is at least as detailed as the mip level.
+            uint16_t GetMipChainForMipLevel(const TexelDensityMipSelector::ImageState& imageState, float mipLevel)
+            {
+                uint16_t mipChainIndex = 0;
+                while (mipChainIndex + 1u < imageState.m_mipChains.size() && imageState.m_mipChains[mipChainIndex + 1].m_mipLevel <= mipLevel)
+                {
+                    ++mipChainIndex;
+                }
+                return mipChainIndex;
+            }
+
+            AZ::u64 GetResidentByteCount(const TexelDensityMipSelector::ImageState& imageState)
+            {
+                AZ::u64 byteCount = 0;
+                for (size_t mipChainIndex = imageState.m_targetMipChain; mipChainIndex < imageState.m_mipChains.size(); ++mipChainIndex)
+                {
+                    byteCount += imageState.m_mipChains[mipChainIndex].m_byteCount;
+                }
+                return byteCount;
+            }
+
+            // Trims the most detailed target mip chain and returns its size.
+            AZ::u64 TrimMipChain(TexelDensityMipSelector::ImageState& imageState, TexelDensityMipSelector::Statistics& statistics)
+            {
+                const AZ::u64 byteCount = imageState.m_mipChains[imageState.m_targetMipChain].m_byteCount;
+                ++imageState.m_targetMipChain;
+                statistics.m_trimmedBytes += byteCount;
+                ++statistics.m_trimmedMipChainCount;
+                return byteCount;
+            }
+        } // namespace
+
+        float TexelDensityMipSelector::GetMipLevelForTexelDensity(uint32_t texelsPerUv, float screenPixelsPerUv)
+        {
+            if (screenPixelsPerUv <= 0.0f)
+            {
+                return NoRequest;
+            }
+
+            return AZStd::clamp(log2f(static_cast<float>(texelsPerUv) / screenPixelsPerUv), 0.0f, NoRequest);
+        }
+
+        float TexelDensityMipSelector::EstimateScreenPixelsPerUv(float objectScreenSize, float uvDensity)
+        {
+            return objectScreenSize * uvDensity;
+        }
+
+        TexelDensityMipSelector::TexelDensityMipSelector(const TexelDensityStreamingSettings& settings)
+            : m_settings(settings)
+        {
+        }
+
+        const TexelDensityStreamingSettings& TexelDensityMipSelector::GetSettings() const
+        {
+            return m_settings;
+        }
+
+        TexelDensityMipSelector::Statistics TexelDensityMipSelector::Update(AZStd::span<ImageState* const> images)
+        {
+            Statistics statistics;
+
+            struct ExpandCandidate
+            {
+                uint32_t m_imageIndex = 0;
+                uint16_t m_desiredMipChain = 0;
+
+                // How many mip levels less detailed than requested the image is
+                float m_need = 0.0f;
+            };
+
+            AZStd::vector<float> requestedMips(images.size(), NoRequest);
+            AZStd::vector<ExpandCandidate> expandCandidates;
+            AZ::u64 residentByteCount = 0;
+
+            for (uint32_t imageIndex = 0; imageIndex < images.size(); ++imageIndex)
+            {
+                ImageState& imageState = *images[imageIndex];
+                if (imageState.m_mipChains.empty())
+                {
+                    continue;
+                }
+
+                const uint16_t tailMipChain = static_cast<uint16_t>(imageState.m_mipChains.size() - 1);
+                imageState.m_targetMipChain = AZStd::min(imageState.m_targetMipChain, tailMipChain);
+
+                if (imageState.m_requestedMip == NoRequest)
+                {
+                    // Without a request there is nothing to tell how detailed the image should be, e.g. it's off screen, so
+                    // it keeps its resident mips. Images that were never requested, e.g. because nothing reports the texel
+                    // density of their surfaces, stream in all their mips like with the DefaultStreamingImageController,
+                    // but only after the requested images and into the room left in the budget. Either way their mips
+                    // are the first ones trimmed when the budget needs room.
+                    imageState.m_trimRequestCount = 0;
+                    if (!imageState.m_wasRequested && imageState.m_targetMipChain > 0)
+                    {
+                        expandCandidates.push_back({ imageIndex, 0, 0.0f });
+                    }
+                    residentByteCount += GetResidentByteCount(imageState);
+                    continue;
+                }
+
+                imageState.m_wasRequested = true;
+                const float requestedMip = AZStd::clamp(imageState.m_requestedMip + m_settings.m_mipBias, 0.0f, NoRequest);
+                requestedMips[imageIndex] = requestedMip;
+                imageState.m_requestedMip = NoRequest;
+
+                const uint16_t desiredMipChain = GetMipChainForMipLevel(imageState, requestedMip);
+                if (desiredMipChain < imageState.m_targetMipChain)
+                {
+                    const float need = imageState.m_mipChains[imageState.m_targetMipChain].m_mipLevel - requestedMip;
+                    expandCandidates.push_back({ imageIndex, desiredMipChain, need });
+                    imageState.m_trimRequestCount = 0;
+                }
+                else
+                {
+                    // Only trim the mips that are more detailed than requested by more than the hysteresis, once the request stayed
+                    // that way for the trim delay, so that small camera motions don't stream the same mips in and out.
+                    const uint16_t trimMipChain = GetMipChainForMipLevel(imageState, requestedMip - m_settings.m_trimHysteresis);
+                    if (trimMipChain > imageState.m_targetMipChain && ++imageState.m_trimRequestCount >= m_settings.m_trimDelay)
+                    {
+                        while (imageState.m_targetMipChain < trimMipChain)
+                        {
+                            TrimMipChain(imageState, statistics);
+                        }
+                        imageState.m_trimRequestCount = 0;
+                    }
+                    else if (trimMipChain <= imageState.m_targetMipChain)
+                    {
+                        imageState.m_trimRequestCount = 0;
+                    }
+                }
+
+                residentByteCount += GetResidentByteCount(imageState);
+            }
+
+            // The mip chains that can be trimmed to fit in the budget, in a heap with the cheapest trim on top. The cost of a
+            // trim is how many mip levels less detailed than requested the image becomes, so mips of unused images and mips
+            // more detailed than requested are trimmed first. Entries of images whose target changed since are skipped.
+            struct TrimCandidate
+            {
+                float m_cost = 0.0f;
+                uint32_t m_imageIndex = 0;
+                uint16_t m_targetMipChain = 0;
+            };
+
+            const AZ::u64 budget = m_settings.m_memoryBudgetInBytes;
+            AZStd::vector<TrimCandidate> trimCandidates;
+            auto trimCandidateCompare = [](const TrimCandidate& lhs, const TrimCandidate& rhs)
+            {
+                return lhs.m_cost > rhs.m_cost;
+            };
+
+            auto pushTrimCandidate = [&](uint32_t imageIndex)
+            {
+                const ImageState& imageState = *images[imageIndex];
+                if (imageState.m_targetMipChain + 1u < imageState.m_mipChains.size())
+                {
+                    const float trimmedMipLevel = imageState.m_mipChains[imageState.m_targetMipChain + 1].m_mipLevel;
+                    trimCandidates.push_back({ AZStd::max(0.0f, trimmedMipLevel - requestedMips[imageIndex]), imageIndex, imageState.m_targetMipChain });
+                    AZStd::push_heap(trimCandidates.begin(), trimCandidates.end(), trimCandidateCompare);
+                }
+            };
+
+            // Trims the cheapest mip chain if its cost is below the maximum, returns false if there is none.
+            auto trimCheapestMipChain = [&](float maxCost)
+            {
+                while (!trimCandidates.empty())
+                {
+                    const TrimCandidate trimCandidate = trimCandidates.front();
+                    ImageState& imageState = *images[trimCandidate.m_imageIndex];
+                    const bool isStale = trimCandidate.m_targetMipChain != imageState.m_targetMipChain;
+                    if (!isStale && trimCandidate.m_cost >= maxCost)
+                    {
+                        return false;
+                    }
+
+                    AZStd::pop_heap(trimCandidates.begin(), trimCandidates.end(), trimCandidateCompare);
+                    trimCandidates.pop_back();
+                    if (!isStale)
+                    {
+                        residentByteCount -= TrimMipChain(imageState, statistics);
+                        pushTrimCandidate(trimCandidate.m_imageIndex);
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            if (budget != 0)
+            {
+                for (uint32_t imageIndex = 0; imageIndex < images.size(); ++imageIndex)
+                {
+                    pushTrimCandidate(imageIndex);
+                }
+
+                // The budget is strict, so the resident mips are trimmed without hysteresis if they don't fit, e.g. after the
+                // budget was lowered.
+                while (residentByteCount > budget && trimCheapestMipChain(AZStd::numeric_limits<float>::max()))
+                {
+                }
+            }
+
+            // Expand the images that need it the most first, one mip chain at a time so that the budget is shared between them
+            AZStd::sort(expandCandidates.begin(), expandCandidates.end(), [](const ExpandCandidate& lhs, const ExpandCandidate& rhs)
+            {
+                return lhs.m_need > rhs.m_need;
+            });
+
+            for (const ExpandCandidate& expandCandidate : expandCandidates)
+            {
+                ImageState& imageState = *images[expandCandidate.m_imageIndex];
+                const float requestedMip = requestedMips[expandCandidate.m_imageIndex];
+                while (imageState.m_targetMipChain > expandCandidate.m_desiredMipChain &&
+                    statistics.m_expandedMipChainCount < m_settings.m_maxExpandsPerUpdate)
+                {
+                    const AZ::u64 byteCount = imageState.m_mipChains[imageState.m_targetMipChain - 1].m_byteCount;
+                    if (budget != 0)
+                    {
+                        // Make room by trimming mips that are needed less than this one, by more than the hysteresis
+                        const float need = imageState.m_mipChains[imageState.m_targetMipChain].m_mipLevel - requestedMip;
+                        while (residentByteCount + byteCount > budget && trimCheapestMipChain(need - m_settings.m_trimHysteresis))
+                        {
+                        }
+
+                        if (residentByteCount + byteCount > budget)
+                        {
+                            break;
+                        }
+                    }
+
+                    --imageState.m_targetMipChain;
+                    residentByteCount += byteCount;
+                    statistics.m_expandedBytes += byteCount;
+                    ++statistics.m_expandedMipChainCount;
+
+                    if (budget != 0)
+                    {
+                        pushTrimCandidate(expandCandidate.m_imageIndex);
+                    }
+                }
+
+                if (imageState.m_targetMipChain > expandCandidate.m_desiredMipChain && requestedMip != NoRequest)
+                {
+                    ++statistics.m_deferredImageCount;
+                }
+            }
+
+            statistics.m_residentBytes = residentByteCount;
+            return statistics;
+        }
+
+        Data::Instance<TexelDensityStreamingImageController> TexelDensityStreamingImageController::FindOrCreate(
+            const Data::Asset<TexelDensityStreamingImageControllerAsset>& asset)
+        {
+            return azrtti_cast<TexelDensityStreamingImageController*>(
+                Data::InstanceDatabase<StreamingImageController>::Instance().FindOrCreate(
+                    Data::InstanceId::CreateFromAssetId(asset.GetId()),
+                    asset));
+        }
+
+        Data::Instance<TexelDensityStreamingImageController> TexelDensityStreamingImageController::CreateInternal(Data::AssetData* assetData)
+        {
+            TexelDensityStreamingImageControllerAsset* specificAsset = azrtti_cast<TexelDensityStreamingImageControllerAsset*>(assetData);
+            if (!specificAsset)
+            {
+                AZ_Error("TexelDensityStreamingImageController", false, "TexelDensityStreamingImageController instance requires a TexelDensityStreamingImageControllerAsset.");
+                return nullptr;
+            }
+
+            Data::Instance<TexelDensityStreamingImageController> instance = aznew TexelDensityStreamingImageController();
+
+            const RHI::ResultCode resultCode = instance->Init(*specificAsset);
+            if (resultCode == RHI::ResultCode::Success)
+            {
+                return instance;
+            }
+
+            return nullptr;
+        }
+
+        RHI::ResultCode TexelDensityStreamingImageController::Init(TexelDensityStreamingImageControllerAsset& imageControllerAsset)
+        {
+            m_mipSelector = TexelDensityMipSelector(imageControllerAsset.GetSettings());
+            return RHI::ResultCode::Success;
+        }
+
+        const TexelDensityMipSelector::Statistics& TexelDensityStreamingImageController::GetStatistics() const
+        {
+            return m_statistics;
+        }
+
+        StreamingImageContextPtr TexelDensityStreamingImageController::CreateContextInternal()
+        {
+            AZStd::intrusive_ptr<Context> context = aznew Context();
+            m_attachedContexts.emplace_back(context);
+            return context;
+        }
+
+        void TexelDensityStreamingImageController::InitImageState(StreamingImage& image, TexelDensityMipSelector::ImageState& imageState) const
+        {
+            const StreamingImageAsset& imageAsset = GetImageAsset(&image);
+            const RHI::ImageDescriptor& imageDescriptor = imageAsset.GetImageDescriptor();
+
+            imageState.m_mipChains.clear();
+            for (size_t mipChainIndex = 0; mipChainIndex < imageAsset.GetMipChainCount(); ++mipChainIndex)
+            {
+                TexelDensityMipSelector::MipChain& mipChain = imageState.m_mipChains.emplace_back();
+                mipChain.m_mipLevel = static_cast<uint16_t>(imageAsset.GetMipLevel(mipChainIndex));
+
+                const uint32_t mipLevelEnd = static_cast<uint32_t>(mipChain.m_mipLevel + imageAsset.GetMipCount(mipChainIndex));
+                for (uint32_t mipLevel = mipChain.m_mipLevel; mipLevel < mipLevelEnd; ++mipLevel)
+                {
+                    const RHI::ImageSubresourceLayout layout =
+                        RHI::GetImageSubresourceLayout(imageDescriptor.m_size.GetReducedMip(mipLevel), imageDescriptor.m_format);
+                    mipChain.m_byteCount += AZ::u64(layout.m_bytesPerImage) * layout.m_size.m_depth * imageDescriptor.m_arraySize;
+                }
+            }
+
+            imageState.m_targetMipChain = static_cast<uint16_t>(imageAsset.GetMipChainIndex(image.GetResidentMipLevel()));
+        }
+
+        void TexelDensityStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
+        {
+            AZ_UNUSED(timestamp);
+            AZ_UNUSED(contexts);
+
+            // Drop the contexts of detached images
+            AZStd::erase_if(m_attachedContexts, [](const AZStd::intrusive_ptr<Context>& context)
+            {
+                return context->TryGetImage() == nullptr;
+            });
+
+            m_imageStates.clear();
+            m_previousTargetMipChains.clear();
+            for (const AZStd::intrusive_ptr<Context>& context : m_attachedContexts)
+            {
+                TexelDensityMipSelector::ImageState& imageState = context->m_imageState;
+                if (!context->m_isImageStateInitialized)
+                {
+                    InitImageState(*context->TryGetImage(), imageState);
+                    context->m_isImageStateInitialized = true;
+                }
+
+                // The requests are reset by the base controller after this update
+                imageState.m_requestedMip = context->GetFractionalTargetMip();
+                m_imageStates.push_back(&imageState);
+                m_previousTargetMipChains.push_back(imageState.m_targetMipChain);
+            }
+
+            m_statistics = m_mipSelector.Update(m_imageStates);
+
+            for (size_t contextIndex = 0; contextIndex < m_attachedContexts.size(); ++contextIndex)
+            {
+                StreamingImage* image = m_attachedContexts[contextIndex]->TryGetImage();
+                const uint16_t targetMipChain = m_imageStates[contextIndex]->m_targetMipChain;
+                const uint16_t previousTargetMipChain = m_previousTargetMipChains[contextIndex];
+                if (targetMipChain < previousTargetMipChain)
+                {
+                    QueueExpandToMipChainLevel(image, targetMipChain);
+                }
+                else if (targetMipChain > previousTargetMipChain)
+                {
+                    TrimToMipChainLevel(image, targetMipChain);
+                }
+            }
+        }
+    }
+}
@@ -13,7 +13,9 @@
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/Path/Path.h>
 
 #include <AzCore/Component/TickBus.h>
 
@@ -23,6 +25,9 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_PrewarmPipelineStates, true, nullptr, ConsoleFunctorFlags::Null,
+            "Compile the pipeline states recorded by previous sessions when a shader is loaded, instead of on first use.");
+
         Data::Instance<Shader> Shader::FindOrCreate(const Data::Asset<ShaderAsset>& shaderAsset, const Name& supervariantName)
         {
             auto anySupervariantName = AZStd::any(supervariantName);
@@ -131,6 +136,51 @@ namespace AZ
             return false;
         }
 
+        //! The pipeline states recorded for prewarming are stored next to the pipeline library. Unlike the pipeline
+        //! library, the records refer to variants, which differ between supervariants, so each supervariant has its own file.
+        static void GetPipelineStateCacheDataPath(
+            char* cacheDataPath, size_t cacheDataPathLength, const char* pipelineLibraryPath, SupervariantIndex supervariantIndex)
+        {
+            if (pipelineLibraryPath[0] == 0)
+            {
+                cacheDataPath[0] = 0;
+                return;
+            }
+
+            IO::FixedMaxPath path(pipelineLibraryPath);
+            path.ReplaceExtension();
+            azsnprintf(cacheDataPath, cacheDataPathLength, "%s_%u.descriptors", path.c_str(), supervariantIndex.GetIndex());
+        }
+
+        //! The shader stage whose function identifies the variant a pipeline state was configured from.
+        static RHI::ShaderStage GetVariantShaderStage(RHI::PipelineStateType pipelineStateType)
+        {
+            switch (pipelineStateType)
+            {
+            case RHI::PipelineStateType::Dispatch:
+                return RHI::ShaderStage::Compute;
+            case RHI::PipelineStateType::RayTracing:
+                return RHI::ShaderStage::RayTracing;
+            default:
+                return RHI::ShaderStage::Vertex;
+            }
+        }
+
+        static const RHI::ShaderStageFunction* GetVariantShaderStageFunction(const RHI::PipelineStateDescriptor& descriptor)
+        {
+            switch (descriptor.GetType())
+            {
+            case RHI::PipelineStateType::Draw:
+                return static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor).m_vertexFunction.get();
+            case RHI::PipelineStateType::Dispatch:
+                return static_cast<const RHI::PipelineStateDescriptorForDispatch&>(descriptor).m_computeFunction.get();
+            case RHI::PipelineStateType::RayTracing:
+                return static_cast<const RHI::PipelineStateDescriptorForRayTracing&>(descriptor).m_rayTracingFunction.get();
+            default:
+                return nullptr;
+            }
+        }
+
         RHI::ResultCode Shader::Init(ShaderAsset& shaderAsset)
         {
             Data::AssetBus::MultiHandler::BusDisconnect();
@@ -143,10 +193,12 @@ namespace AZ
             m_pipelineStateType = shaderAsset.GetPipelineStateType();
 
             GetPipelineLibraryPath(m_pipelineLibraryPath, AZ_MAX_PATH_LEN, *m_asset);
+            GetPipelineStateCacheDataPath(m_pipelineStateCacheDataPath, AZ_MAX_PATH_LEN, m_pipelineLibraryPath, m_supervariantIndex);
 
             {
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
                 m_shaderVariants.clear();
+                m_pendingPrewarmRecords.clear();
             }
             auto rootShaderVariantAsset = shaderAsset.GetRootVariantAsset(m_supervariantIndex);
             m_rootVariant.Init(m_asset, rootShaderVariantAsset, m_supervariantIndex);
@@ -170,6 +222,11 @@ namespace AZ
 
                 m_pipelineLibraryHandle = pipelineLibraryHandle;
                 m_pipelineStateCache = pipelineStateCache;
+
+                if (ConstPtr<PipelineStateCacheData> cacheData = LoadPipelineStateCacheData())
+                {
+                    PrewarmPipelineStates(*cacheData);
+                }
             }
 
             const Name& drawListName = shaderAsset.GetDrawListName();
@@ -197,6 +254,7 @@ namespace AZ
             if (m_pipelineLibraryHandle.IsValid())
             {
                 SavePipelineLibrary();
+                SavePipelineStateCacheData();
 
                 m_pipelineStateCache->ReleaseLibrary(m_pipelineLibraryHandle);
                 m_pipelineStateCache = nullptr;
@@ -288,6 +346,7 @@ namespace AZ
             // we will merge ShaderReloadNotificationBus messages into one. For now, we just indicate the error by passing an empty ShaderVariant,
             // all our call sites don't use this data anyway.
             ShaderVariant updatedVariant;
+            AZStd::vector<PipelineStateCacheRecord> prewarmRecords;
 
             if (isError)
             {
@@ -327,6 +386,18 @@ namespace AZ
                     updatedVariant.Init(m_asset, shaderVariantAsset, m_supervariantIndex);
                     m_shaderVariants.emplace(stableId, updatedVariant);
                 }
+
+                auto pendingIt = m_pendingPrewarmRecords.find(stableId);
+                if (pendingIt != m_pendingPrewarmRecords.end())
+                {
+                    prewarmRecords = AZStd::move(pendingIt->second);
+                    m_pendingPrewarmRecords.erase(pendingIt);
+                }
+            }
+
+            if (!prewarmRecords.empty() && updatedVariant.GetShaderVariantAsset())
+            {
+                PrewarmPipelineStates(updatedVariant, prewarmRecords);
             }
 
             // [GFX TODO] It might make more sense to call OnShaderReinitialized here
@@ -373,6 +444,170 @@ namespace AZ
             }
         }
         
+        ConstPtr<PipelineStateCacheData> Shader::LoadPipelineStateCacheData() const
+        {
+            if (m_pipelineStateCacheDataPath[0] != 0 && r_PrewarmPipelineStates && IO::SystemFile::Exists(m_pipelineStateCacheDataPath))
+            {
+                return Utils::LoadObjectFromFile<PipelineStateCacheData>(m_pipelineStateCacheDataPath);
+            }
+            return nullptr;
+        }
+
+        void Shader::SavePipelineStateCacheData()
+        {
+            if (m_pipelineStateCacheDataPath[0] == 0)
+            {
+                return;
+            }
+
+            // Pipeline states are matched to the variant they were configured from by its shader function. Pipeline
+            // states of variants that were reloaded since then match none, and aren't recorded.
+            const RHI::ShaderStage variantShaderStage = GetVariantShaderStage(m_pipelineStateType);
+            AZStd::unordered_map<const RHI::ShaderStageFunction*, ShaderVariantStableId> variantStableIds;
+            const auto addVariant = [variantShaderStage, &variantStableIds](const ShaderVariant& shaderVariant)
+            {
+                if (const RHI::ShaderStageFunction* function = shaderVariant.GetShaderVariantAsset()->GetShaderStageFunction(variantShaderStage))
+                {
+                    variantStableIds.emplace(function, shaderVariant.GetStableId());
+                }
+            };
+            {
+                AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                addVariant(m_rootVariant);
+                for (const auto& shaderVariantPair : m_shaderVariants)
+                {
+                    addVariant(shaderVariantPair.second);
+                }
+            }
+
+            RHI::Ptr<PipelineStateCacheData> cacheData = aznew PipelineStateCacheData;
+            m_pipelineStateCache->ForEachPipelineState(m_pipelineLibraryHandle,
+                [this, &variantStableIds, &cacheData](const RHI::PipelineStateDescriptor& descriptor, uint32_t unusedSessionCount)
+            {
+                auto variantIt = variantStableIds.find(GetVariantShaderStageFunction(descriptor));
+                if (variantIt == variantStableIds.end() || unusedSessionCount >= PipelineStateCacheData::UnusedSessionCountMax)
+                {
+                    return;
+                }
+
+                PipelineStateCacheRecord record;
+                record.m_shaderAssetId = m_asset.GetId();
+                record.m_shaderVariantStableId = variantIt->second;
+                record.m_unusedSessionCount = unusedSessionCount;
+                if (descriptor.GetType() == RHI::PipelineStateType::Draw)
+                {
+                    const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                    record.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+                    record.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+                    record.m_renderStates = descriptorForDraw.m_renderStates;
+                }
+                cacheData->AddRecord(AZStd::move(record));
+            });
+
+            if (!cacheData->GetRecords().empty())
+            {
+                [[maybe_unused]] bool result = Utils::SaveObjectToFile<PipelineStateCacheData>(
+                    m_pipelineStateCacheDataPath, DataStream::ST_BINARY, cacheData.get());
+                AZ_Error("Shader", result, "Pipeline state descriptors %s were not saved", m_pipelineStateCacheDataPath);
+            }
+        }
+
+        void Shader::PrewarmPipelineStates(const PipelineStateCacheData& cacheData)
+        {
+            AZStd::unordered_map<ShaderVariantStableId, AZStd::vector<PipelineStateCacheRecord>> variantRecords;
+            for (const PipelineStateCacheRecord& record : cacheData.GetRecords())
+            {
+                if (record.m_shaderAssetId == m_asset.GetId())
+                {
+                    variantRecords[record.m_shaderVariantStableId].push_back(record);
+                }
+            }
+
+            for (auto& variantRecordsPair : variantRecords)
+            {
+                const ShaderVariantStableId stableId = variantRecordsPair.first;
+                if (stableId == RootShaderVariantStableId)
+                {
+                    PrewarmPipelineStates(m_rootVariant, variantRecordsPair.second);
+                    continue;
+                }
+
+                // The records are queued before the variant is requested, so that OnShaderVariantAssetReady finds
+                // them even if the variant finishes loading on another thread right away.
+                {
+                    AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                    m_pendingPrewarmRecords[stableId] = AZStd::move(variantRecordsPair.second);
+                }
+
+                // Enqueues a load request if the variant isn't ready, and returns the root variant in that case.
+                const ShaderVariant& shaderVariant = GetVariantInternal(stableId);
+                if (shaderVariant.GetStableId() != stableId)
+                {
+                    continue;
+                }
+
+                AZStd::vector<PipelineStateCacheRecord> records;
+                {
+                    AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                    auto pendingIt = m_pendingPrewarmRecords.find(stableId);
+                    if (pendingIt != m_pendingPrewarmRecords.end())
+                    {
+                        records = AZStd::move(pendingIt->second);
+                        m_pendingPrewarmRecords.erase(pendingIt);
+                    }
+                }
+                if (!records.empty())
+                {
+                    PrewarmPipelineStates(shaderVariant, records);
+                }
+            }
+        }
+
+        void Shader::PrewarmPipelineStates(const ShaderVariant& shaderVariant, AZStd::span<const PipelineStateCacheRecord> records)
+        {
+            AZStd::vector<RHI::PipelineStateCache::PrewarmDescriptor> prewarmDescriptors;
+            prewarmDescriptors.reserve(records.size());
+            for (const PipelineStateCacheRecord& record : records)
+            {
+                RHI::PipelineStateCache::PrewarmDescriptor prewarmDescriptor;
+                prewarmDescriptor.m_unusedSessionCount = record.m_unusedSessionCount;
+
+                switch (m_pipelineStateType)
+                {
+                case RHI::PipelineStateType::Draw:
+                {
+                    RHI::PipelineStateDescriptorForDraw descriptor;
+                    shaderVariant.ConfigurePipelineState(descriptor);
+                    descriptor.m_inputStreamLayout = record.m_inputStreamLayout;
+                    descriptor.m_renderAttachmentConfiguration = record.m_renderAttachmentConfiguration;
+                    descriptor.m_renderStates = record.m_renderStates;
+                    prewarmDescriptor.m_descriptor = AZStd::move(descriptor);
+                    break;
+                }
+                case RHI::PipelineStateType::Dispatch:
+                {
+                    RHI::PipelineStateDescriptorForDispatch descriptor;
+                    shaderVariant.ConfigurePipelineState(descriptor);
+                    prewarmDescriptor.m_descriptor = AZStd::move(descriptor);
+                    break;
+                }
+                case RHI::PipelineStateType::RayTracing:
+                {
+                    RHI::PipelineStateDescriptorForRayTracing descriptor;
+                    shaderVariant.ConfigurePipelineState(descriptor);
+                    prewarmDescriptor.m_descriptor = AZStd::move(descriptor);
+                    break;
+                }
+                default:
+                    continue;
+                }
+
+                prewarmDescriptors.push_back(AZStd::move(prewarmDescriptor));
+            }
+
+            m_pipelineStateCache->PrewarmLibrary(m_pipelineLibraryHandle, AZStd::move(prewarmDescriptors));
+        }
+
         ShaderOptionGroup Shader::CreateShaderOptionGroup() const
         {
             return ShaderOptionGroup(m_asset->GetShaderOptionGroupLayout());
@@ -19,6 +19,7 @@
 #include <Atom/RPI.Reflect/Shader/ShaderVariantAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
 #include <Atom/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.h>
+#include <Atom/RPI.Reflect/Shader/PipelineStateCacheData.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
@@ -41,6 +42,8 @@ namespace AZ
             ShaderVariantTreeAsset::Reflect(context);
             ReflectShaderStageType(context);
             PrecompiledShaderAssetSourceData::Reflect(context);
+            PipelineStateCacheRecord::Reflect(context);
+            PipelineStateCacheData::Reflect(context);
         }
 
         ShaderSystemInterface* ShaderSystemInterface::Get()
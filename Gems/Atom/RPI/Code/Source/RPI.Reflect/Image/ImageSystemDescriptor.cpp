@@ -24,6 +24,8 @@ namespace AZ
                     ->Field("AssetStreamingImagePoolSize", &ImageSystemDescriptor::m_assetStreamingImagePoolSize)
                     ->Field("SystemStreamingImagePoolSize", &ImageSystemDescriptor::m_systemStreamingImagePoolSize)
                     ->Field("SystemAttachmentImagePoolSize", &ImageSystemDescriptor::m_systemAttachmentImagePoolSize)
+                    ->Field("UseTexelDensityStreaming", &ImageSystemDescriptor::m_useTexelDensityStreaming)
+                    ->Field("TexelDensityStreamingSettings", &ImageSystemDescriptor::m_texelDensityStreamingSettings)
                     ;
             }
         }
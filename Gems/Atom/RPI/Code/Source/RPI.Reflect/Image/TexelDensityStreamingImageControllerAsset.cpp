@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Image/TexelDensityStreamingImageControllerAsset.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void TexelDensityStreamingSettings::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<TexelDensityStreamingSettings>()
+                    ->Version(0)
+                    ->Field("MemoryBudgetInBytes", &TexelDensityStreamingSettings::m_memoryBudgetInBytes)
+                    ->Field("MipBias", &TexelDensityStreamingSettings::m_mipBias)
+                    ->Field("TrimHysteresis", &TexelDensityStreamingSettings::m_trimHysteresis)
+                    ->Field("TrimDelay", &TexelDensityStreamingSettings::m_trimDelay)
+                    ->Field("MaxExpandsPerUpdate", &TexelDensityStreamingSettings::m_maxExpandsPerUpdate)
+                    ;
+            }
+        }
+
+        TexelDensityStreamingImageControllerAsset::TexelDensityStreamingImageControllerAsset()
+        {
+            m_status = AssetStatus::Ready;
+        }
+
+        TexelDensityStreamingImageControllerAsset::TexelDensityStreamingImageControllerAsset(const TexelDensityStreamingSettings& settings)
+            : m_settings(settings)
+        {
+            m_status = AssetStatus::Ready;
+        }
+
+        const TexelDensityStreamingSettings& TexelDensityStreamingImageControllerAsset::GetSettings() const
+        {
+            return m_settings;
+        }
+
+        void TexelDensityStreamingImageControllerAsset::Reflect(ReflectContext* context)
+        {
+            TexelDensityStreamingSettings::Reflect(context);
+
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<TexelDensityStreamingImageControllerAsset, StreamingImageControllerAsset>()
+                    ->Version(0)
+                    ->Field("Settings", &TexelDensityStreamingImageControllerAsset::m_settings)
+                    ;
+            }
+        }
+    }
+}
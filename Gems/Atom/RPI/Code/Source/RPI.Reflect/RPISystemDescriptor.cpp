@@ -20,8 +20,9 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
             {
                 serializeContext->Class<DynamicDrawSystemDescriptor>()
-                    ->Version(0)
+                    ->Version(1)
                     ->Field("DynamicBufferPoolSize", &DynamicDrawSystemDescriptor::m_dynamicBufferPoolSize)
+                    ->Field("DynamicBufferMaxPoolSize", &DynamicDrawSystemDescriptor::m_dynamicBufferMaxPoolSize)
                     ;
 
                 serializeContext->Class<RPISystemDescriptor>()
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Shader/PipelineStateCacheData.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void PipelineStateCacheRecord::Reflect(ReflectContext* context)
+        {
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateCacheRecord>()
+                    ->Version(2)
+                    ->Field("m_shaderAssetId", &PipelineStateCacheRecord::m_shaderAssetId)
+                    ->Field("m_shaderVariantStableId", &PipelineStateCacheRecord::m_shaderVariantStableId)
+                    ->Field("m_inputStreamLayout", &PipelineStateCacheRecord::m_inputStreamLayout)
+                    ->Field("m_renderAttachmentConfiguration", &PipelineStateCacheRecord::m_renderAttachmentConfiguration)
+                    ->Field("m_renderStates", &PipelineStateCacheRecord::m_renderStates)
+                    ->Field("m_unusedSessionCount", &PipelineStateCacheRecord::m_unusedSessionCount);
+            }
+        }
+
+        void PipelineStateCacheData::Reflect(ReflectContext* context)
+        {
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateCacheData>()
+                    ->Version(2)
+                    ->Field("m_records", &PipelineStateCacheData::m_records);
+            }
+        }
+
+        void PipelineStateCacheData::AddRecord(PipelineStateCacheRecord&& record)
+        {
+            m_records.emplace_back(AZStd::move(record));
+        }
+
+        AZStd::span<const PipelineStateCacheRecord> PipelineStateCacheData::GetRecords() const
+        {
+            return m_records;
+        }
+    }
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/DynamicDraw/DynamicBuffer.h>
+#include <Atom/RPI.Public/DynamicDraw/DynamicBufferAllocator.h>
+
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    namespace DynamicBufferAllocatorTestUtils
+    {
+        constexpr uint32_t PageSize = 4 * DynamicBufferAllocator::BlockSize;
+        constexpr uint32_t PoolSize = PageSize * RHI::Limits::Device::FrameCountMax;
+
+        const DynamicBufferAllocator::ConsumerStatistics* FindConsumer(const DynamicBufferAllocator::Statistics& statistics, const char* consumer)
+        {
+            for (const DynamicBufferAllocator::ConsumerStatistics& consumerStatistics : statistics.m_consumers)
+            {
+                if (consumerStatistics.m_consumer == Name(consumer))
+                {
+                    return &consumerStatistics;
+                }
+            }
+            return nullptr;
+        }
+    } // namespace DynamicBufferAllocatorTestUtils
+
+    class DynamicBufferAllocatorTests
+        : public RPITestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+            m_allocator = AZStd::make_unique<DynamicBufferAllocator>();
+        }
+
+        void TearDown() override
+        {
+            m_allocator->Shutdown();
+            m_allocator = nullptr;
+            RPITestFixture::TearDown();
+        }
+
+        AZStd::unique_ptr<DynamicBufferAllocator> m_allocator;
+    };
+
+    TEST_F(DynamicBufferAllocatorTests, Allocate_AlignedSizes_BuffersDoNotOverlap)
+    {
+        using namespace DynamicBufferAllocatorTestUtils;
+
+        m_allocator->Init(PoolSize);
+
+        RHI::Ptr<DynamicBuffer> first = m_allocator->Allocate(10, RHI::Alignment::InputAssembly);
+        RHI::Ptr<DynamicBuffer> second = m_allocator->Allocate(100, RHI::Alignment::Constant);
+        ASSERT_TRUE(first && second);
+
+        EXPECT_EQ(first->GetSize(), 12);
+        EXPECT_EQ(second->GetSize(), 256);
+        EXPECT_EQ(second->GetStreamBufferView(4).GetByteOffset() % RHI::Alignment::Constant, 0);
+        EXPECT_GE(static_cast<uint8_t*>(second->GetBufferAddress()), static_cast<uint8_t*>(first->GetBufferAddress()) + first->GetSize());
+        EXPECT_EQ(
+            second->GetStreamBufferView(4).GetByteOffset() - first->GetStreamBufferView(4).GetByteOffset(),
+            static_cast<uint8_t*>(second->GetBufferAddress()) - static_cast<uint8_t*>(first->GetBufferAddress()));
+    }
+
+    TEST_F(DynamicBufferAllocatorTests, Allocate_MoreThanPoolSize_GrowsUpToMaxPoolSize)
+    {
+        using namespace DynamicBufferAllocatorTestUtils;
+
+        m_allocator->Init(PoolSize, 2 * PoolSize);
+        m_allocator->SetEnableAllocationWarning(false);
+
+        // Twice the pool fits after growing, a few more allocations don't
+        const uint32_t allocationSize = DynamicBufferAllocator::BlockSize / 2;
+        const uint32_t allocationCount = 2 * PoolSize / allocationSize;
+        uint32_t allocatedCount = 0;
+        for (uint32_t allocation = 0; allocation < allocationCount + 4; ++allocation)
+        {
+            allocatedCount += m_allocator->Allocate(allocationSize, RHI::Alignment::InputAssembly) ? 1 : 0;
+        }
+        m_allocator->FrameEnd();
+
+        const DynamicBufferAllocator::Statistics& statistics = m_allocator->GetStatistics();
+        EXPECT_EQ(allocatedCount, allocationCount);
+        EXPECT_EQ(statistics.m_allocationCount, allocationCount);
+        EXPECT_EQ(statistics.m_failedAllocationCount, 4);
+        EXPECT_EQ(statistics.m_reservedBytes, 2 * PoolSize);
+        EXPECT_EQ(statistics.m_pageCount, 2 * RHI::Limits::Device::FrameCountMax);
+    }
+
+    TEST_F(DynamicBufferAllocatorTests, Allocate_LargerThanPage_PageReleasedAfterFramesInFlight)
+    {
+        using namespace DynamicBufferAllocatorTestUtils;
+
+        m_allocator->Init(PoolSize, 4 * PoolSize);
+
+        RHI::Ptr<DynamicBuffer> buffer = m_allocator->Allocate(2 * PageSize, RHI::Alignment::InputAssembly);
+        ASSERT_TRUE(buffer);
+        EXPECT_EQ(buffer->GetSize(), 2 * PageSize);
+        buffer = nullptr;
+
+        m_allocator->FrameEnd();
+        EXPECT_EQ(m_allocator->GetStatistics().m_reservedBytes, PoolSize + 2 * PageSize);
+
+        for (uint32_t frame = 1; frame < RHI::Limits::Device::FrameCountMax; ++frame)
+        {
+            m_allocator->FrameEnd();
+        }
+        EXPECT_EQ(m_allocator->GetStatistics().m_reservedBytes, PoolSize);
+    }
+
+    TEST_F(DynamicBufferAllocatorTests, FrameEnd_SteadyFrames_ReusePagesWithoutGrowing)
+    {
+        using namespace DynamicBufferAllocatorTestUtils;
+
+        m_allocator->Init(PoolSize, 4 * PoolSize);
+
+        // Every frame fills its page, so the pages only last if they are recycled after the frames in flight
+        for (uint32_t frame = 0; frame < 10 * RHI::Limits::Device::FrameCountMax; ++frame)
+        {
+            for (uint32_t allocation = 0; allocation < PageSize / DynamicBufferAllocator::BlockSize; ++allocation)
+            {
+                EXPECT_TRUE(m_allocator->Allocate(DynamicBufferAllocator::BlockSize, RHI::Alignment::InputAssembly));
+            }
+            m_allocator->FrameEnd();
+        }
+
+        EXPECT_EQ(m_allocator->GetStatistics().m_reservedBytes, PoolSize);
+        EXPECT_EQ(m_allocator->GetStatistics().m_highWaterBytes, PageSize);
+    }
+
+    TEST_F(DynamicBufferAllocatorTests, FrameEnd_Consumers_AccountedSeparatelyWithHighWaterMarks)
+    {
+        using namespace DynamicBufferAllocatorTestUtils;
+
+        m_allocator->Init(PoolSize);
+
+        const Name auxGeom("AuxGeom");
+        const Name lyShine("LyShine");
+        m_allocator->Allocate(1024, RHI::Alignment::InputAssembly, auxGeom);
+        m_allocator->Allocate(1024, RHI::Alignment::InputAssembly, auxGeom);
+        m_allocator->Allocate(512, RHI::Alignment::InputAssembly, lyShine);
+        m_allocator->Allocate(64, RHI::Alignment::InputAssembly);
+        m_allocator->FrameEnd();
+
+        m_allocator->Allocate(256, RHI::Alignment::InputAssembly, auxGeom);
+        m_allocator->FrameEnd();
+
+        const DynamicBufferAllocator::Statistics& statistics = m_allocator->GetStatistics();
+        const DynamicBufferAllocator::ConsumerStatistics* auxGeomStatistics = FindConsumer(statistics, "AuxGeom");
+        const DynamicBufferAllocator::ConsumerStatistics* lyShineStatistics = FindConsumer(statistics, "LyShine");
+        ASSERT_TRUE(auxGeomStatistics && lyShineStatistics);
+
+        EXPECT_EQ(auxGeomStatistics->m_allocationCount, 1);
+        EXPECT_EQ(auxGeomStatistics->m_allocatedBytes, 256);
+        EXPECT_EQ(auxGeomStatistics->m_highWaterBytes, 2048);
+        EXPECT_EQ(lyShineStatistics->m_allocatedBytes, 0);
+        EXPECT_EQ(lyShineStatistics->m_highWaterBytes, 512);
+        EXPECT_EQ(statistics.m_allocatedBytes, 256);
+        EXPECT_EQ(statistics.m_highWaterBytes, 2048 + 512 + 64);
+
+        m_allocator->ResetHighWaterMarks();
+        m_allocator->FrameEnd();
+        EXPECT_EQ(statistics.m_highWaterBytes, 0);
+        EXPECT_EQ(FindConsumer(statistics, "AuxGeom")->m_highWaterBytes, 0);
+    }
+
+    TEST_F(DynamicBufferAllocatorTests, Allocate_ManyThreadsAndConsumers_BuffersDoNotOverlapAndAreAccounted)
+    {
+        using namespace DynamicBufferAllocatorTestUtils;
+
+        constexpr uint32_t threadCount = 8;
+        constexpr uint32_t allocationsPerThread = 1000;
+        constexpr uint32_t frameCount = 2 * RHI::Limits::Device::FrameCountMax;
+        const Name consumers[] = { Name("AuxGeom"), Name("LyShine"), Name("ImGui"), Name("DebugDraw") };
+
+        // UI and debug draw heavy frames need several times the initial pool
+        m_allocator->Init(PoolSize, 256 * PoolSize);
+
+        for (uint32_t frame = 0; frame < frameCount; ++frame)
+        {
+            AZStd::vector<AZStd::vector<RHI::Ptr<DynamicBuffer>>> threadBuffers(threadCount);
+            AZStd::vector<AZ::u64> threadBytes(threadCount, 0);
+
+            AZStd::vector<AZStd::thread> threads;
+            for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                threads.emplace_back([&, threadIndex]()
+                {
+                    for (uint32_t allocation = 0; allocation < allocationsPerThread; ++allocation)
+                    {
+                        // Mostly small allocations with a few larger than a block
+                        const uint32_t size = (allocation % 97 == 0) ? DynamicBufferAllocator::BlockSize + 4 : 4 + (allocation * 52) % 1024;
+                        RHI::Ptr<DynamicBuffer> buffer =
+                            m_allocator->Allocate(size, RHI::Alignment::InputAssembly, consumers[allocation % AZStd::size(consumers)]);
+                        if (buffer)
+                        {
+                            memset(buffer->GetBufferAddress(), threadIndex + 1, buffer->GetSize());
+                            threadBytes[threadIndex] += buffer->GetSize();
+                            threadBuffers[threadIndex].push_back(buffer);
+                        }
+                    }
+                });
+            }
+
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            // Any overlap between the buffers of two threads would have overwritten the value of one of them
+            AZ::u64 allocatedBytes = 0;
+            uint32_t allocationCount = 0;
+            for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                EXPECT_EQ(threadBuffers[threadIndex].size(), allocationsPerThread);
+                for (const RHI::Ptr<DynamicBuffer>& buffer : threadBuffers[threadIndex])
+                {
+                    const uint8_t* data = static_cast<const uint8_t*>(buffer->GetBufferAddress());
+                    const uint8_t* dataEnd = data + buffer->GetSize();
+                    EXPECT_EQ(AZStd::find_if(data, dataEnd, [threadIndex](uint8_t value) { return value != threadIndex + 1; }), dataEnd);
+                }
+                allocatedBytes += threadBytes[threadIndex];
+                allocationCount += aznumeric_cast<uint32_t>(threadBuffers[threadIndex].size());
+            }
+
+            m_allocator->FrameEnd();
+
+            const DynamicBufferAllocator::Statistics& statistics = m_allocator->GetStatistics();
+            EXPECT_EQ(statistics.m_allocationCount, allocationCount);
+            EXPECT_EQ(statistics.m_allocatedBytes, allocatedBytes);
+            EXPECT_EQ(statistics.m_failedAllocationCount, 0);
+            EXPECT_GE(statistics.m_blockBytes, statistics.m_allocatedBytes);
+
+            AZ::u64 consumerBytes = 0;
+            for (const Name& consumer : consumers)
+            {
+                const DynamicBufferAllocator::ConsumerStatistics* consumerStatistics = FindConsumer(statistics, consumer.GetCStr());
+                ASSERT_TRUE(consumerStatistics);
+                EXPECT_EQ(consumerStatistics->m_allocationCount, threadCount * allocationsPerThread / AZStd::size(consumers));
+                EXPECT_GE(consumerStatistics->m_highWaterBytes, consumerStatistics->m_allocatedBytes);
+                consumerBytes += consumerStatistics->m_allocatedBytes;
+            }
+            EXPECT_EQ(consumerBytes, allocatedBytes);
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/TexelDensityStreamingImageController.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    namespace TexelDensityStreamingTestUtils
+    {
+        constexpr uint32_t ImageSize = 2048;
+        constexpr uint16_t MipCount = 12;
+        constexpr uint16_t TailMipLevel = 5;
+
+        // Block compressed image with one mip chain per mip down to the tail, which holds the remaining mips
+        TexelDensityMipSelector::ImageState CreateImageState()
+        {
+            TexelDensityMipSelector::ImageState imageState;
+            for (uint16_t mipLevel = 0; mipLevel < MipCount; ++mipLevel)
+            {
+                const uint32_t mipSize = AZStd::max(ImageSize >> mipLevel, 4u);
+                const AZ::u64 byteCount = AZ::u64(mipSize) * mipSize / 2;
+                if (mipLevel <= TailMipLevel)
+                {
+                    imageState.m_mipChains.push_back({ mipLevel, byteCount });
+                }
+                else
+                {
+                    imageState.m_mipChains.back().m_byteCount += byteCount;
+                }
+            }
+            return imageState;
+        }
+
+        AZ::u64 GetTotalByteCount(const TexelDensityMipSelector::ImageState& imageState)
+        {
+            AZ::u64 byteCount = 0;
+            for (const TexelDensityMipSelector::MipChain& mipChain : imageState.m_mipChains)
+            {
+                byteCount += mipChain.m_byteCount;
+            }
+            return byteCount;
+        }
+
+        // A camera path recorded as the requested mip of every image in every frame. The camera flies along a row of
+        // objects that sample the images, each image used by a few objects spread along the row.
+        struct RecordedCameraPath
+        {
+            uint32_t m_imageCount = 0;
+            AZStd::vector<AZStd::vector<float>> m_requestedMips;
+        };
+
+        RecordedCameraPath RecordCameraPath()
+        {
+            constexpr uint32_t imageCount = 32;
+            constexpr uint32_t objectCount = 128;
+            constexpr float objectSpacing = 8.0f;
+            constexpr float objectRadius = 2.0f;
+            constexpr uint32_t frameCount = 600;
+            constexpr float screenHeight = 1080.0f;
+            constexpr float tanHalfFov = 0.5f;
+            constexpr float farDistance = 200.0f;
+
+            RecordedCameraPath cameraPath;
+            cameraPath.m_imageCount = imageCount;
+            for (uint32_t frame = 0; frame < frameCount; ++frame)
+            {
+                AZStd::vector<float>& requestedMips = cameraPath.m_requestedMips.emplace_back(imageCount, TexelDensityMipSelector::NoRequest);
+
+                // The camera stops halfway along the row for a while, then moves on
+                const float pathTime = AZStd::min(float(frame), 250.0f) + AZStd::max(float(frame) - 350.0f, 0.0f);
+                const float cameraPosition = -20.0f + pathTime * 2.0f;
+                for (uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+                {
+                    const float distance = objectIndex * objectSpacing - cameraPosition;
+                    if (distance <= objectRadius || distance > farDistance)
+                    {
+                        continue;
+                    }
+
+                    const float objectScreenSize = screenHeight * objectRadius / (distance * tanHalfFov);
+                    const float screenPixelsPerUv = TexelDensityMipSelector::EstimateScreenPixelsPerUv(objectScreenSize, 1.0f);
+                    const float requestedMip = TexelDensityMipSelector::GetMipLevelForTexelDensity(ImageSize, screenPixelsPerUv);
+
+                    float& imageRequestedMip = requestedMips[(objectIndex * 7) % imageCount];
+                    imageRequestedMip = AZStd::min(imageRequestedMip, requestedMip);
+                }
+            }
+            return cameraPath;
+        }
+
+        struct ReplayResult
+        {
+            AZ::u64 m_peakResidentBytes = 0;
+            AZ::u64 m_streamedBytes = 0;
+            AZ::u64 m_peakStreamedBytesPerFrame = 0;
+            uint32_t m_framesOverBudget = 0;
+            uint32_t m_framesTooBlurry = 0;
+        };
+
+        // Replays the camera path with the policy of the DefaultStreamingImageController, which streams in every mip of up
+        // to 20 newly attached images per update and never trims.
+        ReplayResult ReplayWithDefaultController(const RecordedCameraPath& cameraPath, AZ::u64 budget)
+        {
+            constexpr uint32_t maxExpandsCount = 20;
+
+            AZStd::vector<TexelDensityMipSelector::ImageState> imageStates(cameraPath.m_imageCount, CreateImageState());
+            for (TexelDensityMipSelector::ImageState& imageState : imageStates)
+            {
+                imageState.m_targetMipChain = static_cast<uint16_t>(imageState.m_mipChains.size() - 1);
+            }
+
+            ReplayResult result;
+            uint32_t attachedImageCount = 0;
+            for (const AZStd::vector<float>& requestedMips : cameraPath.m_requestedMips)
+            {
+                AZ::u64 streamedBytes = 0;
+                for (uint32_t expandCount = 0; expandCount < maxExpandsCount && attachedImageCount < imageStates.size(); ++expandCount)
+                {
+                    TexelDensityMipSelector::ImageState& imageState = imageStates[attachedImageCount++];
+                    for (size_t mipChainIndex = 0; mipChainIndex < imageState.m_targetMipChain; ++mipChainIndex)
+                    {
+                        streamedBytes += imageState.m_mipChains[mipChainIndex].m_byteCount;
+                    }
+                    imageState.m_targetMipChain = 0;
+                }
+                result.m_streamedBytes += streamedBytes;
+                result.m_peakStreamedBytesPerFrame = AZStd::max(result.m_peakStreamedBytesPerFrame, streamedBytes);
+
+                AZ::u64 residentBytes = 0;
+                for (uint32_t imageIndex = 0; imageIndex < imageStates.size(); ++imageIndex)
+                {
+                    const TexelDensityMipSelector::ImageState& imageState = imageStates[imageIndex];
+                    for (size_t mipChainIndex = imageState.m_targetMipChain; mipChainIndex < imageState.m_mipChains.size(); ++mipChainIndex)
+                    {
+                        residentBytes += imageState.m_mipChains[mipChainIndex].m_byteCount;
+                    }
+                    if (imageState.m_mipChains[imageState.m_targetMipChain].m_mipLevel > requestedMips[imageIndex] + 1.0f)
+                    {
+                        ++result.m_framesTooBlurry;
+                    }
+                }
+                result.m_peakResidentBytes = AZStd::max(result.m_peakResidentBytes, residentBytes);
+                result.m_framesOverBudget += residentBytes > budget ? 1 : 0;
+            }
+            return result;
+        }
+
+        ReplayResult ReplayWithMipSelector(const RecordedCameraPath& cameraPath, const TexelDensityStreamingSettings& settings)
+        {
+            TexelDensityMipSelector mipSelector(settings);
+            AZStd::vector<TexelDensityMipSelector::ImageState> imageStates(cameraPath.m_imageCount, CreateImageState());
+            AZStd::vector<TexelDensityMipSelector::ImageState*> images;
+            for (TexelDensityMipSelector::ImageState& imageState : imageStates)
+            {
+                images.push_back(&imageState);
+            }
+
+            ReplayResult result;
+            for (const AZStd::vector<float>& requestedMips : cameraPath.m_requestedMips)
+            {
+                for (uint32_t imageIndex = 0; imageIndex < imageStates.size(); ++imageIndex)
+                {
+                    imageStates[imageIndex].m_requestedMip = requestedMips[imageIndex];
+                }
+
+                const TexelDensityMipSelector::Statistics statistics = mipSelector.Update(images);
+                result.m_streamedBytes += statistics.m_expandedBytes;
+                result.m_peakStreamedBytesPerFrame = AZStd::max(result.m_peakStreamedBytesPerFrame, statistics.m_expandedBytes);
+                result.m_peakResidentBytes = AZStd::max(result.m_peakResidentBytes, statistics.m_residentBytes);
+                result.m_framesOverBudget += statistics.m_residentBytes > settings.m_memoryBudgetInBytes ? 1 : 0;
+
+                for (uint32_t imageIndex = 0; imageIndex < imageStates.size(); ++imageIndex)
+                {
+                    const TexelDensityMipSelector::ImageState& imageState = imageStates[imageIndex];
+                    if (imageState.m_mipChains[imageState.m_targetMipChain].m_mipLevel > requestedMips[imageIndex] + 1.0f)
+                    {
+                        ++result.m_framesTooBlurry;
+                    }
+                }
+            }
+            return result;
+        }
+    } // namespace TexelDensityStreamingTestUtils
+
+    class TexelDensityStreamingTests
+        : public RPITestFixture
+    {
+    protected:
+        TexelDensityStreamingSettings CreateSettings(AZ::u64 budget, uint32_t trimDelay)
+        {
+            TexelDensityStreamingSettings settings;
+            settings.m_memoryBudgetInBytes = budget;
+            settings.m_trimDelay = trimDelay;
+            settings.m_trimHysteresis = 0.5f;
+            settings.m_maxExpandsPerUpdate = 20;
+            return settings;
+        }
+    };
+
+    TEST_F(TexelDensityStreamingTests, GetMipLevelForTexelDensity_TexelsPerPixel_ReturnsLog2)
+    {
+        EXPECT_FLOAT_EQ(TexelDensityMipSelector::GetMipLevelForTexelDensity(1024, 256.0f), 2.0f);
+        EXPECT_FLOAT_EQ(TexelDensityMipSelector::GetMipLevelForTexelDensity(1024, 4096.0f), 0.0f);
+        EXPECT_FLOAT_EQ(TexelDensityMipSelector::GetMipLevelForTexelDensity(1024, 0.0f), TexelDensityMipSelector::NoRequest);
+    }
+
+    TEST_F(TexelDensityStreamingTests, Update_RequestedMip_ExpandsToMipChainOfRequest)
+    {
+        using namespace TexelDensityStreamingTestUtils;
+
+        TexelDensityMipSelector mipSelector(CreateSettings(0, 10));
+        TexelDensityMipSelector::ImageState imageState = CreateImageState();
+        TexelDensityMipSelector::ImageState* images[] = { &imageState };
+
+        imageState.m_requestedMip = 2.5f;
+        const TexelDensityMipSelector::Statistics statistics = mipSelector.Update(images);
+
+        EXPECT_EQ(imageState.m_targetMipChain, 2);
+        EXPECT_EQ(statistics.m_expandedMipChainCount, 3);
+        EXPECT_EQ(imageState.m_requestedMip, TexelDensityMipSelector::NoRequest);
+    }
+
+    TEST_F(TexelDensityStreamingTests, Update_RequestAroundMipBoundary_DoesNotStreamRepeatedly)
+    {
+        using namespace TexelDensityStreamingTestUtils;
+
+        TexelDensityMipSelector mipSelector(CreateSettings(0, 5));
+        TexelDensityMipSelector::ImageState imageState = CreateImageState();
+        TexelDensityMipSelector::ImageState* images[] = { &imageState };
+
+        uint32_t expandedMipChainCount = 0;
+        uint32_t trimmedMipChainCount = 0;
+        for (uint32_t update = 0; update < 100; ++update)
+        {
+            imageState.m_requestedMip = (update % 2) ? 0.9f : 1.2f;
+            const TexelDensityMipSelector::Statistics statistics = mipSelector.Update(images);
+            expandedMipChainCount += statistics.m_expandedMipChainCount;
+            trimmedMipChainCount += statistics.m_trimmedMipChainCount;
+        }
+
+        EXPECT_EQ(imageState.m_targetMipChain, 0);
+        EXPECT_EQ(expandedMipChainCount, TailMipLevel);
+        EXPECT_EQ(trimmedMipChainCount, 0);
+    }
+
+    TEST_F(TexelDensityStreamingTests, Update_LessDetailedRequest_TrimmedAfterTrimDelay)
+    {
+        using namespace TexelDensityStreamingTestUtils;
+
+        constexpr uint32_t trimDelay = 5;
+        // Less detailed than the tail by more than the hysteresis
+        constexpr float tailRequestedMip = MipCount;
+        TexelDensityMipSelector mipSelector(CreateSettings(0, trimDelay));
+        TexelDensityMipSelector::ImageState imageState = CreateImageState();
+        TexelDensityMipSelector::ImageState* images[] = { &imageState };
+
+        imageState.m_requestedMip = 0.0f;
+        mipSelector.Update(images);
+        EXPECT_EQ(imageState.m_targetMipChain, 0);
+
+        for (uint32_t update = 1; update < trimDelay; ++update)
+        {
+            imageState.m_requestedMip = tailRequestedMip;
+            mipSelector.Update(images);
+            EXPECT_EQ(imageState.m_targetMipChain, 0);
+        }
+
+        imageState.m_requestedMip = tailRequestedMip;
+        mipSelector.Update(images);
+        EXPECT_EQ(imageState.m_targetMipChain, TailMipLevel);
+    }
+
+    TEST_F(TexelDensityStreamingTests, Update_UnusedImage_KeepsResidencyUntilBudgetNeedsRoom)
+    {
+        using namespace TexelDensityStreamingTestUtils;
+
+        TexelDensityMipSelector::ImageState unusedImage = CreateImageState();
+        TexelDensityMipSelector::ImageState usedImage = CreateImageState();
+        TexelDensityMipSelector::ImageState* images[] = { &unusedImage, &usedImage };
+
+        // Room for one image with all its mips and the tail of the other
+        const AZ::u64 budget = GetTotalByteCount(unusedImage) + usedImage.m_mipChains.back().m_byteCount;
+        TexelDensityMipSelector mipSelector(CreateSettings(budget, 5));
+
+        unusedImage.m_requestedMip = 0.0f;
+        mipSelector.Update(images);
+        EXPECT_EQ(unusedImage.m_targetMipChain, 0);
+
+        // Images that aren't requested anymore, e.g. because they went off screen, aren't trimmed to the tail
+        for (uint32_t update = 0; update < 100; ++update)
+        {
+            mipSelector.Update(images);
+        }
+        EXPECT_EQ(unusedImage.m_targetMipChain, 0);
+
+        usedImage.m_requestedMip = 0.0f;
+        const TexelDensityMipSelector::Statistics statistics = mipSelector.Update(images);
+        EXPECT_EQ(usedImage.m_targetMipChain, 0);
+        EXPECT_EQ(unusedImage.m_targetMipChain, TailMipLevel);
+        EXPECT_LE(statistics.m_residentBytes, budget);
+    }
+
+    TEST_F(TexelDensityStreamingTests, Update_NeverRequestedImage_ExpandsIntoRoomLeftByRequestedImages)
+    {
+        using namespace TexelDensityStreamingTestUtils;
+
+        TexelDensityMipSelector::ImageState requestedImage = CreateImageState();
+        TexelDensityMipSelector::ImageState neverRequestedImages[] = { CreateImageState(), CreateImageState() };
+        TexelDensityMipSelector::ImageState* images[] = { &neverRequestedImages[0], &requestedImage, &neverRequestedImages[1] };
+
+        // Room for two images with all their mips and the tail of the third
+        const AZ::u64 budget = 2 * GetTotalByteCount(requestedImage) + requestedImage.m_mipChains.back().m_byteCount;
+        TexelDensityMipSelector mipSelector(CreateSettings(budget, 5));
+
+        // Images nothing requests, e.g. because no producer reports their texel density, stream in all their mips like with
+        // the default controller, but the requested image goes first
+        requestedImage.m_requestedMip = 0.0f;
+        const TexelDensityMipSelector::Statistics statistics = mipSelector.Update(images);
+
+        EXPECT_EQ(requestedImage.m_targetMipChain, 0);
+        EXPECT_EQ(AZStd::min(neverRequestedImages[0].m_targetMipChain, neverRequestedImages[1].m_targetMipChain), 0);
+        EXPECT_EQ(AZStd::max(neverRequestedImages[0].m_targetMipChain, neverRequestedImages[1].m_targetMipChain), TailMipLevel);
+        EXPECT_LE(statistics.m_residentBytes, budget);
+        EXPECT_EQ(statistics.m_deferredImageCount, 0);
+    }
+
+    TEST_F(TexelDensityStreamingTests, Update_OverBudget_TrimsLeastNeededImageWithoutDelay)
+    {
+        using namespace TexelDensityStreamingTestUtils;
+
+        TexelDensityMipSelector::ImageState nearImage = CreateImageState();
+        TexelDensityMipSelector::ImageState farImage = CreateImageState();
+        TexelDensityMipSelector::ImageState* images[] = { &nearImage, &farImage };
+
+        // Room for one image with all its mips and the tail of the other
+        const AZ::u64 budget = GetTotalByteCount(nearImage) + farImage.m_mipChains.back().m_byteCount;
+        TexelDensityMipSelector mipSelector(CreateSettings(budget, 100));
+
+        nearImage.m_requestedMip = 0.0f;
+        farImage.m_requestedMip = 4.0f;
+        mipSelector.Update(images);
+        EXPECT_EQ(nearImage.m_targetMipChain, 0);
+        EXPECT_EQ(farImage.m_targetMipChain, TailMipLevel);
+
+        // The camera turns around, the far image becomes the near one long before the trim delay
+        nearImage.m_requestedMip = TailMipLevel;
+        farImage.m_requestedMip = 0.0f;
+        const TexelDensityMipSelector::Statistics statistics = mipSelector.Update(images);
+
+        EXPECT_EQ(farImage.m_targetMipChain, 0);
+        EXPECT_EQ(nearImage.m_targetMipChain, TailMipLevel);
+        EXPECT_LE(statistics.m_residentBytes, budget);
+        EXPECT_EQ(statistics.m_deferredImageCount, 0);
+    }
+
+    TEST_F(TexelDensityStreamingTests, Update_ExpandLimit_DefersRemainingImages)
+    {
+        using namespace TexelDensityStreamingTestUtils;
+
+        TexelDensityStreamingSettings settings = CreateSettings(0, 10);
+        settings.m_maxExpandsPerUpdate = 4;
+        TexelDensityMipSelector mipSelector(settings);
+
+        TexelDensityMipSelector::ImageState imageStates[] = { CreateImageState(), CreateImageState() };
+        TexelDensityMipSelector::ImageState* images[] = { &imageStates[0], &imageStates[1] };
+        imageStates[0].m_requestedMip = 0.0f;
+        imageStates[1].m_requestedMip = 3.0f;
+        const TexelDensityMipSelector::Statistics statistics = mipSelector.Update(images);
+
+        // The image that needs the most detail goes first
+        EXPECT_EQ(statistics.m_expandedMipChainCount, 4);
+        EXPECT_EQ(imageStates[0].m_targetMipChain, 1);
+        EXPECT_EQ(imageStates[1].m_targetMipChain, TailMipLevel);
+        EXPECT_EQ(statistics.m_deferredImageCount, 2);
+    }
+
+    TEST_F(TexelDensityStreamingTests, Simulation_RecordedCameraPath_StaysInBudgetWithLowerPeakBandwidthThanDefaultController)
+    {
+        using namespace TexelDensityStreamingTestUtils;
+
+        const RecordedCameraPath cameraPath = RecordCameraPath();
+        const AZ::u64 budget = GetTotalByteCount(CreateImageState()) * cameraPath.m_imageCount / 4;
+
+        const ReplayResult defaultResult = ReplayWithDefaultController(cameraPath, budget);
+        const ReplayResult texelDensityResult = ReplayWithMipSelector(cameraPath, CreateSettings(budget, 30));
+
+        // The default controller keeps every mip of every image resident, four times the budget
+        EXPECT_GT(defaultResult.m_peakResidentBytes, budget);
+        EXPECT_GT(defaultResult.m_framesOverBudget, 0);
+
+        EXPECT_LE(texelDensityResult.m_peakResidentBytes, budget);
+        EXPECT_EQ(texelDensityResult.m_framesOverBudget, 0);
+
+        // The mips are streamed as the objects come closer instead of all at once when the images are attached. Trimmed
+        // mips are streamed again when the camera comes back to their images, which the default controller avoids by
+        // never trimming, so the total is only bounded by a few times the size of all the images.
+        EXPECT_LT(texelDensityResult.m_peakStreamedBytesPerFrame, defaultResult.m_peakStreamedBytesPerFrame / 4);
+        EXPECT_LT(texelDensityResult.m_streamedBytes, defaultResult.m_streamedBytes * 8);
+
+        // Within the budget, images are only rarely more than one mip blurrier than requested
+        const uint32_t imageFrameCount = cameraPath.m_imageCount * aznumeric_cast<uint32_t>(cameraPath.m_requestedMips.size());
+        EXPECT_LT(texelDensityResult.m_framesTooBlurry, imageFrameCount / 20);
+    }
+} // namespace UnitTest
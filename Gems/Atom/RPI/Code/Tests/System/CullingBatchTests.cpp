@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/CullingBatch.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    namespace CullingBatchTestUtils
+    {
+        // Perspective frustum of a camera at the origin, with spheres placed all around it
+        Frustum CreateTestFrustum()
+        {
+            const Matrix4x4 worldToView = Matrix4x4::CreateRotationX(-Constants::HalfPi);
+            const Matrix4x4 viewToClip = Matrix4x4::CreateProjection(Constants::HalfPi, 16.0f / 9.0f, 0.1f, 100.0f);
+            return Frustum::CreateFromMatrixColumnMajor(viewToClip * worldToView);
+        }
+
+        void AddRandomSpheres(uint32_t count, CullingBatch& batch, AZStd::vector<Sphere>& spheres)
+        {
+            SimpleLcgRandom random;
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                const Vector3 center(
+                    random.GetRandomFloat() * 240.0f - 120.0f, random.GetRandomFloat() * 240.0f - 120.0f,
+                    random.GetRandomFloat() * 240.0f - 120.0f);
+                const float radius = 0.1f + random.GetRandomFloat() * 10.0f;
+                spheres.emplace_back(center, radius);
+                batch.Add(center, radius, 0.5f * radius);
+            }
+        }
+
+        // The batch evaluates the plane distances with multiply-adds, which may round differently than the scalar plane distance.
+        // Spheres that touch a plane within the rounding error can therefore be classified differently by either path.
+        bool IsOnClassificationBoundary(const Frustum& frustum, const Sphere& sphere)
+        {
+            constexpr float Tolerance = 1.0e-3f;
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const float distance = frustum.GetPlane(planeId).GetPointDist(sphere.GetCenter());
+                if (AZ::GetAbs(distance + sphere.GetRadius()) < Tolerance || AZ::GetAbs(distance - sphere.GetRadius()) < Tolerance)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace CullingBatchTestUtils
+
+    class CullingBatchTests : public RPITestFixture
+    {
+    };
+
+    TEST_F(CullingBatchTests, Add_ReturnsSequentialIndices)
+    {
+        CullingBatch batch;
+        EXPECT_EQ(batch.Add(Vector3::CreateZero(), 1.0f, 1.0f), 0u);
+        EXPECT_EQ(batch.Add(Vector3::CreateOne(), 1.0f, 1.0f), 1u);
+        EXPECT_EQ(batch.GetSize(), 2u);
+
+        batch.Clear();
+        EXPECT_EQ(batch.GetSize(), 0u);
+        EXPECT_EQ(batch.Add(Vector3::CreateZero(), 1.0f, 1.0f), 0u);
+    }
+
+    TEST_F(CullingBatchTests, ClassifySpheres_MatchesFrustumIntersectSphere)
+    {
+        const Frustum frustum = CullingBatchTestUtils::CreateTestFrustum();
+
+        // Cover sizes that don't fill the last set of lanes
+        for (uint32_t count : { 1u, 3u, CullingBatch::LaneCount, CullingBatch::LaneCount + 1, 1000u })
+        {
+            CullingBatch batch;
+            AZStd::vector<Sphere> spheres;
+            CullingBatchTestUtils::AddRandomSpheres(count, batch, spheres);
+
+            AZStd::vector<uint32_t> interiorIndices;
+            AZStd::vector<uint32_t> overlappingIndices;
+            batch.ClassifySpheres(frustum, interiorIndices, overlappingIndices);
+
+            AZStd::vector<IntersectResult> results(count, IntersectResult::Exterior);
+            for (uint32_t index : interiorIndices)
+            {
+                ASSERT_LT(index, count);
+                results[index] = IntersectResult::Interior;
+            }
+            for (uint32_t index : overlappingIndices)
+            {
+                ASSERT_LT(index, count);
+                EXPECT_EQ(results[index], IntersectResult::Exterior);
+                results[index] = IntersectResult::Overlaps;
+            }
+
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                if (!CullingBatchTestUtils::IsOnClassificationBoundary(frustum, spheres[index]))
+                {
+                    EXPECT_EQ(results[index], frustum.IntersectSphere(spheres[index])) << "Sphere " << index << " of " << count;
+                }
+            }
+        }
+    }
+
+    TEST_F(CullingBatchTests, CalculateScreenPercentages_MatchesApproxScreenPercentage)
+    {
+        CullingBatch batch;
+        AZStd::vector<Sphere> spheres;
+        CullingBatchTestUtils::AddRandomSpheres(CullingBatch::LaneCount * 8 + 3, batch, spheres);
+
+        const Vector3 cameraPosition(1.0f, 2.0f, 3.0f);
+        const float yScale = 1.5f;
+        for (bool isPerspective : { true, false })
+        {
+            AZStd::vector<float> screenPercentages;
+            batch.CalculateScreenPercentages(cameraPosition, yScale, isPerspective, screenPercentages);
+            ASSERT_EQ(screenPercentages.size(), spheres.size());
+
+            for (size_t index = 0; index < spheres.size(); ++index)
+            {
+                const float expected = ModelLodUtils::ApproxScreenPercentage(
+                    spheres[index].GetCenter(), 0.5f * spheres[index].GetRadius(), cameraPosition, yScale, isPerspective);
+                EXPECT_NEAR(screenPercentages[index], expected, 1.0e-5f);
+            }
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class CullingBatchBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            InternalSetUp(st);
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            InternalSetUp(st);
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+    protected:
+        void InternalSetUp(const ::benchmark::State& st)
+        {
+            m_frustum = CullingBatchTestUtils::CreateTestFrustum();
+            m_batch = AZStd::make_unique<CullingBatch>();
+            m_spheres = {};
+            CullingBatchTestUtils::AddRandomSpheres(aznumeric_cast<uint32_t>(st.range(0)), *m_batch, m_spheres);
+        }
+
+        void InternalTearDown()
+        {
+            m_batch.reset();
+            m_spheres = {};
+        }
+
+        Frustum m_frustum;
+        AZStd::unique_ptr<CullingBatch> m_batch;
+        AZStd::vector<Sphere> m_spheres;
+    };
+
+    // Per sphere frustum test and lod calculation, which is what the culling system did before cullables were batched
+    BENCHMARK_DEFINE_F(CullingBatchBenchmarkFixture, ScalarFrustumAndLod)(::benchmark::State& state)
+    {
+        const Vector3 cameraPosition = Vector3::CreateZero();
+        AZStd::vector<uint32_t> visibleIndices;
+        AZStd::vector<float> screenPercentages;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            visibleIndices.clear();
+            screenPercentages.clear();
+            for (uint32_t index = 0; index < m_spheres.size(); ++index)
+            {
+                if (m_frustum.IntersectSphere(m_spheres[index]) != IntersectResult::Exterior)
+                {
+                    visibleIndices.push_back(index);
+                    screenPercentages.push_back(ModelLodUtils::ApproxScreenPercentage(
+                        m_spheres[index].GetCenter(), 0.5f * m_spheres[index].GetRadius(), cameraPosition, 1.0f, true));
+                }
+            }
+            ::benchmark::DoNotOptimize(screenPercentages.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_spheres.size());
+    }
+    BENCHMARK_REGISTER_F(CullingBatchBenchmarkFixture, ScalarFrustumAndLod)->Arg(10000)->Arg(100000)->Arg(500000)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(CullingBatchBenchmarkFixture, BatchedFrustumAndLod)(::benchmark::State& state)
+    {
+        const Vector3 cameraPosition = Vector3::CreateZero();
+        AZStd::vector<uint32_t> interiorIndices;
+        AZStd::vector<uint32_t> overlappingIndices;
+        AZStd::vector<float> screenPercentages;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            interiorIndices.clear();
+            overlappingIndices.clear();
+            m_batch->ClassifySpheres(m_frustum, interiorIndices, overlappingIndices);
+            m_batch->CalculateScreenPercentages(cameraPosition, 1.0f, true, screenPercentages);
+            ::benchmark::DoNotOptimize(screenPercentages.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_spheres.size());
+    }
+    BENCHMARK_REGISTER_F(CullingBatchBenchmarkFixture, BatchedFrustumAndLod)->Arg(10000)->Arg(100000)->Arg(500000)->Unit(::benchmark::kMicrosecond);
+#endif // defined(HAVE_BENCHMARK)
+} // namespace UnitTest
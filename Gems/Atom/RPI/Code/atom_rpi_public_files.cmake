@@ -11,6 +11,7 @@ set(FILES
     Include/Atom/RPI.Public/Base.h
     Include/Atom/RPI.Public/BlockCompression.h
     Include/Atom/RPI.Public/Culling.h
+    Include/Atom/RPI.Public/CullingBatch.h
     Include/Atom/RPI.Public/FeatureProcessor.h
     Include/Atom/RPI.Public/FeatureProcessorFactory.h
     Include/Atom/RPI.Public/MeshDrawPacket.h
@@ -49,6 +50,7 @@ set(FILES
     Include/Atom/RPI.Public/Image/StreamingImageContext.h
     Include/Atom/RPI.Public/Image/StreamingImageController.h
     Include/Atom/RPI.Public/Image/StreamingImagePool.h
+    Include/Atom/RPI.Public/Image/TexelDensityStreamingImageController.h
     Include/Atom/RPI.Public/Material/Material.h
     Include/Atom/RPI.Public/Material/MaterialReloadNotificationBus.h
     Include/Atom/RPI.Public/Material/MaterialSystem.h
@@ -103,6 +105,7 @@ set(FILES
     Include/Atom/RPI.Public/GpuQuery/TimestampQueryPool.h
     Include/Atom/RPI.Public/XR/XRRenderingInterface.h
     Source/RPI.Public/Culling.cpp
+    Source/RPI.Public/CullingBatch.cpp
     Source/RPI.Public/FeatureProcessor.cpp
     Source/RPI.Public/FeatureProcessorFactory.cpp
     Source/RPI.Public/MeshDrawPacket.cpp
@@ -131,6 +134,7 @@ set(FILES
     Source/RPI.Public/Image/StreamingImageContext.cpp
     Source/RPI.Public/Image/StreamingImageController.cpp
     Source/RPI.Public/Image/StreamingImagePool.cpp
+    Source/RPI.Public/Image/TexelDensityStreamingImageController.cpp
     Source/RPI.Public/Material/Material.cpp
     Source/RPI.Public/Material/MaterialSystem.cpp
     Source/RPI.Public/Model/Model.cpp
@@ -50,6 +50,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Image/StreamingImageControllerAsset.h
     Include/Atom/RPI.Reflect/Image/StreamingImagePoolAsset.h
     Include/Atom/RPI.Reflect/Image/StreamingImagePoolAssetCreator.h
+    Include/Atom/RPI.Reflect/Image/TexelDensityStreamingImageControllerAsset.h
     Include/Atom/RPI.Reflect/Material/LuaMaterialFunctor.h
     Include/Atom/RPI.Reflect/Material/MaterialAsset.h
     Include/Atom/RPI.Reflect/Material/MaterialAssetCreator.h
@@ -90,6 +91,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Shader/ShaderVariantAsset.h
     Include/Atom/RPI.Reflect/Shader/IShaderVariantFinder.h
     Include/Atom/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.h
+    Include/Atom/RPI.Reflect/Shader/PipelineStateCacheData.h
     Include/Atom/RPI.Reflect/System/AnyAsset.h
     Include/Atom/RPI.Reflect/System/AssetAliases.h
     Include/Atom/RPI.Reflect/System/PipelineRenderSettings.h
@@ -133,6 +135,7 @@ set(FILES
     Source/RPI.Reflect/Image/StreamingImageControllerAsset.cpp
     Source/RPI.Reflect/Image/StreamingImagePoolAsset.cpp
     Source/RPI.Reflect/Image/StreamingImagePoolAssetCreator.cpp
+    Source/RPI.Reflect/Image/TexelDensityStreamingImageControllerAsset.cpp
     Source/RPI.Reflect/Material/MaterialPropertyValue.cpp
     Source/RPI.Reflect/Material/MaterialAsset.cpp
     Source/RPI.Reflect/Material/MaterialAssetCreator.cpp
@@ -161,6 +164,7 @@ set(FILES
     Source/RPI.Reflect/Shader/ShaderVariantTreeAsset.cpp
     Source/RPI.Reflect/Shader/ShaderVariantAsset.cpp
     Source/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.cpp
+    Source/RPI.Reflect/Shader/PipelineStateCacheData.cpp
     Source/RPI.Reflect/System/AnyAsset.cpp
     Source/RPI.Reflect/System/AssetAliases.cpp
     Source/RPI.Reflect/System/RenderPipelineDescriptor.cpp
@@ -26,7 +26,9 @@ set(FILES
     Tests/Common/RHI/Stubs.h
     Tests/Common/ShaderAssetTestUtils.cpp
     Tests/Common/ShaderAssetTestUtils.h
+    Tests/DynamicDraw/DynamicBufferAllocatorTests.cpp
     Tests/Image/StreamingImageTests.cpp
+    Tests/Image/TexelDensityStreamingTests.cpp
     Tests/Material/LuaMaterialFunctorTests.cpp
     Tests/Material/MaterialVersionUpdateTests.cpp
     Tests/Material/MaterialTypeAssetTests.cpp
@@ -49,6 +51,7 @@ set(FILES
     Tests/ShaderResourceGroup/ShaderResourceGroupConstantBufferTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupImageTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupGeneralTests.cpp
+    Tests/System/CullingBatchTests.cpp
     Tests/System/FeatureProcessorFactoryTests.cpp
     Tests/System/GpuQueryTests.cpp
     Tests/System/RenderPipelineTests.cpp
@@ -60,6 +60,8 @@ namespace AZ
                 uint32_t totalVisibleCullables = 0;
                 uint32_t totalVisibleDrawPackets = 0;
                 uint32_t totalCullJobs = 0;
+                uint32_t totalNodeCacheHits = 0;
+                uint32_t totalNodeCacheMisses = 0;
                 size_t numViews = 0;
 
                 auto& perViewCullStats = debugCtx.LockAndGetAllCullStats();
@@ -83,12 +85,14 @@ namespace AZ
                 for (CullStatsType* cullStats : cullStatsSorted)
                 {
                     // create formatted display strings
-                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs",
+                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs, %d/%d nodes cached",
                         cullStats->m_name.GetCStr(),
                         static_cast<uint32_t>(cullStats->m_numVisibleCullables),
                         static_cast<uint32_t>(debugCtx.m_numCullablesInScene),
                         static_cast<uint32_t>(cullStats->m_numVisibleDrawPackets),
-                        static_cast<uint32_t>(cullStats->m_numJobs)
+                        static_cast<uint32_t>(cullStats->m_numJobs),
+                        static_cast<uint32_t>(cullStats->m_numNodeCacheHits),
+                        static_cast<uint32_t>(cullStats->m_numNodeCacheHits + cullStats->m_numNodeCacheMisses)
                     ));
 
                     // collect totals
@@ -96,9 +100,11 @@ namespace AZ
                     totalVisibleCullables += cullStats->m_numVisibleCullables;
                     totalVisibleDrawPackets += cullStats->m_numVisibleDrawPackets;
                     totalCullJobs += cullStats->m_numJobs;
+                    totalNodeCacheHits += cullStats->m_numNodeCacheHits;
+                    totalNodeCacheMisses += cullStats->m_numNodeCacheMisses;
                 }
 
-                if (ImGui::BeginChild("Totals", ImVec2(0, 120.0f), true, ImGuiWindowFlags_None))
+                if (ImGui::BeginChild("Totals", ImVec2(0, 140.0f), true, ImGuiWindowFlags_None))
                 {
                     ImGui::Text("Totals:");
                     ImGui::Separator();
@@ -106,6 +112,7 @@ namespace AZ
                     ImGui::Text("   %u Cull Jobs", totalCullJobs);
                     ImGui::Text("   %d/%d Visible Cullables", totalVisibleCullables, totalCullables);
                     ImGui::Text("   %d Submitted DrawPackets", totalVisibleDrawPackets);
+                    ImGui::Text("   %u/%u Octree Node Cache Hits", totalNodeCacheHits, totalNodeCacheHits + totalNodeCacheMisses);
                 }                
                 ImGui::EndChild();
 
@@ -108,6 +108,7 @@ namespace AZ::AtomBridge
             }
             context = RPI::DynamicDrawInterface::Get()->CreateDynamicDrawContext();
             context->SetOutputScope(pipeline);
+            context->InitBufferConsumer(name);
             contextFactoryIt->second(context);
         }
 
@@ -105,6 +105,7 @@ void CDraw2d::OnBootstrapSceneReady(AZ::RPI::Scene* bootstrapScene)
 
     m_dynamicDraw = AZ::RPI::DynamicDrawInterface::Get()->CreateDynamicDrawContext();
     m_dynamicDraw->InitShader(shader);
+    m_dynamicDraw->InitBufferConsumer(AZ::Name("LyShine"));
     m_dynamicDraw->InitVertexFormat(
         { {"POSITION", AZ::RHI::Format::R32G32B32_FLOAT},
         {"COLOR", AZ::RHI::Format::B8G8R8A8_UNORM},
@@ -125,6 +125,7 @@ AZ::RHI::Ptr<AZ::RPI::DynamicDrawContext> UiRenderer::CreateDynamicDrawContext(
 
     // Initialize the dynamic draw context
     dynamicDraw->InitShader(uiShader);
+    dynamicDraw->InitBufferConsumer(AZ::Name("LyShine"));
     dynamicDraw->InitVertexFormat(
         { { "POSITION", AZ::RHI::Format::R32G32_FLOAT },
         { "COLOR", AZ::RHI::Format::B8G8R8A8_UNORM },
@@ -247,6 +248,7 @@ AZ::RHI::Ptr<AZ::RPI::DynamicDrawContext> UiRenderer::CreateDynamicDrawContextFo
 
     // Initialize the dynamic draw context
     dynamicDraw->InitShader(m_dynamicDraw->GetShader());
+    dynamicDraw->InitBufferConsumer(AZ::Name("LyShine"));
     dynamicDraw->InitVertexFormat(
         { { "POSITION", AZ::RHI::Format::R32G32_FLOAT },
         { "COLOR", AZ::RHI::Format::B8G8R8A8_UNORM },
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/FieldSchema.h>
 #include <AzNetworking/DataStructures/FixedSizeBitsetView.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/MultiplayerStats.h>
@@ -105,27 +106,34 @@ namespace Multiplayer
     inline void UpdateComponentMetrics
     (
         bool modifyRecord,
-        uint32_t prevSerializerSize,
-        uint32_t currSerializerSize,
+        uint32_t prevSerializerBits,
+        uint32_t currSerializerBits,
         NetComponentId componentId,
         PropertyIndex propertyIndex,
         MultiplayerStats& stats
     )
     {
-        const uint32_t updateSize = (currSerializerSize - prevSerializerSize);
-        if (updateSize > 0)
+        const uint32_t updateBits = (currSerializerBits - prevSerializerBits);
+        if (updateBits > 0)
         {
             if (modifyRecord)
             {
-                stats.RecordPropertyReceived(componentId, propertyIndex, updateSize);
+                stats.RecordPropertyReceived(componentId, propertyIndex, updateBits);
             }
             else
             {
-                stats.RecordPropertySent(componentId, propertyIndex, updateSize);
+                stats.RecordPropertySent(componentId, propertyIndex, updateBits);
             }
         }
     }
 
+    //! Field schemas are only applied to bit-packed payloads, byte aligned payloads keep the default encoding of every property.
+    inline const AzNetworking::FieldSchema& SelectFieldSchema(const AzNetworking::ISerializer& serializer, const AzNetworking::FieldSchema& schema)
+    {
+        static const AzNetworking::FieldSchema DefaultSchema;
+        return serializer.IsBitPacked() ? schema : DefaultSchema;
+    }
+
     template <typename TYPE>
     inline void SerializeNetworkPropertyHelper
     (
@@ -136,22 +144,24 @@ namespace Multiplayer
         const char* name,
         NetComponentId componentId,
         PropertyIndex propertyIndex,
-        MultiplayerStats& stats
+        MultiplayerStats& stats,
+        const AzNetworking::FieldSchema& schema = {}
     )
     {
         if (bitset.GetBit(bitIndex))
         {
             const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
-            const uint32_t prevUpdateSize = serializer.GetSize();
+            const uint32_t prevUpdateBits = serializer.GetSizeInBits();
             serializer.ClearTrackedChangesFlag();
-            serializer.Serialize(value, name);
+            // Unqualified so that overloads for rewindable types are found through argument dependent lookup
+            SerializeWithSchema(serializer, value, name, SelectFieldSchema(serializer, schema));
             if (modifyRecord && !serializer.GetTrackedChangesFlag())
             {
                 // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
                 bitset.SetBit(bitIndex, false);
             }
-            const uint32_t postUpdateSize = serializer.GetSize();
-            UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+            const uint32_t postUpdateBits = serializer.GetSizeInBits();
+            UpdateComponentMetrics(modifyRecord, prevUpdateBits, postUpdateBits, componentId, propertyIndex, stats);
         }
     }
 
@@ -163,25 +173,27 @@ namespace Multiplayer
         AZStd::array<TYPE, SIZE>& value,
         NetComponentId componentId,
         PropertyIndex propertyIndex,
-        MultiplayerStats& stats
+        MultiplayerStats& stats,
+        const AzNetworking::FieldSchema& schema = {}
     )
     {
         const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
-        const uint32_t prevUpdateSize = serializer.GetSize();
+        const AzNetworking::FieldSchema& fieldSchema = SelectFieldSchema(serializer, schema);
+        const uint32_t prevUpdateBits = serializer.GetSizeInBits();
         for (uint32_t i = 0; i < SIZE; ++i)
         {
             if (bitset.GetBit(i))
             {
                 serializer.ClearTrackedChangesFlag();
-                serializer.Serialize(value[i], "Element");
+                SerializeWithSchema(serializer, value[i], "Element", fieldSchema);
                 if (modifyRecord && !serializer.GetTrackedChangesFlag())
                 {
                     bitset.SetBit(i, false);
                 }
             }
         }
-        const uint32_t postUpdateSize = serializer.GetSize();
-        UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+        const uint32_t postUpdateBits = serializer.GetSizeInBits();
+        UpdateComponentMetrics(modifyRecord, prevUpdateBits, postUpdateBits, componentId, propertyIndex, stats);
     }
 
     template <typename TYPE, AZStd::size_t SIZE>
@@ -192,11 +204,13 @@ namespace Multiplayer
         AZStd::fixed_vector<TYPE, SIZE>& value,
         NetComponentId componentId,
         PropertyIndex propertyIndex,
-        MultiplayerStats& stats
+        MultiplayerStats& stats,
+        const AzNetworking::FieldSchema& schema = {}
     )
     {
         const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
-        const uint32_t prevUpdateSize = serializer.GetSize();
+        const AzNetworking::FieldSchema& fieldSchema = SelectFieldSchema(serializer, schema);
+        const uint32_t prevUpdateBits = serializer.GetSizeInBits();
         if (bitset.GetBit(SIZE))
         {
             using SizeType = typename AZ::SizeType<AZ::RequiredBytesForValue<SIZE>(), false>::Type;
@@ -215,14 +229,14 @@ namespace Multiplayer
             if (bitset.GetBit(i))
             {
                 serializer.ClearTrackedChangesFlag();
-                serializer.Serialize(value[i], "Element");
+                SerializeWithSchema(serializer, value[i], "Element", fieldSchema);
                 if (modifyRecord && !serializer.GetTrackedChangesFlag())
                 {
                     bitset.SetBit(i, false);
                 }
             }
         }
-        const uint32_t postUpdateSize = serializer.GetSize();
-        UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+        const uint32_t postUpdateBits = serializer.GetSizeInBits();
+        UpdateComponentMetrics(modifyRecord, prevUpdateBits, postUpdateBits, componentId, propertyIndex, stats);
     }
 }
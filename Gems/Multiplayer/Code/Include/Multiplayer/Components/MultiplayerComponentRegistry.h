@@ -19,6 +19,7 @@ namespace Multiplayer
     {
     public:
         using PropertyNameLookupFunction = AZStd::function<const char*(PropertyIndex index)>;
+        using PropertySchemaLookupFunction = AZStd::function<AzNetworking::FieldSchema(PropertyIndex index)>;
         using RpcNameLookupFunction = AZStd::function<const char*(RpcIndex index)>;
         using AllocComponentInputFunction = AZStd::function<AZStd::unique_ptr<IMultiplayerComponentInput>()>;
         struct ComponentData
@@ -26,6 +27,7 @@ namespace Multiplayer
             AZ::Name m_gemName;
             AZ::Name m_componentName;
             PropertyNameLookupFunction m_componentPropertyNameLookupFunction;
+            PropertySchemaLookupFunction m_componentPropertySchemaLookupFunction;
             RpcNameLookupFunction m_componentRpcNameLookupFunction;
             AllocComponentInputFunction m_allocComponentInputFunction;
         };
@@ -56,6 +58,12 @@ namespace Multiplayer
         //! @return the name of the network property
         const char* GetComponentPropertyName(NetComponentId netComponentId, PropertyIndex propertyIndex) const;
 
+        //! Returns the field schema used to bit-pack the network property at propertyIndex.
+        //! @param  netComponentId the NetComponentId to return the property schema of
+        //! @param  propertyIndex  the index of the network property to return the schema of
+        //! @return the schema of the network property, a default schema if the property does not specify an encoding
+        AzNetworking::FieldSchema GetComponentPropertySchema(NetComponentId netComponentId, PropertyIndex propertyIndex) const;
+
         //! Returns the Rpc name associated with the provided NetComponentId and rpcId.
         //! @param  netComponentId the NetComponentId to return the property name of
         //! @param  rpcIndex       the index of the rpc to return the rpc name of
@@ -10,6 +10,7 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/LagCompensationStore.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 
@@ -51,6 +52,9 @@ namespace Multiplayer
             const Physics::ShapeConfiguration* m_shapeConfig = nullptr;
             AZ::Transform m_colliderOffSetTransform;
             const AZ::u32 m_jointIndex = 0;
+
+            // Handle into the LagCompensationStore, only valid on the authority
+            LagCompensationStore::VolumeHandle m_lagCompensationHandle = LagCompensationStore::InvalidVolumeHandle;
         };
 
         AZ_MULTIPLAYER_COMPONENT(Multiplayer::NetworkHitVolumesComponent, s_networkHitVolumesComponentConcreteUuid, Multiplayer::NetworkHitVolumesComponentBase);
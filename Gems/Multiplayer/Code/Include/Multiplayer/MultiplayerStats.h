@@ -26,6 +26,10 @@ namespace Multiplayer
         uint64_t m_clientConnectionCount = 0;
         uint64_t m_serverConnectionCount = 0;
 
+        //! Serialized property deltas that were shared between connections rather than re-serialized
+        uint64_t m_propertyDeltaCacheHits = 0;
+        uint64_t m_propertyDeltaCacheMisses = 0;
+
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::Time::ZeroTimeMs;
 
@@ -38,6 +42,7 @@ namespace Multiplayer
             uint64_t m_totalBytes = 0;
             MetricRingbuffer m_callHistory;
             MetricRingbuffer m_byteHistory;
+            uint32_t m_pendingBits = 0; //!< Property bits recorded that don't add up to a whole byte yet
         };
 
         struct ComponentStats
@@ -53,12 +58,22 @@ namespace Multiplayer
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
         void RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
-        void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
-        void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
+        //! Property updates are recorded in bits, since bit-packed serializers don't round individual properties up to whole bytes.
+        //! The bits are accumulated into the byte metrics of the property.
+        //! @{
+        void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBits);
+        void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBits);
+        //! @}
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
+        void RecordPropertyDeltaCacheHit();
+        void RecordPropertyDeltaCacheMiss();
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
+        //! Returns the fraction of entity property deltas that were served from the property delta cache.
+        //! @return hit ratio in the range [0, 1], or 0 if no deltas have been serialized
+        float GetPropertyDeltaCacheHitRatio() const;
+
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
         Metric CalculateComponentPropertyUpdateRecvMetrics(NetComponentId netComponentId) const;
         Metric CalculateComponentRpcsSentMetrics(NetComponentId netComponentId) const;
@@ -73,8 +88,8 @@ namespace Multiplayer
             AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*> m_entitySerializeStart;
             AZ::Event<AzNetworking::SerializerMode, NetComponentId> m_componentSerializeEnd;
             AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*> m_entitySerializeStop;
-            AZ::Event<NetComponentId, PropertyIndex, uint32_t> m_propertySent;
-            AZ::Event<NetComponentId, PropertyIndex, uint32_t> m_propertyReceived;
+            AZ::Event<NetComponentId, PropertyIndex, uint32_t> m_propertySent; //!< Signaled with the size of the update in bits
+            AZ::Event<NetComponentId, PropertyIndex, uint32_t> m_propertyReceived; //!< Signaled with the size of the update in bits
             AZ::Event<AZ::EntityId, const char*, NetComponentId, RpcIndex, uint32_t> m_rpcSent;
             AZ::Event<AZ::EntityId, const char*, NetComponentId, RpcIndex, uint32_t> m_rpcReceived;
         };
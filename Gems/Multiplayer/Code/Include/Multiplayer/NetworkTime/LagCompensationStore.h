@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace Multiplayer
+{
+    //! Shape of a single lag compensated hit volume, described in the local space of the volume transform.
+    struct LagCompensatedShape
+    {
+        enum class Type : uint8_t
+        {
+            Sphere,
+            Capsule,
+            Box,
+        };
+
+        Type m_type = Type::Sphere;
+        float m_radius = 0.5f; //!< Radius of spheres and capsules
+        float m_height = 1.0f; //!< Total height of capsules along the local z axis, including both caps
+        AZ::Vector3 m_halfExtents = AZ::Vector3(0.5f); //!< Half extents of boxes
+
+        //! Returns the radius of a sphere centered on the shape origin that fully contains the shape.
+        //! @return the bounding radius of the shape in local space
+        float GetBoundingRadius() const;
+    };
+
+    //! Result of a lag compensated scene query.
+    struct LagCompensatedHit
+    {
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+        uint32_t m_volumeHandle = 0;
+        float m_distance = 0.0f; //!< Distance along the ray for raycasts, zero for overlaps
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero(); //!< Hit point for raycasts, rewound volume origin for overlaps
+    };
+
+    //! @class LagCompensationStore
+    //! @brief Server side history of hit volume transforms that answers rewound scene queries without moving physics bodies.
+    //!
+    //! Hit volumes of every entity are stored together as a structure of arrays per recorded frame, held in a ring of
+    //! historySize frames indexed by HostFrameId. Raycast and overlap queries against a past frame run a bounding sphere
+    //! test over four volumes at a time using AZ::Simd, and only run the exact shape test on the volumes that pass.
+    //! This avoids INetworkTime::SyncEntitiesToRewindState, which has to pose every physics shape in the rewind volume.
+    class LagCompensationStore
+    {
+    public:
+        AZ_TYPE_INFO(LagCompensationStore, "{FE35FAAC-D52E-46A1-B537-56CF16344BBD}");
+
+        using VolumeHandle = uint32_t;
+        static constexpr VolumeHandle InvalidVolumeHandle = AZStd::numeric_limits<VolumeHandle>::max();
+
+        //! Constructor.
+        //! @param historySize number of frames of history to keep
+        explicit LagCompensationStore(uint32_t historySize = RewindHistorySize);
+
+        //! Adds a hit volume to the store.
+        //! @param netEntityId the network entity that owns the hit volume
+        //! @param shape       the local space shape of the hit volume
+        //! @return handle used to record transforms for this volume
+        VolumeHandle RegisterVolume(NetEntityId netEntityId, const LagCompensatedShape& shape);
+
+        //! Removes a hit volume from the store, the handle may be reused by subsequent registrations.
+        //! @param volumeHandle the handle returned from RegisterVolume
+        void UnregisterVolume(VolumeHandle volumeHandle);
+
+        //! Records the world transform of a hit volume for the provided frame.
+        //! @param volumeHandle   the handle returned from RegisterVolume
+        //! @param frameId        the host frame the transform belongs to
+        //! @param worldTransform the world space transform of the hit volume
+        void RecordTransform(VolumeHandle volumeHandle, HostFrameId frameId, const AZ::Transform& worldTransform);
+
+        //! Casts a ray against all hit volumes as they were at the provided frame.
+        //! @param frameId           the host frame to rewind to
+        //! @param blendFactor       factor used to blend between the previous frame and frameId, as provided by INetworkTime::GetHostBlendFactor
+        //! @param start             the world space start of the ray
+        //! @param direction         the normalized direction of the ray
+        //! @param maxDistance       the maximum distance along the ray to test
+        //! @param ignoreNetEntityId hit volumes of this entity are skipped, typically the entity performing the query
+        //! @param outHit            the closest hit if any
+        //! @return boolean true if any hit volume was hit
+        bool Raycast
+        (
+            HostFrameId frameId,
+            float blendFactor,
+            const AZ::Vector3& start,
+            const AZ::Vector3& direction,
+            float maxDistance,
+            NetEntityId ignoreNetEntityId,
+            LagCompensatedHit& outHit
+        ) const;
+
+        //! Gathers all hit volumes that overlap a sphere as they were at the provided frame.
+        //! @param frameId           the host frame to rewind to
+        //! @param blendFactor       factor used to blend between the previous frame and frameId, as provided by INetworkTime::GetHostBlendFactor
+        //! @param center            the world space center of the sphere
+        //! @param radius            the radius of the sphere
+        //! @param ignoreNetEntityId hit volumes of this entity are skipped, typically the entity performing the query
+        //! @param outHits           overlapping hit volumes are appended to this vector
+        //! @return the number of overlapping hit volumes appended
+        uint32_t Overlap
+        (
+            HostFrameId frameId,
+            float blendFactor,
+            const AZ::Vector3& center,
+            float radius,
+            NetEntityId ignoreNetEntityId,
+            AZStd::vector<LagCompensatedHit>& outHits
+        ) const;
+
+        //! Returns the number of currently registered hit volumes.
+        //! @return the number of currently registered hit volumes
+        uint32_t GetVolumeCount() const;
+
+        //! Returns the number of frames of history kept by the store.
+        //! @return the number of frames of history kept by the store
+        uint32_t GetHistorySize() const;
+
+    private:
+
+        //! All volumes for one recorded frame, padded to a multiple of four so the query kernels never need a scalar tail.
+        struct FrameSlot
+        {
+            AZStd::vector<float> m_centerX;
+            AZStd::vector<float> m_centerY;
+            AZStd::vector<float> m_centerZ;
+            AZStd::vector<float> m_radius;
+            AZStd::vector<AZ::Transform> m_transforms;
+            AZStd::vector<uint32_t> m_frameIds; // Raw HostFrameId values so they can be loaded as SIMD lanes
+        };
+
+        uint32_t GetSlotIndex(HostFrameId frameId) const;
+        void ResizeSlots(uint32_t volumeCapacity);
+        bool GetRewoundTransform(VolumeHandle volumeHandle, HostFrameId frameId, float blendFactor, AZ::Transform& outTransform) const;
+
+        AZStd::vector<FrameSlot> m_frameSlots;
+        AZStd::vector<LagCompensatedShape> m_shapes;
+        AZStd::vector<NetEntityId> m_netEntityIds;
+        AZStd::vector<VolumeHandle> m_freeHandles;
+        uint32_t m_volumeCapacity = 0;
+        uint32_t m_volumeCount = 0;
+    };
+
+    // Convenience helpers
+    inline LagCompensationStore* GetLagCompensationStore()
+    {
+        return AZ::Interface<LagCompensationStore>::Get();
+    }
+}
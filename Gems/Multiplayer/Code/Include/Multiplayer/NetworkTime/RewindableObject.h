@@ -10,6 +10,7 @@
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/FieldSchema.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/std/containers/array.h>
@@ -87,6 +88,12 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serialize method which encodes the current value using the provided field schema.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @param schema     the schema describing how to encode the value
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(AzNetworking::ISerializer& serializer, const AzNetworking::FieldSchema& schema);
+
     private:
 
         //! Returns what the appropriate current time is for this rewindable property.
@@ -117,6 +124,15 @@ namespace Multiplayer
         HostFrameId m_lastSerializedTime = HostFrameId{0};
         uint32_t m_headIndex = 0;
     };
+
+    //! Serializes a rewindable object using the provided field schema, found through argument dependent lookup by network property serialization.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the rewindable object to serialize
+    //! @param name       the name of the value
+    //! @param schema     the schema describing how to encode the value
+    //! @return boolean true for success, false for serialization failure
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    bool SerializeWithSchema(AzNetworking::ISerializer& serializer, RewindableObject<BASE_TYPE, REWIND_SIZE>& value, const char* name, const AzNetworking::FieldSchema& schema);
 }
 
 namespace AZ
@@ -110,10 +110,16 @@ namespace Multiplayer
 
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        return Serialize(serializer, AzNetworking::FieldSchema{});
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer, const AzNetworking::FieldSchema& schema)
     {
         const HostFrameId frameTime = GetCurrentTimeForProperty();
         BASE_TYPE value = GetValueForTime(frameTime);
-        if (serializer.Serialize(value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        if (AzNetworking::SerializeWithSchema(serializer, value, "Element", schema) && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
         {
             SetValueForTime(value, frameTime);
             if (m_headTime == frameTime && m_headTime > m_lastSerializedTime)
@@ -202,4 +208,18 @@ namespace Multiplayer
         }
         return ((m_headIndex + m_history.size()) - absoluteIndex) % m_history.size();
     }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline bool SerializeWithSchema(AzNetworking::ISerializer& serializer, RewindableObject<BASE_TYPE, REWIND_SIZE>& value, const char* name, const AzNetworking::FieldSchema& schema)
+    {
+        if (serializer.BeginObject(name, "Type name unknown"))
+        {
+            if (value.Serialize(serializer, schema))
+            {
+                return serializer.EndObject(name, "Type name unknown");
+            }
+        }
+        return false;
+    }
 }
+
@@ -41,6 +41,16 @@ namespace Multiplayer
         return componentData.m_componentPropertyNameLookupFunction(propertyIndex);
     }
 
+    AzNetworking::FieldSchema MultiplayerComponentRegistry::GetComponentPropertySchema(NetComponentId netComponentId, PropertyIndex propertyIndex) const
+    {
+        const ComponentData& componentData = GetMultiplayerComponentData(netComponentId);
+        if (componentData.m_componentPropertySchemaLookupFunction)
+        {
+            return componentData.m_componentPropertySchemaLookupFunction(propertyIndex);
+        }
+        return AzNetworking::FieldSchema{};
+    }
+
     const char* MultiplayerComponentRegistry::GetComponentRpcName(NetComponentId netComponentId, RpcIndex rpcIndex) const
     {
         const ComponentData& componentData = GetMultiplayerComponentData(netComponentId);
@@ -12,6 +12,7 @@
 #include <AzFramework/Physics/CharacterBus.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/SystemBus.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
 #include <MCore/Source/AzCoreConversions.h>
 #include <Integration/ActorComponentBus.h>
 
@@ -23,6 +24,38 @@ namespace Multiplayer
     AZ_CVAR(float, bg_RewindPositionTolerance, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta position is less than this value");
     AZ_CVAR(float, bg_RewindOrientationTolerance, 0.001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta orientation is less than this value");
 
+    //! Converts a physics shape configuration into a lag compensated shape, returns false for unsupported shape types.
+    static bool GetLagCompensatedShape(const Physics::ShapeConfiguration& shapeConfig, LagCompensatedShape& outShape)
+    {
+        switch (shapeConfig.GetShapeType())
+        {
+        case Physics::ShapeType::Sphere:
+        {
+            const auto& sphereConfig = static_cast<const Physics::SphereShapeConfiguration&>(shapeConfig);
+            outShape.m_type = LagCompensatedShape::Type::Sphere;
+            outShape.m_radius = sphereConfig.m_radius * shapeConfig.m_scale.GetMaxElement();
+            return true;
+        }
+        case Physics::ShapeType::Capsule:
+        {
+            const auto& capsuleConfig = static_cast<const Physics::CapsuleShapeConfiguration&>(shapeConfig);
+            outShape.m_type = LagCompensatedShape::Type::Capsule;
+            outShape.m_radius = capsuleConfig.m_radius * AZ::GetMax(shapeConfig.m_scale.GetX(), shapeConfig.m_scale.GetY());
+            outShape.m_height = capsuleConfig.m_height * shapeConfig.m_scale.GetZ();
+            return true;
+        }
+        case Physics::ShapeType::Box:
+        {
+            const auto& boxConfig = static_cast<const Physics::BoxShapeConfiguration&>(shapeConfig);
+            outShape.m_type = LagCompensatedShape::Type::Box;
+            outShape.m_halfExtents = boxConfig.m_dimensions * shapeConfig.m_scale * 0.5f;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
     NetworkHitVolumesComponent::AnimatedHitVolume::AnimatedHitVolume
     (
         AzNetworking::ConnectionId connectionId,
@@ -142,12 +175,21 @@ namespace Multiplayer
             CreateHitVolumes();
         }
 
+        LagCompensationStore* lagCompensationStore = GetLagCompensationStore();
+        const AZ::Transform& worldTransform = GetTransformComponent()->GetWorldTM();
+        const HostFrameId hostFrameId = GetNetworkTime()->GetHostFrameId();
+
         AZ::Vector3 position, scale;
         AZ::Quaternion rotation;
         for (AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
         {
             m_actorComponent->GetJointTransformComponents(hitVolume.m_jointIndex, EMotionFX::Integration::Space::ModelSpace, position, rotation, scale);
             hitVolume.UpdateTransform(AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position) * hitVolume.m_colliderOffSetTransform);
+
+            if (lagCompensationStore && (hitVolume.m_lagCompensationHandle != LagCompensationStore::InvalidVolumeHandle))
+            {
+                lagCompensationStore->RecordTransform(hitVolume.m_lagCompensationHandle, hostFrameId, worldTransform * hitVolume.m_transform.Get());
+            }
         }
     }
 
@@ -186,6 +228,9 @@ namespace Multiplayer
         m_hitDetectionConfig = &physicsConfig->m_hitDetectionConfig;
         const AzNetworking::ConnectionId owningConnectionId = GetNetBindComponent()->GetOwningConnectionId();
 
+        // Only the authority answers rewound scene queries, so only the authority populates the lag compensation store
+        LagCompensationStore* lagCompensationStore = GetNetBindComponent()->IsNetEntityRoleAuthority() ? GetLagCompensationStore() : nullptr;
+
         m_animatedHitVolumes.reserve(m_hitDetectionConfig->m_nodes.size());
         for (const Physics::CharacterColliderNodeConfiguration& nodeConfig : m_hitDetectionConfig->m_nodes)
         {
@@ -199,13 +244,26 @@ namespace Multiplayer
             {
                 const Physics::ColliderConfiguration* colliderConfig = coliderPair.first.get();
                 Physics::ShapeConfiguration* shapeConfig = coliderPair.second.get();
-                m_animatedHitVolumes.emplace_back(owningConnectionId, m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
+                AnimatedHitVolume& hitVolume = m_animatedHitVolumes.emplace_back(owningConnectionId, m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
+
+                LagCompensatedShape lagCompensatedShape;
+                if (lagCompensationStore && GetLagCompensatedShape(*shapeConfig, lagCompensatedShape))
+                {
+                    hitVolume.m_lagCompensationHandle = lagCompensationStore->RegisterVolume(GetNetEntityId(), lagCompensatedShape);
+                }
             }
         }
     }
 
     void NetworkHitVolumesComponent::DestroyHitVolumes()
     {
+        if (LagCompensationStore* lagCompensationStore = GetLagCompensationStore())
+        {
+            for (const AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+            {
+                lagCompensationStore->UnregisterVolume(hitVolume.m_lagCompensationHandle);
+            }
+        }
         m_animatedHitVolumes.clear();
     }
 
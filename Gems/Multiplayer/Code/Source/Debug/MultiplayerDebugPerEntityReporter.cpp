@@ -142,14 +142,14 @@ namespace Multiplayer
                 RecordEntitySerializeStop(mode, entityId, entityName);
             });
         m_eventHandlers.m_propertySent = decltype(m_eventHandlers.m_propertySent)([this](NetComponentId netComponentId,
-                                                                                         PropertyIndex propertyId, uint32_t totalBytes)
+                                                                                         PropertyIndex propertyId, uint32_t totalBits)
             {
-                RecordPropertySent(netComponentId, propertyId, totalBytes);
+                RecordPropertySent(netComponentId, propertyId, totalBits);
             });
         m_eventHandlers.m_propertyReceived = decltype(m_eventHandlers.m_propertyReceived)([this](NetComponentId netComponentId,
-            PropertyIndex propertyId, uint32_t totalBytes)
+            PropertyIndex propertyId, uint32_t totalBits)
             {
-                RecordPropertyReceived(netComponentId, propertyId, totalBytes);
+                RecordPropertyReceived(netComponentId, propertyId, totalBits);
             });
         m_eventHandlers.m_rpcSent = decltype(m_eventHandlers.m_rpcSent)([this](AZ::EntityId entityId, const char* entityName,
                                                                                NetComponentId netComponentId,
@@ -260,26 +260,28 @@ namespace Multiplayer
     void MultiplayerDebugPerEntityReporter::RecordPropertySent(
         NetComponentId netComponentId,
         PropertyIndex propertyId,
-        uint32_t totalBytes)
+        uint32_t totalBits)
     {
         if (const MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry())
         {
+            // Field reports are in whole bytes, so bit-packed fields are rounded up
             m_currentSendingEntityReport.ReportField(static_cast<AZ::u32>(netComponentId),
                 componentRegistry->GetComponentName(netComponentId),
-                componentRegistry->GetComponentPropertyName(netComponentId, propertyId), totalBytes);
+                componentRegistry->GetComponentPropertyName(netComponentId, propertyId), (totalBits + 7) / 8);
         }
     }
 
     void MultiplayerDebugPerEntityReporter::RecordPropertyReceived(
         NetComponentId netComponentId,
         PropertyIndex propertyId,
-        uint32_t totalBytes)
+        uint32_t totalBits)
     {
         if (const MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry())
         {
+            // Field reports are in whole bytes, so bit-packed fields are rounded up
             m_currentReceivingEntityReport.ReportField(static_cast<AZ::u32>(netComponentId),
                 componentRegistry->GetComponentName(netComponentId),
-                componentRegistry->GetComponentPropertyName(netComponentId, propertyId), totalBytes);
+                componentRegistry->GetComponentPropertyName(netComponentId, propertyId), (totalBits + 7) / 8);
         }
     }
 
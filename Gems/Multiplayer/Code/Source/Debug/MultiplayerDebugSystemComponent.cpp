@@ -461,6 +461,8 @@ namespace Multiplayer
         ImGui::Text("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
         ImGui::Text("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
         ImGui::Text("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+        ImGui::Text("Property delta cache hit ratio: %.1f%% (%llu hits, %llu misses)", stats.GetPropertyDeltaCacheHitRatio() * 100.0f,
+            aznumeric_cast<AZ::u64>(stats.m_propertyDeltaCacheHits), aznumeric_cast<AZ::u64>(stats.m_propertyDeltaCacheMisses));
         ImGui::NewLine();
 
         static ImGuiTableFlags flags = ImGuiTableFlags_BordersV
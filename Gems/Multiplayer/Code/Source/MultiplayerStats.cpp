@@ -16,6 +16,15 @@ namespace Multiplayer
         AZStd::uninitialized_fill_n(m_byteHistory.data(), RingbufferSamples, 0);
     }
 
+    // Adds the bits to the pending bits of the metric and returns the whole bytes they add up to, the remainder stays pending
+    static uint32_t ConsumeWholeBytes(MultiplayerStats::Metric& metric, uint32_t totalBits)
+    {
+        metric.m_pendingBits += totalBits;
+        const uint32_t totalBytes = metric.m_pendingBits / 8;
+        metric.m_pendingBits %= 8;
+        return totalBytes;
+    }
+
     void MultiplayerStats::ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
@@ -44,28 +53,32 @@ namespace Multiplayer
         m_events.m_entitySerializeStop.Signal(mode, entityId, entityName);
     }
 
-    void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
+    void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBits)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
-        m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
-        m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalBytes += totalBytes;
-        m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_callHistory[m_recordMetricIndex]++;
-        m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+        Metric& metric = m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex];
+        const uint32_t totalBytes = ConsumeWholeBytes(metric, totalBits);
+        metric.m_totalCalls++;
+        metric.m_totalBytes += totalBytes;
+        metric.m_callHistory[m_recordMetricIndex]++;
+        metric.m_byteHistory[m_recordMetricIndex] += totalBytes;
 
-        m_events.m_propertySent.Signal(netComponentId, propertyId, totalBytes);
+        m_events.m_propertySent.Signal(netComponentId, propertyId, totalBits);
     }
 
-    void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
+    void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBits)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
-        m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_totalCalls++;
-        m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_totalBytes += totalBytes;
-        m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_callHistory[m_recordMetricIndex]++;
-        m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+        Metric& metric = m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex];
+        const uint32_t totalBytes = ConsumeWholeBytes(metric, totalBits);
+        metric.m_totalCalls++;
+        metric.m_totalBytes += totalBytes;
+        metric.m_callHistory[m_recordMetricIndex]++;
+        metric.m_byteHistory[m_recordMetricIndex] += totalBytes;
 
-        m_events.m_propertyReceived.Signal(netComponentId, propertyId, totalBytes);
+        m_events.m_propertyReceived.Signal(netComponentId, propertyId, totalBits);
     }
 
     void MultiplayerStats::RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
@@ -92,6 +105,22 @@ namespace Multiplayer
         m_events.m_rpcReceived.Signal(entityId, entityName, netComponentId, rpcId, totalBytes);
     }
 
+    void MultiplayerStats::RecordPropertyDeltaCacheHit()
+    {
+        m_propertyDeltaCacheHits++;
+    }
+
+    void MultiplayerStats::RecordPropertyDeltaCacheMiss()
+    {
+        m_propertyDeltaCacheMisses++;
+    }
+
+    float MultiplayerStats::GetPropertyDeltaCacheHitRatio() const
+    {
+        const uint64_t totalLookups = m_propertyDeltaCacheHits + m_propertyDeltaCacheMisses;
+        return (totalLookups > 0) ? aznumeric_cast<float>(m_propertyDeltaCacheHits) / aznumeric_cast<float>(totalLookups) : 0.0f;
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
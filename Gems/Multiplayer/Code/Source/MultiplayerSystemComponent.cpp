@@ -178,10 +178,14 @@ namespace Multiplayer
         , m_autonomousEntityReplicatorCreatedHandler([this]([[maybe_unused]] NetEntityId netEntityId) { OnAutonomousEntityReplicatorCreated(); })
     {
         AZ::Interface<IMultiplayer>::Register(this);
+        AZ::Interface<PropertyDeltaCache>::Register(&m_propertyDeltaCache);
+        AZ::Interface<LagCompensationStore>::Register(&m_lagCompensationStore);
     }
 
     MultiplayerSystemComponent::~MultiplayerSystemComponent()
     {
+        AZ::Interface<LagCompensationStore>::Unregister(&m_lagCompensationStore);
+        AZ::Interface<PropertyDeltaCache>::Unregister(&m_propertyDeltaCache);
         AZ::Interface<IMultiplayer>::Unregister(this);
     }
 
@@ -433,7 +437,10 @@ namespace Multiplayer
                 }
             };
 
+            // Connections that share an acknowledged baseline for an entity can share its serialized property delta for this update
+            m_propertyDeltaCache.BeginUpdate(stats);
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            m_propertyDeltaCache.EndUpdate();
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -1091,6 +1098,9 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+        AZLOG_INFO("Property delta cache hits: %llu", aznumeric_cast<AZ::u64>(stats.m_propertyDeltaCacheHits));
+        AZLOG_INFO("Property delta cache misses: %llu", aznumeric_cast<AZ::u64>(stats.m_propertyDeltaCacheMisses));
+        AZLOG_INFO("Property delta cache hit ratio: %.3f", stats.GetPropertyDeltaCacheHitRatio());
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
@@ -9,11 +9,13 @@
 #pragma once
 
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkTime/LagCompensationStore.h>
 #include <Multiplayer/Session/ISessionHandlingRequests.h>
 #include <Multiplayer/Session/SessionNotifications.h>
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <NetworkEntity/EntityReplication/PropertyDeltaCache.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -155,6 +157,8 @@ namespace Multiplayer
 
         NetworkEntityManager m_networkEntityManager;
         NetworkTime m_networkTime;
+        PropertyDeltaCache m_propertyDeltaCache;
+        LagCompensationStore m_lagCompensationStore;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
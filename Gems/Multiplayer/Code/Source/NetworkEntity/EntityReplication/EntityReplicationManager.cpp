@@ -22,6 +22,8 @@
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/TrackChangedSerializer.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
@@ -39,6 +41,7 @@ namespace Multiplayer
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(bool, net_BitPackedEntityUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, entity update and migration payloads are bit-packed using each network property's field schema. Replicated from the server, all endpoints must agree on this value.");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -825,8 +828,6 @@ namespace Multiplayer
             return HandleEntityDeleteMessage(entityReplicator, packetHeader, updateMessage);
         }
 
-        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
-
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
         {
@@ -850,7 +851,17 @@ namespace Multiplayer
         }
 
         // This may implicitly create a replicator for us
-        bool handled = HandlePropertyChangeMessage(invokingConnection, entityReplicator, packetHeader.GetPacketId(), updateMessage.GetEntityId(), updateMessage.GetNetworkRole(), outputSerializer, prefabEntityId);
+        bool handled = false;
+        if (net_BitPackedEntityUpdates)
+        {
+            AzNetworking::TrackChangedSerializer<AzNetworking::NetworkBitOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+            handled = HandlePropertyChangeMessage(invokingConnection, entityReplicator, packetHeader.GetPacketId(), updateMessage.GetEntityId(), updateMessage.GetNetworkRole(), outputSerializer, prefabEntityId);
+        }
+        else
+        {
+            AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+            handled = HandlePropertyChangeMessage(invokingConnection, entityReplicator, packetHeader.GetPacketId(), updateMessage.GetEntityId(), updateMessage.GetNetworkRole(), outputSerializer, prefabEntityId);
+        }
         AZ_Assert(handled, "Failed to handle NetworkEntityUpdateMessage message");
 
         return handled;
@@ -1156,14 +1167,28 @@ namespace Multiplayer
                 // Send an update packet if it needs one
                 propPublisher->GenerateRecord();
                 bool needsNetworkPropertyUpdate = propPublisher->PrepareSerialization();
-                AzNetworking::NetworkInputSerializer inputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetCapacity()));
-                if (needsNetworkPropertyUpdate)
+                if (net_BitPackedEntityUpdates)
                 {
-                    // Write out entity state into the buffer
-                    propPublisher->UpdateSerialization(inputSerializer);
+                    AzNetworking::NetworkBitInputSerializer inputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetCapacity()));
+                    if (needsNetworkPropertyUpdate)
+                    {
+                        // Write out entity state into the buffer
+                        propPublisher->UpdateSerialization(inputSerializer);
+                    }
+                    didSucceed &= inputSerializer.IsValid();
+                    message.m_propertyUpdateData.Resize(inputSerializer.GetSize());
+                }
+                else
+                {
+                    AzNetworking::NetworkInputSerializer inputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetCapacity()));
+                    if (needsNetworkPropertyUpdate)
+                    {
+                        // Write out entity state into the buffer
+                        propPublisher->UpdateSerialization(inputSerializer);
+                    }
+                    didSucceed &= inputSerializer.IsValid();
+                    message.m_propertyUpdateData.Resize(inputSerializer.GetSize());
                 }
-                didSucceed &= inputSerializer.IsValid();
-                message.m_propertyUpdateData.Resize(inputSerializer.GetSize());
             }
             AZ_Assert(didSucceed, "Failed to migrate entity from server");
 
@@ -1184,17 +1209,18 @@ namespace Multiplayer
         {
             if (message.m_propertyUpdateData.GetSize() > 0)
             {
-                AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetSize()));
-                if (!HandlePropertyChangeMessage
-                (
-                    invokingConnection,
-                    replicator,
-                    AzNetworking::InvalidPacketId,
-                    message.m_netEntityId,
-                    NetEntityRole::Server,
-                    outputSerializer,
-                    message.m_prefabEntityId
-                ))
+                bool handled = false;
+                if (net_BitPackedEntityUpdates)
+                {
+                    AzNetworking::TrackChangedSerializer<AzNetworking::NetworkBitOutputSerializer> outputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetSize()));
+                    handled = HandlePropertyChangeMessage(invokingConnection, replicator, AzNetworking::InvalidPacketId, message.m_netEntityId, NetEntityRole::Server, outputSerializer, message.m_prefabEntityId);
+                }
+                else
+                {
+                    AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetSize()));
+                    handled = HandlePropertyChangeMessage(invokingConnection, replicator, AzNetworking::InvalidPacketId, message.m_netEntityId, NetEntityRole::Server, outputSerializer, message.m_prefabEntityId);
+                }
+                if (!handled)
                 {
                     AZ_Assert(false, "Unable to process network properties during server entity migration");
                     return false;
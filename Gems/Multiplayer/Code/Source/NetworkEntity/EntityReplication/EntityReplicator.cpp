@@ -24,6 +24,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
 
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
@@ -33,6 +34,8 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR_EXTERNED(bool, net_BitPackedEntityUpdates);
+
     void SyncActivatingEntityTransform(AZ::Entity* entity)
     {
         NetworkTransformComponent* netTransform = entity->FindComponent<NetworkTransformComponent>();
@@ -492,9 +495,18 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        m_propertyPublisher->UpdateSerialization(inputSerializer);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        if (net_BitPackedEntityUpdates)
+        {
+            AzNetworking::NetworkBitInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
+            m_propertyPublisher->UpdateSerialization(inputSerializer);
+            updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        }
+        else
+        {
+            AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
+            m_propertyPublisher->UpdateSerialization(inputSerializer);
+            updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        }
 
         return updateMessage;
     }
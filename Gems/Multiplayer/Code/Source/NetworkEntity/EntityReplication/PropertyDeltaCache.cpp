@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/PropertyDeltaCache.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/Console/IConsole.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, net_PropertyDeltaCacheEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, identical entity property deltas are serialized once and shared across all connections during a network update");
+
+    // Copies a bit range out of a serialized buffer so that it starts at bit zero, making ranges comparable with memcmp
+    static void ExtractBits(const uint8_t* data, uint32_t bitOffset, uint32_t bitCount, AZStd::vector<uint8_t>& outData)
+    {
+        outData.resize((bitCount + 7) / 8);
+        AzNetworking::NetworkBitInputSerializer serializer(outData.data(), static_cast<uint32_t>(outData.size()));
+        serializer.CopyBitsToBuffer(data, bitOffset, bitCount);
+    }
+
+    PropertyDeltaCache::PropertyDeltaCache()
+        : m_propertySentHandler([this](NetComponentId netComponentId, PropertyIndex propertyIndex, uint32_t totalBits)
+        {
+            if (m_isCapturing)
+            {
+                m_capturedMetrics.push_back({ netComponentId, propertyIndex, totalBits, false });
+            }
+        })
+        , m_componentSerializeEndHandler([this](AzNetworking::SerializerMode mode, NetComponentId netComponentId)
+        {
+            if (m_isCapturing && (mode == AzNetworking::SerializerMode::ReadFromObject))
+            {
+                m_capturedMetrics.push_back({ netComponentId, PropertyIndex{ 0 }, 0, true });
+            }
+        })
+    {
+        ;
+    }
+
+    void PropertyDeltaCache::BeginUpdate(MultiplayerStats& stats)
+    {
+        m_stats = &stats;
+        m_propertySentHandler.Connect(stats.m_events.m_propertySent);
+        m_componentSerializeEndHandler.Connect(stats.m_events.m_componentSerializeEnd);
+    }
+
+    void PropertyDeltaCache::EndUpdate()
+    {
+        m_propertySentHandler.Disconnect();
+        m_componentSerializeEndHandler.Disconnect();
+        m_stats = nullptr;
+        m_isCapturing = false;
+        m_capturedMetrics.clear();
+        m_cachedDeltas.clear();
+    }
+
+    bool PropertyDeltaCache::IsActive() const
+    {
+        return net_PropertyDeltaCacheEnabled && (m_stats != nullptr);
+    }
+
+    bool PropertyDeltaCache::TryWriteDelta
+    (
+        NetEntityId netEntityId,
+        NetEntityRole remoteRole,
+        AZ::EntityId entityId,
+        const char* entityName,
+        const uint8_t* data,
+        uint32_t recordStart,
+        uint32_t recordBits,
+        AzNetworking::NetworkInputSerializer& serializer
+    )
+    {
+        const CachedDelta* cachedDelta = FindDelta(netEntityId, remoteRole, data, recordStart, recordBits);
+        if (cachedDelta == nullptr)
+        {
+            return false;
+        }
+
+        // Byte aligned serializers only ever produce whole byte deltas
+        if (serializer.CopyToBuffer(cachedDelta->m_deltaData.data(), cachedDelta->m_deltaBits / 8))
+        {
+            ReplayMetrics(*cachedDelta, entityId, entityName);
+        }
+        // Otherwise the serializer has been invalidated, regular serialization would fail in the same way
+        return true;
+    }
+
+    bool PropertyDeltaCache::TryWriteDelta
+    (
+        NetEntityId netEntityId,
+        NetEntityRole remoteRole,
+        AZ::EntityId entityId,
+        const char* entityName,
+        const uint8_t* data,
+        uint32_t recordStart,
+        uint32_t recordBits,
+        AzNetworking::NetworkBitInputSerializer& serializer
+    )
+    {
+        const CachedDelta* cachedDelta = FindDelta(netEntityId, remoteRole, data, recordStart, recordBits);
+        if (cachedDelta == nullptr)
+        {
+            return false;
+        }
+
+        if (serializer.CopyBitsToBuffer(cachedDelta->m_deltaData.data(), 0, cachedDelta->m_deltaBits))
+        {
+            ReplayMetrics(*cachedDelta, entityId, entityName);
+        }
+        // Otherwise the serializer has been invalidated, regular serialization would fail in the same way
+        return true;
+    }
+
+    void PropertyDeltaCache::BeginCapture()
+    {
+        m_capturedMetrics.clear();
+        m_isCapturing = IsActive();
+    }
+
+    void PropertyDeltaCache::CancelCapture()
+    {
+        m_capturedMetrics.clear();
+        m_isCapturing = false;
+    }
+
+    void PropertyDeltaCache::StoreDelta
+    (
+        NetEntityId netEntityId,
+        NetEntityRole remoteRole,
+        const uint8_t* data,
+        uint32_t recordStart,
+        uint32_t recordBits,
+        uint32_t deltaStart,
+        uint32_t deltaBits
+    )
+    {
+        if (!m_isCapturing)
+        {
+            return;
+        }
+        m_isCapturing = false;
+
+        CachedDelta& cachedDelta = m_cachedDeltas[netEntityId].emplace_back();
+        cachedDelta.m_remoteRole = remoteRole;
+        cachedDelta.m_recordBits = recordBits;
+        cachedDelta.m_deltaBits = deltaBits;
+        ExtractBits(data, recordStart, recordBits, cachedDelta.m_recordData);
+        ExtractBits(data, deltaStart, deltaBits, cachedDelta.m_deltaData);
+        cachedDelta.m_metrics.swap(m_capturedMetrics);
+    }
+
+    const PropertyDeltaCache::CachedDelta* PropertyDeltaCache::FindDelta
+    (
+        NetEntityId netEntityId,
+        NetEntityRole remoteRole,
+        const uint8_t* data,
+        uint32_t recordStart,
+        uint32_t recordBits
+    )
+    {
+        if (!IsActive())
+        {
+            return nullptr;
+        }
+
+        auto entityIter = m_cachedDeltas.find(netEntityId);
+        if (entityIter != m_cachedDeltas.end())
+        {
+            ExtractBits(data, recordStart, recordBits, m_lookupRecordData);
+            for (const CachedDelta& cachedDelta : entityIter->second)
+            {
+                if ((cachedDelta.m_remoteRole != remoteRole) || (cachedDelta.m_recordBits != recordBits))
+                {
+                    continue;
+                }
+
+                if (memcmp(cachedDelta.m_recordData.data(), m_lookupRecordData.data(), m_lookupRecordData.size()) == 0)
+                {
+                    return &cachedDelta;
+                }
+            }
+        }
+
+        m_stats->RecordPropertyDeltaCacheMiss();
+        return nullptr;
+    }
+
+    void PropertyDeltaCache::ReplayMetrics(const CachedDelta& cachedDelta, AZ::EntityId entityId, const char* entityName)
+    {
+        // Replay the metrics captured when this delta was first serialized so bandwidth reporting is unaffected by the cache
+        m_stats->RecordEntitySerializeStart(AzNetworking::SerializerMode::ReadFromObject, entityId, entityName);
+        for (const CapturedMetric& metric : cachedDelta.m_metrics)
+        {
+            if (metric.m_componentEnd)
+            {
+                m_stats->RecordComponentSerializeEnd(AzNetworking::SerializerMode::ReadFromObject, metric.m_netComponentId);
+            }
+            else
+            {
+                m_stats->RecordPropertySent(metric.m_netComponentId, metric.m_propertyIndex, metric.m_totalBits);
+            }
+        }
+        m_stats->RecordEntitySerializeStop(AzNetworking::SerializerMode::ReadFromObject, entityId, entityName);
+        m_stats->RecordPropertyDeltaCacheHit();
+    }
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/Event.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzNetworking
+{
+    class NetworkInputSerializer;
+    class NetworkBitInputSerializer;
+}
+
+namespace Multiplayer
+{
+    //! @class PropertyDeltaCache
+    //! @brief Shares serialized entity property deltas between connections during a single network update.
+    //!
+    //! Every PropertyPublisher serializes the dirty properties of its entity against the records its remote endpoint has not yet
+    //! acknowledged. Connections that share the same acknowledged baseline end up with identical replication records, and so produce
+    //! bit-identical delta payloads. The first publisher to serialize a given (entity, remote role, replication record) stores the
+    //! payload here, and subsequent publishers copy the stored bits directly into their own packet.
+    //!
+    //! The serialized replication record bits are used as the cache key, so a lookup can never return a payload for a different dirty mask.
+    //! Cached payloads are only valid while network property values cannot change, so the cache must be bracketed by BeginUpdate/EndUpdate.
+    class PropertyDeltaCache
+    {
+    public:
+        AZ_TYPE_INFO(PropertyDeltaCache, "{007B8508-EF6B-4AC2-A62A-068A4C3C35D1}");
+
+        PropertyDeltaCache();
+
+        //! Enables the cache for the duration of a network update.
+        //! @param stats the multiplayer stats instance used to capture per-property metrics and to record hit ratios
+        void BeginUpdate(MultiplayerStats& stats);
+
+        //! Disables the cache and discards all deltas stored during the current update.
+        void EndUpdate();
+
+        //! Returns true if the cache is between a BeginUpdate/EndUpdate pair and enabled by cvar.
+        //! @return boolean true if deltas may be looked up or stored
+        bool IsActive() const;
+
+        //! Attempts to write a previously serialized property delta into the provided serializer.
+        //! On a hit the per-property metrics captured when the delta was first serialized are replayed against the stats instance.
+        //! @param netEntityId  the network entity id of the entity being serialized
+        //! @param remoteRole   the network role of the remote replicator
+        //! @param entityId     the entity id of the entity being serialized, used for metrics
+        //! @param entityName   the name of the entity being serialized, used for metrics
+        //! @param data         pointer to the buffer containing the serialized replication record
+        //! @param recordStart  bit offset of the serialized replication record within data
+        //! @param recordBits   size of the serialized replication record in bits
+        //! @param serializer   the serializer to copy the cached delta into
+        //! @return boolean true if a cached delta was found and copied (check serializer validity), false if the caller must serialize the delta itself
+        //! @{
+        bool TryWriteDelta
+        (
+            NetEntityId netEntityId,
+            NetEntityRole remoteRole,
+            AZ::EntityId entityId,
+            const char* entityName,
+            const uint8_t* data,
+            uint32_t recordStart,
+            uint32_t recordBits,
+            AzNetworking::NetworkInputSerializer& serializer
+        );
+        bool TryWriteDelta
+        (
+            NetEntityId netEntityId,
+            NetEntityRole remoteRole,
+            AZ::EntityId entityId,
+            const char* entityName,
+            const uint8_t* data,
+            uint32_t recordStart,
+            uint32_t recordBits,
+            AzNetworking::NetworkBitInputSerializer& serializer
+        );
+        //! @}
+
+        //! Starts capturing per-property metrics for a delta that is about to be serialized.
+        void BeginCapture();
+
+        //! Discards any metrics captured since BeginCapture without storing a delta, used when serialization fails.
+        void CancelCapture();
+
+        //! Stores a freshly serialized delta along with the metrics captured since BeginCapture.
+        //! @param netEntityId the network entity id of the entity that was serialized
+        //! @param remoteRole  the network role of the remote replicator
+        //! @param data        pointer to the buffer containing the serialized replication record and property delta
+        //! @param recordStart bit offset of the serialized replication record within data
+        //! @param recordBits  size of the serialized replication record in bits
+        //! @param deltaStart  bit offset of the serialized property delta within data
+        //! @param deltaBits   size of the serialized property delta in bits
+        void StoreDelta
+        (
+            NetEntityId netEntityId,
+            NetEntityRole remoteRole,
+            const uint8_t* data,
+            uint32_t recordStart,
+            uint32_t recordBits,
+            uint32_t deltaStart,
+            uint32_t deltaBits
+        );
+
+    private:
+
+        struct CapturedMetric
+        {
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            PropertyIndex m_propertyIndex = PropertyIndex{ 0 };
+            uint32_t m_totalBits = 0;
+            bool m_componentEnd = false;
+        };
+
+        struct CachedDelta
+        {
+            NetEntityRole m_remoteRole = NetEntityRole::InvalidRole;
+            uint32_t m_recordBits = 0;
+            uint32_t m_deltaBits = 0;
+            AZStd::vector<uint8_t> m_recordData; // Record bits, realigned to start at bit zero
+            AZStd::vector<uint8_t> m_deltaData; // Delta bits, realigned to start at bit zero
+            AZStd::vector<CapturedMetric> m_metrics;
+        };
+
+        const CachedDelta* FindDelta(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* data, uint32_t recordStart, uint32_t recordBits);
+        void ReplayMetrics(const CachedDelta& cachedDelta, AZ::EntityId entityId, const char* entityName);
+
+        using CachedDeltaMap = AZStd::unordered_map<NetEntityId, AZStd::vector<CachedDelta>>;
+        CachedDeltaMap m_cachedDeltas;
+        AZStd::vector<CapturedMetric> m_capturedMetrics;
+        AZStd::vector<uint8_t> m_lookupRecordData;
+
+        AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler m_propertySentHandler;
+        AZ::Event<AzNetworking::SerializerMode, NetComponentId>::Handler m_componentSerializeEndHandler;
+        MultiplayerStats* m_stats = nullptr;
+        bool m_isCapturing = false;
+    };
+}
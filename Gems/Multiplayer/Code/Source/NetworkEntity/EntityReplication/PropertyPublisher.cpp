@@ -7,7 +7,12 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/PropertyDeltaCache.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
@@ -167,16 +172,47 @@ namespace Multiplayer
         return !IsDeleted();
     }
 
-    bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::ISerializer &serializer)
+    template <typename SerializerType>
+    bool PropertyPublisher::SerializeUpdateEntityRecord(SerializerType& serializer)
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
         m_pendingRecord.ResetConsumedBits();
+
+        const uint32_t recordStart = serializer.GetSizeInBits();
         m_pendingRecord.Serialize(serializer);
+        const uint32_t recordBits = serializer.GetSizeInBits() - recordStart;
+
+        PropertyDeltaCache* deltaCache = AZ::Interface<PropertyDeltaCache>::Get();
+        if ((deltaCache == nullptr) || !deltaCache->IsActive() || !serializer.IsValid())
+        {
+            m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, serializer);
+            return serializer.IsValid();
+        }
+
+        // The serialized record bits uniquely describe the delta, so any other connection that produced the same bits for this entity this update has already serialized an identical payload
+        const NetEntityId netEntityId = m_netBindComponent->GetNetEntityId();
+        const NetEntityRole remoteRole = m_pendingRecord.GetRemoteNetworkRole();
+        const AZ::Entity* entity = m_netBindComponent->GetEntity();
+        if (deltaCache->TryWriteDelta(netEntityId, remoteRole, entity->GetId(), entity->GetName().c_str(), serializer.GetBuffer(), recordStart, recordBits, serializer))
+        {
+            return serializer.IsValid();
+        }
+
+        deltaCache->BeginCapture();
+        const uint32_t deltaStart = serializer.GetSizeInBits();
         m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, serializer);
+        if (serializer.IsValid())
+        {
+            deltaCache->StoreDelta(netEntityId, remoteRole, serializer.GetBuffer(), recordStart, recordBits, deltaStart, serializer.GetSizeInBits() - deltaStart);
+        }
+        else
+        {
+            deltaCache->CancelCapture();
+        }
         return serializer.IsValid();
     }
 
-    bool PropertyPublisher::SerializeDeleteEntityRecord(AzNetworking::ISerializer &serializer)
+    bool PropertyPublisher::SerializeDeleteEntityRecord(AzNetworking::ISerializer& serializer)
     {
         return serializer.IsValid();
     }
@@ -285,7 +321,8 @@ namespace Multiplayer
     }
 
 
-    bool PropertyPublisher::UpdateSerialization(AzNetworking::ISerializer& serializer)
+    template <typename SerializerType>
+    bool PropertyPublisher::UpdateSerialization(SerializerType& serializer)
     {
         bool success(true);
         switch (m_replicatorState)
@@ -318,6 +355,9 @@ namespace Multiplayer
         return success;
     }
 
+    template bool PropertyPublisher::UpdateSerialization(AzNetworking::NetworkInputSerializer& serializer);
+    template bool PropertyPublisher::UpdateSerialization(AzNetworking::NetworkBitInputSerializer& serializer);
+
     void PropertyPublisher::FinalizeSerialization(AzNetworking::PacketId sentId)
     {
         switch (m_replicatorState)
@@ -14,6 +14,7 @@
 namespace AzNetworking
 {
     class IConnection;
+    class ISerializer;
 }
 
 namespace Multiplayer
@@ -40,10 +41,12 @@ namespace Multiplayer
         void GenerateRecord();
 
         //! Interface for ReplicationManager to manage serialization of entities
+        //! UpdateSerialization is instantiated for NetworkInputSerializer and NetworkBitInputSerializer
         //! @{
         bool RequiresSerialization();
         bool PrepareSerialization();
-        bool UpdateSerialization(AzNetworking::ISerializer& serializer);
+        template <typename SerializerType>
+        bool UpdateSerialization(SerializerType& serializer);
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
@@ -76,7 +79,8 @@ namespace Multiplayer
 
         //! Phase 2, serialize the record
         //! No add, they share the update path
-        bool SerializeUpdateEntityRecord(AzNetworking::ISerializer& serializer);
+        template <typename SerializerType>
+        bool SerializeUpdateEntityRecord(SerializerType& serializer);
         bool SerializeDeleteEntityRecord(AzNetworking::ISerializer& serializer);
 
         //! Phase 3, finalize with the packet id
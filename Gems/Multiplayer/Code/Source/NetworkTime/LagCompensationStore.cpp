@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/LagCompensationStore.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/Obb.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace Multiplayer
+{
+    static constexpr uint32_t LaneCount = static_cast<uint32_t>(AZ::Simd::Vec4::ElementCount);
+    static constexpr uint32_t InvalidFrameId = static_cast<uint32_t>(InvalidHostFrameId);
+
+    float LagCompensatedShape::GetBoundingRadius() const
+    {
+        switch (m_type)
+        {
+        case Type::Sphere:
+            return m_radius;
+        case Type::Capsule:
+            return AZ::GetMax(m_radius, m_height * 0.5f);
+        case Type::Box:
+            return m_halfExtents.GetLength();
+        }
+        return 0.0f;
+    }
+
+    //! Returns the closest point on the segment [segmentStart, segmentEnd] to the provided point.
+    static AZ::Vector3 ClosestPointOnSegment(const AZ::Vector3& segmentStart, const AZ::Vector3& segmentEnd, const AZ::Vector3& point)
+    {
+        const AZ::Vector3 segment = segmentEnd - segmentStart;
+        const float segmentLengthSq = segment.GetLengthSq();
+        if (segmentLengthSq <= AZ::Constants::FloatEpsilon)
+        {
+            return segmentStart;
+        }
+        const float t = AZ::GetClamp((point - segmentStart).Dot(segment) / segmentLengthSq, 0.0f, 1.0f);
+        return segmentStart + segment * t;
+    }
+
+    //! Returns the end points of the inner segment of a capsule in world space.
+    static void GetCapsuleSegment(const LagCompensatedShape& shape, const AZ::Transform& transform, AZ::Vector3& outStart, AZ::Vector3& outEnd)
+    {
+        const float halfSegmentLength = AZ::GetMax(shape.m_height * 0.5f - shape.m_radius, 0.0f) * transform.GetUniformScale();
+        const AZ::Vector3 axis = transform.GetRotation().TransformVector(AZ::Vector3::CreateAxisZ(halfSegmentLength));
+        outStart = transform.GetTranslation() - axis;
+        outEnd = transform.GetTranslation() + axis;
+    }
+
+    //! Exact ray test against a single rewound hit volume.
+    static bool RaycastShape
+    (
+        const LagCompensatedShape& shape,
+        const AZ::Transform& transform,
+        const AZ::Vector3& start,
+        const AZ::Vector3& direction,
+        float maxDistance,
+        float& outDistance
+    )
+    {
+        const float scale = transform.GetUniformScale();
+        switch (shape.m_type)
+        {
+        case LagCompensatedShape::Type::Sphere:
+        {
+            float t = 0.0f;
+            const AZ::Intersect::SphereIsectTypes result = AZ::Intersect::IntersectRaySphere(start, direction, transform.GetTranslation(), shape.m_radius * scale, t);
+            if (result == AZ::Intersect::ISECT_RAY_SPHERE_SA_INSIDE)
+            {
+                outDistance = 0.0f;
+                return true;
+            }
+            outDistance = t;
+            return (result == AZ::Intersect::ISECT_RAY_SPHERE_ISECT) && (t <= maxDistance);
+        }
+        case LagCompensatedShape::Type::Capsule:
+        {
+            AZ::Vector3 segmentStart;
+            AZ::Vector3 segmentEnd;
+            GetCapsuleSegment(shape, transform, segmentStart, segmentEnd);
+            float t = 0.0f;
+            const AZ::Intersect::CapsuleIsectTypes result =
+                AZ::Intersect::IntersectSegmentCapsule(start, direction * maxDistance, segmentStart, segmentEnd, shape.m_radius * scale, t);
+            if (result == AZ::Intersect::ISECT_RAY_CAPSULE_SA_INSIDE)
+            {
+                outDistance = 0.0f;
+                return true;
+            }
+            outDistance = t * maxDistance;
+            return result != AZ::Intersect::ISECT_RAY_CAPSULE_NONE;
+        }
+        case LagCompensatedShape::Type::Box:
+        {
+            const AZ::Obb obb = AZ::Obb::CreateFromPositionRotationAndHalfLengths(transform.GetTranslation(), transform.GetRotation(), shape.m_halfExtents * scale);
+            float t = 0.0f;
+            if (AZ::Intersect::IntersectRayObb(start, direction, obb, t) && (t <= maxDistance))
+            {
+                outDistance = AZ::GetMax(t, 0.0f);
+                return true;
+            }
+            return false;
+        }
+        }
+        return false;
+    }
+
+    //! Exact sphere overlap test against a single rewound hit volume.
+    static bool OverlapShape(const LagCompensatedShape& shape, const AZ::Transform& transform, const AZ::Vector3& center, float radius)
+    {
+        const float scale = transform.GetUniformScale();
+        switch (shape.m_type)
+        {
+        case LagCompensatedShape::Type::Sphere:
+        {
+            const float combinedRadius = shape.m_radius * scale + radius;
+            return transform.GetTranslation().GetDistanceSq(center) <= combinedRadius * combinedRadius;
+        }
+        case LagCompensatedShape::Type::Capsule:
+        {
+            AZ::Vector3 segmentStart;
+            AZ::Vector3 segmentEnd;
+            GetCapsuleSegment(shape, transform, segmentStart, segmentEnd);
+            const float combinedRadius = shape.m_radius * scale + radius;
+            return ClosestPointOnSegment(segmentStart, segmentEnd, center).GetDistanceSq(center) <= combinedRadius * combinedRadius;
+        }
+        case LagCompensatedShape::Type::Box:
+        {
+            // Move the sphere into the unscaled local space of the box and clamp it to the box extents
+            const AZ::Vector3 localCenter = transform.GetRotation().GetInverseFast().TransformVector(center - transform.GetTranslation());
+            const AZ::Vector3 halfExtents = shape.m_halfExtents * scale;
+            const AZ::Vector3 closestPoint = localCenter.GetClamp(-halfExtents, halfExtents);
+            return closestPoint.GetDistanceSq(localCenter) <= radius * radius;
+        }
+        }
+        return false;
+    }
+
+    LagCompensationStore::LagCompensationStore(uint32_t historySize)
+        : m_frameSlots(AZ::GetMax(historySize, 2u))
+    {
+        ;
+    }
+
+    LagCompensationStore::VolumeHandle LagCompensationStore::RegisterVolume(NetEntityId netEntityId, const LagCompensatedShape& shape)
+    {
+        VolumeHandle volumeHandle = InvalidVolumeHandle;
+        if (!m_freeHandles.empty())
+        {
+            volumeHandle = m_freeHandles.back();
+            m_freeHandles.pop_back();
+            m_shapes[volumeHandle] = shape;
+            m_netEntityIds[volumeHandle] = netEntityId;
+        }
+        else
+        {
+            volumeHandle = static_cast<VolumeHandle>(m_shapes.size());
+            m_shapes.push_back(shape);
+            m_netEntityIds.push_back(netEntityId);
+            if (m_shapes.size() > m_volumeCapacity)
+            {
+                ResizeSlots(m_volumeCapacity > 0 ? m_volumeCapacity * 2 : LaneCount * 16);
+            }
+        }
+        ++m_volumeCount;
+        return volumeHandle;
+    }
+
+    void LagCompensationStore::UnregisterVolume(VolumeHandle volumeHandle)
+    {
+        if ((volumeHandle >= m_netEntityIds.size()) || (m_netEntityIds[volumeHandle] == InvalidNetEntityId))
+        {
+            return;
+        }
+
+        m_netEntityIds[volumeHandle] = InvalidNetEntityId;
+        for (FrameSlot& frameSlot : m_frameSlots)
+        {
+            frameSlot.m_frameIds[volumeHandle] = InvalidFrameId;
+            frameSlot.m_radius[volumeHandle] = 0.0f;
+        }
+        m_freeHandles.push_back(volumeHandle);
+        --m_volumeCount;
+    }
+
+    void LagCompensationStore::RecordTransform(VolumeHandle volumeHandle, HostFrameId frameId, const AZ::Transform& worldTransform)
+    {
+        AZ_Assert(volumeHandle < m_shapes.size(), "Invalid lag compensation volume handle");
+        FrameSlot& frameSlot = m_frameSlots[GetSlotIndex(frameId)];
+        const AZ::Vector3& position = worldTransform.GetTranslation();
+        frameSlot.m_centerX[volumeHandle] = position.GetX();
+        frameSlot.m_centerY[volumeHandle] = position.GetY();
+        frameSlot.m_centerZ[volumeHandle] = position.GetZ();
+        frameSlot.m_radius[volumeHandle] = m_shapes[volumeHandle].GetBoundingRadius() * worldTransform.GetUniformScale();
+        frameSlot.m_transforms[volumeHandle] = worldTransform;
+        frameSlot.m_frameIds[volumeHandle] = static_cast<uint32_t>(frameId);
+    }
+
+    bool LagCompensationStore::Raycast
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        const AZ::Vector3& start,
+        const AZ::Vector3& direction,
+        float maxDistance,
+        NetEntityId ignoreNetEntityId,
+        LagCompensatedHit& outHit
+    ) const
+    {
+        using namespace AZ::Simd;
+
+        const bool blend = blendFactor < 1.0f;
+        const FrameSlot& frameSlot = m_frameSlots[GetSlotIndex(frameId)];
+        const FrameSlot& previousSlot = m_frameSlots[GetSlotIndex(frameId - HostFrameId{ 1 })];
+
+        const Vec4::FloatType startX = Vec4::Splat(start.GetX());
+        const Vec4::FloatType startY = Vec4::Splat(start.GetY());
+        const Vec4::FloatType startZ = Vec4::Splat(start.GetZ());
+        const Vec4::FloatType directionX = Vec4::Splat(direction.GetX());
+        const Vec4::FloatType directionY = Vec4::Splat(direction.GetY());
+        const Vec4::FloatType directionZ = Vec4::Splat(direction.GetZ());
+        const Vec4::FloatType maxDistanceSplat = Vec4::Splat(maxDistance);
+        const Vec4::FloatType blendSplat = Vec4::Splat(blendFactor);
+        const Vec4::Int32Type previousFrameSplat = Vec4::Splat(static_cast<int32_t>(frameId - HostFrameId{ 1 }));
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        bool hasHit = false;
+        float closestDistance = maxDistance;
+        const uint32_t volumeCount = static_cast<uint32_t>(m_shapes.size());
+        for (uint32_t baseIndex = 0; baseIndex < volumeCount; baseIndex += LaneCount)
+        {
+            Vec4::FloatType centerX = Vec4::LoadUnaligned(&frameSlot.m_centerX[baseIndex]);
+            Vec4::FloatType centerY = Vec4::LoadUnaligned(&frameSlot.m_centerY[baseIndex]);
+            Vec4::FloatType centerZ = Vec4::LoadUnaligned(&frameSlot.m_centerZ[baseIndex]);
+            const Vec4::FloatType radius = Vec4::LoadUnaligned(&frameSlot.m_radius[baseIndex]);
+
+            if (blend)
+            {
+                // Blend towards the previous frame only for lanes that actually have a previous frame recorded
+                const Vec4::Int32Type previousIds = Vec4::LoadUnaligned(reinterpret_cast<const int32_t*>(&previousSlot.m_frameIds[baseIndex]));
+                const Vec4::FloatType hasPrevious = Vec4::CastToFloat(Vec4::CmpEq(previousIds, previousFrameSplat));
+                const Vec4::FloatType previousX = Vec4::LoadUnaligned(&previousSlot.m_centerX[baseIndex]);
+                const Vec4::FloatType previousY = Vec4::LoadUnaligned(&previousSlot.m_centerY[baseIndex]);
+                const Vec4::FloatType previousZ = Vec4::LoadUnaligned(&previousSlot.m_centerZ[baseIndex]);
+                centerX = Vec4::Select(Vec4::Madd(Vec4::Sub(centerX, previousX), blendSplat, previousX), centerX, hasPrevious);
+                centerY = Vec4::Select(Vec4::Madd(Vec4::Sub(centerY, previousY), blendSplat, previousY), centerY, hasPrevious);
+                centerZ = Vec4::Select(Vec4::Madd(Vec4::Sub(centerZ, previousZ), blendSplat, previousZ), centerZ, hasPrevious);
+            }
+
+            // Closest approach of the ray segment to each bounding sphere center
+            const Vec4::FloatType toCenterX = Vec4::Sub(centerX, startX);
+            const Vec4::FloatType toCenterY = Vec4::Sub(centerY, startY);
+            const Vec4::FloatType toCenterZ = Vec4::Sub(centerZ, startZ);
+            const Vec4::FloatType projection = Vec4::Madd(toCenterZ, directionZ, Vec4::Madd(toCenterY, directionY, Vec4::Mul(toCenterX, directionX)));
+            const Vec4::FloatType t = Vec4::Clamp(projection, zero, maxDistanceSplat);
+            const Vec4::FloatType toCenterLengthSq = Vec4::Madd(toCenterZ, toCenterZ, Vec4::Madd(toCenterY, toCenterY, Vec4::Mul(toCenterX, toCenterX)));
+            // |c - (s + d * t)|^2 = |c - s|^2 - 2 * t * projection + t^2
+            const Vec4::FloatType distanceSq = Vec4::Madd(t, Vec4::Sub(t, Vec4::Add(projection, projection)), toCenterLengthSq);
+            const Vec4::Int32Type candidates = Vec4::CastToInt(Vec4::CmpLtEq(distanceSq, Vec4::Mul(radius, radius)));
+
+            if (Vec4::CmpAllEq(candidates, Vec4::ZeroInt()))
+            {
+                continue;
+            }
+
+            int32_t candidateLanes[LaneCount];
+            Vec4::StoreUnaligned(candidateLanes, candidates);
+            for (uint32_t lane = 0; lane < LaneCount; ++lane)
+            {
+                const VolumeHandle volumeHandle = baseIndex + lane;
+                if ((candidateLanes[lane] == 0) || (volumeHandle >= volumeCount))
+                {
+                    continue;
+                }
+
+                const NetEntityId netEntityId = m_netEntityIds[volumeHandle];
+                if ((netEntityId == InvalidNetEntityId) || (netEntityId == ignoreNetEntityId))
+                {
+                    continue;
+                }
+
+                AZ::Transform rewoundTransform;
+                if (!GetRewoundTransform(volumeHandle, frameId, blendFactor, rewoundTransform))
+                {
+                    continue;
+                }
+
+                float distance = 0.0f;
+                if (RaycastShape(m_shapes[volumeHandle], rewoundTransform, start, direction, closestDistance, distance) && (!hasHit || distance < closestDistance))
+                {
+                    hasHit = true;
+                    closestDistance = distance;
+                    outHit.m_netEntityId = netEntityId;
+                    outHit.m_volumeHandle = volumeHandle;
+                    outHit.m_distance = distance;
+                    outHit.m_position = start + direction * distance;
+                }
+            }
+        }
+        return hasHit;
+    }
+
+    uint32_t LagCompensationStore::Overlap
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        const AZ::Vector3& center,
+        float radius,
+        NetEntityId ignoreNetEntityId,
+        AZStd::vector<LagCompensatedHit>& outHits
+    ) const
+    {
+        using namespace AZ::Simd;
+
+        const bool blend = blendFactor < 1.0f;
+        const FrameSlot& frameSlot = m_frameSlots[GetSlotIndex(frameId)];
+        const FrameSlot& previousSlot = m_frameSlots[GetSlotIndex(frameId - HostFrameId{ 1 })];
+
+        const Vec4::FloatType queryX = Vec4::Splat(center.GetX());
+        const Vec4::FloatType queryY = Vec4::Splat(center.GetY());
+        const Vec4::FloatType queryZ = Vec4::Splat(center.GetZ());
+        const Vec4::FloatType queryRadius = Vec4::Splat(radius);
+        const Vec4::FloatType blendSplat = Vec4::Splat(blendFactor);
+        const Vec4::Int32Type previousFrameSplat = Vec4::Splat(static_cast<int32_t>(frameId - HostFrameId{ 1 }));
+
+        uint32_t hitCount = 0;
+        const uint32_t volumeCount = static_cast<uint32_t>(m_shapes.size());
+        for (uint32_t baseIndex = 0; baseIndex < volumeCount; baseIndex += LaneCount)
+        {
+            Vec4::FloatType centerX = Vec4::LoadUnaligned(&frameSlot.m_centerX[baseIndex]);
+            Vec4::FloatType centerY = Vec4::LoadUnaligned(&frameSlot.m_centerY[baseIndex]);
+            Vec4::FloatType centerZ = Vec4::LoadUnaligned(&frameSlot.m_centerZ[baseIndex]);
+            const Vec4::FloatType volumeRadius = Vec4::LoadUnaligned(&frameSlot.m_radius[baseIndex]);
+
+            if (blend)
+            {
+                const Vec4::Int32Type previousIds = Vec4::LoadUnaligned(reinterpret_cast<const int32_t*>(&previousSlot.m_frameIds[baseIndex]));
+                const Vec4::FloatType hasPrevious = Vec4::CastToFloat(Vec4::CmpEq(previousIds, previousFrameSplat));
+                const Vec4::FloatType previousX = Vec4::LoadUnaligned(&previousSlot.m_centerX[baseIndex]);
+                const Vec4::FloatType previousY = Vec4::LoadUnaligned(&previousSlot.m_centerY[baseIndex]);
+                const Vec4::FloatType previousZ = Vec4::LoadUnaligned(&previousSlot.m_centerZ[baseIndex]);
+                centerX = Vec4::Select(Vec4::Madd(Vec4::Sub(centerX, previousX), blendSplat, previousX), centerX, hasPrevious);
+                centerY = Vec4::Select(Vec4::Madd(Vec4::Sub(centerY, previousY), blendSplat, previousY), centerY, hasPrevious);
+                centerZ = Vec4::Select(Vec4::Madd(Vec4::Sub(centerZ, previousZ), blendSplat, previousZ), centerZ, hasPrevious);
+            }
+
+            const Vec4::FloatType deltaX = Vec4::Sub(centerX, queryX);
+            const Vec4::FloatType deltaY = Vec4::Sub(centerY, queryY);
+            const Vec4::FloatType deltaZ = Vec4::Sub(centerZ, queryZ);
+            const Vec4::FloatType distanceSq = Vec4::Madd(deltaZ, deltaZ, Vec4::Madd(deltaY, deltaY, Vec4::Mul(deltaX, deltaX)));
+            const Vec4::FloatType combinedRadius = Vec4::Add(volumeRadius, queryRadius);
+            const Vec4::Int32Type candidates = Vec4::CastToInt(Vec4::CmpLtEq(distanceSq, Vec4::Mul(combinedRadius, combinedRadius)));
+
+            if (Vec4::CmpAllEq(candidates, Vec4::ZeroInt()))
+            {
+                continue;
+            }
+
+            int32_t candidateLanes[LaneCount];
+            Vec4::StoreUnaligned(candidateLanes, candidates);
+            for (uint32_t lane = 0; lane < LaneCount; ++lane)
+            {
+                const VolumeHandle volumeHandle = baseIndex + lane;
+                if ((candidateLanes[lane] == 0) || (volumeHandle >= volumeCount))
+                {
+                    continue;
+                }
+
+                const NetEntityId netEntityId = m_netEntityIds[volumeHandle];
+                if ((netEntityId == InvalidNetEntityId) || (netEntityId == ignoreNetEntityId))
+                {
+                    continue;
+                }
+
+                AZ::Transform rewoundTransform;
+                if (GetRewoundTransform(volumeHandle, frameId, blendFactor, rewoundTransform)
+                    && OverlapShape(m_shapes[volumeHandle], rewoundTransform, center, radius))
+                {
+                    LagCompensatedHit& hit = outHits.emplace_back();
+                    hit.m_netEntityId = netEntityId;
+                    hit.m_volumeHandle = volumeHandle;
+                    hit.m_distance = 0.0f;
+                    hit.m_position = rewoundTransform.GetTranslation();
+                    ++hitCount;
+                }
+            }
+        }
+        return hitCount;
+    }
+
+    uint32_t LagCompensationStore::GetVolumeCount() const
+    {
+        return m_volumeCount;
+    }
+
+    uint32_t LagCompensationStore::GetHistorySize() const
+    {
+        return static_cast<uint32_t>(m_frameSlots.size());
+    }
+
+    uint32_t LagCompensationStore::GetSlotIndex(HostFrameId frameId) const
+    {
+        return static_cast<uint32_t>(frameId) % static_cast<uint32_t>(m_frameSlots.size());
+    }
+
+    void LagCompensationStore::ResizeSlots(uint32_t volumeCapacity)
+    {
+        // Capacity is always a multiple of the lane count so the query kernels can load full lanes without bounds checks
+        m_volumeCapacity = ((volumeCapacity + LaneCount - 1) / LaneCount) * LaneCount;
+        for (FrameSlot& frameSlot : m_frameSlots)
+        {
+            frameSlot.m_centerX.resize(m_volumeCapacity, 0.0f);
+            frameSlot.m_centerY.resize(m_volumeCapacity, 0.0f);
+            frameSlot.m_centerZ.resize(m_volumeCapacity, 0.0f);
+            frameSlot.m_radius.resize(m_volumeCapacity, 0.0f);
+            frameSlot.m_transforms.resize(m_volumeCapacity, AZ::Transform::CreateIdentity());
+            frameSlot.m_frameIds.resize(m_volumeCapacity, InvalidFrameId);
+        }
+    }
+
+    bool LagCompensationStore::GetRewoundTransform(VolumeHandle volumeHandle, HostFrameId frameId, float blendFactor, AZ::Transform& outTransform) const
+    {
+        const FrameSlot& frameSlot = m_frameSlots[GetSlotIndex(frameId)];
+        if (frameSlot.m_frameIds[volumeHandle] != static_cast<uint32_t>(frameId))
+        {
+            return false;
+        }
+
+        const AZ::Transform& targetTransform = frameSlot.m_transforms[volumeHandle];
+        const HostFrameId previousFrameId = frameId - HostFrameId{ 1 };
+        const FrameSlot& previousSlot = m_frameSlots[GetSlotIndex(previousFrameId)];
+        if ((blendFactor >= 1.0f) || (previousSlot.m_frameIds[volumeHandle] != static_cast<uint32_t>(previousFrameId)))
+        {
+            outTransform = targetTransform;
+            return true;
+        }
+
+        // Matches the interpolation performed by NetworkHitVolumesComponent::AnimatedHitVolume::SyncToCurrentTransform
+        const AZ::Transform& previousTransform = previousSlot.m_transforms[volumeHandle];
+        outTransform.SetRotation(previousTransform.GetRotation().Slerp(targetTransform.GetRotation(), blendFactor));
+        outTransform.SetTranslation(previousTransform.GetTranslation().Lerp(targetTransform.GetTranslation(), blendFactor));
+        outTransform.SetUniformScale(AZ::Lerp(previousTransform.GetUniformScale(), targetTransform.GetUniformScale(), blendFactor));
+        return true;
+    }
+}
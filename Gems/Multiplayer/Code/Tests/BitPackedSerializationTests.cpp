@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonHierarchySetup.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkHierarchyChildComponent.h>
+#include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
+#include <Multiplayer/Components/NetworkTransformComponent.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    class BitPackedSerializationTests : public HierarchyTests
+    {
+    public:
+        // More than the combined authority to client properties of every component under test, each component only consumes its own bits
+        static constexpr uint32_t RecordBitCount = 64;
+        static constexpr uint32_t MaxPropertyCount = 64;
+        static constexpr uint32_t BufferSize = 256;
+
+        void SetUp() override
+        {
+            HierarchyTests::SetUp();
+
+            m_root = AZStd::make_unique<EntityInfo>(1, "root", NetEntityId{ 1 }, EntityInfo::Role::Root);
+            m_child = AZStd::make_unique<EntityInfo>(2, "child", NetEntityId{ 2 }, EntityInfo::Role::Child);
+            m_client = AZStd::make_unique<EntityInfo>(3, "client", NetEntityId{ 3 }, EntityInfo::Role::Root);
+
+            PopulateNetworkEntity(*m_root);
+            SetupEntity(m_root->m_entity, m_root->m_netId, NetEntityRole::Authority);
+            PopulateNetworkEntity(*m_child);
+            SetupEntity(m_child->m_entity, m_child->m_netId, NetEntityRole::Authority);
+            PopulateNetworkEntity(*m_client);
+            SetupEntity(m_client->m_entity, m_client->m_netId, NetEntityRole::Client);
+
+            m_root->m_entity->Activate();
+            m_child->m_entity->Activate();
+            m_client->m_entity->Activate();
+
+            AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.75f) * AZ::Quaternion::CreateRotationX(-0.3f), AZ::Vector3(12.5f, -3.0f, 400.25f));
+            m_root->m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(transform);
+            m_child->m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(transform.GetInverse());
+        }
+
+        void TearDown() override
+        {
+            m_client.reset();
+            m_child.reset();
+            m_root.reset();
+
+            HierarchyTests::TearDown();
+        }
+
+        void PopulateNetworkEntity(const EntityInfo& entityInfo)
+        {
+            entityInfo.m_entity->CreateComponent<AzFramework::TransformComponent>();
+            entityInfo.m_entity->CreateComponent<NetBindComponent>();
+            entityInfo.m_entity->CreateComponent<NetworkTransformComponent>();
+            switch (entityInfo.m_role)
+            {
+            case EntityInfo::Role::Root:
+                entityInfo.m_entity->CreateComponent<NetworkHierarchyRootComponent>();
+                break;
+            case EntityInfo::Role::Child:
+                entityInfo.m_entity->CreateComponent<NetworkHierarchyChildComponent>();
+                break;
+            case EntityInfo::Role::None:
+                break;
+            }
+        }
+
+        ReplicationRecord CreateFullRecord() const
+        {
+            ReplicationRecord record(NetEntityRole::Client);
+            record.m_authorityToClient.AddBits(RecordBitCount);
+            for (uint32_t bit = 0; bit < RecordBitCount; ++bit)
+            {
+                record.m_authorityToClient.SetBit(bit, true);
+            }
+            return record;
+        }
+
+        PropertyIndex FindPropertyIndex(NetComponentId netComponentId, const char* propertyName) const
+        {
+            for (uint32_t index = 0; index < MaxPropertyCount; ++index)
+            {
+                if (strcmp(m_multiplayerComponentRegistry->GetComponentPropertyName(netComponentId, PropertyIndex(index)), propertyName) == 0)
+                {
+                    return PropertyIndex(index);
+                }
+            }
+            ADD_FAILURE() << "Network property " << propertyName << " not found";
+            return PropertyIndex(0);
+        }
+
+        AzNetworking::FieldSchema GetSchema(const MultiplayerComponent& component, const char* propertyName) const
+        {
+            const NetComponentId netComponentId = component.GetNetComponentId();
+            return m_multiplayerComponentRegistry->GetComponentPropertySchema(netComponentId, FindPropertyIndex(netComponentId, propertyName));
+        }
+
+        // Size of a single property bit-packed with the schema registered for it
+        template <typename TYPE>
+        uint32_t GetBitPackedBits(const MultiplayerComponent& component, const char* propertyName, TYPE value) const
+        {
+            AZStd::array<uint8_t, BufferSize> buffer = {};
+            AzNetworking::NetworkBitInputSerializer serializer(buffer.begin(), BufferSize);
+            EXPECT_TRUE(AzNetworking::SerializeWithSchema(serializer, value, propertyName, GetSchema(component, propertyName)));
+            return serializer.GetSizeInBits();
+        }
+
+        // Size of a single property serialized with the default byte aligned encoding
+        template <typename TYPE>
+        uint32_t GetByteAlignedBytes(TYPE value) const
+        {
+            AZStd::array<uint8_t, BufferSize> buffer = {};
+            AzNetworking::NetworkInputSerializer serializer(buffer.begin(), BufferSize);
+            EXPECT_TRUE(AzNetworking::SerializeWithSchema(serializer, value, "Value", AzNetworking::FieldSchema{}));
+            return serializer.GetSize();
+        }
+
+        uint32_t GetExpectedBitPackedBits(const AZ::Entity& entity) const
+        {
+            uint32_t totalBits = 0;
+            const NetworkTransformComponent* transform = entity.FindComponent<NetworkTransformComponent>();
+            totalBits += GetBitPackedBits(*transform, "Rotation", transform->GetRotation());
+            totalBits += GetBitPackedBits(*transform, "Translation", transform->GetTranslation());
+            totalBits += GetBitPackedBits(*transform, "Scale", transform->GetScale());
+            totalBits += GetBitPackedBits(*transform, "ResetCount", transform->GetResetCount());
+            totalBits += GetBitPackedBits(*transform, "ParentEntityId", transform->GetParentEntityId());
+            totalBits += GetBitPackedBits(*transform, "ParentAttachmentBoneId", transform->GetParentAttachmentBoneId());
+            if (const NetworkHierarchyRootComponent* root = entity.FindComponent<NetworkHierarchyRootComponent>())
+            {
+                totalBits += GetBitPackedBits(*root, "HierarchyRoot", root->GetHierarchyRoot());
+            }
+            if (const NetworkHierarchyChildComponent* child = entity.FindComponent<NetworkHierarchyChildComponent>())
+            {
+                totalBits += GetBitPackedBits(*child, "HierarchyRoot", child->GetHierarchyRoot());
+            }
+            return totalBits;
+        }
+
+        uint32_t GetExpectedByteAlignedBytes(const AZ::Entity& entity) const
+        {
+            uint32_t totalBytes = 0;
+            const NetworkTransformComponent* transform = entity.FindComponent<NetworkTransformComponent>();
+            totalBytes += GetByteAlignedBytes(transform->GetRotation());
+            totalBytes += GetByteAlignedBytes(transform->GetTranslation());
+            totalBytes += GetByteAlignedBytes(transform->GetScale());
+            totalBytes += GetByteAlignedBytes(transform->GetResetCount());
+            totalBytes += GetByteAlignedBytes(transform->GetParentEntityId());
+            totalBytes += GetByteAlignedBytes(transform->GetParentAttachmentBoneId());
+            if (const NetworkHierarchyRootComponent* root = entity.FindComponent<NetworkHierarchyRootComponent>())
+            {
+                totalBytes += GetByteAlignedBytes(root->GetHierarchyRoot());
+            }
+            if (const NetworkHierarchyChildComponent* child = entity.FindComponent<NetworkHierarchyChildComponent>())
+            {
+                totalBytes += GetByteAlignedBytes(child->GetHierarchyRoot());
+            }
+            return totalBytes;
+        }
+
+        AZStd::unique_ptr<EntityInfo> m_root;
+        AZStd::unique_ptr<EntityInfo> m_child;
+        AZStd::unique_ptr<EntityInfo> m_client;
+    };
+
+    TEST_F(BitPackedSerializationTests, GeneratedSchemasMatchAutoComponentAttributes)
+    {
+        const NetworkTransformComponent* transform = m_root->m_entity->FindComponent<NetworkTransformComponent>();
+
+        const AzNetworking::FieldSchema rotationSchema = GetSchema(*transform, "Rotation");
+        EXPECT_EQ(rotationSchema.m_encoding, AzNetworking::FieldEncoding::SmallestThree);
+        EXPECT_EQ(rotationSchema.m_bitCount, 15u);
+
+        const AzNetworking::FieldSchema boneIdSchema = GetSchema(*transform, "ParentAttachmentBoneId");
+        EXPECT_EQ(boneIdSchema.m_encoding, AzNetworking::FieldEncoding::Delta);
+        EXPECT_EQ(boneIdSchema.m_baseline, -1);
+
+        // Properties without an Encoding attribute keep the default encoding
+        EXPECT_EQ(GetSchema(*transform, "Translation").m_encoding, AzNetworking::FieldEncoding::Default);
+        const NetworkHierarchyRootComponent* root = m_root->m_entity->FindComponent<NetworkHierarchyRootComponent>();
+        EXPECT_EQ(GetSchema(*root, "HierarchyRoot").m_encoding, AzNetworking::FieldEncoding::Default);
+    }
+
+    TEST_F(BitPackedSerializationTests, BitPackedPayloadMatchesFieldSchemas)
+    {
+        for (EntityInfo* entityInfo : { m_root.get(), m_child.get() })
+        {
+            NetBindComponent* netBind = entityInfo->m_entity->FindComponent<NetBindComponent>();
+
+            AZStd::array<uint8_t, BufferSize> buffer = {};
+            AzNetworking::NetworkBitInputSerializer serializer(buffer.begin(), BufferSize);
+            ReplicationRecord record = CreateFullRecord();
+            EXPECT_TRUE(netBind->SerializeStateDeltaMessage(record, serializer));
+            EXPECT_EQ(serializer.GetSizeInBits(), GetExpectedBitPackedBits(*entityInfo->m_entity));
+        }
+    }
+
+    TEST_F(BitPackedSerializationTests, BytePayloadIgnoresFieldSchemas)
+    {
+        for (EntityInfo* entityInfo : { m_root.get(), m_child.get() })
+        {
+            NetBindComponent* netBind = entityInfo->m_entity->FindComponent<NetBindComponent>();
+
+            AZStd::array<uint8_t, BufferSize> buffer = {};
+            AzNetworking::NetworkInputSerializer serializer(buffer.begin(), BufferSize);
+            ReplicationRecord record = CreateFullRecord();
+            EXPECT_TRUE(netBind->SerializeStateDeltaMessage(record, serializer));
+            EXPECT_EQ(serializer.GetSize(), GetExpectedByteAlignedBytes(*entityInfo->m_entity));
+        }
+    }
+
+    TEST_F(BitPackedSerializationTests, BitPackedPayloadIsSmallerThanBytePayload)
+    {
+        NetBindComponent* netBind = m_root->m_entity->FindComponent<NetBindComponent>();
+
+        AZStd::array<uint8_t, BufferSize> byteBuffer = {};
+        AzNetworking::NetworkInputSerializer byteSerializer(byteBuffer.begin(), BufferSize);
+        ReplicationRecord byteRecord = CreateFullRecord();
+        EXPECT_TRUE(netBind->SerializeStateDeltaMessage(byteRecord, byteSerializer));
+
+        AZStd::array<uint8_t, BufferSize> bitBuffer = {};
+        AzNetworking::NetworkBitInputSerializer bitSerializer(bitBuffer.begin(), BufferSize);
+        ReplicationRecord bitRecord = CreateFullRecord();
+        EXPECT_TRUE(netBind->SerializeStateDeltaMessage(bitRecord, bitSerializer));
+
+        EXPECT_LT(bitSerializer.GetSize(), byteSerializer.GetSize());
+    }
+
+    TEST_F(BitPackedSerializationTests, BitPackedPayloadRoundTrips)
+    {
+        NetBindComponent* serverNetBind = m_root->m_entity->FindComponent<NetBindComponent>();
+        NetBindComponent* clientNetBind = m_client->m_entity->FindComponent<NetBindComponent>();
+
+        AZStd::array<uint8_t, BufferSize> buffer = {};
+        AzNetworking::NetworkBitInputSerializer inSerializer(buffer.begin(), BufferSize);
+        ReplicationRecord serverRecord = CreateFullRecord();
+        EXPECT_TRUE(serverNetBind->SerializeStateDeltaMessage(serverRecord, inSerializer));
+
+        AzNetworking::NetworkBitOutputSerializer outSerializer(buffer.begin(), inSerializer.GetSize());
+        ReplicationRecord clientRecord = CreateFullRecord();
+        ReplicationRecord notifyRecord = clientRecord;
+        EXPECT_TRUE(clientNetBind->SerializeStateDeltaMessage(clientRecord, outSerializer));
+        clientNetBind->NotifyStateDeltaChanges(notifyRecord);
+        EXPECT_EQ(outSerializer.GetSizeInBits(), inSerializer.GetSizeInBits());
+
+        const NetworkTransformComponent* serverTransform = m_root->m_entity->FindComponent<NetworkTransformComponent>();
+        const NetworkTransformComponent* clientTransform = m_client->m_entity->FindComponent<NetworkTransformComponent>();
+        EXPECT_EQ(clientTransform->GetTranslation(), serverTransform->GetTranslation());
+        EXPECT_EQ(clientTransform->GetScale(), serverTransform->GetScale());
+        EXPECT_EQ(clientTransform->GetParentEntityId(), serverTransform->GetParentEntityId());
+        EXPECT_EQ(clientTransform->GetParentAttachmentBoneId(), serverTransform->GetParentAttachmentBoneId());
+        EXPECT_GT(AZ::GetAbs(clientTransform->GetRotation().Dot(serverTransform->GetRotation())), 0.9999f);
+    }
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Multiplayer/NetworkTime/LagCompensationStore.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace Multiplayer
+{
+    /*
+     * Compares a rewound raycast through the LagCompensationStore against the rewind-and-sync path used by NetworkHitVolumesComponent,
+     * where every hit volume is rewound through its RewindableObject, posed (SetLocalPose on the physics shape) and then queried.
+     * Physics isn't available to the Multiplayer tests, so posing writes into a pose array and the query is a scalar sphere test.
+     * Range is the number of hit volumes, roughly 16 per character.
+     */
+    class LagCompensationBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t RecordedFrames = RewindHistorySize;
+        static constexpr float VolumeRadius = 0.25f;
+        const AzNetworking::ConnectionId RewindingConnectionId = AzNetworking::ConnectionId{ 1 };
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void InternalSetUp(const benchmark::State& state)
+        {
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_networkTime = AZStd::make_unique<NetworkTime>();
+            m_store = AZStd::make_unique<LagCompensationStore>();
+
+            const uint32_t volumeCount = aznumeric_cast<uint32_t>(state.range(0));
+            m_rewindableTransforms.resize(volumeCount);
+            m_posedTransforms.resize(volumeCount, AZ::Transform::CreateIdentity());
+
+            LagCompensatedShape shape;
+            shape.m_type = LagCompensatedShape::Type::Sphere;
+            shape.m_radius = VolumeRadius;
+            for (uint32_t index = 0; index < volumeCount; ++index)
+            {
+                m_volumeHandles.push_back(m_store->RegisterVolume(NetEntityId{ index / 16 }, shape));
+            }
+
+            // Characters are laid out on a grid and drift a little every frame
+            for (uint32_t frame = 0; frame < RecordedFrames; ++frame)
+            {
+                const HostFrameId frameId = m_networkTime->GetHostFrameId();
+                for (uint32_t index = 0; index < volumeCount; ++index)
+                {
+                    const AZ::Vector3 position(aznumeric_cast<float>((index / 16) % 32) * 4.0f + 0.01f * frame, aznumeric_cast<float>((index / 16) / 32) * 4.0f, aznumeric_cast<float>(index % 16) * 0.1f);
+                    const AZ::Transform transform = AZ::Transform::CreateTranslation(position);
+                    m_rewindableTransforms[index] = transform;
+                    m_store->RecordTransform(m_volumeHandles[index], frameId, transform);
+                }
+                m_networkTime->IncrementHostFrameId();
+            }
+
+            m_queryFrameId = m_networkTime->GetHostFrameId() - HostFrameId{ RecordedFrames / 2 };
+        }
+
+        void InternalTearDown()
+        {
+            m_volumeHandles = {};
+            m_posedTransforms = {};
+            m_rewindableTransforms = {};
+            m_store.reset();
+            m_networkTime.reset();
+            m_loggerComponent.reset();
+            m_timeSystem.reset();
+        }
+
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<NetworkTime> m_networkTime;
+        AZStd::unique_ptr<LagCompensationStore> m_store;
+        AZStd::vector<RewindableObject<AZ::Transform, RewindHistorySize>> m_rewindableTransforms;
+        AZStd::vector<AZ::Transform> m_posedTransforms;
+        AZStd::vector<LagCompensationStore::VolumeHandle> m_volumeHandles;
+        HostFrameId m_queryFrameId = InvalidHostFrameId;
+    };
+
+    BENCHMARK_DEFINE_F(LagCompensationBenchmark, RewindAndSyncRaycast)(benchmark::State& state)
+    {
+        const AZ::Vector3 start(-10.0f, 2.0f, 0.5f);
+        const AZ::Vector3 direction = AZ::Vector3::CreateAxisX();
+        const float blendFactor = 0.5f;
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            ScopedAlterTime rewind(m_queryFrameId, AZ::Time::ZeroTimeMs, blendFactor, RewindingConnectionId);
+
+            // Equivalent of NetworkHitVolumesComponent::OnSyncRewind for every hit volume
+            for (uint32_t index = 0; index < m_rewindableTransforms.size(); ++index)
+            {
+                const AZ::Transform& targetTransform = m_rewindableTransforms[index].Get();
+                const AZ::Transform& previousTransform = m_rewindableTransforms[index].GetPrevious();
+                AZ::Transform& rewoundTransform = m_posedTransforms[index];
+                rewoundTransform.SetRotation(previousTransform.GetRotation().Slerp(targetTransform.GetRotation(), blendFactor));
+                rewoundTransform.SetTranslation(previousTransform.GetTranslation().Lerp(targetTransform.GetTranslation(), blendFactor));
+                rewoundTransform.SetUniformScale(AZ::Lerp(previousTransform.GetUniformScale(), targetTransform.GetUniformScale(), blendFactor));
+            }
+
+            float closestDistance = 1000.0f;
+            for (const AZ::Transform& posedTransform : m_posedTransforms)
+            {
+                float distance = 0.0f;
+                if ((AZ::Intersect::IntersectRaySphere(start, direction, posedTransform.GetTranslation(), VolumeRadius, distance) == AZ::Intersect::ISECT_RAY_SPHERE_ISECT)
+                    && (distance < closestDistance))
+                {
+                    closestDistance = distance;
+                }
+            }
+            benchmark::DoNotOptimize(closestDistance);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(LagCompensationBenchmark, LagCompensationStoreRaycast)(benchmark::State& state)
+    {
+        const AZ::Vector3 start(-10.0f, 2.0f, 0.5f);
+        const AZ::Vector3 direction = AZ::Vector3::CreateAxisX();
+        const float blendFactor = 0.5f;
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            LagCompensatedHit hit;
+            benchmark::DoNotOptimize(m_store->Raycast(m_queryFrameId, blendFactor, start, direction, 1000.0f, InvalidNetEntityId, hit));
+        }
+    }
+
+    BENCHMARK_DEFINE_F(LagCompensationBenchmark, LagCompensationStoreOverlap)(benchmark::State& state)
+    {
+        AZStd::vector<LagCompensatedHit> hits;
+        for ([[maybe_unused]] auto value : state)
+        {
+            hits.clear();
+            benchmark::DoNotOptimize(m_store->Overlap(m_queryFrameId, 0.5f, AZ::Vector3(8.0f, 4.0f, 0.5f), 3.0f, InvalidNetEntityId, hits));
+        }
+    }
+
+    BENCHMARK_REGISTER_F(LagCompensationBenchmark, RewindAndSyncRaycast)
+        ->RangeMultiplier(4)->Range(64, 4096)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(LagCompensationBenchmark, LagCompensationStoreRaycast)
+        ->RangeMultiplier(4)->Range(64, 4096)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(LagCompensationBenchmark, LagCompensationStoreOverlap)
+        ->RangeMultiplier(4)->Range(64, 4096)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
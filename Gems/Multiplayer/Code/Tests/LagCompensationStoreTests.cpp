@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/LagCompensationStore.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class LagCompensationStoreTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr uint32_t HistorySize = 8;
+
+        static Multiplayer::LagCompensatedShape MakeSphere(float radius)
+        {
+            Multiplayer::LagCompensatedShape shape;
+            shape.m_type = Multiplayer::LagCompensatedShape::Type::Sphere;
+            shape.m_radius = radius;
+            return shape;
+        }
+    };
+
+    TEST_F(LagCompensationStoreTests, RaycastHitsVolumeAtRewoundFrame)
+    {
+        Multiplayer::LagCompensationStore store(HistorySize);
+        const auto handle = store.RegisterVolume(Multiplayer::NetEntityId{ 1 }, MakeSphere(1.0f));
+
+        // Volume moves 10 units along x every frame
+        for (uint32_t frame = 0; frame < 4; ++frame)
+        {
+            store.RecordTransform(handle, Multiplayer::HostFrameId{ frame }, AZ::Transform::CreateTranslation(AZ::Vector3(10.0f * frame, 10.0f, 0.0f)));
+        }
+
+        const AZ::Vector3 start(20.0f, 0.0f, 0.0f);
+        const AZ::Vector3 direction = AZ::Vector3::CreateAxisY();
+
+        Multiplayer::LagCompensatedHit hit;
+        EXPECT_TRUE(store.Raycast(Multiplayer::HostFrameId{ 2 }, 1.0f, start, direction, 100.0f, Multiplayer::InvalidNetEntityId, hit));
+        EXPECT_EQ(hit.m_netEntityId, Multiplayer::NetEntityId{ 1 });
+        EXPECT_EQ(hit.m_volumeHandle, handle);
+        EXPECT_NEAR(hit.m_distance, 9.0f, 0.001f);
+
+        // The same ray misses the volume at every other frame
+        EXPECT_FALSE(store.Raycast(Multiplayer::HostFrameId{ 1 }, 1.0f, start, direction, 100.0f, Multiplayer::InvalidNetEntityId, hit));
+        EXPECT_FALSE(store.Raycast(Multiplayer::HostFrameId{ 3 }, 1.0f, start, direction, 100.0f, Multiplayer::InvalidNetEntityId, hit));
+
+        // Halfway between frames 1 and 2 the volume is centered at x = 15
+        EXPECT_TRUE(store.Raycast(Multiplayer::HostFrameId{ 2 }, 0.5f, AZ::Vector3(15.0f, 0.0f, 0.0f), direction, 100.0f, Multiplayer::InvalidNetEntityId, hit));
+        EXPECT_FALSE(store.Raycast(Multiplayer::HostFrameId{ 2 }, 0.5f, start, direction, 100.0f, Multiplayer::InvalidNetEntityId, hit));
+
+        // Frames that have fallen out of the history can no longer be queried
+        store.RecordTransform(handle, Multiplayer::HostFrameId{ 2 + HistorySize }, AZ::Transform::CreateTranslation(AZ::Vector3(20.0f, 10.0f, 0.0f)));
+        EXPECT_FALSE(store.Raycast(Multiplayer::HostFrameId{ 2 }, 1.0f, start, direction, 100.0f, Multiplayer::InvalidNetEntityId, hit));
+    }
+
+    TEST_F(LagCompensationStoreTests, RaycastReturnsClosestShape)
+    {
+        Multiplayer::LagCompensationStore store(HistorySize);
+        const Multiplayer::HostFrameId frameId{ 5 };
+
+        Multiplayer::LagCompensatedShape capsule;
+        capsule.m_type = Multiplayer::LagCompensatedShape::Type::Capsule;
+        capsule.m_radius = 0.5f;
+        capsule.m_height = 4.0f;
+
+        Multiplayer::LagCompensatedShape box;
+        box.m_type = Multiplayer::LagCompensatedShape::Type::Box;
+        box.m_halfExtents = AZ::Vector3(1.0f, 1.0f, 1.0f);
+
+        const auto farSphere = store.RegisterVolume(Multiplayer::NetEntityId{ 1 }, MakeSphere(1.0f));
+        const auto capsuleHandle = store.RegisterVolume(Multiplayer::NetEntityId{ 2 }, capsule);
+        const auto boxHandle = store.RegisterVolume(Multiplayer::NetEntityId{ 3 }, box);
+        const auto selfSphere = store.RegisterVolume(Multiplayer::NetEntityId{ 4 }, MakeSphere(1.0f));
+
+        store.RecordTransform(farSphere, frameId, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 30.0f, 0.0f)));
+        store.RecordTransform(capsuleHandle, frameId, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 20.0f, 1.5f)));
+        store.RecordTransform(boxHandle, frameId, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 10.0f, 0.0f)));
+        store.RecordTransform(selfSphere, frameId, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 1.0f, 0.0f)));
+
+        Multiplayer::LagCompensatedHit hit;
+        EXPECT_TRUE(store.Raycast(frameId, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, Multiplayer::NetEntityId{ 4 }, hit));
+        EXPECT_EQ(hit.m_netEntityId, Multiplayer::NetEntityId{ 3 });
+        EXPECT_NEAR(hit.m_distance, 9.0f, 0.001f);
+
+        store.UnregisterVolume(boxHandle);
+        EXPECT_TRUE(store.Raycast(frameId, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, Multiplayer::NetEntityId{ 4 }, hit));
+        EXPECT_EQ(hit.m_netEntityId, Multiplayer::NetEntityId{ 2 });
+        EXPECT_NEAR(hit.m_distance, 19.5f, 0.001f);
+
+        // Beyond the max distance nothing is hit
+        EXPECT_FALSE(store.Raycast(frameId, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 15.0f, Multiplayer::NetEntityId{ 4 }, hit));
+    }
+
+    TEST_F(LagCompensationStoreTests, OverlapGathersIntersectingVolumes)
+    {
+        Multiplayer::LagCompensationStore store(HistorySize);
+        const Multiplayer::HostFrameId frameId{ 3 };
+
+        // Register enough volumes to span several SIMD lane groups
+        constexpr uint32_t VolumeCount = 37;
+        for (uint32_t index = 0; index < VolumeCount; ++index)
+        {
+            const auto handle = store.RegisterVolume(Multiplayer::NetEntityId{ index + 1 }, MakeSphere(0.5f));
+            store.RecordTransform(handle, frameId, AZ::Transform::CreateTranslation(AZ::Vector3(2.0f * index, 0.0f, 0.0f)));
+        }
+        EXPECT_EQ(store.GetVolumeCount(), VolumeCount);
+
+        AZStd::vector<Multiplayer::LagCompensatedHit> hits;
+        EXPECT_EQ(store.Overlap(frameId, 1.0f, AZ::Vector3(40.0f, 0.0f, 0.0f), 2.0f, Multiplayer::InvalidNetEntityId, hits), 3u);
+        ASSERT_EQ(hits.size(), 3u);
+        EXPECT_EQ(hits[0].m_netEntityId, Multiplayer::NetEntityId{ 20 });
+        EXPECT_EQ(hits[1].m_netEntityId, Multiplayer::NetEntityId{ 21 });
+        EXPECT_EQ(hits[2].m_netEntityId, Multiplayer::NetEntityId{ 22 });
+
+        hits.clear();
+        EXPECT_EQ(store.Overlap(frameId, 1.0f, AZ::Vector3(40.0f, 0.0f, 0.0f), 2.0f, Multiplayer::NetEntityId{ 21 }, hits), 2u);
+
+        hits.clear();
+        EXPECT_EQ(store.Overlap(frameId + Multiplayer::HostFrameId{ 1 }, 1.0f, AZ::Vector3(40.0f, 0.0f, 0.0f), 2.0f, Multiplayer::InvalidNetEntityId, hits), 0u);
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Source/NetworkEntity/EntityReplication/PropertyDeltaCache.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class PropertyDeltaCacheTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr uint32_t BufferSize = 64;
+        static constexpr Multiplayer::NetEntityId TestNetEntityId = Multiplayer::NetEntityId{ 7 };
+        static constexpr Multiplayer::NetComponentId TestNetComponentId = Multiplayer::NetComponentId{ 0 };
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_stats = AZStd::make_unique<Multiplayer::MultiplayerStats>();
+            m_stats->ReserveComponentStats(TestNetComponentId, 1, 0);
+            m_cache = AZStd::make_unique<Multiplayer::PropertyDeltaCache>();
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            m_stats.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        // Writes a fake record followed by either a cached or freshly 'serialized' delta, mirroring PropertyPublisher
+        template <typename SerializerType>
+        bool WriteUpdate(SerializerType& serializer, uint8_t recordValue, uint8_t deltaValue, Multiplayer::NetEntityRole remoteRole)
+        {
+            const uint32_t recordStart = serializer.GetSizeInBits();
+            serializer.Serialize(recordValue, "Record", uint8_t(0), uint8_t(7));
+            const uint32_t recordBits = serializer.GetSizeInBits() - recordStart;
+
+            if (m_cache->TryWriteDelta(TestNetEntityId, remoteRole, AZ::EntityId(), "TestEntity", serializer.GetBuffer(), recordStart, recordBits, serializer))
+            {
+                return true;
+            }
+
+            m_cache->BeginCapture();
+            const uint32_t deltaStart = serializer.GetSizeInBits();
+            serializer.Serialize(deltaValue, "Delta", uint8_t(0), uint8_t(127));
+            serializer.Serialize(deltaValue, "Delta", uint8_t(0), uint8_t(127));
+            m_stats->RecordPropertySent(TestNetComponentId, Multiplayer::PropertyIndex{ 0 }, serializer.GetSizeInBits() - deltaStart);
+            m_stats->RecordComponentSerializeEnd(AzNetworking::SerializerMode::ReadFromObject, TestNetComponentId);
+            m_cache->StoreDelta(TestNetEntityId, remoteRole, serializer.GetBuffer(), recordStart, recordBits, deltaStart, serializer.GetSizeInBits() - deltaStart);
+            return false;
+        }
+
+        AZStd::unique_ptr<Multiplayer::MultiplayerStats> m_stats;
+        AZStd::unique_ptr<Multiplayer::PropertyDeltaCache> m_cache;
+    };
+
+    TEST_F(PropertyDeltaCacheTests, IdenticalRecordsShareSerializedDelta)
+    {
+        uint8_t bufferA[BufferSize];
+        uint8_t bufferB[BufferSize];
+        AzNetworking::NetworkBitInputSerializer serializerA(bufferA, BufferSize);
+        AzNetworking::NetworkBitInputSerializer serializerB(bufferB, BufferSize);
+
+        m_cache->BeginUpdate(*m_stats);
+        EXPECT_FALSE(WriteUpdate(serializerA, 1, 42, Multiplayer::NetEntityRole::Client));
+        EXPECT_TRUE(WriteUpdate(serializerB, 1, 99, Multiplayer::NetEntityRole::Client));
+        m_cache->EndUpdate();
+
+        // 3 record bits followed by two 7 bit delta values
+        ASSERT_EQ(serializerA.GetSizeInBits(), 17u);
+        ASSERT_EQ(serializerA.GetSizeInBits(), serializerB.GetSizeInBits());
+        EXPECT_EQ(memcmp(bufferA, bufferB, serializerA.GetSize()), 0);
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheHits, 1u);
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheMisses, 1u);
+        EXPECT_FLOAT_EQ(m_stats->GetPropertyDeltaCacheHitRatio(), 0.5f);
+
+        // Metrics captured on the miss are replayed on the hit
+        const Multiplayer::MultiplayerStats::Metric sent = m_stats->CalculateTotalPropertyUpdateSentMetrics();
+        // Two 14 bit deltas add up to 3 whole bytes, the remaining 4 bits stay pending
+        EXPECT_EQ(sent.m_totalCalls, 2u);
+        EXPECT_EQ(sent.m_totalBytes, 3u);
+    }
+
+    TEST_F(PropertyDeltaCacheTests, IdenticalRecordsShareByteAlignedDelta)
+    {
+        uint8_t bufferA[BufferSize];
+        uint8_t bufferB[BufferSize];
+        AzNetworking::NetworkInputSerializer serializerA(bufferA, BufferSize);
+        AzNetworking::NetworkInputSerializer serializerB(bufferB, BufferSize);
+
+        m_cache->BeginUpdate(*m_stats);
+        EXPECT_FALSE(WriteUpdate(serializerA, 1, 42, Multiplayer::NetEntityRole::Client));
+        EXPECT_TRUE(WriteUpdate(serializerB, 1, 99, Multiplayer::NetEntityRole::Client));
+        m_cache->EndUpdate();
+
+        // One record byte followed by two delta bytes
+        ASSERT_EQ(serializerA.GetSize(), 3u);
+        ASSERT_EQ(serializerA.GetSize(), serializerB.GetSize());
+        EXPECT_EQ(memcmp(bufferA, bufferB, serializerA.GetSize()), 0);
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheHits, 1u);
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheMisses, 1u);
+    }
+
+    TEST_F(PropertyDeltaCacheTests, DifferentRecordsOrRolesMiss)
+    {
+        uint8_t buffer[BufferSize];
+        AzNetworking::NetworkBitInputSerializer serializer(buffer, BufferSize);
+
+        m_cache->BeginUpdate(*m_stats);
+        EXPECT_FALSE(WriteUpdate(serializer, 1, 42, Multiplayer::NetEntityRole::Client));
+        EXPECT_FALSE(WriteUpdate(serializer, 2, 42, Multiplayer::NetEntityRole::Client));
+        EXPECT_FALSE(WriteUpdate(serializer, 1, 42, Multiplayer::NetEntityRole::Autonomous));
+        EXPECT_TRUE(WriteUpdate(serializer, 2, 42, Multiplayer::NetEntityRole::Client));
+        m_cache->EndUpdate();
+
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheHits, 1u);
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheMisses, 3u);
+    }
+
+    TEST_F(PropertyDeltaCacheTests, CacheIsClearedBetweenUpdates)
+    {
+        uint8_t buffer[BufferSize];
+        AzNetworking::NetworkBitInputSerializer serializer(buffer, BufferSize);
+
+        // Outside of an update the cache is inactive and neither hits nor misses are recorded
+        EXPECT_FALSE(m_cache->IsActive());
+        EXPECT_FALSE(WriteUpdate(serializer, 1, 42, Multiplayer::NetEntityRole::Client));
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheMisses, 0u);
+
+        m_cache->BeginUpdate(*m_stats);
+        EXPECT_FALSE(WriteUpdate(serializer, 1, 42, Multiplayer::NetEntityRole::Client));
+        m_cache->EndUpdate();
+
+        m_cache->BeginUpdate(*m_stats);
+        EXPECT_FALSE(WriteUpdate(serializer, 1, 42, Multiplayer::NetEntityRole::Client));
+        m_cache->EndUpdate();
+
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheHits, 0u);
+        EXPECT_EQ(m_stats->m_propertyDeltaCacheMisses, 2u);
+    }
+}
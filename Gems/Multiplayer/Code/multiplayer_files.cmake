@@ -55,6 +55,7 @@ set(FILES
     Include/Multiplayer/NetworkInput/NetworkInputHistory.h
     Include/Multiplayer/NetworkInput/NetworkInputMigrationVector.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
+    Include/Multiplayer/NetworkTime/LagCompensationStore.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
     Include/Multiplayer/NetworkTime/RewindableFixedVector.h
@@ -112,6 +113,8 @@ set(FILES
     Source/MultiplayerSystemComponent.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
+    Source/NetworkEntity/EntityReplication/PropertyDeltaCache.cpp
+    Source/NetworkEntity/EntityReplication/PropertyDeltaCache.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
@@ -134,6 +137,7 @@ set(FILES
     Source/NetworkInput/NetworkInputChild.cpp
     Source/NetworkInput/NetworkInputHistory.cpp
     Source/NetworkInput/NetworkInputMigrationVector.cpp
+    Source/NetworkTime/LagCompensationStore.cpp
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
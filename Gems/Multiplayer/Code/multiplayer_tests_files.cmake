@@ -13,17 +13,21 @@ set(FILES
     Include/Multiplayer/AutoGen/AutoComponent_Header.jinja
     Include/Multiplayer/AutoGen/AutoComponent_Source.jinja
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
+    Tests/BitPackedSerializationTests.cpp
     Tests/ClientHierarchyTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonBenchmarkSetup.h
     Tests/IMultiplayerConnectionMock.h
     Tests/IMultiplayerSpawnerMock.h
+    Tests/LagCompensationBenchmarks.cpp
+    Tests/LagCompensationStoreTests.cpp
     Tests/Main.cpp
     Tests/MockInterfaces.h
     Tests/MultiplayerSystemTests.cpp
     Tests/NetworkInputTests.cpp
     Tests/NetworkTransformTests.cpp
+    Tests/PropertyDeltaCacheTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
     Tests/ServerHierarchyTests.cpp